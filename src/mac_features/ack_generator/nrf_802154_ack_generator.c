@@ -40,6 +40,7 @@
 #include <stdlib.h>
 
 #include "nrf_802154_const.h"
+#include "nrf_802154_debug.h"
 #include "nrf_802154_enh_ack_generator.h"
 #include "nrf_802154_imm_ack_generator.h"
 
@@ -75,18 +76,29 @@ void nrf_802154_ack_generator_init(void)
 
 const uint8_t * nrf_802154_ack_generator_create(const uint8_t * p_frame)
 {
+    const uint8_t * p_ack;
+
     // This function should not be called if ACK is not requested.
     assert(p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT);
 
+    nrf_802154_profile_begin(ACK_GENERATOR_CREATE);
+
     switch (frame_version_is_2015_or_above(p_frame))
     {
         case FRAME_VERSION_BELOW_2015:
-            return nrf_802154_imm_ack_generator_create(p_frame);
+            p_ack = nrf_802154_imm_ack_generator_create(p_frame);
+            break;
 
         case FRAME_VERSION_2015_OR_ABOVE:
-            return nrf_802154_enh_ack_generator_create(p_frame);
+            p_ack = nrf_802154_enh_ack_generator_create(p_frame);
+            break;
 
         default:
-            return NULL;
+            p_ack = NULL;
+            break;
     }
+
+    nrf_802154_profile_end(ACK_GENERATOR_CREATE);
+
+    return p_ack;
 }
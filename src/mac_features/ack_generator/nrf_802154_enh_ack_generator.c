@@ -39,10 +39,14 @@
 #include <assert.h>
 #include <string.h>
 
+#include "mac_features/nrf_802154_csl.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "nrf_802154_ack_data.h"
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_pib.h"
+#include "nrf_802154_procedures_duration.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #define ENH_ACK_MAX_SIZE MAX_PACKET_SIZE
 
@@ -100,9 +104,9 @@ static void fcf_sequence_number_suppression_set(const uint8_t * p_frame)
     }
 }
 
-static void fcf_ie_present_set(const uint8_t * p_frame, const uint8_t * p_ie_data)
+static void fcf_ie_present_set(bool ie_present)
 {
-    if (p_ie_data != NULL)
+    if (ie_present)
     {
         m_ack_data[IE_PRESENT_OFFSET] |= IE_PRESENT_BIT;
     }
@@ -126,6 +130,8 @@ static void fcf_dst_addressing_mode_set(const uint8_t * p_frame)
 
 static void fcf_src_addressing_mode_set(const uint8_t * p_frame)
 {
+    (void)p_frame;
+
     m_ack_data[SRC_ADDR_TYPE_OFFSET] |= SRC_ADDR_TYPE_NONE;
 }
 
@@ -135,7 +141,7 @@ static void fcf_frame_version_set(void)
 }
 
 static void frame_control_set(const uint8_t                      * p_frame,
-                              const uint8_t                      * p_ie_data,
+                              bool                                 ie_present,
                               nrf_802154_frame_parser_mhr_data_t * p_ack_offsets)
 {
     bool parse_results;
@@ -145,7 +151,7 @@ static void frame_control_set(const uint8_t                      * p_frame,
     fcf_frame_pending_set(p_frame);
     fcf_panid_compression_set(p_frame);
     fcf_sequence_number_suppression_set(p_frame);
-    fcf_ie_present_set(p_frame, p_ie_data);
+    fcf_ie_present_set(ie_present);
     fcf_dst_addressing_mode_set(p_frame);
     fcf_frame_version_set();
     fcf_src_addressing_mode_set(p_frame);
@@ -198,6 +204,7 @@ static void destination_set(const nrf_802154_frame_parser_mhr_data_t * p_frame,
 static void source_set(const uint8_t * p_frame)
 {
     // Intentionally empty: source address type is None.
+    (void)p_frame;
 }
 
 /***************************************************************************************************
@@ -325,6 +332,36 @@ static void ie_header_set(const uint8_t * p_ie_data, uint8_t ie_data_len, const
     m_ack_data[PHR_OFFSET] += ie_data_len;
 }
 
+static bool csl_ie_is_present(void)
+{
+#if NRF_802154_CSL_ENABLED
+    return nrf_802154_csl_is_running();
+#else
+    return false;
+#endif
+}
+
+static void csl_ie_set(bool csl_ie_present, const uint8_t * p_sec_end)
+{
+#if NRF_802154_CSL_ENABLED
+    if (csl_ie_present)
+    {
+        uint32_t frame_end;
+
+        m_ack_data[PHR_OFFSET] += CSL_IE_SIZE;
+
+        // The Enh-Ack transmission starts aTurnaroundTime after the end of the received frame.
+        frame_end = nrf_802154_timer_sched_time_get() + TURNAROUND_TIME +
+                    nrf_802154_frame_duration_get(m_ack_data[PHR_OFFSET], true, true);
+
+        nrf_802154_csl_ie_write((uint8_t *)p_sec_end, frame_end);
+    }
+#else
+    (void)csl_ie_present;
+    (void)p_sec_end;
+#endif
+}
+
 /***************************************************************************************************
  * @section Public API implementation
  **************************************************************************************************/
@@ -354,11 +391,13 @@ const uint8_t * nrf_802154_enh_ack_generator_create(const uint8_t * p_frame)
         frame_offsets.src_addr_size == EXTENDED_ADDRESS_SIZE,
         &ie_data_len);
 
+    bool csl_ie_present = csl_ie_is_present();
+
     // Clear previously created ACK.
     ack_buffer_clear();
 
     // Set Frame Control field bits.
-    frame_control_set(p_frame, p_ie_data, &ack_offsets);
+    frame_control_set(p_frame, (p_ie_data != NULL) || csl_ie_present, &ack_offsets);
 
     // Set valid sequence number in ACK frame.
     sequence_number_set(p_frame);
@@ -372,8 +411,11 @@ const uint8_t * nrf_802154_enh_ack_generator_create(const uint8_t * p_frame)
     // Set auxiliary security header.
     security_header_set(&frame_offsets, &ack_offsets, &p_sec_end);
 
-    // Set IE header.
-    ie_header_set(p_ie_data, ie_data_len, p_sec_end);
+    // Set IE header. The CSL IE precedes the IEs from the ACK data list, which may be terminated.
+    ie_header_set(p_ie_data, ie_data_len, p_sec_end + (csl_ie_present ? CSL_IE_SIZE : 0));
+
+    // Set CSL IE. It is set last, as the CSL phase depends on the final length of the frame.
+    csl_ie_set(csl_ie_present, p_sec_end);
 
     return m_ack_data;
 }
@@ -0,0 +1,122 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the coordinated sampled listening (CSL) receiver feature.
+ *
+ */
+
+#include "nrf_802154_csl.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_rx_duty_cycle.h"
+
+#if NRF_802154_CSL_ENABLED
+
+#if !NRF_802154_RX_DUTY_CYCLE_ENABLED
+#error NRF_802154_CSL_ENABLED requires NRF_802154_RX_DUTY_CYCLE_ENABLED.
+#endif
+
+#define CSL_IE_CONTENT_SIZE 4 ///< Size of the CSL IE content: CSL Phase and CSL Period fields.
+
+static volatile uint16_t m_period; ///< CSL period in units of 10 symbols. 0 if the CSL receiver is stopped.
+
+bool nrf_802154_csl_receive_start(uint32_t t0, uint32_t dt, uint16_t period, uint8_t channel)
+{
+    bool result = (period > 0);
+
+    if (result)
+    {
+        result = nrf_802154_rx_duty_cycle_start(t0,
+                                                dt,
+                                                period * CSL_UNIT,
+                                                NRF_802154_CSL_RX_WINDOW_DURATION,
+                                                channel);
+    }
+
+    if (result)
+    {
+        m_period = period;
+    }
+
+    return result;
+}
+
+bool nrf_802154_csl_receive_stop(void)
+{
+    bool result = (m_period > 0);
+
+    if (result)
+    {
+        m_period = 0;
+        (void)nrf_802154_rx_duty_cycle_stop();
+    }
+
+    return result;
+}
+
+bool nrf_802154_csl_is_running(void)
+{
+    return m_period > 0;
+}
+
+void nrf_802154_csl_ie_write(uint8_t * p_ie, uint32_t frame_end)
+{
+    uint16_t period         = m_period;
+    uint32_t time_to_window = nrf_802154_rx_duty_cycle_time_to_window_get(frame_end);
+    uint16_t ie_descriptor  = CSL_IE_CONTENT_SIZE | (IE_CSL_ELEMENT_ID << IE_ELEMENT_ID_SHIFT);
+    uint16_t phase;
+
+    assert(period > 0);
+
+    // Round up, so that the peer does not start transmission before the window is opened.
+    phase = (uint16_t)(((time_to_window + CSL_UNIT - 1) / CSL_UNIT) % period);
+
+    // The time to the window is never 0, so a whole number of periods means the window after them.
+    if (phase == 0)
+    {
+        phase = period;
+    }
+
+    p_ie[0] = (uint8_t)ie_descriptor;
+    p_ie[1] = (uint8_t)(ie_descriptor >> 8);
+    p_ie[2] = (uint8_t)phase;
+    p_ie[3] = (uint8_t)(phase >> 8);
+    p_ie[4] = (uint8_t)period;
+    p_ie[5] = (uint8_t)(period >> 8);
+}
+
+#endif // NRF_802154_CSL_ENABLED
@@ -0,0 +1,102 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_CSL_H__
+#define NRF_802154_CSL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+
+/**
+ * @defgroup nrf_802154_csl Coordinated sampled listening receiver feature
+ * @{
+ * @ingroup nrf_802154
+ * @brief Coordinated sampled listening (CSL) receiver.
+ *
+ * This module implements the receiver side of the CSL mode. The sample windows are opened by
+ * the duty-cycled reception module. This module advertises the sampling schedule with the CSL IE
+ * appended to the Enh-Ack frames.
+ */
+
+/**
+ * @brief Starts the CSL receiver.
+ *
+ * The first sample window starts at @p t0 + @p dt. The following windows start every @p period
+ * units of 10 symbols. Each window lasts @ref NRF_802154_CSL_RX_WINDOW_DURATION and is extended
+ * if a frame reception starts before the window ends.
+ *
+ * @param[in]  t0       Base of delay time in microseconds.
+ * @param[in]  dt       Delta of the delay time from @p t0 in microseconds.
+ * @param[in]  period   CSL period in units of 10 symbols. Must not be 0.
+ * @param[in]  channel  Number of the channel on which the frames are to be received.
+ *
+ * @retval true   The CSL receiver has been started.
+ * @retval false  The CSL receiver or the duty-cycled reception is already running or the first
+ *                window is in the past.
+ */
+bool nrf_802154_csl_receive_start(uint32_t t0, uint32_t dt, uint16_t period, uint8_t channel);
+
+/**
+ * @brief Stops the CSL receiver started by a call to @ref nrf_802154_csl_receive_start.
+ *
+ * If a sample window is ongoing, the radio remains in the receive state.
+ *
+ * @retval true   The CSL receiver has been stopped.
+ * @retval false  The CSL receiver was not running.
+ */
+bool nrf_802154_csl_receive_stop(void);
+
+/**
+ * @brief Checks if the CSL receiver is running.
+ *
+ * @retval true   The CSL receiver is running.
+ * @retval false  The CSL receiver is stopped.
+ */
+bool nrf_802154_csl_is_running(void);
+
+/**
+ * @brief Writes the CSL IE describing the current sampling schedule.
+ *
+ * The CSL Phase field is calculated as the time from the end of the frame containing the IE
+ * to the start of the nearest sample window.
+ *
+ * @param[out]  p_ie       Pointer to a buffer of at least @ref CSL_IE_SIZE bytes.
+ * @param[in]   frame_end  Time at which the transmission of the frame containing the IE ends,
+ *                         in microseconds. It uses the same time base as the Timer Scheduler.
+ */
+void nrf_802154_csl_ie_write(uint8_t * p_ie, uint32_t frame_end);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_CSL_H__
@@ -48,16 +48,12 @@
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_rx_duty_cycle.h"
+#include "nrf_802154_setup_time.h"
+#include "nrf_802154_timer_coord.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
-/* The following time is the sum of 70us RTC_IRQHandler processing time, 40us of time that elapses
- * from the moment a board starts transmission to the moment other boards (e.g. sniffer) are able
- * to detect that frame and in case of TX - 50us that accounts for a delay of yet unknown origin.
- */
-#define TX_SETUP_TIME 160u ///< Time needed to prepare TX procedure [us]. It does not include TX ramp-up time.
-#define RX_SETUP_TIME 110u ///< Time needed to prepare RX procedure [us]. It does not include RX ramp-up time.
-
 /**
  * @brief States of delayed operations.
  */
@@ -85,12 +81,17 @@ typedef struct
 static const uint8_t * mp_tx_data;         ///< Pointer to a buffer containing PHR and PSDU of the frame requested to be transmitted.
 static bool            m_tx_cca;           ///< If CCA should be performed prior to transmission.
 static uint8_t         m_tx_channel;       ///< Channel number on which transmission should be performed.
+static uint32_t        m_tx_time;          ///< Requested time of the transmission of the first symbol of SHR [us].
+static uint32_t        m_tx_setup_time;    ///< Setup time used to schedule the transmission [us].
+static volatile bool   m_tx_setup_measure; ///< If the start of the transmission is to be measured to calibrate the setup time.
 
 /**
  * @brief RX delayed operation configuration.
  */
 static nrf_802154_timer_t m_timeout_timer; ///< Timer for delayed RX timeout handling.
 static uint8_t            m_rx_channel;    ///< Channel number on which reception should be performed.
+static uint32_t           m_rx_time;       ///< Requested time of the reception start [us].
+static uint32_t           m_rx_setup_time; ///< Setup time used to schedule the reception [us].
 
 /**
  * @brief State of delayed operations.
@@ -284,7 +285,11 @@ static void tx_timeslot_started_callback(bool result)
     // and state is changed to STOPPED right after transmit request.
     m_dly_op_state[RSCH_DLY_TX] = DELAYED_TRX_OP_STATE_STOPPED;
 
-    if (!result)
+    if (result)
+    {
+        m_tx_setup_measure = true;
+    }
+    else
     {
         nrf_802154_notify_transmit_failed(mp_tx_data, NRF_802154_TX_ERROR_TIMESLOT_DENIED);
     }
@@ -301,6 +306,14 @@ static void rx_timeslot_started_callback(bool result)
     {
         uint32_t now;
 
+        if (nrf_802154_timer_coord_time_get(&now))
+        {
+            // The radio ramps up right after the receive request is processed.
+            nrf_802154_setup_time_measured(NRF_802154_SETUP_TIME_RX,
+                                           m_rx_setup_time,
+                                           (int32_t)(now + RX_RAMP_UP_TIME - m_rx_time));
+        }
+
         dly_op_state_set(RSCH_DLY_RX, DELAYED_TRX_OP_STATE_PENDING, DELAYED_TRX_OP_STATE_ONGOING);
 
         now = nrf_802154_timer_sched_time_get();
@@ -382,7 +395,11 @@ bool nrf_802154_delayed_trx_transmit(const uint8_t * p_data,
 
     if (result)
     {
-        dt -= TX_SETUP_TIME;
+        m_tx_setup_measure = false;
+        m_tx_time          = t0 + dt;
+        m_tx_setup_time    = nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX);
+
+        dt -= m_tx_setup_time;
         dt -= TX_RAMP_UP_TIME;
 
         if (cca)
@@ -415,8 +432,10 @@ bool nrf_802154_delayed_trx_receive(uint32_t t0,
 
     if (result)
     {
+        m_rx_time       = t0 + dt;
+        m_rx_setup_time = nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_RX);
 
-        dt -= RX_SETUP_TIME;
+        dt -= m_rx_setup_time;
         dt -= RX_RAMP_UP_TIME;
 
         timeslot_length = timeout + nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true);
@@ -456,6 +475,14 @@ static inline void timeslot_started_callout(rsch_dly_ts_id_t dly_ts_id)
 
 void nrf_802154_rsch_delayed_timeslot_started(rsch_dly_ts_id_t dly_ts_id)
 {
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+    if (dly_ts_id == RSCH_DLY_RX_DUTY_CYCLE)
+    {
+        nrf_802154_rx_duty_cycle_timeslot_started();
+        return;
+    }
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
+
     switch (dly_op_state_get(dly_ts_id))
     {
         case DELAYED_TRX_OP_STATE_PENDING:
@@ -528,6 +555,29 @@ bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t r
     return result;
 }
 
+bool nrf_802154_delayed_trx_tx_started_hook(const uint8_t * p_frame)
+{
+    uint32_t now;
+
+    if (m_tx_setup_measure && (p_frame == mp_tx_data))
+    {
+        m_tx_setup_measure = false;
+
+        if (nrf_802154_timer_coord_time_get(&now))
+        {
+            // This hook is called on FRAMESTART, when SHR and PHR have been transmitted.
+            uint32_t shr_start = now - PHY_US_TIME_FROM_SYMBOLS(PHY_SHR_SYMBOLS) -
+                                 PHY_US_TIME_FROM_SYMBOLS(PHY_SYMBOLS_FROM_OCTETS(PHR_SIZE));
+
+            nrf_802154_setup_time_measured(NRF_802154_SETUP_TIME_TX,
+                                           m_tx_setup_time,
+                                           (int32_t)(shr_start - m_tx_time));
+        }
+    }
+
+    return true;
+}
+
 void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame)
 {
     if (dly_op_state_get(RSCH_DLY_RX) == DELAYED_TRX_OP_STATE_ONGOING)
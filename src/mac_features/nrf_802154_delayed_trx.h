@@ -127,6 +127,18 @@ bool nrf_802154_delayed_trx_receive_cancel(void);
  */
 bool nrf_802154_delayed_trx_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
 
+/**
+ * @brief Measures the start of the delayed transmission to calibrate the setup time.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
+ *                      that is being transmitted.
+ *
+ * If the delayed transmission is not running during the call, this function does nothing.
+ *
+ * @retval  true  Always.
+ */
+bool nrf_802154_delayed_trx_tx_started_hook(const uint8_t * p_frame);
+
 /**
  * @brief Extends the timeout timer when the reception start is detected and there is not enough
  *        time left for a delayed RX operation.
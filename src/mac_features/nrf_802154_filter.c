@@ -45,6 +45,7 @@
 #include <string.h>
 
 #include "nrf_802154_const.h"
+#include "nrf_802154_debug.h"
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_pib.h"
 
@@ -342,6 +343,8 @@ static bool dst_short_addr_check(const uint8_t * p_dst_addr, uint8_t frame_type)
 {
     bool result;
 
+    (void)frame_type;
+
     if ((0 == memcmp(p_dst_addr, nrf_802154_pib_short_address_get(), SHORT_ADDRESS_SIZE)) ||
         (0 == memcmp(p_dst_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE)))
     {
@@ -368,6 +371,8 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr, uint8_t frame_ty
 {
     bool result;
 
+    (void)frame_type;
+
     if (0 == memcmp(p_dst_addr, nrf_802154_pib_extended_address_get(), EXTENDED_ADDRESS_SIZE))
     {
         result = true;
@@ -443,6 +448,8 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
     uint8_t               frame_type    = p_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK;
     uint8_t               frame_version = p_data[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK;
 
+    nrf_802154_profile_begin(FILTER_FRAME_PART);
+
     switch (*p_num_bytes)
     {
         case FCF_CHECK_OFFSET:
@@ -472,5 +479,7 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(const uint8_t * p_data, uint8
             break;
     }
 
+    nrf_802154_profile_end(FILTER_FRAME_PART);
+
     return result;
 }
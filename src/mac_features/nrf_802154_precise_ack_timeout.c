@@ -41,6 +41,7 @@
 #include <stdint.h>
 
 #include "../nrf_802154_debug.h"
+#include "../nrf_802154_stats.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_request.h"
@@ -60,6 +61,7 @@ static void notify_tx_error(bool result)
 {
     if (result)
     {
+        nrf_802154_stats_inc(tx_no_ack);
         nrf_802154_notify_transmit_failed(mp_frame, NRF_802154_TX_ERROR_NO_ACK);
     }
 }
@@ -0,0 +1,495 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the duty-cycled reception feature.
+ *
+ */
+
+#include "nrf_802154_rx_duty_cycle.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../nrf_802154_debug.h"
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_frame_parser.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_setup_time.h"
+#include "nrf_802154_timer_coord.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+/**
+ * @brief States of the duty-cycled reception.
+ */
+typedef enum
+{
+    RXDC_STATE_STOPPED,   ///< Duty-cycled reception stopped.
+    RXDC_STATE_WAITING,   ///< Duty-cycled reception waiting for the next window.
+    RXDC_STATE_LISTENING, ///< Window ongoing.
+} rxdc_state_t;
+
+/**
+ * @brief Data of the frame received in a window.
+ */
+typedef struct
+{
+    uint32_t sof_timestamp; ///< Timestamp of last start of frame notification received in the window.
+    uint8_t  psdu_length;   ///< Length in bytes of the frame received in the window.
+    bool     ack_requested; ///< Flag indicating if Ack for the frame received in the window is requested.
+} rxdc_frame_data_t;
+
+static volatile rxdc_state_t            m_state;        ///< State of the duty-cycled reception.
+static volatile uint32_t                m_window_start; ///< Start time of the current or the next window [us].
+static uint32_t                         m_period;       ///< Time between the starts of consecutive windows [us].
+static uint32_t                         m_window;       ///< Duration of a single window [us].
+static uint8_t                          m_channel;      ///< Channel number on which reception is performed.
+static nrf_802154_timer_t               m_window_timer; ///< Timer closing the window.
+static volatile rxdc_frame_data_t       m_rx_frame;     ///< Data of the frame received in the window.
+static uint32_t                         m_listen_start; ///< Time at which the radio entered the receive state in the window [us].
+static uint32_t                         m_setup_time;   ///< Setup time used to schedule the current or the next window [us].
+static volatile bool                    m_sleep_req;    ///< Indicates that the sleep request is issued by this module.
+static nrf_802154_rx_window_stats_t     m_window_stats; ///< Statistics of the current window.
+static nrf_802154_rx_duty_cycle_stats_t m_stats;        ///< Cumulative statistics.
+
+/**
+ * Set state of the duty-cycled reception.
+ *
+ * @param[in]  expected_state  Current expected state.
+ * @param[in]  new_state       New state to be set.
+ *
+ * @retval true   Successfully set the new state.
+ * @retval false  Failed to set the new state.
+ */
+static bool rxdc_state_set(rxdc_state_t expected_state, rxdc_state_t new_state)
+{
+    volatile rxdc_state_t current_state;
+
+    do
+    {
+        current_state = (rxdc_state_t)__LDREXB((uint8_t *)&m_state);
+
+        if (current_state != expected_state)
+        {
+            __CLREX();
+            return false;
+        }
+    }
+    while (__STREXB((uint8_t)new_state, (uint8_t *)&m_state));
+
+    __DMB();
+
+    return true;
+}
+
+/**
+ * End listening in the current window.
+ *
+ * @note This function must be called only by the context that changed the state from LISTENING.
+ */
+static void listen_end(void)
+{
+    m_window_stats.listen_time = nrf_802154_timer_sched_time_get() - m_listen_start;
+}
+
+/**
+ * Get the time by which the timeslot for a window must be requested before the window starts.
+ *
+ * @param[in]  setup_time  Setup time of the reception [us].
+ *
+ * @returns  Minimal time between the timeslot request and the window start [us].
+ */
+static uint32_t window_lead_time_get(uint32_t setup_time)
+{
+    return setup_time + RX_RAMP_UP_TIME + nrf_802154_rsch_delayed_timeslot_lead_time_get();
+}
+
+/**
+ * Request timeslot for a window.
+ *
+ * @param[in]  t0  Base time of the window start [us].
+ * @param[in]  dt  Time delta between @p t0 and the window start [us].
+ *
+ * @retval true   The timeslot has been requested.
+ * @retval false  The window cannot be started on time.
+ */
+static bool window_request(uint32_t t0, uint32_t dt)
+{
+    uint32_t timeslot_length = m_window + nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true);
+    uint32_t setup_time      = nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_RX);
+
+    if (dt <= setup_time + RX_RAMP_UP_TIME)
+    {
+        return false;
+    }
+
+    // The window parameters are set before the request, as the timeslot may start right away.
+    m_window_start = t0 + dt;
+    m_setup_time   = setup_time;
+
+    return nrf_802154_rsch_delayed_timeslot_request(t0,
+                                                    dt - setup_time - RX_RAMP_UP_TIME,
+                                                    timeslot_length,
+                                                    RSCH_PRIO_MAX,
+                                                    RSCH_DLY_RX_DUTY_CYCLE);
+}
+
+/**
+ * Request timeslot for the first window that can still be started on time.
+ *
+ * The windows that cannot be requested on time any more, for example because the window was
+ * extended or the module was delayed by higher priority activities, are skipped at once.
+ */
+static void next_window_request(void)
+{
+    uint32_t now    = nrf_802154_timer_sched_time_get();
+    uint32_t lead   = window_lead_time_get(nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_RX));
+    uint32_t t0     = m_window_start;
+    int32_t  late   = (int32_t)(now + lead - t0);
+    bool     result;
+
+    // The timeslot for the window at t0 + (n + 1) * period must be requested before
+    // t0 + (n + 1) * period - lead, so late / period windows are missed.
+    if (late > 0)
+    {
+        t0 += ((uint32_t)late / m_period) * m_period;
+    }
+
+    result = window_request(t0, m_period);
+
+    if (!result)
+    {
+        // The module was preempted for longer than the time left before the window. The following
+        // window leaves a whole period for the request.
+        result = window_request(t0 + m_period, m_period);
+    }
+
+    assert(result);
+    (void)result;
+}
+
+/**
+ * Update the cumulative statistics with the statistics of the window that has just ended.
+ */
+static void window_stats_update(void)
+{
+    m_stats.last_window     = m_window_stats;
+    m_stats.windows        += 1;
+    m_stats.frames_started += m_window_stats.frames_started;
+    m_stats.listen_time    += m_window_stats.listen_time;
+
+    if (m_window_stats.skipped)
+    {
+        m_stats.windows_skipped += 1;
+    }
+
+    if (m_window_stats.extended)
+    {
+        m_stats.windows_extended += 1;
+    }
+}
+
+/**
+ * Close the window, unless a frame is being received, and schedule the next one.
+ *
+ * @param[in]  p_context  Not used.
+ */
+static void window_close(void * p_context)
+{
+    (void)p_context;
+
+    bool window_extended = false;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RXDC_WINDOW_CLOSE);
+
+    if (m_state == RXDC_STATE_LISTENING)
+    {
+        uint32_t now           = nrf_802154_timer_sched_time_get();
+        uint32_t sof_timestamp = m_rx_frame.sof_timestamp;
+
+        // Make sure that the timestamp has been latched safely. If frame reception preempts the code
+        // after executing this line, the window will not be extended.
+        __DMB();
+        uint8_t  psdu_length   = m_rx_frame.psdu_length;
+        bool     ack_requested = m_rx_frame.ack_requested;
+        uint32_t frame_length  = nrf_802154_rx_duration_get(psdu_length, ack_requested);
+
+        if (nrf_802154_timer_sched_time_is_in_future(now, sof_timestamp, frame_length))
+        {
+            m_window_timer.t0 = sof_timestamp;
+            m_window_timer.dt = frame_length;
+
+            nrf_802154_timer_sched_add(&m_window_timer, true);
+
+            m_window_stats.extended = true;
+            window_extended         = true;
+        }
+        else
+        {
+            // The sleep request fails if any other module took over the radio in the meantime.
+            // The core aborts the window with REQ_ORIG_CORE for both this request and the requests
+            // of the higher layer, so the flag tells them apart.
+            m_sleep_req = true;
+            (void)nrf_802154_request_sleep(NRF_802154_TERM_NONE);
+            m_sleep_req = false;
+
+            if (rxdc_state_set(RXDC_STATE_LISTENING, RXDC_STATE_WAITING))
+            {
+                listen_end();
+            }
+        }
+    }
+
+    if (!window_extended && (m_state != RXDC_STATE_STOPPED))
+    {
+        window_stats_update();
+        nrf_802154_notify_rx_window_ended(&m_stats.last_window);
+
+        next_window_request();
+    }
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RXDC_WINDOW_CLOSE);
+}
+
+/**
+ * Receive request result callback.
+ *
+ * @param[in]  result  Result of RX request.
+ */
+static void window_started_callback(bool result)
+{
+    memset(&m_window_stats, 0, sizeof(m_window_stats));
+    m_window_stats.start = m_window_start;
+
+    if (result && rxdc_state_set(RXDC_STATE_WAITING, RXDC_STATE_LISTENING))
+    {
+        uint32_t now;
+
+        if (nrf_802154_timer_coord_time_get(&now))
+        {
+            // The radio ramps up right after the receive request is processed.
+            nrf_802154_setup_time_measured(NRF_802154_SETUP_TIME_RX,
+                                           m_setup_time,
+                                           (int32_t)(now + RX_RAMP_UP_TIME - m_window_start));
+        }
+
+        m_listen_start           = nrf_802154_timer_sched_time_get();
+        m_rx_frame.sof_timestamp = m_listen_start;
+        m_rx_frame.psdu_length   = 0;
+        m_rx_frame.ack_requested = false;
+    }
+    else
+    {
+        m_window_stats.skipped = true;
+    }
+
+    // The window timer is started even if the radio could not enter the receive state, so that
+    // the next window is requested.
+    if (m_state != RXDC_STATE_STOPPED)
+    {
+        m_window_timer.t0 = m_window_start;
+        m_window_timer.dt = m_window;
+
+        nrf_802154_timer_sched_add(&m_window_timer, true);
+    }
+}
+
+/***************************************************************************************************
+ * @section Public API implementation
+ **************************************************************************************************/
+
+bool nrf_802154_rx_duty_cycle_start(uint32_t t0,
+                                    uint32_t dt,
+                                    uint32_t period,
+                                    uint32_t window,
+                                    uint8_t  channel)
+{
+    bool result;
+
+    // The next window is requested when the current one ends, so the rest of the period must leave
+    // enough time for the request. The estimated setup time never exceeds RX_SETUP_TIME.
+    result = (m_state == RXDC_STATE_STOPPED) &&
+             (window > 0) &&
+             (period > window + window_lead_time_get(RX_SETUP_TIME));
+
+    if (result)
+    {
+        m_period  = period;
+        m_window  = window;
+        m_channel = channel;
+
+        m_window_timer.callback  = window_close;
+        m_window_timer.p_context = NULL;
+
+        // Set WAITING state before timeslot request, in case timeslot starts
+        // immediately and interrupts current function execution.
+        m_state = RXDC_STATE_WAITING;
+        __DMB();
+
+        result = window_request(t0, dt);
+
+        if (!result)
+        {
+            m_state = RXDC_STATE_STOPPED;
+        }
+    }
+
+    return result;
+}
+
+bool nrf_802154_rx_duty_cycle_stop(void)
+{
+    bool result = (m_state != RXDC_STATE_STOPPED);
+
+    m_state = RXDC_STATE_STOPPED;
+    __DMB();
+
+    (void)nrf_802154_rsch_delayed_timeslot_cancel(RSCH_DLY_RX_DUTY_CYCLE);
+    nrf_802154_timer_sched_remove(&m_window_timer, NULL);
+
+    return result;
+}
+
+bool nrf_802154_rx_duty_cycle_is_running(void)
+{
+    return m_state != RXDC_STATE_STOPPED;
+}
+
+uint32_t nrf_802154_rx_duty_cycle_time_to_window_get(uint32_t time)
+{
+    uint32_t window_start = m_window_start;
+    uint32_t result       = window_start - time;
+
+    assert(m_period > 0);
+
+    if (!nrf_802154_timer_sched_time_is_in_future(time, window_start, 0))
+    {
+        // The window at window_start has already started. Point at the next one.
+        result = m_period - ((time - window_start) % m_period);
+    }
+
+    return result;
+}
+
+void nrf_802154_rx_duty_cycle_stats_get(nrf_802154_rx_duty_cycle_stats_t * p_stats)
+{
+    // The statistics are updated from the timer interrupt, which is masked in the critical section.
+    // If the critical section cannot be entered, it is held by a preempted context, which keeps
+    // the timer interrupt masked as well.
+    bool in_crit_sect = nrf_802154_critical_section_enter();
+
+    *p_stats = m_stats;
+
+    if (in_crit_sect)
+    {
+        nrf_802154_critical_section_exit();
+    }
+}
+
+void nrf_802154_rx_duty_cycle_stats_reset(void)
+{
+    bool in_crit_sect = nrf_802154_critical_section_enter();
+
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    if (in_crit_sect)
+    {
+        nrf_802154_critical_section_exit();
+    }
+}
+
+void nrf_802154_rx_duty_cycle_timeslot_started(void)
+{
+    if (m_state == RXDC_STATE_WAITING)
+    {
+        bool result;
+
+        nrf_802154_pib_channel_set(m_channel);
+        result = nrf_802154_request_channel_update();
+
+        if (result)
+        {
+            (void)nrf_802154_request_receive(NRF_802154_TERM_NONE,
+                                             REQ_ORIG_RX_DUTY_CYCLE,
+                                             window_started_callback,
+                                             false);
+        }
+        else
+        {
+            window_started_callback(result);
+        }
+    }
+}
+
+bool nrf_802154_rx_duty_cycle_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+{
+    (void)term_lvl;
+
+    bool own_request = (req_orig == REQ_ORIG_RX_DUTY_CYCLE) ||
+                       ((req_orig == REQ_ORIG_CORE) && m_sleep_req);
+
+    if (!own_request)
+    {
+        // Another module or the higher layer takes over the radio. The window must not put
+        // the radio to sleep when it ends.
+        if (rxdc_state_set(RXDC_STATE_LISTENING, RXDC_STATE_WAITING))
+        {
+            listen_end();
+        }
+    }
+
+    return true;
+}
+
+void nrf_802154_rx_duty_cycle_rx_started_hook(const uint8_t * p_frame)
+{
+    if (m_state == RXDC_STATE_LISTENING)
+    {
+        m_rx_frame.sof_timestamp = nrf_802154_timer_sched_time_get();
+        m_rx_frame.psdu_length   = p_frame[PHR_OFFSET];
+        m_rx_frame.ack_requested = nrf_802154_frame_parser_ar_bit_is_set(p_frame);
+
+        m_window_stats.frames_started++;
+    }
+}
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
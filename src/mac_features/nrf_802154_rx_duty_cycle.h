@@ -0,0 +1,149 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_RX_DUTY_CYCLE_H__
+#define NRF_802154_RX_DUTY_CYCLE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @defgroup nrf_802154_rx_duty_cycle Duty-cycled reception feature
+ * @{
+ * @ingroup nrf_802154
+ * @brief Duty-cycled reception.
+ *
+ * This module opens receive windows periodically without any involvement of the higher layer
+ * and puts the radio to sleep between the windows, so that the high-frequency clock and the radio
+ * timeslot are released. The module is also used by the CSL receiver.
+ */
+
+/**
+ * @brief Starts the duty-cycled reception.
+ *
+ * The first window starts at @p t0 + @p dt. The following windows start every @p period.
+ * Each window lasts @p window and is extended if a frame reception starts before the window ends.
+ *
+ * @param[in]  t0       Base of delay time in microseconds.
+ * @param[in]  dt       Delta of the delay time from @p t0 in microseconds.
+ * @param[in]  period   Time between the starts of consecutive windows in microseconds. Must exceed
+ *                      @p window by the time needed to request the timeslot for a window.
+ * @param[in]  window   Duration of a single window in microseconds. Must not be 0.
+ * @param[in]  channel  Number of the channel on which the frames are to be received.
+ *
+ * @retval true   The duty-cycled reception has been started.
+ * @retval false  The duty-cycled reception is already running, the parameters are invalid
+ *                or the first window is in the past.
+ */
+bool nrf_802154_rx_duty_cycle_start(uint32_t t0,
+                                    uint32_t dt,
+                                    uint32_t period,
+                                    uint32_t window,
+                                    uint8_t  channel);
+
+/**
+ * @brief Stops the duty-cycled reception started by a call to @ref nrf_802154_rx_duty_cycle_start.
+ *
+ * If a window is ongoing, the radio remains in the receive state.
+ *
+ * @retval true   The duty-cycled reception has been stopped.
+ * @retval false  The duty-cycled reception was not running.
+ */
+bool nrf_802154_rx_duty_cycle_stop(void);
+
+/**
+ * @brief Checks if the duty-cycled reception is running.
+ *
+ * @retval true   The duty-cycled reception is running.
+ * @retval false  The duty-cycled reception is stopped.
+ */
+bool nrf_802154_rx_duty_cycle_is_running(void);
+
+/**
+ * @brief Gets the time from the given moment to the start of the nearest window.
+ *
+ * @param[in]  time  Moment for which the time to the window is calculated, in microseconds.
+ *                   It uses the same time base as the Timer Scheduler.
+ *
+ * @returns  Time from @p time to the start of the nearest window that has not started yet,
+ *           in microseconds.
+ */
+uint32_t nrf_802154_rx_duty_cycle_time_to_window_get(uint32_t time);
+
+/**
+ * @brief Gets the statistics of the duty-cycled reception.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_rx_duty_cycle_stats_get(nrf_802154_rx_duty_cycle_stats_t * p_stats);
+
+/**
+ * @brief Resets the statistics of the duty-cycled reception.
+ */
+void nrf_802154_rx_duty_cycle_stats_reset(void);
+
+/**
+ * @brief Handles the start of the timeslot requested for a window.
+ *
+ * If the duty-cycled reception is running, the radio is requested to enter the receive state.
+ */
+void nrf_802154_rx_duty_cycle_timeslot_started(void);
+
+/**
+ * @brief Aborts an ongoing window.
+ *
+ * The duty-cycled reception keeps running and opens the next window as scheduled. If the request
+ * is not issued by this module, the radio is left to the requester when the window ends.
+ *
+ * @param[in]  term_lvl  Termination level set by the request to abort the ongoing operation.
+ * @param[in]  req_orig  Module that originates this request.
+ *
+ * @retval  true  The window is not blocking the request.
+ */
+bool nrf_802154_rx_duty_cycle_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig);
+
+/**
+ * @brief Extends the window when the reception start is detected.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
+ *                      that is being received.
+ *
+ * If no window is ongoing during the call, this function does nothing.
+ */
+void nrf_802154_rx_duty_cycle_rx_started_hook(const uint8_t * p_frame);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_RX_DUTY_CYCLE_H__
@@ -53,6 +53,12 @@
 #include "nrf_802154_request.h"
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_setup_time.h"
+#include "nrf_802154_capture.h"
+#include "nrf_802154_energy.h"
+#include "nrf_802154_irq_latency.h"
+#include "nrf_802154_state_time.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_timer_coord.h"
 #include "nrf_radio.h"
 #include "platform/clock/nrf_802154_clock.h"
@@ -64,8 +70,10 @@
 #include "timer_scheduler/nrf_802154_timer_sched.h"
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_csl.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_rx_duty_cycle.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 
 #if ENABLE_FEM
@@ -146,6 +154,27 @@ void nrf_802154_channel_set(uint8_t channel)
     }
 }
 
+bool nrf_802154_channel_set_async(uint8_t                   channel,
+                                  nrf_802154_request_done_t done,
+                                  void                    * p_context)
+{
+    bool changed = nrf_802154_pib_channel_get() != channel;
+
+    nrf_802154_pib_channel_set(channel);
+
+    if (changed)
+    {
+        return nrf_802154_request_channel_update_async(done, p_context);
+    }
+
+    if (done != NULL)
+    {
+        done(true, p_context);
+    }
+
+    return true;
+}
+
 uint8_t nrf_802154_channel_get(void)
 {
     return nrf_802154_pib_channel_get();
@@ -200,13 +229,34 @@ uint32_t nrf_802154_first_symbol_timestamp_get(uint32_t end_timestamp, uint8_t p
     return end_timestamp - (frame_symbols * PHY_US_PER_SYMBOL);
 }
 
+uint64_t nrf_802154_time64_get(void)
+{
+    return nrf_802154_timer_sched_time64_get();
+}
+
+uint64_t nrf_802154_timestamp64_get(uint32_t timestamp)
+{
+    return nrf_802154_timer_sched_time64_from_time(timestamp);
+}
+
+bool nrf_802154_timer_drift_get(int32_t * p_drift, uint32_t * p_uncertainty)
+{
+    return nrf_802154_timer_coord_drift_get(p_drift, p_uncertainty);
+}
+
 void nrf_802154_init(void)
 {
     nrf_802154_ack_data_init();
+#if NRF_802154_CAPTURE_ENABLED
+    nrf_802154_capture_init();
+#endif // NRF_802154_CAPTURE_ENABLED
     nrf_802154_core_init();
     nrf_802154_clock_init();
     nrf_802154_critical_section_init();
     nrf_802154_debug_init();
+#if NRF_802154_IRQ_LATENCY_STATS_ENABLED
+    nrf_802154_irq_latency_init();
+#endif // NRF_802154_IRQ_LATENCY_STATS_ENABLED
     nrf_802154_notification_init();
     nrf_802154_lp_timer_init();
     nrf_802154_pib_init();
@@ -216,6 +266,16 @@ void nrf_802154_init(void)
     nrf_802154_rsch_crit_sect_init();
     nrf_802154_rsch_init();
     nrf_802154_rx_buffer_init();
+    nrf_802154_setup_time_init();
+#if NRF_802154_STATE_TIME_STATS_ENABLED
+    nrf_802154_state_time_init();
+#endif // NRF_802154_STATE_TIME_STATS_ENABLED
+#if NRF_802154_STATS_ENABLED
+    nrf_802154_stats_init();
+#endif // NRF_802154_STATS_ENABLED
+#if NRF_802154_ENERGY_STATS_ENABLED
+    nrf_802154_energy_init();
+#endif // NRF_802154_ENERGY_STATS_ENABLED
     nrf_802154_temperature_init();
     nrf_802154_timer_coord_init();
     nrf_802154_timer_sched_init();
@@ -225,6 +285,9 @@ void nrf_802154_deinit(void)
 {
     nrf_802154_timer_sched_deinit();
     nrf_802154_timer_coord_uninit();
+#if NRF_802154_IRQ_LATENCY_STATS_ENABLED
+    nrf_802154_irq_latency_deinit();
+#endif // NRF_802154_IRQ_LATENCY_STATS_ENABLED
     nrf_802154_temperature_deinit();
     nrf_802154_rsch_uninit();
     nrf_802154_random_deinit();
@@ -317,6 +380,76 @@ nrf_802154_state_t nrf_802154_state_get(void)
     return NRF_802154_STATE_INVALID;
 }
 
+#if NRF_802154_STATE_TIME_STATS_ENABLED
+
+void nrf_802154_state_time_stats_get(nrf_802154_state_time_stats_t * p_stats)
+{
+    nrf_802154_state_time_get(p_stats);
+}
+
+void nrf_802154_state_time_stats_reset(void)
+{
+    nrf_802154_state_time_reset();
+}
+
+#endif // NRF_802154_STATE_TIME_STATS_ENABLED
+
+#if NRF_802154_STATS_ENABLED
+
+void nrf_802154_stats_get(nrf_802154_stats_t * p_stats)
+{
+    nrf_802154_stats_counters_get(p_stats);
+}
+
+void nrf_802154_stats_reset(void)
+{
+    nrf_802154_stats_counters_reset();
+}
+
+#endif // NRF_802154_STATS_ENABLED
+
+#if NRF_802154_IRQ_LATENCY_STATS_ENABLED
+
+void nrf_802154_irq_latency_stats_get(nrf_802154_irq_latency_stats_t * p_stats)
+{
+    nrf_802154_irq_latency_get(p_stats);
+}
+
+void nrf_802154_irq_latency_stats_reset(void)
+{
+    nrf_802154_irq_latency_reset();
+}
+
+#endif // NRF_802154_IRQ_LATENCY_STATS_ENABLED
+
+#if NRF_802154_ENERGY_STATS_ENABLED
+
+void nrf_802154_energy_stats_get(nrf_802154_energy_stats_t * p_stats)
+{
+    nrf_802154_energy_get(p_stats);
+}
+
+void nrf_802154_energy_stats_reset(void)
+{
+    nrf_802154_energy_reset();
+}
+
+#endif // NRF_802154_ENERGY_STATS_ENABLED
+
+#if NRF_802154_CAPTURE_ENABLED
+
+void nrf_802154_capture_set(bool enabled)
+{
+    nrf_802154_capture_enabled_set(enabled);
+}
+
+uint32_t nrf_802154_capture_read(uint8_t * p_buffer, uint32_t length)
+{
+    return nrf_802154_capture_data_read(p_buffer, length);
+}
+
+#endif // NRF_802154_CAPTURE_ENABLED
+
 bool nrf_802154_sleep(void)
 {
     bool result;
@@ -373,6 +506,28 @@ bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca)
     return result;
 }
 
+bool nrf_802154_transmit_raw_async(const uint8_t           * p_data,
+                                   bool                      cca,
+                                   nrf_802154_request_done_t done,
+                                   void                    * p_context)
+{
+    bool result;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TRANSMIT);
+
+    result = nrf_802154_request_transmit_async(NRF_802154_TERM_NONE,
+                                               REQ_ORIG_HIGHER_LAYER,
+                                               p_data,
+                                               cca,
+                                               false,
+                                               NULL,
+                                               done,
+                                               p_context);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TRANSMIT);
+    return result;
+}
+
 #else // NRF_802154_USE_RAW_API
 
 bool nrf_802154_transmit(const uint8_t * p_data, uint8_t length, bool cca)
@@ -423,6 +578,18 @@ bool nrf_802154_transmit_at_cancel(void)
     return result;
 }
 
+bool nrf_802154_transmit_raw_at_time64(const uint8_t * p_data,
+                                       bool            cca,
+                                       uint64_t        tx_time,
+                                       uint8_t         channel)
+{
+    uint32_t t0;
+    uint32_t dt;
+
+    return nrf_802154_timer_sched_time64_to_t0_dt(tx_time, &t0, &dt) &&
+           nrf_802154_transmit_raw_at(p_data, cca, t0, dt, channel);
+}
+
 bool nrf_802154_receive_at(uint32_t t0,
                            uint32_t dt,
                            uint32_t timeout,
@@ -450,6 +617,89 @@ bool nrf_802154_receive_at_cancel(void)
     return result;
 }
 
+bool nrf_802154_receive_at_time64(uint64_t rx_time, uint32_t timeout, uint8_t channel)
+{
+    uint32_t t0;
+    uint32_t dt;
+
+    return nrf_802154_timer_sched_time64_to_t0_dt(rx_time, &t0, &dt) &&
+           nrf_802154_receive_at(t0, dt, timeout, channel);
+}
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+bool nrf_802154_receive_duty_cycle(uint32_t t0,
+                                   uint32_t dt,
+                                   uint32_t period,
+                                   uint32_t window,
+                                   uint8_t  channel)
+{
+    bool result;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RECEIVE_DC);
+
+    result = nrf_802154_rx_duty_cycle_start(t0, dt, period, window, channel);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RECEIVE_DC);
+    return result;
+}
+
+bool nrf_802154_receive_duty_cycle_stop(void)
+{
+    bool result;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RECEIVE_DC_STOP);
+
+#if NRF_802154_CSL_ENABLED
+    result = !nrf_802154_csl_is_running() && nrf_802154_rx_duty_cycle_stop();
+#else
+    result = nrf_802154_rx_duty_cycle_stop();
+#endif
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RECEIVE_DC_STOP);
+    return result;
+}
+
+void nrf_802154_receive_duty_cycle_stats_get(nrf_802154_rx_duty_cycle_stats_t * p_stats)
+{
+    nrf_802154_rx_duty_cycle_stats_get(p_stats);
+}
+
+void nrf_802154_receive_duty_cycle_stats_reset(void)
+{
+    nrf_802154_rx_duty_cycle_stats_reset();
+}
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+#if NRF_802154_CSL_ENABLED
+
+bool nrf_802154_receive_csl(uint32_t t0, uint32_t dt, uint16_t period, uint8_t channel)
+{
+    bool result;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RECEIVE_CSL);
+
+    result = nrf_802154_csl_receive_start(t0, dt, period, channel);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RECEIVE_CSL);
+    return result;
+}
+
+bool nrf_802154_receive_csl_stop(void)
+{
+    bool result;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RECEIVE_CSL_STOP);
+
+    result = nrf_802154_csl_receive_stop();
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RECEIVE_CSL_STOP);
+    return result;
+}
+
+#endif // NRF_802154_CSL_ENABLED
+
 bool nrf_802154_energy_detection(uint32_t time_us)
 {
     bool result;
@@ -521,6 +771,49 @@ bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data)
     return result;
 }
 
+bool nrf_802154_buffer_free_raw_async(uint8_t                 * p_data,
+                                      nrf_802154_request_done_t done,
+                                      void                    * p_context)
+{
+    bool          result;
+    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+
+    assert(p_buffer->free == false);
+    (void)p_buffer;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffer_free_async(p_data, done, p_context);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+    return result;
+}
+
+void nrf_802154_buffers_free_raw(uint8_t * const * pp_data, uint8_t count)
+{
+    bool result;
+
+    assert(count <= NRF_802154_RX_BUFFERS);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        assert(((rx_buffer_t *)pp_data[i])->free == false);
+    }
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffers_free(pp_data, count);
+    assert(result);
+    (void)result;
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+}
+
 #else // NRF_802154_USE_RAW_API
 
 void nrf_802154_buffer_free(uint8_t * p_data)
@@ -556,6 +849,51 @@ bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
     return result;
 }
 
+bool nrf_802154_buffer_free_async(uint8_t                 * p_data,
+                                  nrf_802154_request_done_t done,
+                                  void                    * p_context)
+{
+    bool          result;
+    rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
+
+    assert(p_buffer->free == false);
+    (void)p_buffer;
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffer_free_async(p_data - RAW_PAYLOAD_OFFSET, done, p_context);
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+    return result;
+}
+
+void nrf_802154_buffers_free(uint8_t * const * pp_data, uint8_t count)
+{
+    bool      result;
+    uint8_t * p_raw[NRF_802154_RX_BUFFERS];
+
+    assert(count <= NRF_802154_RX_BUFFERS);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        p_raw[i] = pp_data[i] - RAW_PAYLOAD_OFFSET;
+        assert(((rx_buffer_t *)p_raw[i])->free == false);
+    }
+
+    nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_BUFFER_FREE);
+
+    result = nrf_802154_request_buffers_free(p_raw, count);
+    assert(result);
+    (void)result;
+
+    nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_BUFFER_FREE);
+}
+
 #endif // NRF_802154_USE_RAW_API
 
 bool nrf_802154_rssi_measure_begin(void)
@@ -835,3 +1173,11 @@ __WEAK void nrf_802154_cca_failed(nrf_802154_cca_error_t error)
 {
     (void)error;
 }
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+__WEAK void nrf_802154_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats)
+{
+    (void)p_stats;
+}
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
@@ -58,6 +58,12 @@ extern "C" {
  */
 #define NRF_802154_NO_TIMESTAMP 0
 
+/**
+ * @brief Maximal time by which a 64-bit operation time can be ahead of the current time,
+ *        in microseconds (about 35 minutes).
+ */
+#define NRF_802154_TIME64_DELAY_MAX INT32_MAX
+
 /**
  * @brief Initializes the 802.15.4 driver.
  *
@@ -95,6 +101,29 @@ void nrf_802154_radio_irq_handler(void);
  */
 void nrf_802154_channel_set(uint8_t channel);
 
+/**
+ * @brief Sets the channel on which the radio is to operate without waiting for the radio to
+ *        switch to it.
+ *
+ * The channel is stored immediately, and the switch of the radio is queued for processing.
+ * The caller does not wait for the result, which is reported to @p done instead.
+ *
+ * @note @p done is called from the context in which the request is processed. It may be called
+ *       before this function returns.
+ *
+ * @param[in]  channel    Channel number (11-26).
+ * @param[in]  done       Function called when the radio has been switched to the channel.
+ *                        May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The channel switch was accepted.
+ * @retval  false  The channel switch cannot be queued. The new channel is used when the radio is
+ *                 switched to it by a subsequent request.
+ */
+bool nrf_802154_channel_set_async(uint8_t                   channel,
+                                  nrf_802154_request_done_t done,
+                                  void                    * p_context);
+
 /**
  * @brief Gets the channel on which the radio operates.
  *
@@ -244,6 +273,46 @@ uint8_t nrf_802154_ccaedthres_from_dbm_calculate(int8_t dbm);
  */
 uint32_t nrf_802154_first_symbol_timestamp_get(uint32_t end_timestamp, uint8_t psdu_length);
 
+/**
+ * @brief  Gets the current time as a 64-bit value.
+ *
+ * The 32 least significant bits of the returned value are equal to the current time used by
+ * the Timer Scheduler. The returned value does not wrap around, so it can be used as a long-term
+ * time base. A single operation can be scheduled at most @ref NRF_802154_TIME64_DELAY_MAX
+ * microseconds ahead of the current time.
+ *
+ * @return  Current time, in microseconds.
+ */
+uint64_t nrf_802154_time64_get(void);
+
+/**
+ * @brief  Converts a 32-bit timestamp reported by the driver to the 64-bit time base.
+ *
+ * @note The timestamp must not be older than 2^31 microseconds (about 35 minutes).
+ *
+ * @param[in]  timestamp  Timestamp reported by the driver, in microseconds.
+ *
+ * @return  64-bit time corresponding to @p timestamp, in microseconds.
+ */
+uint64_t nrf_802154_timestamp64_get(uint32_t timestamp);
+
+/**
+ * @brief  Gets the estimated drift of the high-precision timer relatively to the low-power timer.
+ *
+ * The drift is used to convert the timestamps captured with the high-precision timer to the time
+ * base of the low-power timer. The estimate is kept across radio timeslots, as the low-power timer
+ * keeps running between them.
+ *
+ * @param[out]  p_drift        Estimated drift, in parts per billion (ppb). A positive value means
+ *                             that the high-precision timer runs faster than the low-power timer.
+ * @param[out]  p_uncertainty  Standard error of @p p_drift, in parts per billion (ppb). It is set
+ *                             to UINT32_MAX if it cannot be estimated yet.
+ *
+ * @retval true   The drift is known.
+ * @retval false  The drift is not known yet or the frame timestamps are disabled.
+ */
+bool nrf_802154_timer_drift_get(int32_t * p_drift, uint32_t * p_uncertainty);
+
 /**
  * @}
  * @defgroup nrf_802154_transitions Functions to request FSM transitions and check current state
@@ -255,6 +324,134 @@ uint32_t nrf_802154_first_symbol_timestamp_get(uint32_t end_timestamp, uint8_t p
  */
 nrf_802154_state_t nrf_802154_state_get(void);
 
+#if NRF_802154_STATE_TIME_STATS_ENABLED
+
+/**
+ * @brief Gets the time spent by the driver in each state since the initialization or the last
+ *        call to @ref nrf_802154_state_time_stats_reset.
+ *
+ * The time spent in the current state so far is included. The waiting time of a state shows how
+ * long the driver waited in the state for the requested radio timeslot, for example because
+ * another protocol held the RADIO peripheral. It is also split per precondition of the timeslot:
+ * the high-frequency clock, the RAAL, and the Wi-Fi coexistence arbiter. The preconditions are
+ * requested in parallel, so the split parts may overlap.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_state_time_stats_get(nrf_802154_state_time_stats_t * p_stats);
+
+/**
+ * @brief Resets the time spent by the driver in each state.
+ */
+void nrf_802154_state_time_stats_reset(void);
+
+#endif // NRF_802154_STATE_TIME_STATS_ENABLED
+
+#if NRF_802154_STATS_ENABLED
+
+/**
+ * @brief Gets the counters of the driver events since the initialization or the last call to
+ *        @ref nrf_802154_stats_reset.
+ *
+ * Besides the events notified to the higher layer, the counters include the frames dropped by
+ * the driver internally, for example the frames rejected by the frame filter or the frames lost
+ * because no receive buffer was available. All counters are read at once, so they are consistent
+ * with each other.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the counters.
+ */
+void nrf_802154_stats_get(nrf_802154_stats_t * p_stats);
+
+/**
+ * @brief Resets all counters of the driver events at once.
+ */
+void nrf_802154_stats_reset(void);
+
+#endif // NRF_802154_STATS_ENABLED
+
+#if NRF_802154_IRQ_LATENCY_STATS_ENABLED
+
+/**
+ * @brief Gets the latency of the RADIO IRQ handler since the initialization or the last call to
+ *        @ref nrf_802154_irq_latency_stats_reset.
+ *
+ * The latency is the time from a RADIO event to the start of its processing by the driver.
+ * In each state, the driver measures only the event it is waiting for, for example the CRCOK event
+ * of a received frame that may require an ACK. The worst-case latency of the CRCOK event shows if
+ * the ACK can meet the turnaround time under the current interrupt load.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_irq_latency_stats_get(nrf_802154_irq_latency_stats_t * p_stats);
+
+/**
+ * @brief Resets the latency statistics of the RADIO IRQ handler.
+ */
+void nrf_802154_irq_latency_stats_reset(void);
+
+#endif // NRF_802154_IRQ_LATENCY_STATS_ENABLED
+
+#if NRF_802154_ENERGY_STATS_ENABLED
+
+/**
+ * @brief Gets the estimate of the charge drawn by the radio subsystem since the initialization or
+ *        the last call to @ref nrf_802154_energy_stats_reset.
+ *
+ * The estimate combines the time spent receiving and transmitting, the transmit power, the
+ * Front-End Module activity, and the high-frequency clock running time with the current
+ * consumption table configured by the NRF_802154_ENERGY_CURRENT_* options. The charge drawn by
+ * the rest of the system is not included.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the estimate.
+ */
+void nrf_802154_energy_stats_get(nrf_802154_energy_stats_t * p_stats);
+
+/**
+ * @brief Resets the estimate of the charge drawn by the radio subsystem.
+ */
+void nrf_802154_energy_stats_reset(void);
+
+#endif // NRF_802154_ENERGY_STATS_ENABLED
+
+#if NRF_802154_CAPTURE_ENABLED
+
+/**
+ * @brief Enables or disables the capture of the received frames.
+ *
+ * When the capture is enabled, each frame passed to the higher layer is also written into the
+ * capture ring buffer as a pcap record with the IEEE 802.15.4 TAP link layer, including the RSSI,
+ * LQI, channel, and 64-bit timestamp of the frame. Enable the promiscuous mode with
+ * @ref nrf_802154_promiscuous_set to capture all frames on the channel.
+ *
+ * The records can be read with @ref nrf_802154_capture_read or extracted from a RAM dump of
+ * the @c nrf_802154_capture_buffer variable. The tools/capture/capture2pcap.py script converts
+ * both forms into a pcap file.
+ *
+ * @note The capture is disabled by default.
+ *
+ * @param[in]  enabled  If the received frames are to be captured.
+ */
+void nrf_802154_capture_set(bool enabled);
+
+/**
+ * @brief Reads the captured records.
+ *
+ * Only whole records are read, so the read data can be forwarded, for example, over UART
+ * without additional framing. The space of the read data is released for new records.
+ *
+ * @note @p length of at least 177 bytes is needed to read a record of the longest frame.
+ *
+ * @note This function must not be called from more than one context at a time.
+ *
+ * @param[out]  p_buffer  Buffer to be filled with the captured data.
+ * @param[in]   length    Size of @p p_buffer, in bytes.
+ *
+ * @returns  Number of bytes written to @p p_buffer.
+ */
+uint32_t nrf_802154_capture_read(uint8_t * p_buffer, uint32_t length);
+
+#endif // NRF_802154_CAPTURE_ENABLED
+
 /**
  * @brief Changes the radio state to the @ref RADIO_STATE_SLEEP state.
  *
@@ -337,6 +534,133 @@ bool nrf_802154_receive_at(uint32_t t0,
  */
 bool nrf_802154_receive_at_cancel(void);
 
+/**
+ * @brief Requests reception at the specified 64-bit time.
+ *
+ * This function works like @ref nrf_802154_receive_at, but the reception time is given in the time
+ * base of @ref nrf_802154_time64_get.
+ *
+ * @note The reception time must be in the future and at most @ref NRF_802154_TIME64_DELAY_MAX
+ *       microseconds (about 35 minutes) ahead of the current time. Otherwise, the reception is not
+ *       scheduled and this function returns false. Later receptions must be requested when
+ *       the reception time is within the limit.
+ *
+ * @param[in]  rx_time  Time of the reception start, in microseconds (us).
+ * @param[in]  timeout  Reception timeout (counted from @p rx_time), in microseconds (us).
+ * @param[in]  channel  Radio channel on which the frame is to be received.
+ *
+ * @retval  true   The reception procedure was scheduled.
+ * @retval  false  The reception time is out of range or the driver could not schedule
+ *                 the reception procedure.
+ */
+bool nrf_802154_receive_at_time64(uint64_t rx_time, uint32_t timeout, uint8_t channel);
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+/**
+ * @brief Starts the duty-cycled reception.
+ *
+ * In this mode, the driver autonomously opens a receive window lasting @p window every
+ * @p period and puts the radio to sleep between the windows, so that the high-frequency clock and
+ * the radio timeslot are released. A window is extended if a frame reception starts before
+ * the window ends. Received frames are reported to the higher layer by a call to
+ * @ref nrf_802154_received. The end of each window is reported by a call to
+ * @ref nrf_802154_rx_window_ended.
+ *
+ * @note The higher layer is expected to keep the radio in the sleep state outside of the windows
+ *       while the duty-cycled reception is running. If another operation is ongoing when a window
+ *       is to start, the window is skipped.
+ * @note The timeslot for the next window is requested when the current window ends. The windows
+ *       that cannot be requested on time, because the current window was extended, are skipped.
+ * @note The duty-cycled reception cannot be started while the CSL receiver is running.
+ *
+ * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                      in microseconds (us).
+ * @param[in]  dt       Delta of delay time from @p t0 to the start of the first window,
+ *                      in microseconds (us).
+ * @param[in]  period   Time between the starts of consecutive windows, in microseconds (us).
+ *                      Must exceed @p window by the setup and ramp-up time of the reception
+ *                      and the time needed to request the radio timeslot.
+ * @param[in]  window   Duration of a single window, in microseconds (us). Must not be 0.
+ * @param[in]  channel  Radio channel on which the frames are to be received.
+ *
+ * @retval  true   The duty-cycled reception was started.
+ * @retval  false  The duty-cycled reception is already running, the parameters are invalid,
+ *                 or the first window is in the past.
+ */
+bool nrf_802154_receive_duty_cycle(uint32_t t0,
+                                   uint32_t dt,
+                                   uint32_t period,
+                                   uint32_t window,
+                                   uint8_t  channel);
+
+/**
+ * @brief Stops the duty-cycled reception started by a call to
+ *        @ref nrf_802154_receive_duty_cycle.
+ *
+ * If a window is ongoing, the radio remains in the receive state.
+ *
+ * @retval  true   The duty-cycled reception was running and has been stopped.
+ * @retval  false  The duty-cycled reception was not running or it is used by the CSL receiver.
+ */
+bool nrf_802154_receive_duty_cycle_stop(void);
+
+/**
+ * @brief Gets the statistics of the duty-cycled reception.
+ *
+ * The statistics are gathered for both the duty-cycled reception and the CSL receiver.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_receive_duty_cycle_stats_get(nrf_802154_rx_duty_cycle_stats_t * p_stats);
+
+/**
+ * @brief Resets the statistics of the duty-cycled reception.
+ */
+void nrf_802154_receive_duty_cycle_stats_reset(void);
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+#if NRF_802154_CSL_ENABLED
+
+/**
+ * @brief Starts the coordinated sampled listening (CSL) receiver.
+ *
+ * In this mode, the driver autonomously opens a receive window lasting
+ * @ref NRF_802154_CSL_RX_WINDOW_DURATION every @p period and puts the radio to sleep between
+ * the windows. A window is extended if a frame reception starts before the window ends.
+ * Received frames are reported to the higher layer by a call to @ref nrf_802154_received.
+ * Enh-Ack frames sent by the driver contain the CSL IE with the CSL phase calculated for
+ * the nearest window.
+ *
+ * @note The higher layer is expected to keep the radio in the sleep state outside of the windows
+ *       while the CSL receiver is running. If another operation is ongoing when a window is to
+ *       start, the window is skipped.
+ *
+ * @param[in]  t0       Base of delay time - absolute time used by the Timer Scheduler,
+ *                      in microseconds (us).
+ * @param[in]  dt       Delta of delay time from @p t0 to the start of the first window,
+ *                      in microseconds (us). It determines the CSL phase.
+ * @param[in]  period   CSL period in units of 10 symbols (160 us). Must not be 0.
+ * @param[in]  channel  Radio channel on which the frames are to be received.
+ *
+ * @retval  true   The CSL receiver was started.
+ * @retval  false  The CSL receiver is already running or the first window is in the past.
+ */
+bool nrf_802154_receive_csl(uint32_t t0, uint32_t dt, uint16_t period, uint8_t channel);
+
+/**
+ * @brief Stops the CSL receiver started by a call to @ref nrf_802154_receive_csl.
+ *
+ * If a window is ongoing, the radio remains in the receive state.
+ *
+ * @retval  true   The CSL receiver was running and has been stopped.
+ * @retval  false  The CSL receiver was not running.
+ */
+bool nrf_802154_receive_csl_stop(void);
+
+#endif // NRF_802154_CSL_ENABLED
+
 #if NRF_802154_USE_RAW_API
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_TX.
@@ -377,6 +701,35 @@ bool nrf_802154_receive_at_cancel(void);
  */
 bool nrf_802154_transmit_raw(const uint8_t * p_data, bool cca);
 
+/**
+ * @brief Changes the radio state to @ref RADIO_STATE_TX without waiting for the result.
+ *
+ * This function works as @ref nrf_802154_transmit_raw, but it does not wait for the result, which
+ * is reported to @p done instead.
+ *
+ * The request is queued and processed by the driver's software interrupt handler. The handler
+ * preempts a caller at thread level, so the request is usually processed before this function
+ * returns. The requests are not deferred: only those issued while the interrupts are masked are
+ * processed together, after the caller unmasks the interrupts.
+ *
+ * @note @p done is called from the context in which the request is processed. It may be called
+ *       before this function returns.
+ *
+ * @param[in]  p_data     Pointer to the array with data to transmit. The buffer must remain valid
+ *                        until the transmission result is reported.
+ * @param[in]  cca        If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  done       Function called with the result that @ref nrf_802154_transmit_raw would
+ *                        return. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was accepted.
+ * @retval  false  The request cannot be accepted because the request queue is full.
+ */
+bool nrf_802154_transmit_raw_async(const uint8_t           * p_data,
+                                   bool                      cca,
+                                   nrf_802154_request_done_t done,
+                                   void                    * p_context);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -478,6 +831,32 @@ bool nrf_802154_transmit_raw_at(const uint8_t * p_data,
  */
 bool nrf_802154_transmit_at_cancel(void);
 
+/**
+ * @brief Requests transmission at the specified 64-bit time.
+ *
+ * This function works like @ref nrf_802154_transmit_raw_at, but the transmission time is given in
+ * the time base of @ref nrf_802154_time64_get.
+ *
+ * @note The transmission time must be in the future and at most @ref NRF_802154_TIME64_DELAY_MAX
+ *       microseconds (about 35 minutes) ahead of the current time. Otherwise, the transmission is
+ *       not scheduled and this function returns false. Later transmissions must be requested when
+ *       the transmission time is within the limit.
+ *
+ * @param[in]  p_data   Pointer to the array with data to transmit. The first byte must contain
+ *                      the frame length (including PHR and FCS). The following bytes contain data.
+ * @param[in]  cca      If the driver is to perform a CCA procedure before transmission.
+ * @param[in]  tx_time  Time of the transmission of the first symbol of SHR, in microseconds (us).
+ * @param[in]  channel  Radio channel on which the frame is to be transmitted.
+ *
+ * @retval  true   The transmission procedure was scheduled.
+ * @retval  false  The transmission time is out of range or the driver could not schedule
+ *                 the transmission procedure.
+ */
+bool nrf_802154_transmit_raw_at_time64(const uint8_t * p_data,
+                                       bool            cca,
+                                       uint64_t        tx_time,
+                                       uint8_t         channel);
+
 /**
  * @brief Changes the radio state to energy detection.
  *
@@ -828,6 +1207,21 @@ extern void nrf_802154_cca_done(bool channel_free);
  */
 extern void nrf_802154_cca_failed(nrf_802154_cca_error_t error);
 
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+/**
+ * @brief Notifies that a receive window of the duty-cycled reception or of the CSL receiver
+ *        has ended.
+ *
+ * @note This function is called from the same context as the other notifications, after the radio
+ *       has been put to sleep.
+ *
+ * @param[in]  p_stats  Pointer to the statistics of the window that has ended.
+ */
+extern void nrf_802154_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats);
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
+
 /**
  * @}
  * @defgroup nrf_802154_memman Driver memory management
@@ -864,6 +1258,45 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data);
  */
 bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data);
 
+/**
+ * @brief Notifies the driver that the buffer containing the received frame is not used anymore,
+ *        without waiting for the driver to free it.
+ *
+ * @note The buffer pointed to by @p p_data may be modified by this function.
+ * @note @p done is called from the context in which the request is processed. It may be called
+ *       before this function returns.
+ *
+ * @param[in]  p_data     Pointer to the buffer containing the received data that is no longer
+ *                        needed by the higher layer.
+ * @param[in]  done       Function called with the result that
+ *                        @ref nrf_802154_buffer_free_immediately_raw would return. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was accepted.
+ * @retval  false  The request cannot be accepted because the request queue is full.
+ */
+bool nrf_802154_buffer_free_raw_async(uint8_t                 * p_data,
+                                      nrf_802154_request_done_t done,
+                                      void                    * p_context);
+
+/**
+ * @brief Notifies the driver that several buffers containing the received frames are not used
+ *        anymore.
+ *
+ * All buffers are returned to the driver in a single request, and the receiver is restarted at
+ * most once. This is cheaper than calling @ref nrf_802154_buffer_free_raw for each buffer when
+ * the higher layer consumes the received frames in batches.
+ *
+ * @note The buffers pointed to by @p pp_data may be modified by this function.
+ * @note This function can be safely called only from the main context.
+ *
+ * @param[in]  pp_data  Array of pointers to the buffers containing the received data that are no
+ *                      longer needed by the higher layer.
+ * @param[in]  count    Number of pointers in @p pp_data. Must not exceed
+ *                      @ref NRF_802154_RX_BUFFERS.
+ */
+void nrf_802154_buffers_free_raw(uint8_t * const * pp_data, uint8_t count);
+
 #else // NRF_802154_USE_RAW_API
 
 /**
@@ -894,6 +1327,45 @@ void nrf_802154_buffer_free(uint8_t * p_data);
  */
 bool nrf_802154_buffer_free_immediately(uint8_t * p_data);
 
+/**
+ * @brief Notifies the driver that the buffer containing the received frame is not used anymore,
+ *        without waiting for the driver to free it.
+ *
+ * @note The buffer pointed to by @p p_data may be modified by this function.
+ * @note @p done is called from the context in which the request is processed. It may be called
+ *       before this function returns.
+ *
+ * @param[in]  p_data     Pointer to the buffer containing the received data that is no longer
+ *                        needed by the higher layer.
+ * @param[in]  done       Function called with the result that
+ *                        @ref nrf_802154_buffer_free_immediately would return. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was accepted.
+ * @retval  false  The request cannot be accepted because the request queue is full.
+ */
+bool nrf_802154_buffer_free_async(uint8_t                 * p_data,
+                                  nrf_802154_request_done_t done,
+                                  void                    * p_context);
+
+/**
+ * @brief Notifies the driver that several buffers containing the received frames are not used
+ *        anymore.
+ *
+ * All buffers are returned to the driver in a single request, and the receiver is restarted at
+ * most once. This is cheaper than calling @ref nrf_802154_buffer_free for each buffer when
+ * the higher layer consumes the received frames in batches.
+ *
+ * @note The buffers pointed to by @p pp_data may be modified by this function.
+ * @note This function can be safely called only from the main context.
+ *
+ * @param[in]  pp_data  Array of pointers to the buffers containing the received data that are no
+ *                      longer needed by the higher layer.
+ * @param[in]  count    Number of pointers in @p pp_data. Must not exceed
+ *                      @ref NRF_802154_RX_BUFFERS.
+ */
+void nrf_802154_buffers_free(uint8_t * const * pp_data, uint8_t count);
+
 #endif // NRF_802154_USE_RAW_API
 
 /**
@@ -0,0 +1,287 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the capture of the received frames in the pcap record format.
+ *
+ */
+
+#include "nrf_802154_capture.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_timer_coord.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#if NRF_802154_CAPTURE_ENABLED
+
+#if (NRF_802154_CAPTURE_BUFFER_SIZE & (NRF_802154_CAPTURE_BUFFER_SIZE - 1)) != 0
+#error NRF_802154_CAPTURE_BUFFER_SIZE must be a power of two.
+#endif
+
+#define PCAP_RECORD_HDR_SIZE         16 ///< Size of the pcap record header.
+#define PCAP_RECORD_INCL_LEN_OFFSET  8  ///< Offset of the captured length in the pcap record header.
+
+#define TAP_HDR_SIZE         4  ///< Size of the TAP header without TLVs.
+#define TAP_TLV_SIZE         8  ///< Size of each TLV used in the TAP header, including the padding.
+#define TAP_TLV_NUM          4  ///< Number of TLVs in the TAP header.
+#define TAP_SIZE             (TAP_HDR_SIZE + TAP_TLV_NUM * TAP_TLV_SIZE)
+
+#define TAP_TLV_FCS_TYPE     0  ///< FCS type TLV.
+#define TAP_TLV_RSS          1  ///< Received signal strength TLV.
+#define TAP_TLV_CHANNEL      3  ///< Channel assignment TLV.
+#define TAP_TLV_LQI          10 ///< Link quality indicator TLV.
+
+#define TAP_FCS_TYPE_NONE    0  ///< Frame is captured without the FCS.
+#define CHANNEL_PAGE         0  ///< Channel page of the 2.4 GHz O-QPSK PHY.
+
+#define RECORD_HDR_SIZE      (PCAP_RECORD_HDR_SIZE + TAP_SIZE)
+
+volatile nrf_802154_capture_buffer_t nrf_802154_capture_buffer =
+{
+    .magic = NRF_802154_CAPTURE_MAGIC,
+    .size  = NRF_802154_CAPTURE_BUFFER_SIZE,
+};
+
+static volatile bool m_enabled; ///< If the received frames are captured.
+
+/**
+ * @brief Store a 16-bit value in the little-endian byte order.
+ */
+static uint8_t * u16_put(uint8_t * p_dst, uint16_t value)
+{
+    p_dst[0] = (uint8_t)value;
+    p_dst[1] = (uint8_t)(value >> 8);
+
+    return p_dst + sizeof(uint16_t);
+}
+
+/**
+ * @brief Store a 32-bit value in the little-endian byte order.
+ */
+static uint8_t * u32_put(uint8_t * p_dst, uint32_t value)
+{
+    p_dst = u16_put(p_dst, (uint16_t)value);
+
+    return u16_put(p_dst, (uint16_t)(value >> 16));
+}
+
+/**
+ * @brief Load a 32-bit value stored in the little-endian byte order.
+ */
+static uint32_t u32_get(const uint8_t * p_src)
+{
+    return (uint32_t)p_src[0] |
+           ((uint32_t)p_src[1] << 8) |
+           ((uint32_t)p_src[2] << 16) |
+           ((uint32_t)p_src[3] << 24);
+}
+
+/**
+ * @brief Store a TLV of the TAP header. The value is padded to @ref TAP_TLV_SIZE.
+ */
+static uint8_t * tlv_put(uint8_t * p_dst, uint16_t type, const void * p_value, uint16_t length)
+{
+    assert(length <= TAP_TLV_SIZE - 4);
+
+    p_dst = u16_put(p_dst, type);
+    p_dst = u16_put(p_dst, length);
+
+    memset(p_dst, 0, TAP_TLV_SIZE - 4);
+    memcpy(p_dst, p_value, length);
+
+    return p_dst + TAP_TLV_SIZE - 4;
+}
+
+/**
+ * @brief Copy data to the ring buffer at the given free-running index.
+ */
+static void ring_write(uint32_t idx, const uint8_t * p_src, uint32_t length)
+{
+    uint32_t offset = idx & (NRF_802154_CAPTURE_BUFFER_SIZE - 1);
+    uint32_t first  = NRF_802154_CAPTURE_BUFFER_SIZE - offset;
+
+    if (first > length)
+    {
+        first = length;
+    }
+
+    memcpy((uint8_t *)&nrf_802154_capture_buffer.data[offset], p_src, first);
+    memcpy((uint8_t *)&nrf_802154_capture_buffer.data[0], p_src + first, length - first);
+}
+
+/**
+ * @brief Copy data from the ring buffer at the given free-running index.
+ */
+static void ring_read(uint32_t idx, uint8_t * p_dst, uint32_t length)
+{
+    uint32_t offset = idx & (NRF_802154_CAPTURE_BUFFER_SIZE - 1);
+    uint32_t first  = NRF_802154_CAPTURE_BUFFER_SIZE - offset;
+
+    if (first > length)
+    {
+        first = length;
+    }
+
+    memcpy(p_dst, (const uint8_t *)&nrf_802154_capture_buffer.data[offset], first);
+    memcpy(p_dst + first, (const uint8_t *)&nrf_802154_capture_buffer.data[0], length - first);
+}
+
+/**
+ * @brief Get the 64-bit timestamp of the last received frame.
+ */
+static uint64_t frame_timestamp_get(void)
+{
+    uint32_t timestamp;
+
+    if (nrf_802154_timer_coord_timestamp_get(&timestamp))
+    {
+        return nrf_802154_timer_sched_time64_from_time(timestamp);
+    }
+
+    return nrf_802154_timer_sched_time64_get();
+}
+
+void nrf_802154_capture_init(void)
+{
+    m_enabled = false;
+
+    nrf_802154_capture_buffer.w_idx   = 0;
+    nrf_802154_capture_buffer.r_idx   = 0;
+    nrf_802154_capture_buffer.dropped = 0;
+}
+
+void nrf_802154_capture_enabled_set(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+void nrf_802154_capture_frame_put(const uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    uint8_t   header[RECORD_HDR_SIZE];
+    uint8_t   channel[3];
+    uint8_t   fcs_type = TAP_FCS_TYPE_NONE;
+    float     rss      = power;
+    uint8_t * p_hdr    = header;
+    uint32_t  psdu_len;
+    uint32_t  record_len;
+    uint32_t  w_idx;
+    uint64_t  timestamp;
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    psdu_len   = (p_data[PHR_OFFSET] > FCS_SIZE) ? (p_data[PHR_OFFSET] - FCS_SIZE) : 0;
+    record_len = RECORD_HDR_SIZE + psdu_len;
+    w_idx      = nrf_802154_capture_buffer.w_idx;
+
+    if (record_len > NRF_802154_CAPTURE_BUFFER_SIZE - (w_idx - nrf_802154_capture_buffer.r_idx))
+    {
+        nrf_802154_capture_buffer.dropped++;
+        return;
+    }
+
+    timestamp = frame_timestamp_get();
+
+    // pcap record header.
+    p_hdr = u32_put(p_hdr, (uint32_t)(timestamp / 1000000));
+    p_hdr = u32_put(p_hdr, (uint32_t)(timestamp % 1000000));
+    p_hdr = u32_put(p_hdr, TAP_SIZE + psdu_len);
+    p_hdr = u32_put(p_hdr, TAP_SIZE + psdu_len);
+
+    // TAP header.
+    *p_hdr++ = 0; // Version
+    *p_hdr++ = 0; // Reserved
+    p_hdr    = u16_put(p_hdr, TAP_SIZE);
+
+    u16_put(channel, nrf_802154_pib_channel_get());
+    channel[2] = CHANNEL_PAGE;
+
+    p_hdr = tlv_put(p_hdr, TAP_TLV_FCS_TYPE, &fcs_type, sizeof(fcs_type));
+    p_hdr = tlv_put(p_hdr, TAP_TLV_RSS, &rss, sizeof(rss));
+    p_hdr = tlv_put(p_hdr, TAP_TLV_CHANNEL, channel, sizeof(channel));
+    p_hdr = tlv_put(p_hdr, TAP_TLV_LQI, &lqi, sizeof(lqi));
+
+    assert(p_hdr == &header[RECORD_HDR_SIZE]);
+
+    ring_write(w_idx, header, RECORD_HDR_SIZE);
+    ring_write(w_idx + RECORD_HDR_SIZE, &p_data[PHR_SIZE], psdu_len);
+
+    // Publish the record after its data is written.
+    __DMB();
+    nrf_802154_capture_buffer.w_idx = w_idx + record_len;
+}
+
+uint32_t nrf_802154_capture_data_read(uint8_t * p_buffer, uint32_t length)
+{
+    uint32_t r_idx = nrf_802154_capture_buffer.r_idx;
+    uint32_t w_idx = nrf_802154_capture_buffer.w_idx;
+    uint32_t read  = 0;
+
+    // Read the data only after its index is observed.
+    __DMB();
+
+    while (w_idx - r_idx >= RECORD_HDR_SIZE)
+    {
+        uint8_t  incl_len[sizeof(uint32_t)];
+        uint32_t record_len;
+
+        ring_read(r_idx + PCAP_RECORD_INCL_LEN_OFFSET, incl_len, sizeof(incl_len));
+
+        record_len = PCAP_RECORD_HDR_SIZE + u32_get(incl_len);
+
+        if (read + record_len > length)
+        {
+            break;
+        }
+
+        ring_read(r_idx, &p_buffer[read], record_len);
+
+        r_idx += record_len;
+        read  += record_len;
+    }
+
+    // Release the space only after the data is read.
+    __DMB();
+    nrf_802154_capture_buffer.r_idx = r_idx;
+
+    return read;
+}
+
+#endif // NRF_802154_CAPTURE_ENABLED
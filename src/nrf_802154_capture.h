@@ -0,0 +1,137 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that captures the received frames into a ring buffer in the pcap record format.
+ *
+ */
+
+#ifndef NRF_802154_CAPTURE_H__
+#define NRF_802154_CAPTURE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_capture 802.15.4 driver frame capture
+ * @{
+ * @ingroup nrf_802154
+ * @brief Capture of the received frames.
+ *
+ * Each received frame is written into the ring buffer as a pcap record with the IEEE 802.15.4 TAP
+ * link layer (LINKTYPE_IEEE802_15_4_TAP). The TAP header holds the RSSI, LQI, and channel of the
+ * frame, and the record holds its 64-bit timestamp. The FCS is not captured, because the RADIO
+ * peripheral overwrites it with the LQI.
+ *
+ * The ring buffer contains a stream of the records that can be read with
+ * @ref nrf_802154_capture_data_read, for example to be forwarded over UART, or can be extracted
+ * from a RAM dump. Prepending the pcap file header to the stream creates a valid pcap file.
+ * If there is not enough free space for a record, the frame is not captured and it is counted as
+ * dropped.
+ */
+
+#if NRF_802154_CAPTURE_ENABLED
+
+#define NRF_802154_CAPTURE_MAGIC    0x50414350UL // "PCAP"
+#define NRF_802154_CAPTURE_LINKTYPE 283          ///< LINKTYPE_IEEE802_15_4_TAP.
+
+/**
+ * @brief Frame capture ring buffer.
+ */
+typedef struct
+{
+    uint32_t magic;                                ///< Equal to @ref NRF_802154_CAPTURE_MAGIC.
+    uint32_t size;                                 ///< Size of the data buffer, in bytes.
+    uint32_t w_idx;                                ///< Free-running index of the next byte to be written.
+    uint32_t r_idx;                                ///< Free-running index of the next byte to be read.
+    uint32_t dropped;                              ///< Number of frames dropped due to lack of space.
+    uint8_t  data[NRF_802154_CAPTURE_BUFFER_SIZE]; ///< Stream of the pcap records.
+} nrf_802154_capture_buffer_t;
+
+extern volatile nrf_802154_capture_buffer_t nrf_802154_capture_buffer;
+
+/**
+ * @brief Initializes the frame capture module.
+ *
+ * The capture is disabled after the initialization.
+ */
+void nrf_802154_capture_init(void);
+
+/**
+ * @brief Enables or disables the frame capture.
+ *
+ * @param[in]  enabled  If the received frames are to be captured.
+ */
+void nrf_802154_capture_enabled_set(bool enabled);
+
+/**
+ * @brief Captures a received frame if the capture is enabled.
+ *
+ * @note This function must be called from the core critical section, right after the reception,
+ *       so that the timestamp of the frame is still available.
+ *
+ * @param[in]  p_data  Pointer to the buffer containing PHR and PSDU of the received frame.
+ * @param[in]  power   RSSI of the received frame, in dBm.
+ * @param[in]  lqi     LQI of the received frame.
+ */
+void nrf_802154_capture_frame_put(const uint8_t * p_data, int8_t power, uint8_t lqi);
+
+/**
+ * @brief Reads the captured records from the ring buffer.
+ *
+ * Only whole records are read. The records that do not fit in @p p_buffer are left in the ring
+ * buffer.
+ *
+ * @note This function must not be called from more than one context at a time.
+ *
+ * @param[out]  p_buffer  Buffer to be filled with the captured data.
+ * @param[in]   length    Size of @p p_buffer, in bytes.
+ *
+ * @returns  Number of bytes written to @p p_buffer.
+ */
+uint32_t nrf_802154_capture_data_read(uint8_t * p_buffer, uint32_t length);
+
+#endif // NRF_802154_CAPTURE_ENABLED
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_CAPTURE_H__
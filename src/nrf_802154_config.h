@@ -199,6 +199,37 @@ extern "C" {
 #define NRF_802154_SWI_PRIORITY 5
 #endif
 
+/**
+ * @def NRF_802154_SWI_REQUEST_QUEUE_SIZE
+ *
+ * The number of slots in the queue of requests processed by SWI. Every context that can preempt
+ * another one calling the driver API may hold one slot, and each asynchronous request holds one
+ * slot until it is processed.
+ *
+ * @note The value must be a power of two.
+ *
+ */
+#ifndef NRF_802154_SWI_REQUEST_QUEUE_SIZE
+#define NRF_802154_SWI_REQUEST_QUEUE_SIZE 8
+#endif
+
+/**
+ * @def NRF_802154_NOTIFICATION_RING_SIZE
+ *
+ * The number of slots in the ring of notifications drained by the higher layer thread.
+ *
+ * @note This option is used only when the notification ring backend
+ *       (nrf_802154_notification_ring.c) is in use.
+ * @note The value must be a power of two, greater than @ref NRF_802154_RX_BUFFERS + 2.
+ *       @ref NRF_802154_RX_BUFFERS + 2 slots are reserved for the notifications which cannot be
+ *       dropped, and the reception failures and the ends of the duty-cycled reception windows
+ *       are dropped when only the reserved slots are free.
+ *
+ */
+#ifndef NRF_802154_NOTIFICATION_RING_SIZE
+#define NRF_802154_NOTIFICATION_RING_SIZE 32
+#endif
+
 /**
  * @def NRF_802154_USE_RAW_API
  *
@@ -289,6 +320,65 @@ extern "C" {
 #define NRF_802154_DELAYED_TRX_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_SETUP_TIME_CALIBRATION_ENABLED
+ *
+ * If the time needed to prepare delayed operations is calibrated at runtime. If disabled,
+ * the worst-case setup times are used. The calibration requires
+ * @ref NRF_802154_FRAME_TIMESTAMP_ENABLED to measure the setup time.
+ *
+ */
+#ifndef NRF_802154_SETUP_TIME_CALIBRATION_ENABLED
+#define NRF_802154_SETUP_TIME_CALIBRATION_ENABLED 1
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_rx_duty_cycle Duty-cycled reception feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_RX_DUTY_CYCLE_ENABLED
+ *
+ * If the duty-cycled reception feature is available.
+ * Enabling this feature enables the functions @ref nrf_802154_receive_duty_cycle and
+ * @ref nrf_802154_receive_duty_cycle_stop. The feature is required by the CSL receiver.
+ *
+ */
+#ifndef NRF_802154_RX_DUTY_CYCLE_ENABLED
+#define NRF_802154_RX_DUTY_CYCLE_ENABLED 1
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_csl CSL receiver feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_CSL_ENABLED
+ *
+ * If the coordinated sampled listening (CSL) receiver feature is available.
+ * Enabling this feature enables the functions @ref nrf_802154_receive_csl and
+ * @ref nrf_802154_receive_csl_stop.
+ *
+ */
+#ifndef NRF_802154_CSL_ENABLED
+#define NRF_802154_CSL_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_CSL_RX_WINDOW_DURATION
+ *
+ * The duration of a single CSL sample window, in microseconds (us). The window is extended
+ * automatically if a frame reception starts before the window ends.
+ *
+ */
+#ifndef NRF_802154_CSL_RX_WINDOW_DURATION
+#define NRF_802154_CSL_RX_WINDOW_DURATION 1000
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_clock Clock driver configuration
@@ -532,6 +622,376 @@ extern "C" {
 #endif
 #endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
 
+/**
+ * @}
+ * @defgroup nrf_802154_config_rsch Radio Scheduler configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+ *
+ * Indicates whether the Radio Scheduler is to predict the radio time needed by the core and hint
+ * the radio arbiter to extend the timeslot before it is actually requested.
+ *
+ * @note The prediction is based on the lengths and intervals of the recent timeslot requests and
+ *       on the pending delayed timeslots. It reduces the number of frames dropped because
+ *       the timeslot was not extended in time, at the cost of holding the radio a little longer.
+ *
+ */
+#ifndef NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+#define NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED 1
+#endif
+
+/**
+ * @def NRF_802154_RSCH_PREDICTIVE_LOOKAHEAD_MAX
+ *
+ * The maximum time in microseconds (us) the Radio Scheduler looks ahead when predicting the radio
+ * time needed by the core.
+ *
+ */
+#ifndef NRF_802154_RSCH_PREDICTIVE_LOOKAHEAD_MAX
+#define NRF_802154_RSCH_PREDICTIVE_LOOKAHEAD_MAX 20000
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_wifi_coex Wi-Fi Coexistence feature configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_WIFI_COEX_ENABLED
+ *
+ * Indicates whether the Wi-Fi Coexistence (PTA client) feature is to be enabled in the driver.
+ * If disabled, the Wi-Fi Coexistence precondition of the Radio Scheduler is always approved.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_ENABLED
+#define NRF_802154_WIFI_COEX_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_REQUEST_PIN
+ *
+ * The GPIO pin driving the PTA REQUEST signal (active high).
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_REQUEST_PIN
+#define NRF_802154_WIFI_COEX_REQUEST_PIN 28
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_PRIORITY_PIN
+ *
+ * The GPIO pin driving the PTA PRIORITY signal (active high).
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_PRIORITY_PIN
+#define NRF_802154_WIFI_COEX_PRIORITY_PIN 29
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_GRANT_PIN
+ *
+ * The GPIO pin receiving the PTA GRANT signal.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_GRANT_PIN
+#define NRF_802154_WIFI_COEX_GRANT_PIN 30
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_GRANT_ACTIVE_HIGH
+ *
+ * Indicates whether the PTA GRANT signal is active high. If set to 0, the signal is active low.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_GRANT_ACTIVE_HIGH
+#define NRF_802154_WIFI_COEX_GRANT_ACTIVE_HIGH 1
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_GPIOTE_CHANNEL
+ *
+ * The GPIOTE channel used to detect changes of the PTA GRANT signal.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_GPIOTE_CHANNEL
+#define NRF_802154_WIFI_COEX_GPIOTE_CHANNEL 7
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_INTERNAL_GPIOTE_IRQ_HANDLING
+ *
+ * If the driver is expected to internally handle the GPIOTE IRQ. If the GPIOTE IRQ is shared with
+ * other modules, the internal handling must be disabled and the shared handler must call
+ * @ref nrf_802154_pta_gpiote_irq_handler.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_INTERNAL_GPIOTE_IRQ_HANDLING
+#define NRF_802154_WIFI_COEX_INTERNAL_GPIOTE_IRQ_HANDLING 1
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_REQUEST_LEAD_TIME
+ *
+ * The time in microseconds (us) the REQUEST signal is asserted before a scheduled radio operation
+ * starts. The Radio Scheduler requests preconditions of delayed timeslots at least this long
+ * before the timeslot start.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_REQUEST_LEAD_TIME
+#define NRF_802154_WIFI_COEX_REQUEST_LEAD_TIME 500
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_PRIORITY_THRESHOLD
+ *
+ * The lowest Radio Scheduler priority level signalled to the arbiter as the high priority.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_PRIORITY_THRESHOLD
+#define NRF_802154_WIFI_COEX_PRIORITY_THRESHOLD RSCH_PRIO_RX
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_GRANT_SETTLE_TIME
+ *
+ * The time in microseconds (us) the GRANT signal must remain asserted before the radio is used.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_GRANT_SETTLE_TIME
+#define NRF_802154_WIFI_COEX_GRANT_SETTLE_TIME 0
+#endif
+
+/**
+ * @def NRF_802154_WIFI_COEX_DENY_MODE
+ *
+ * The default handling of the grant revoked by the arbiter during a frame.
+ * See @ref nrf_802154_wifi_coex_deny_mode_t for the possible values.
+ *
+ */
+#ifndef NRF_802154_WIFI_COEX_DENY_MODE
+#define NRF_802154_WIFI_COEX_DENY_MODE NRF_802154_WIFI_COEX_DENY_MODE_ABORT
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_crit_sect Critical section instrumentation configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+ *
+ * Indicates whether the time for which the driver critical section masks the radio interrupts
+ * is to be measured. The measurement uses the DWT cycle counter.
+ *
+ */
+#ifndef NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+#define NRF_802154_CRITICAL_SECTION_STATS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CRITICAL_SECTION_BUDGET
+ *
+ * The maximum time in microseconds (us) the critical section is expected to be held. Each hold
+ * exceeding this time is reported with @ref nrf_802154_critical_section_budget_exceeded.
+ * 0 disables the check.
+ *
+ * @note This option is used only when @ref NRF_802154_CRITICAL_SECTION_STATS_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_CRITICAL_SECTION_BUDGET
+#define NRF_802154_CRITICAL_SECTION_BUDGET 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_state_time State time accounting configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_STATE_TIME_STATS_ENABLED
+ *
+ * Indicates whether the time spent by the driver in each state is to be accounted.
+ * Enabling this feature enables the functions @ref nrf_802154_state_time_stats_get and
+ * @ref nrf_802154_state_time_stats_reset.
+ *
+ */
+#ifndef NRF_802154_STATE_TIME_STATS_ENABLED
+#define NRF_802154_STATE_TIME_STATS_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_stats Driver statistics configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_STATS_ENABLED
+ *
+ * Indicates whether the driver is to count the received, dropped, and transmitted frames.
+ * Enabling this feature enables the functions @ref nrf_802154_stats_get and
+ * @ref nrf_802154_stats_reset.
+ *
+ */
+#ifndef NRF_802154_STATS_ENABLED
+#define NRF_802154_STATS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_IRQ_LATENCY_STATS_ENABLED
+ *
+ * Indicates whether the latency of the RADIO IRQ handler is to be measured. The time of the RADIO
+ * event is captured through PPI by the High Precision Timer and compared with the time the handler
+ * starts processing the event. Enabling this feature enables the functions
+ * @ref nrf_802154_irq_latency_stats_get and @ref nrf_802154_irq_latency_stats_reset.
+ *
+ * @note This feature requires @ref NRF_802154_FRAME_TIMESTAMP_ENABLED, which keeps the High
+ *       Precision Timer running during the radio timeslots.
+ * @note This feature uses PPI channel @ref NRF_802154_IRQ_LATENCY_PPI_CHANNEL and
+ *       the compare channel 0 of the High Precision Timer. This channel is owned by the RAAL
+ *       when the driver shares the radio through the timeslot API, so this feature is available
+ *       only with the single PHY RAAL.
+ *
+ */
+#ifndef NRF_802154_IRQ_LATENCY_STATS_ENABLED
+#define NRF_802154_IRQ_LATENCY_STATS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_IRQ_LATENCY_PPI_CHANNEL
+ *
+ * The PPI channel used to capture the time of the RADIO events.
+ *
+ * @note This option is used only when @ref NRF_802154_IRQ_LATENCY_STATS_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_IRQ_LATENCY_PPI_CHANNEL
+#define NRF_802154_IRQ_LATENCY_PPI_CHANNEL NRF_PPI_CHANNEL15
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_energy Energy estimator configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_ENERGY_STATS_ENABLED
+ *
+ * Indicates whether the charge drawn by the radio subsystem is to be estimated. The estimate is
+ * based on the time spent by the driver in each state and on the current consumption table given
+ * by the NRF_802154_ENERGY_CURRENT_* options, so it requires
+ * @ref NRF_802154_STATE_TIME_STATS_ENABLED.
+ * Enabling this feature enables the functions @ref nrf_802154_energy_stats_get and
+ * @ref nrf_802154_energy_stats_reset.
+ *
+ */
+#ifndef NRF_802154_ENERGY_STATS_ENABLED
+#define NRF_802154_ENERGY_STATS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_CURRENT_RX
+ *
+ * The current drawn by the RADIO peripheral when receiving, in microamperes (uA).
+ * The default value is approximate for nRF52840 with the DC/DC converter enabled.
+ *
+ */
+#ifndef NRF_802154_ENERGY_CURRENT_RX
+#define NRF_802154_ENERGY_CURRENT_RX 6400
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_CURRENT_TX_TABLE
+ *
+ * The current drawn by the RADIO peripheral when transmitting, for each transmit power. The table
+ * is an initializer of an array of pairs { transmit power in dBm, current in uA }, sorted by
+ * ascending transmit power. The current of the first entry with the power equal to or higher than
+ * the transmit power set in the PIB is used.
+ * The default values are approximate for nRF52840 with the DC/DC converter enabled.
+ *
+ */
+#ifndef NRF_802154_ENERGY_CURRENT_TX_TABLE
+#define NRF_802154_ENERGY_CURRENT_TX_TABLE \
+    {                                      \
+        { -40, 3300  },                    \
+        { -20, 3700  },                    \
+        { -8,  4600  },                    \
+        { -4,  5100  },                    \
+        { 0,   6400  },                    \
+        { 4,   9600  },                    \
+        { 8,   14800 },                    \
+    }
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_CURRENT_HFCLK
+ *
+ * The current drawn by the high-frequency crystal oscillator, in microamperes (uA).
+ *
+ */
+#ifndef NRF_802154_ENERGY_CURRENT_HFCLK
+#define NRF_802154_ENERGY_CURRENT_HFCLK 250
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_CURRENT_FEM_PA
+ *
+ * The current drawn by the PA of the Front-End Module when transmitting, in microamperes (uA).
+ * Keep it 0 if no Front-End Module is used.
+ *
+ */
+#ifndef NRF_802154_ENERGY_CURRENT_FEM_PA
+#define NRF_802154_ENERGY_CURRENT_FEM_PA 0
+#endif
+
+/**
+ * @def NRF_802154_ENERGY_CURRENT_FEM_LNA
+ *
+ * The current drawn by the LNA of the Front-End Module when receiving, in microamperes (uA).
+ * Keep it 0 if no Front-End Module is used.
+ *
+ */
+#ifndef NRF_802154_ENERGY_CURRENT_FEM_LNA
+#define NRF_802154_ENERGY_CURRENT_FEM_LNA 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_capture Frame capture configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_CAPTURE_ENABLED
+ *
+ * Indicates whether the received frames can be captured into a ring buffer in the pcap record
+ * format with the IEEE 802.15.4 TAP link layer. Enabling this feature enables the functions
+ * @ref nrf_802154_capture_set and @ref nrf_802154_capture_read.
+ *
+ */
+#ifndef NRF_802154_CAPTURE_ENABLED
+#define NRF_802154_CAPTURE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_CAPTURE_BUFFER_SIZE
+ *
+ * The size of the frame capture ring buffer, in bytes. It must be a power of two.
+ *
+ * @note This option is used only when @ref NRF_802154_CAPTURE_ENABLED is set.
+ *
+ */
+#ifndef NRF_802154_CAPTURE_BUFFER_SIZE
+#define NRF_802154_CAPTURE_BUFFER_SIZE 4096
+#endif
+
 /**
  *@}
  **/
@@ -78,6 +78,8 @@
 #define FRAME_VERSION_2              0x20                                         ///< Bits containing the frame version 0b10.
 #define FRAME_VERSION_3              0x30                                         ///< Bits containing the frame version 0b11.
 
+#define IE_CSL_ELEMENT_ID            0x1a                                         ///< Element ID of the CSL IE.
+#define IE_ELEMENT_ID_SHIFT          7                                            ///< Position of the Element ID field in the Header IE descriptor.
 #define IE_HEADER_LENGTH_MASK        0x3f                                         ///< Mask of bits containing the length of an IE header content.
 #define IE_PRESENT_OFFSET            2                                            ///< Byte containing the IE Present bit.
 #define IE_PRESENT_BIT               0x02                                         ///< Bits containing the IE Present field.
@@ -114,6 +116,7 @@
 #define SRC_ADDR_OFFSET_SHORT_DST    8                                            ///< Offset of the source address in the Data frame if the destination address is short.
 #define SRC_ADDR_OFFSET_EXTENDED_DST 14                                           ///< Offset of the source address in the Data frame if the destination address is extended.
 
+#define CSL_IE_SIZE                  6                                            ///< Size of the CSL IE, including the Header IE descriptor.
 #define DSN_SIZE                     1                                            ///< Size of the Sequence Number field.
 #define FCF_SIZE                     2                                            ///< Size of the FCF field.
 #define FCS_SIZE                     2                                            ///< Size of the FCS field.
@@ -137,6 +140,7 @@
 #define TURNAROUND_TIME              192UL                                        ///< RX-to-TX or TX-to-RX turnaround time (aTurnaroundTime), in microseconds (us).
 #define CCA_TIME                     128UL                                        ///< Time required to perform CCA detection (aCcaTime), in microseconds (us).
 #define UNIT_BACKOFF_PERIOD          (TURNAROUND_TIME + CCA_TIME)                 ///< Number of symbols in the basic time period used by CSMA-CA algorithm (aUnitBackoffPeriod), in (us).
+#define CSL_UNIT                     160UL                                        ///< Unit of the CSL Phase and CSL Period fields (10 symbols), in microseconds (us).
 
 #define PHY_US_PER_SYMBOL            16                                           ///< Duration of a single symbol in microseconds (us).
 #define PHY_SYMBOLS_PER_OCTET        2                                            ///< Number of symbols in a single byte (octet).
@@ -162,6 +166,9 @@ typedef enum
 #if NRF_802154_DELAYED_TRX_ENABLED
     REQ_ORIG_DELAYED_TRX,
 #endif // NRF_802154_DELAYED_TRX_ENABLED
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+    REQ_ORIG_RX_DUTY_CYCLE,
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
 } req_originator_t;
 
 #endif // NRD_DRV_RADIO802154_CONST_H_
@@ -51,6 +51,10 @@
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_rssi.h"
 #include "nrf_802154_rx_buffer.h"
+#include "nrf_802154_capture.h"
+#include "nrf_802154_irq_latency.h"
+#include "nrf_802154_state_time.h"
+#include "nrf_802154_stats.h"
 #include "nrf_802154_utils.h"
 #include "nrf_802154_timer_coord.h"
 #include "nrf_802154_types.h"
@@ -234,6 +238,73 @@ static volatile bool m_rsch_timeslot_is_granted; ///< State of the RSCH timeslot
  * @section Common core operations
  **************************************************************************************************/
 
+/** Select the RADIO event whose IRQ latency is to be measured in the current state. */
+static void irq_latency_arm(void)
+{
+#if NRF_802154_IRQ_LATENCY_STATS_ENABLED
+    nrf_802154_irq_latency_event_t event = NRF_802154_IRQ_LATENCY_EVENT_NONE;
+
+    if (m_rsch_timeslot_is_granted)
+    {
+        switch (m_state)
+        {
+            case RADIO_STATE_RX:
+#if !NRF_802154_DISABLE_BCC_MATCHING
+                event = m_flags.frame_filtered ? NRF_802154_IRQ_LATENCY_EVENT_CRCOK :
+                        NRF_802154_IRQ_LATENCY_EVENT_BCMATCH;
+#else // !NRF_802154_DISABLE_BCC_MATCHING
+                event = NRF_802154_IRQ_LATENCY_EVENT_CRCOK;
+#endif // !NRF_802154_DISABLE_BCC_MATCHING
+                break;
+
+            case RADIO_STATE_CCA_TX:
+            case RADIO_STATE_TX:
+#if NRF_802154_TX_STARTED_NOTIFY_ENABLED
+                event = m_flags.tx_started ? NRF_802154_IRQ_LATENCY_EVENT_PHYEND :
+                        NRF_802154_IRQ_LATENCY_EVENT_FRAMESTART;
+#else // NRF_802154_TX_STARTED_NOTIFY_ENABLED
+                event = NRF_802154_IRQ_LATENCY_EVENT_PHYEND;
+#endif // NRF_802154_TX_STARTED_NOTIFY_ENABLED
+                break;
+
+            case RADIO_STATE_TX_ACK:
+                event = NRF_802154_IRQ_LATENCY_EVENT_PHYEND;
+                break;
+
+            case RADIO_STATE_RX_ACK:
+                event = NRF_802154_IRQ_LATENCY_EVENT_END;
+                break;
+
+            case RADIO_STATE_FALLING_ASLEEP:
+                event = NRF_802154_IRQ_LATENCY_EVENT_DISABLED;
+                break;
+
+            case RADIO_STATE_CCA:
+                event = NRF_802154_IRQ_LATENCY_EVENT_CCAIDLE;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    nrf_802154_irq_latency_arm(event);
+#endif // NRF_802154_IRQ_LATENCY_STATS_ENABLED
+}
+
+/** Notify the IRQ latency measurement that the processing of a RADIO event starts.
+ *
+ * @param[in]  event  RADIO event being processed.
+ */
+static void irq_latency_measure(nrf_802154_irq_latency_event_t event)
+{
+#if NRF_802154_IRQ_LATENCY_STATS_ENABLED
+    nrf_802154_irq_latency_measure(event);
+#else // NRF_802154_IRQ_LATENCY_STATS_ENABLED
+    (void)event;
+#endif // NRF_802154_IRQ_LATENCY_STATS_ENABLED
+}
+
 /** Set driver state.
  *
  * @param[in]  state  Driver state to set.
@@ -242,9 +313,30 @@ static void state_set(radio_state_t state)
 {
     m_state = state;
 
+    irq_latency_arm();
+
+#if NRF_802154_STATE_TIME_STATS_ENABLED
+    nrf_802154_state_time_state_set(state);
+#endif // NRF_802154_STATE_TIME_STATS_ENABLED
+
     nrf_802154_log(EVENT_SET_STATE, (uint32_t)state);
 }
 
+/** Set the state of the RSCH timeslot.
+ *
+ * @param[in]  granted  If the timeslot is granted.
+ */
+static void timeslot_granted_set(bool granted)
+{
+    m_rsch_timeslot_is_granted = granted;
+
+#if NRF_802154_STATE_TIME_STATS_ENABLED
+    nrf_802154_state_time_timeslot_set(granted);
+#endif // NRF_802154_STATE_TIME_STATS_ENABLED
+
+    irq_latency_arm();
+}
+
 /** Clear flags describing frame being received. */
 static void rx_flags_clear(void)
 {
@@ -307,8 +399,68 @@ static uint8_t lqi_get(const uint8_t * p_data)
     return (uint8_t)lqi;
 }
 
+/** Count a frame dropped by the frame filter.
+ *
+ * @param[in]  reason  Reason of dropping the frame returned by the frame filter.
+ */
+static void rx_filtered_stats_inc(nrf_802154_rx_error_t reason)
+{
+    switch (reason)
+    {
+        case NRF_802154_RX_ERROR_INVALID_FRAME:
+            nrf_802154_stats_inc(rx_filtered_invalid_frame);
+            break;
+
+        case NRF_802154_RX_ERROR_INVALID_DEST_ADDR:
+            nrf_802154_stats_inc(rx_filtered_invalid_dest_addr);
+            break;
+
+        case NRF_802154_RX_ERROR_INVALID_LENGTH:
+            nrf_802154_stats_inc(rx_filtered_invalid_length);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/** Count a failed transmission procedure.
+ *
+ * @param[in]  error  Reason of the failure.
+ */
+static void tx_error_stats_inc(nrf_802154_tx_error_t error)
+{
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+            nrf_802154_stats_inc(tx_cca_busy);
+            break;
+
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+            nrf_802154_stats_inc(tx_invalid_ack);
+            break;
+
+        case NRF_802154_TX_ERROR_NO_MEM:
+            nrf_802154_stats_inc(tx_no_mem);
+            break;
+
+        case NRF_802154_TX_ERROR_TIMESLOT_ENDED:
+            nrf_802154_stats_inc(tx_timeslot_ended);
+            break;
+
+        default:
+            break;
+    }
+}
+
 static void received_frame_notify(uint8_t * p_data)
 {
+    nrf_802154_stats_inc(rx_accepted);
+
+#if NRF_802154_CAPTURE_ENABLED
+    nrf_802154_capture_frame_put(p_data, rssi_last_measurement_get(), lqi_get(p_data));
+#endif // NRF_802154_CAPTURE_ENABLED
+
     nrf_802154_notify_received(p_data,                      // data
                                rssi_last_measurement_get(), // rssi
                                lqi_get(p_data));            // lqi
@@ -362,6 +514,8 @@ static void transmitted_frame_notify(uint8_t * p_ack, int8_t power, uint8_t lqi)
 {
     const uint8_t * p_frame = mp_tx_data;
 
+    nrf_802154_stats_inc(tx_success);
+
     nrf_802154_critical_section_nesting_allow();
 
     nrf_802154_core_hooks_transmitted(p_frame);
@@ -375,6 +529,8 @@ static void transmit_failed_notify(nrf_802154_tx_error_t error)
 {
     const uint8_t * p_frame = mp_tx_data;
 
+    tx_error_stats_inc(error);
+
     if (nrf_802154_core_hooks_tx_failed(p_frame, error))
     {
         nrf_802154_notify_transmit_failed(p_frame, error);
@@ -994,10 +1150,20 @@ static bool critical_section_can_be_processed_now(void)
     return !timeslot_is_granted() || remaining_timeslot_time_is_enough_for_crit_sect();
 }
 
-/** Enter critical section and verify if there is enough time to complete operations within. */
-static bool critical_section_enter_and_verify_timeslot_length(void)
+/** Verify if there is enough time to complete operations within the entered critical section.
+ *
+ * The critical section is entered by the caller, so that the critical section statistics attribute
+ * the hold to the caller rather than to this function. The critical section is exited if the
+ * remaining timeslot time is not enough.
+ *
+ * @param[in]  entered  Result of @ref nrf_802154_critical_section_enter.
+ *
+ * @retval true   Critical section was entered and there is enough time to process it.
+ * @retval false  Critical section was not entered or was exited.
+ */
+static bool critical_section_verify_timeslot_length(bool entered)
 {
-    bool result = nrf_802154_critical_section_enter();
+    bool result = entered;
 
     if (result)
     {
@@ -1678,12 +1844,20 @@ static bool tx_init(const uint8_t * p_data, bool cca, bool disabled_was_triggere
 {
     uint32_t ints_to_enable = 0;
 
-    if (!timeslot_is_granted() || !nrf_802154_rsch_timeslot_request(
+    if (!timeslot_is_granted())
+    {
+        return false;
+    }
+
+    if (!nrf_802154_rsch_timeslot_request(
             nrf_802154_tx_duration_get(p_data[0], cca, ack_is_requested(p_data))))
     {
+        nrf_802154_stats_inc(tx_timeslot_denials);
         return false;
     }
 
+    nrf_802154_stats_inc(tx_attempts);
+
     nrf_radio_txpower_set(nrf_802154_pib_tx_power_get());
     nrf_radio_packetptr_set(p_data);
 
@@ -1829,7 +2003,7 @@ static void cont_prec_approved(void)
 
         assert(nrf_radio_shorts_get() == SHORTS_IDLE);
 
-        m_rsch_timeslot_is_granted = true;
+        timeslot_granted_set(true);
         nrf_802154_timer_coord_start();
 
         nrf_802154_fal_pa_configuration_set(NULL, &m_deactivate_on_disable);
@@ -1881,7 +2055,7 @@ static void cont_prec_denied(void)
 
     if (timeslot_is_granted())
     {
-        m_rsch_timeslot_is_granted = false;
+        timeslot_granted_set(false);
 
         if (nrf_802154_rsch_timeslot_is_requested())
         {
@@ -1909,6 +2083,7 @@ static void cont_prec_denied(void)
             case RADIO_STATE_RX:
                 if (psdu_is_being_received())
                 {
+                    nrf_802154_stats_inc(rx_timeslot_ended);
                     receive_failed_notify(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
                 }
 
@@ -2025,6 +2200,8 @@ static void irq_bcmatch_state_rx(void)
 
             frame_accepted = false;
 
+            rx_filtered_stats_inc(filter_result);
+
             if ((mp_current_rx_buffer->data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) !=
                 FRAME_TYPE_ACK)
             {
@@ -2052,6 +2229,7 @@ static void irq_bcmatch_state_rx(void)
             // Disable receiver and wait for a new timeslot.
             rx_terminate();
 
+            nrf_802154_stats_inc(rx_timeslot_denials);
             nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_TIMESLOT_ENDED);
         }
     }
@@ -2062,6 +2240,8 @@ static void irq_bcmatch_state_rx(void)
 #if !NRF_802154_DISABLE_BCC_MATCHING || NRF_802154_NOTIFY_CRCERROR
 static void irq_crcerror_state_rx(void)
 {
+    nrf_802154_stats_inc(rx_crc_errors);
+
 #if !NRF_802154_DISABLE_BCC_MATCHING
     rx_restart(false);
 #endif // !NRF_802154_DISABLE_BCC_MATCHING
@@ -2117,6 +2297,8 @@ static void irq_crcok_state_rx(void)
 
         rx_flags_clear();
 
+        nrf_802154_stats_inc(ack_timeslot_denials);
+
         // Filter out received ACK frame if promiscuous mode is disabled.
         if (((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK) ||
             nrf_802154_pib_promiscuous_get())
@@ -2142,6 +2324,10 @@ static void irq_crcok_state_rx(void)
             {
                 send_ack = true;
             }
+            else
+            {
+                nrf_802154_stats_inc(ack_create_failures);
+            }
         }
 
         if (send_ack)
@@ -2271,11 +2457,17 @@ static void irq_crcok_state_rx(void)
                         nrf_radio_task_trigger(NRF_RADIO_TASK_START);
                     }
                 }
+                else
+                {
+                    nrf_802154_stats_inc(rx_buffer_overruns);
+                }
 
                 received_frame_notify_and_nesting_allow(p_received_data);
             }
             else
             {
+                nrf_802154_stats_inc(rx_filtered_ack);
+
                 nrf_radio_shorts_set(SHORTS_RX | SHORTS_RX_FREE_BUFFER);
 
                 if (nrf_radio_state_get() == NRF_RADIO_STATE_RXIDLE)
@@ -2294,11 +2486,14 @@ static void irq_crcok_state_rx(void)
         rx_init(true);
 
 #if NRF_802154_DISABLE_BCC_MATCHING
+        rx_filtered_stats_inc(filter_result);
+
         if ((p_received_data[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) != FRAME_TYPE_ACK)
         {
             receive_failed_notify(filter_result);
         }
 #else // NRF_802154_DISABLE_BCC_MATCHING
+        nrf_802154_stats_inc(rx_runtime_errors);
         receive_failed_notify(NRF_802154_RX_ERROR_RUNTIME);
 #endif  // NRF_802154_DISABLE_BCC_MATCHING
     }
@@ -2310,6 +2505,8 @@ static void irq_phyend_state_tx_ack(void)
     uint32_t  ints_to_enable  = 0;
     uint32_t  ints_to_disable = 0;
 
+    nrf_802154_stats_inc(ack_sent);
+
     // Disable PPIs on DISABLED event to control TIMER.
     nrf_ppi_channel_disable(PPI_DISABLED_EGU);
 
@@ -2406,6 +2603,10 @@ static void irq_phyend_state_tx_ack(void)
             nrf_radio_task_trigger(NRF_RADIO_TASK_START);
         }
     }
+    else
+    {
+        nrf_802154_stats_inc(rx_buffer_overruns);
+    }
 
     state_set(RADIO_STATE_RX);
 
@@ -2652,6 +2853,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_ADDRESS))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_FRAMESTART);
+        irq_latency_measure(NRF_802154_IRQ_LATENCY_EVENT_FRAMESTART);
         nrf_radio_event_clear(NRF_RADIO_EVENT_ADDRESS);
 
         switch (m_state)
@@ -2682,13 +2884,18 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_BCMATCH))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_BCMATCH);
+        irq_latency_measure(NRF_802154_IRQ_LATENCY_EVENT_BCMATCH);
         nrf_radio_event_clear(NRF_RADIO_EVENT_BCMATCH);
 
         switch (m_state)
         {
             case RADIO_STATE_RX:
+            {
+                nrf_802154_profile_begin(IRQ_BCMATCH_STATE_RX);
                 irq_bcmatch_state_rx();
+                nrf_802154_profile_end(IRQ_BCMATCH_STATE_RX);
                 break;
+            }
 
             default:
                 assert(false);
@@ -2724,13 +2931,18 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_CRCOK))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CRCOK);
+        irq_latency_measure(NRF_802154_IRQ_LATENCY_EVENT_CRCOK);
         nrf_radio_event_clear(NRF_RADIO_EVENT_CRCOK);
 
         switch (m_state)
         {
             case RADIO_STATE_RX:
+            {
+                nrf_802154_profile_begin(IRQ_CRCOK_STATE_RX);
                 irq_crcok_state_rx();
+                nrf_802154_profile_end(IRQ_CRCOK_STATE_RX);
                 break;
+            }
 
             default:
                 assert(false);
@@ -2743,6 +2955,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_PHYEND))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_PHYEND);
+        irq_latency_measure(NRF_802154_IRQ_LATENCY_EVENT_PHYEND);
         nrf_radio_event_clear(NRF_RADIO_EVENT_PHYEND);
 
         switch (m_state)
@@ -2767,6 +2980,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_END))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_END);
+        irq_latency_measure(NRF_802154_IRQ_LATENCY_EVENT_END);
         nrf_radio_event_clear(NRF_RADIO_EVENT_END);
 
         switch (m_state)
@@ -2786,6 +3000,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_DISABLED))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_DISABLED);
+        irq_latency_measure(NRF_802154_IRQ_LATENCY_EVENT_DISABLED);
         nrf_radio_event_clear(NRF_RADIO_EVENT_DISABLED);
 
         switch (m_state)
@@ -2805,6 +3020,7 @@ static void irq_handler(void)
         nrf_radio_event_check(NRF_RADIO_EVENT_CCAIDLE))
     {
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_EVENT_CCAIDLE);
+        irq_latency_measure(NRF_802154_IRQ_LATENCY_EVENT_CCAIDLE);
         nrf_radio_event_clear(NRF_RADIO_EVENT_CCAIDLE);
 
         switch (m_state)
@@ -2863,6 +3079,9 @@ static void irq_handler(void)
         nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_EVENT_EDEND);
     }
 
+    // The flags selecting the awaited event might have been changed by the event handlers.
+    irq_latency_arm();
+
     nrf_802154_critical_section_exit();
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_IRQ_HANDLER);
@@ -2974,7 +3193,7 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
                               bool                           immediate,
                               nrf_802154_notification_func_t notify_function)
 {
-    bool result = critical_section_enter_and_verify_timeslot_length();
+    bool result = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
 
     if (result)
     {
@@ -3019,7 +3238,7 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
-    bool result = critical_section_enter_and_verify_timeslot_length();
+    bool result = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
 
     if (result)
     {
@@ -3041,7 +3260,7 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
 
 bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 {
-    bool result = critical_section_enter_and_verify_timeslot_length();
+    bool result = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
 
     if (result)
     {
@@ -3061,7 +3280,7 @@ bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 
 bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl)
 {
-    bool result = critical_section_enter_and_verify_timeslot_length();
+    bool result = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
 
     if (result)
     {
@@ -3081,10 +3300,25 @@ bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl)
 
 bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
 {
-    rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
-    bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
+    return nrf_802154_core_notify_buffers_free(&p_data, 1);
+}
+
+bool nrf_802154_core_notify_buffers_free(uint8_t * const * pp_data, uint8_t count)
+{
+    rx_buffer_t * p_buffer;
+    bool          in_crit_sect;
+
+    assert(count > 0);
+
+    in_crit_sect = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        ((rx_buffer_t *)pp_data[i])->free = true;
+    }
 
-    p_buffer->free = true;
+    // The receiver is restarted at most once, using the first freed buffer.
+    p_buffer = (rx_buffer_t *)pp_data[0];
 
     if (in_crit_sect)
     {
@@ -3136,7 +3370,7 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
 
 bool nrf_802154_core_channel_update(void)
 {
-    bool result = critical_section_enter_and_verify_timeslot_length();
+    bool result = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
 
     if (result)
     {
@@ -3176,7 +3410,7 @@ bool nrf_802154_core_channel_update(void)
 
 bool nrf_802154_core_cca_cfg_update(void)
 {
-    bool result = critical_section_enter_and_verify_timeslot_length();
+    bool result = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
 
     if (result)
     {
@@ -3193,7 +3427,7 @@ bool nrf_802154_core_cca_cfg_update(void)
 
 bool nrf_802154_core_rssi_measure(void)
 {
-    bool result = critical_section_enter_and_verify_timeslot_length();
+    bool result = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
 
     if (result)
     {
@@ -3220,7 +3454,7 @@ bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi)
 
     if (rssi_started)
     {
-        in_crit_sect = critical_section_enter_and_verify_timeslot_length();
+        in_crit_sect = critical_section_verify_timeslot_length(nrf_802154_critical_section_enter());
     }
 
     if (rssi_started && in_crit_sect)
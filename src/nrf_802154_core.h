@@ -198,6 +198,17 @@ bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl);
  */
 bool nrf_802154_core_notify_buffer_free(uint8_t * p_data);
 
+/**
+ * @brief Notifies the core module that a higher layer freed several frame buffers at once.
+ *
+ * All buffers are marked as free before the receiver is restarted, so the receiver is restarted
+ * at most once regardless of the number of freed buffers.
+ *
+ * @param[in]  pp_data  Array of pointers to buffers that have been freed.
+ * @param[in]  count    Number of pointers in @p pp_data. Must be greater than 0.
+ */
+bool nrf_802154_core_notify_buffers_free(uint8_t * const * pp_data, uint8_t count);
+
 /**
  * @brief Notifies the core module that the next higher layer requested the change of the channel.
  *
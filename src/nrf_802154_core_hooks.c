@@ -44,6 +44,7 @@
 #include "mac_features/nrf_802154_ack_timeout.h"
 #include "mac_features/nrf_802154_csma_ca.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_rx_duty_cycle.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_types.h"
 
@@ -73,6 +74,10 @@ static const abort_hook m_abort_hooks[] =
     nrf_802154_delayed_trx_abort,
 #endif
 
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+    nrf_802154_rx_duty_cycle_abort,
+#endif
+
     NULL,
 };
 
@@ -100,6 +105,10 @@ static const tx_failed_hook m_tx_failed_hooks[] =
 
 static const tx_started_hook m_tx_started_hooks[] =
 {
+#if NRF_802154_DELAYED_TRX_ENABLED
+    nrf_802154_delayed_trx_tx_started_hook,
+#endif
+
 #if NRF_802154_CSMA_CA_ENABLED
     nrf_802154_csma_ca_tx_started_hook,
 #endif
@@ -117,6 +126,10 @@ static const rx_started_hook m_rx_started_hooks[] =
     nrf_802154_delayed_trx_rx_started_hook,
 #endif
 
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+    nrf_802154_rx_duty_cycle_rx_started_hook,
+#endif
+
     NULL,
 };
 
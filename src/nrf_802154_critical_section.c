@@ -38,6 +38,7 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
@@ -51,10 +52,149 @@
 
 #define NESTED_CRITICAL_SECTION_ALLOWED_PRIORITY_NONE (-1)
 
+#if defined(__GNUC__)
+#define CALLER_ADDRESS()                              __builtin_return_address(0)
+#else
+#define CALLER_ADDRESS()                              NULL
+#endif
+
 static volatile uint8_t m_critical_section_monitor;                 ///< Monitors each critical section enter operation
 static volatile uint8_t m_nested_critical_section_counter;          ///< Counter of nested critical sections
 static volatile int8_t  m_nested_critical_section_allowed_priority; ///< Indicator if nested critical sections are currently allowed
 
+#if NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+static nrf_802154_critical_section_stats_t m_stats;                 ///< Statistics of the hold times
+static uint32_t                            m_hold_start;            ///< Cycle counter value at the start of the current hold
+static const void                        * mp_hold_caller;          ///< Return address of the call that entered the current hold
+static uint32_t                            m_cycles_per_us;         ///< Number of CPU cycles in a microsecond
+#endif
+
+/***************************************************************************************************
+ * @section Hold time statistics
+ **************************************************************************************************/
+
+#if NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+
+/** @brief Start the cycle counter used to measure the hold times. */
+static void stats_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    m_cycles_per_us = SystemCoreClock / 1000000UL;
+
+    nrf_802154_critical_section_stats_reset();
+}
+
+/** @brief Mark the start of a hold of the critical section.
+ *
+ * @param[in]  p_caller  Return address of the call that entered the critical section.
+ */
+static void hold_start(const void * p_caller)
+{
+    mp_hold_caller = p_caller;
+    m_hold_start   = DWT->CYCCNT;
+}
+
+/** @brief Get the return address of the call that entered the current hold. */
+static const void * hold_caller_get(void)
+{
+    return mp_hold_caller;
+}
+
+/** @brief Mark the end of a hold of the critical section and account its time.
+ *
+ * @returns  Time of the hold, in microseconds.
+ */
+static uint32_t hold_end(void)
+{
+    uint32_t hold_time = (DWT->CYCCNT - m_hold_start) / m_cycles_per_us;
+    uint32_t bin       = 32 - __CLZ(hold_time);
+
+    if (bin >= NRF_802154_CRITICAL_SECTION_HIST_BINS)
+    {
+        bin = NRF_802154_CRITICAL_SECTION_HIST_BINS - 1;
+    }
+
+    m_stats.holds++;
+    m_stats.hold_sum += hold_time;
+    m_stats.hist[bin]++;
+
+    if (hold_time > m_stats.hold_max)
+    {
+        m_stats.hold_max          = hold_time;
+        m_stats.p_hold_max_caller = mp_hold_caller;
+    }
+
+#if NRF_802154_CRITICAL_SECTION_BUDGET
+    if (hold_time > NRF_802154_CRITICAL_SECTION_BUDGET)
+    {
+        m_stats.budget_exceeded++;
+    }
+#endif
+
+    return hold_time;
+}
+
+/** @brief Notify a hold longer than the budget. Called after the interrupts are unmasked.
+ *
+ * @param[in]  hold_time  Time of the hold, in microseconds.
+ * @param[in]  p_caller   Return address of the call that entered the hold.
+ */
+static void budget_check(uint32_t hold_time, const void * p_caller)
+{
+#if NRF_802154_CRITICAL_SECTION_BUDGET
+    if (hold_time > NRF_802154_CRITICAL_SECTION_BUDGET)
+    {
+        nrf_802154_critical_section_budget_exceeded(hold_time, p_caller);
+    }
+#else
+    (void)hold_time;
+    (void)p_caller;
+#endif
+}
+
+/** @brief Account a re-entry of the critical section during the exit procedure. */
+static void reentry_count(void)
+{
+    m_stats.reentries++;
+}
+
+#else // NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+
+static void stats_init(void)
+{
+    // Intentionally empty
+}
+
+static void hold_start(const void * p_caller)
+{
+    (void)p_caller;
+}
+
+static const void * hold_caller_get(void)
+{
+    return NULL;
+}
+
+static uint32_t hold_end(void)
+{
+    return 0;
+}
+
+static void budget_check(uint32_t hold_time, const void * p_caller)
+{
+    (void)hold_time;
+    (void)p_caller;
+}
+
+static void reentry_count(void)
+{
+    // Intentionally empty
+}
+
+#endif // NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+
 /***************************************************************************************************
  * @section Critical sections management
  **************************************************************************************************/
@@ -107,7 +247,7 @@ static bool nested_critical_section_is_allowed_in_this_context(void)
            active_priority_convert(nrf_802154_critical_section_active_vector_priority_get());
 }
 
-static bool critical_section_enter(bool forced)
+static bool critical_section_enter(bool forced, const void * p_caller)
 {
     bool    result = false;
     uint8_t cnt;
@@ -130,6 +270,11 @@ static bool critical_section_enter(bool forced)
         __DSB();
         __ISB();
 
+        if (cnt == 0)
+        {
+            hold_start(p_caller);
+        }
+
         m_critical_section_monitor++;
 
         result = true;
@@ -140,11 +285,13 @@ static bool critical_section_enter(bool forced)
 
 static void critical_section_exit(void)
 {
-    uint8_t     cnt = m_nested_critical_section_counter;
-    uint8_t     monitor;
-    uint8_t     atomic_cnt;
-    static bool exiting_crit_sect;
-    bool        result;
+    uint8_t      cnt           = m_nested_critical_section_counter;
+    uint32_t     hold_time     = 0;
+    const void * p_hold_caller = NULL;
+    uint8_t      monitor;
+    uint8_t      atomic_cnt;
+    static bool  exiting_crit_sect;
+    bool         result;
 
     assert(cnt > 0);
 
@@ -159,6 +306,9 @@ static void critical_section_exit(void)
             (void)exiting_crit_sect;
             exiting_crit_sect = true;
 
+            p_hold_caller = hold_caller_get();
+            hold_time     = hold_end();
+
             nrf_802154_critical_section_rsch_exit();
             radio_critical_section_exit();
             nrf_802154_lp_timer_critical_section_exit();
@@ -177,11 +327,15 @@ static void critical_section_exit(void)
         // change of state or critical section was visited by higher priority IRQ meantime.
         if (cnt == 1)
         {
+            budget_check(hold_time, p_hold_caller);
+
             // Check if critical section must be exited again.
             if (nrf_802154_critical_section_rsch_event_is_pending() ||
                 (monitor != m_critical_section_monitor))
             {
-                result = critical_section_enter(false);
+                reentry_count();
+
+                result = critical_section_enter(false, hold_caller_get());
                 assert(result);
                 (void)result;
 
@@ -204,6 +358,8 @@ void nrf_802154_critical_section_init(void)
 {
     m_nested_critical_section_counter          = 0;
     m_nested_critical_section_allowed_priority = NESTED_CRITICAL_SECTION_ALLOWED_PRIORITY_NONE;
+
+    stats_init();
 }
 
 bool nrf_802154_critical_section_enter(void)
@@ -212,7 +368,7 @@ bool nrf_802154_critical_section_enter(void)
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CRIT_SECT_ENTER);
 
-    result = critical_section_enter(false);
+    result = critical_section_enter(false, CALLER_ADDRESS());
 
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_CRIT_SECT_ENTER);
 
@@ -225,7 +381,7 @@ void nrf_802154_critical_section_forcefully_enter(void)
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_CRIT_SECT_ENTER);
 
-    critical_section_entered = critical_section_enter(true);
+    critical_section_entered = critical_section_enter(true, CALLER_ADDRESS());
     assert(critical_section_entered);
     (void)critical_section_entered;
 
@@ -283,3 +439,17 @@ uint32_t nrf_802154_critical_section_active_vector_priority_get(void)
 
     return active_priority;
 }
+
+#if NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+
+void nrf_802154_critical_section_stats_get(nrf_802154_critical_section_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+}
+
+void nrf_802154_critical_section_stats_reset(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+#endif // NRF_802154_CRITICAL_SECTION_STATS_ENABLED
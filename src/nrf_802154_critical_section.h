@@ -34,6 +34,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -102,6 +104,64 @@ bool nrf_802154_critical_section_is_nested(void);
  */
 uint32_t nrf_802154_critical_section_active_vector_priority_get(void);
 
+#if NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+
+/**
+ * @brief Number of bins in the histogram of the critical section hold times.
+ *
+ * Bin 0 counts the holds shorter than 1 us, bin n counts the holds from 2^(n-1) us to 2^n us, and
+ * the last bin counts also all longer holds.
+ */
+#define NRF_802154_CRITICAL_SECTION_HIST_BINS 12
+
+/**
+ * @brief Statistics of the critical section hold times.
+ *
+ * A hold starts when the outermost critical section masks the interrupts and ends when it starts
+ * to unmask them. If the critical section is re-entered during the exit procedure, the re-entry is
+ * counted and the masked time after it is measured as a separate hold.
+ */
+typedef struct
+{
+    uint32_t     holds;                                        ///< Number of the holds.
+    uint32_t     reentries;                                    ///< Number of the re-entries during the exit procedure.
+    uint32_t     budget_exceeded;                              ///< Number of the holds longer than @ref NRF_802154_CRITICAL_SECTION_BUDGET.
+    uint64_t     hold_sum;                                     ///< Sum of the hold times, in microseconds.
+    uint32_t     hold_max;                                     ///< Longest hold time, in microseconds.
+    const void * p_hold_max_caller;                            ///< Return address of the call that entered the longest hold.
+    uint32_t     hist[NRF_802154_CRITICAL_SECTION_HIST_BINS]; ///< Histogram of the hold times.
+} nrf_802154_critical_section_stats_t;
+
+/**
+ * @brief Gets the statistics of the critical section hold times.
+ *
+ * @param[out]  p_stats  Structure to be filled with the statistics.
+ */
+void nrf_802154_critical_section_stats_get(nrf_802154_critical_section_stats_t * p_stats);
+
+/**
+ * @brief Resets the statistics of the critical section hold times.
+ */
+void nrf_802154_critical_section_stats_reset(void);
+
+#if NRF_802154_CRITICAL_SECTION_BUDGET
+
+/**
+ * @brief Notifies that the critical section was held longer than
+ *        @ref NRF_802154_CRITICAL_SECTION_BUDGET.
+ *
+ * This function is called after the radio interrupts are unmasked, in the context that exited
+ * the critical section. It may be preempted by the driver, so it must not rely on the driver state.
+ *
+ * @param[in]  hold_time  Time for which the critical section was held, in microseconds.
+ * @param[in]  p_caller   Return address of the call that entered the critical section.
+ */
+extern void nrf_802154_critical_section_budget_exceeded(uint32_t hold_time, const void * p_caller);
+
+#endif // NRF_802154_CRITICAL_SECTION_BUDGET
+
+#endif // NRF_802154_CRITICAL_SECTION_STATS_ENABLED
+
 /**
  * @brief Function for entering a critical section in the RSCH module.
  */
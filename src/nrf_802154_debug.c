@@ -37,6 +37,7 @@
 #include "nrf_802154_debug.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "nrf.h"
 #include "nrf_gpio.h"
@@ -51,6 +52,120 @@ volatile uint32_t nrf_802154_debug_log_ptr = 0;
 
 #endif
 
+#if ENABLE_DEBUG_TRACE
+
+#if (NRF_802154_DEBUG_TRACE_BUFFER_LEN & (NRF_802154_DEBUG_TRACE_BUFFER_LEN - 1)) != 0
+#error NRF_802154_DEBUG_TRACE_BUFFER_LEN must be a power of two.
+#endif
+
+/// Buffer used to store timestamped trace entries.
+volatile nrf_802154_debug_trace_t nrf_802154_debug_trace =
+{
+    .magic = NRF_802154_DEBUG_TRACE_MAGIC,
+    .len   = NRF_802154_DEBUG_TRACE_BUFFER_LEN,
+};
+
+/**
+ * @brief Start the cycle counter used to timestamp the trace entries.
+ */
+static void trace_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    nrf_802154_debug_trace.clock = SystemCoreClock;
+}
+
+void nrf_802154_debug_trace_put(uint32_t data)
+{
+    volatile nrf_802154_debug_trace_entry_t * p_entry;
+    uint32_t                                  idx;
+    uint32_t                                  time;
+
+    // The timestamp is taken inside the exclusive access, so that an entry written by
+    // a preempting context never has an earlier index and a later timestamp.
+    do
+    {
+        idx  = __LDREXW(&nrf_802154_debug_trace.w_idx);
+        time = DWT->CYCCNT;
+    }
+    while (__STREXW(idx + 1, &nrf_802154_debug_trace.w_idx));
+
+    p_entry       = &nrf_802154_debug_trace.entries[idx & (NRF_802154_DEBUG_TRACE_BUFFER_LEN - 1)];
+    p_entry->time = time;
+    p_entry->data = data;
+}
+
+#endif // ENABLE_DEBUG_TRACE
+
+#if ENABLE_DEBUG_PROFILE
+
+/// Statistics of the profiling probes.
+volatile nrf_802154_debug_profile_t nrf_802154_debug_profile =
+{
+    .magic      = NRF_802154_DEBUG_PROFILE_MAGIC,
+    .probes_num = PROFILE_PROBES_NUM,
+};
+
+/**
+ * @brief Start the profiling clock and measure the overhead of a probe.
+ */
+static void profile_init(void)
+{
+#if defined(__unix__)
+    nrf_802154_debug_profile.clock = 1000000000UL;
+#else
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    nrf_802154_debug_profile.clock = SystemCoreClock;
+#endif
+
+    uint32_t start = nrf_802154_debug_profile_time_get();
+
+    nrf_802154_debug_profile.overhead = nrf_802154_debug_profile_time_get() - start;
+
+    nrf_802154_debug_profile_reset();
+}
+
+void nrf_802154_debug_profile_put(uint32_t probe, uint32_t duration)
+{
+    volatile nrf_802154_debug_profile_probe_t * p_probe = &nrf_802154_debug_profile.probes[probe];
+    uint32_t                                    primask = __get_PRIMASK();
+
+    // Probes are updated from interrupt handlers of different priorities.
+    __disable_irq();
+
+    if ((p_probe->count == 0) || (duration < p_probe->min))
+    {
+        p_probe->min = duration;
+    }
+
+    if (duration > p_probe->max)
+    {
+        p_probe->max = duration;
+    }
+
+    p_probe->sum  += duration;
+    p_probe->last  = duration;
+    p_probe->count++;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_debug_profile_reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    memset((void *)nrf_802154_debug_profile.probes, 0, sizeof(nrf_802154_debug_profile.probes));
+
+    __set_PRIMASK(primask);
+}
+
+#endif // ENABLE_DEBUG_PROFILE
+
 #if ENABLE_DEBUG_GPIO
 /**
  * @brief Initialize PPI to toggle GPIO pins on radio events.
@@ -128,6 +243,14 @@ static void raal_simulator_gpio_init(void)
 
 void nrf_802154_debug_init(void)
 {
+#if ENABLE_DEBUG_TRACE
+    trace_init();
+#endif // ENABLE_DEBUG_TRACE
+
+#if ENABLE_DEBUG_PROFILE
+    profile_init();
+#endif // ENABLE_DEBUG_PROFILE
+
 #if ENABLE_DEBUG_GPIO
     radio_event_gpio_toggle_init();
     raal_simulator_gpio_init();
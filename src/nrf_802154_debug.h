@@ -59,6 +59,10 @@ extern "C" {
 #define FUNCTION_RECEIVE_AT         0x000AUL
 #define FUNCTION_TRANSMIT_AT_CANCEL 0x000BUL
 #define FUNCTION_RECEIVE_AT_CANCEL  0x000CUL
+#define FUNCTION_RECEIVE_CSL        0x000DUL
+#define FUNCTION_RECEIVE_CSL_STOP   0x000EUL
+#define FUNCTION_RECEIVE_DC         0x000FUL
+#define FUNCTION_RECEIVE_DC_STOP    0x0010UL
 
 #define FUNCTION_IRQ_HANDLER        0x0100UL
 #define FUNCTION_EVENT_FRAMESTART   0x0101UL
@@ -111,6 +115,8 @@ extern "C" {
 
 #define FUNCTION_ACK_TIMEOUT_FIRED                 0x0900UL
 
+#define FUNCTION_RXDC_WINDOW_CLOSE                 0x0A00UL
+
 #define FUNCTION_mutex_trylock                     0x1000UL
 #define FUNCTION_mutex_unlock                      0x1001UL
 #define FUNCTION_max_prio_for_delayed_timeslot_get 0x1002UL
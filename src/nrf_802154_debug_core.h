@@ -44,6 +44,14 @@ extern "C" {
 
 #define NRF_802154_DEBUG_LOG_BUFFER_LEN 1024
 
+#ifndef NRF_802154_DEBUG_TRACE_BUFFER_LEN
+#define NRF_802154_DEBUG_TRACE_BUFFER_LEN 1024 // Must be a power of two
+#endif
+
+#define NRF_802154_DEBUG_TRACE_MAGIC    0x4352544EUL // "NTRC"
+
+#define NRF_802154_DEBUG_PROFILE_MAGIC  0x464F5250UL // "PROF"
+
 #define EVENT_TRACE_ENTER               0x0001UL
 #define EVENT_TRACE_EXIT                0x0002UL
 
@@ -62,7 +70,48 @@ extern "C" {
 #endif
 
 #ifndef CU_TEST
-#if ENABLE_DEBUG_LOG
+#if ENABLE_DEBUG_TRACE
+
+/**
+ * @brief Entry of the trace buffer.
+ */
+typedef struct
+{
+    uint32_t time; ///< Value of the DWT cycle counter when the entry was written.
+    uint32_t data; ///< Event code in bits 0-15 and the event argument in bits 16-31.
+} nrf_802154_debug_trace_entry_t;
+
+/**
+ * @brief Trace buffer.
+ *
+ * The header fields let the host decoder interpret a RAM dump of the whole structure without
+ * access to the firmware image.
+ */
+typedef struct
+{
+    uint32_t                       magic;                                     ///< Equal to @ref NRF_802154_DEBUG_TRACE_MAGIC.
+    uint32_t                       len;                                       ///< Number of entries in the buffer.
+    uint32_t                       clock;                                     ///< Frequency of the cycle counter, in Hz.
+    uint32_t                       w_idx;                                     ///< Free-running index of the next entry to be written.
+    nrf_802154_debug_trace_entry_t entries[NRF_802154_DEBUG_TRACE_BUFFER_LEN]; ///< Entries.
+} nrf_802154_debug_trace_t;
+
+extern volatile nrf_802154_debug_trace_t nrf_802154_debug_trace;
+
+/**
+ * @brief Writes an entry into the trace buffer.
+ *
+ * This function can be called from any priority. The entries are written in the order of their
+ * timestamps.
+ *
+ * @param[in]  data  Event code in bits 0-15 and the event argument in bits 16-31.
+ */
+void nrf_802154_debug_trace_put(uint32_t data);
+
+#define nrf_802154_log(EVENT_CODE, EVENT_ARG) \
+    nrf_802154_debug_trace_put((EVENT_CODE) | ((EVENT_ARG) << 16))
+
+#elif ENABLE_DEBUG_LOG
 extern volatile uint32_t nrf_802154_debug_log_buffer[
     NRF_802154_DEBUG_LOG_BUFFER_LEN];
 extern volatile uint32_t nrf_802154_debug_log_ptr;
@@ -78,11 +127,11 @@ extern volatile uint32_t nrf_802154_debug_log_ptr;
     }                                                                            \
     while (0)
 
-#else // ENABLE_DEBUG_LOG
+#else // ENABLE_DEBUG_TRACE
 
 #define nrf_802154_log(EVENT_CODE, EVENT_ARG) (void)(EVENT_ARG)
 
-#endif // ENABLE_DEBUG_LOG
+#endif // ENABLE_DEBUG_TRACE
 
 #define nrf_802154_log_entry(function, verbosity)                     \
     do                                                                \
@@ -110,6 +159,101 @@ extern volatile uint32_t nrf_802154_debug_log_ptr;
 
 #endif
 
+#define PROFILE_IRQ_BCMATCH_STATE_RX    0UL
+#define PROFILE_IRQ_CRCOK_STATE_RX      1UL
+#define PROFILE_ACK_GENERATOR_CREATE    2UL
+#define PROFILE_FILTER_FRAME_PART       3UL
+#define PROFILE_RSCH_TIMESLOT_REQUEST   4UL
+#define PROFILE_PROBES_NUM              5UL
+
+#if ENABLE_DEBUG_PROFILE && !defined(CU_TEST)
+
+#if defined(__unix__)
+#include <time.h>
+#else
+#include "nrf.h"
+#endif
+
+/**
+ * @brief Statistics of a single profiling probe.
+ *
+ * The durations are expressed in ticks of the profiling clock.
+ */
+typedef struct
+{
+    uint64_t sum;   ///< Sum of the measured durations.
+    uint32_t count; ///< Number of the measurements.
+    uint32_t min;   ///< Shortest measured duration.
+    uint32_t max;   ///< Longest measured duration.
+    uint32_t last;  ///< Last measured duration.
+} nrf_802154_debug_profile_probe_t;
+
+/**
+ * @brief Profiling statistics.
+ *
+ * The header fields let the host decoder interpret a RAM dump of the whole structure without
+ * access to the firmware image.
+ */
+typedef struct
+{
+    uint32_t                         magic;                      ///< Equal to @ref NRF_802154_DEBUG_PROFILE_MAGIC.
+    uint32_t                         clock;                      ///< Frequency of the profiling clock, in Hz.
+    uint32_t                         probes_num;                 ///< Number of the probes.
+    uint32_t                         overhead;                   ///< Duration measured by an empty probe, included in every measurement.
+    nrf_802154_debug_profile_probe_t probes[PROFILE_PROBES_NUM]; ///< Statistics of the probes.
+} nrf_802154_debug_profile_t;
+
+extern volatile nrf_802154_debug_profile_t nrf_802154_debug_profile;
+
+/**
+ * @brief Reads the profiling clock.
+ *
+ * On the target, the DWT cycle counter is used. In a host build, the monotonic clock of the
+ * operating system is used, with a resolution of one nanosecond.
+ */
+static inline uint32_t nrf_802154_debug_profile_time_get(void)
+{
+#if defined(__unix__)
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/**
+ * @brief Adds a measurement to the statistics of a profiling probe.
+ *
+ * This function can be called from any priority.
+ *
+ * @param[in]  probe     Probe ID, one of the PROFILE_ values.
+ * @param[in]  duration  Measured duration, in ticks of the profiling clock.
+ */
+void nrf_802154_debug_profile_put(uint32_t probe, uint32_t duration);
+
+/**
+ * @brief Clears the statistics of all profiling probes.
+ */
+void nrf_802154_debug_profile_reset(void);
+
+#define nrf_802154_profile_begin(probe) \
+    uint32_t profile_start_ ## probe = nrf_802154_debug_profile_time_get()
+
+#define nrf_802154_profile_end(probe)                                  \
+    nrf_802154_debug_profile_put(PROFILE_ ## probe,                    \
+                                 nrf_802154_debug_profile_time_get() - \
+                                 profile_start_ ## probe)
+
+#else // ENABLE_DEBUG_PROFILE && !defined(CU_TEST)
+
+#define nrf_802154_profile_begin(probe)
+#define nrf_802154_profile_end(probe)
+
+#endif // ENABLE_DEBUG_PROFILE && !defined(CU_TEST)
+
 #if ENABLE_DEBUG_GPIO
 
 #define nrf_802154_pin_set(pin) NRF_P0->OUTSET = (1UL << (pin))
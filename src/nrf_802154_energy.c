@@ -0,0 +1,203 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the estimator of the charge drawn by the radio subsystem.
+ *
+ */
+
+#include "nrf_802154_energy.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_state_time.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_ENERGY_STATS_ENABLED
+
+#if !NRF_802154_STATE_TIME_STATS_ENABLED
+#error "NRF_802154_ENERGY_STATS_ENABLED requires NRF_802154_STATE_TIME_STATS_ENABLED"
+#endif
+
+/** @brief Activity of the RADIO peripheral. */
+typedef enum
+{
+    RADIO_ACTIVITY_OFF,
+    RADIO_ACTIVITY_RX,
+    RADIO_ACTIVITY_TX,
+} radio_activity_t;
+
+/** @brief Entry of the transmit current table. */
+typedef struct
+{
+    int8_t   power;   ///< Transmit power, in dBm.
+    uint32_t current; ///< Current drawn at @c power, in microamperes.
+} tx_current_t;
+
+static const tx_current_t m_tx_currents[] = NRF_802154_ENERGY_CURRENT_TX_TABLE;
+
+static nrf_802154_energy_stats_t m_stats;      ///< Accumulated estimate.
+static uint32_t                  m_tx_current; ///< Current drawn when transmitting at the power set at the start of the accounted period.
+
+/**
+ * @brief Get the activity of the RADIO peripheral in the given state.
+ *
+ * @param[in]  state    State of the driver.
+ * @param[in]  granted  If the radio timeslot is granted.
+ *
+ * @returns  Activity of the RADIO peripheral.
+ */
+static radio_activity_t radio_activity_get(radio_state_t state, bool granted)
+{
+    if (!granted)
+    {
+        return RADIO_ACTIVITY_OFF;
+    }
+
+    switch (state)
+    {
+        case RADIO_STATE_RX:
+        case RADIO_STATE_RX_ACK:
+        case RADIO_STATE_ED:
+        case RADIO_STATE_CCA:
+            return RADIO_ACTIVITY_RX;
+
+        case RADIO_STATE_TX_ACK:
+        case RADIO_STATE_CCA_TX:
+        case RADIO_STATE_TX:
+        case RADIO_STATE_CONTINUOUS_CARRIER:
+            return RADIO_ACTIVITY_TX;
+
+        default:
+            return RADIO_ACTIVITY_OFF;
+    }
+}
+
+/**
+ * @brief Get the current drawn when transmitting at the power set in the PIB.
+ *
+ * @returns  Current in microamperes.
+ */
+static uint32_t tx_current_get(void)
+{
+    int8_t power = (int8_t)nrf_802154_pib_tx_power_get();
+
+    for (uint32_t i = 0; i < NUMELTS(m_tx_currents); i++)
+    {
+        if (m_tx_currents[i].power >= power)
+        {
+            return m_tx_currents[i].current;
+        }
+    }
+
+    return m_tx_currents[NUMELTS(m_tx_currents) - 1].current;
+}
+
+void nrf_802154_energy_init(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    m_tx_current = tx_current_get();
+}
+
+void nrf_802154_energy_account(radio_state_t state, bool granted, bool hfclk, uint64_t elapsed)
+{
+    uint64_t charge;
+
+    m_stats.time += elapsed;
+
+    switch (radio_activity_get(state, granted))
+    {
+        case RADIO_ACTIVITY_RX:
+            charge             = elapsed * (NRF_802154_ENERGY_CURRENT_RX +
+                                            NRF_802154_ENERGY_CURRENT_FEM_LNA);
+            m_stats.rx_time   += elapsed;
+            m_stats.rx_charge += charge;
+            m_stats.charge    += charge;
+            break;
+
+        case RADIO_ACTIVITY_TX:
+            charge             = elapsed * (m_tx_current + NRF_802154_ENERGY_CURRENT_FEM_PA);
+            m_stats.tx_time   += elapsed;
+            m_stats.tx_charge += charge;
+            m_stats.charge    += charge;
+            break;
+
+        default:
+            break;
+    }
+
+    if (hfclk)
+    {
+        charge                = elapsed * NRF_802154_ENERGY_CURRENT_HFCLK;
+        m_stats.hfclk_time   += elapsed;
+        m_stats.hfclk_charge += charge;
+        m_stats.charge       += charge;
+    }
+
+    // The transmit power is applied by the core when a transmission starts, so the power set now
+    // is used for the next period.
+    m_tx_current = tx_current_get();
+}
+
+void nrf_802154_energy_get(nrf_802154_energy_stats_t * p_stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    nrf_802154_state_time_update();
+    *p_stats = m_stats;
+
+    __set_PRIMASK(primask);
+
+    p_stats->average_current = (p_stats->time != 0) ?
+                               (uint32_t)(p_stats->charge / p_stats->time) : 0;
+}
+
+void nrf_802154_energy_reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    nrf_802154_state_time_update();
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    __set_PRIMASK(primask);
+}
+
+#endif // NRF_802154_ENERGY_STATS_ENABLED
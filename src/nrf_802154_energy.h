@@ -0,0 +1,104 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that estimates the charge drawn by the radio subsystem of the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_ENERGY_H__
+#define NRF_802154_ENERGY_H__
+
+#include <stdbool.h>
+
+#include "nrf_802154_core.h"
+#include "nrf_802154_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_energy 802.15.4 driver energy estimator
+ * @{
+ * @ingroup nrf_802154
+ * @brief Estimate of the charge drawn by the radio subsystem.
+ *
+ * The current drawn at a time is the sum of the currents of the active components: the RADIO
+ * peripheral receiving or transmitting at the current transmit power, the Front-End Module LNA or
+ * PA, and the high-frequency clock. The charge is accumulated at every change of the current, so
+ * reading the estimate does not require any computation over the history.
+ *
+ * The Front-End Module is switched by the hardware together with the RADIO peripheral, so its
+ * LNA and PA are accounted during the receive and transmit time.
+ *
+ * The estimator does not track the driver by itself. The state time accounting module
+ * (@ref nrf_802154_state_time) passes every accounted period to @ref nrf_802154_energy_account
+ * together with the state of the driver, the radio timeslot, and the high-frequency clock.
+ */
+
+/**
+ * @brief Initializes the energy estimator.
+ */
+void nrf_802154_energy_init(void);
+
+/**
+ * @brief Accounts the charge drawn during a period of time.
+ *
+ * @note This function is called by the state time accounting module with interrupts disabled.
+ *
+ * @param[in]  state    State of the driver during the period.
+ * @param[in]  granted  If the radio timeslot was granted during the period.
+ * @param[in]  hfclk    If the high-frequency clock was running during the period.
+ * @param[in]  elapsed  Length of the period, in microseconds.
+ */
+void nrf_802154_energy_account(radio_state_t state, bool granted, bool hfclk, uint64_t elapsed);
+
+/**
+ * @brief Gets the estimate, including the charge drawn in the current state so far.
+ *
+ * @param[out]  p_stats  Structure to be filled with the estimate.
+ */
+void nrf_802154_energy_get(nrf_802154_energy_stats_t * p_stats);
+
+/**
+ * @brief Resets the estimate.
+ */
+void nrf_802154_energy_reset(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_ENERGY_H__
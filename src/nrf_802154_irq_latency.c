@@ -0,0 +1,264 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the measurement of the latency of the RADIO IRQ handler.
+ *
+ */
+
+#include "nrf_802154_irq_latency.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "nrf_802154_config.h"
+#include "nrf_ppi.h"
+#include "nrf_radio.h"
+#include "platform/hp_timer/nrf_802154_hp_timer.h"
+
+#if NRF_802154_IRQ_LATENCY_STATS_ENABLED
+
+#if !NRF_802154_FRAME_TIMESTAMP_ENABLED
+#error "NRF_802154_IRQ_LATENCY_STATS_ENABLED requires NRF_802154_FRAME_TIMESTAMP_ENABLED"
+#endif
+
+#if RAAL_SIMULATOR
+#error "NRF_802154_IRQ_LATENCY_STATS_ENABLED cannot be used with RAAL_SIMULATOR"
+#endif
+
+// The compare channel 0 of the High Precision Timer is used by the RAAL of the timeslot API.
+#if RAAL_SOFTDEVICE || RAAL_REM
+#error "NRF_802154_IRQ_LATENCY_STATS_ENABLED cannot be used with RAAL_SOFTDEVICE or RAAL_REM"
+#endif
+
+#define PPI_LATENCY NRF_802154_IRQ_LATENCY_PPI_CHANNEL ///< PPI that connects the armed RADIO event with the HP timer capture task.
+
+static nrf_802154_irq_latency_stats_t m_stats; ///< Latency statistics.
+static nrf_802154_irq_latency_event_t m_armed; ///< Event whose time is captured.
+
+/**
+ * @brief Get the RADIO event corresponding to the measured event.
+ *
+ * @param[in]  event  Measured event.
+ *
+ * @returns  RADIO event.
+ */
+static nrf_radio_event_t radio_event_get(nrf_802154_irq_latency_event_t event)
+{
+    switch (event)
+    {
+        case NRF_802154_IRQ_LATENCY_EVENT_FRAMESTART:
+            return NRF_RADIO_EVENT_ADDRESS;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_BCMATCH:
+            return NRF_RADIO_EVENT_BCMATCH;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_CRCOK:
+            return NRF_RADIO_EVENT_CRCOK;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_PHYEND:
+            return NRF_RADIO_EVENT_PHYEND;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_END:
+            return NRF_RADIO_EVENT_END;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_DISABLED:
+            return NRF_RADIO_EVENT_DISABLED;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_CCAIDLE:
+            return NRF_RADIO_EVENT_CCAIDLE;
+
+        default:
+            assert(false);
+            return NRF_RADIO_EVENT_END;
+    }
+}
+
+/**
+ * @brief Get the statistics entry of the measured event.
+ *
+ * @param[in]  event  Measured event.
+ *
+ * @returns  Pointer to the statistics entry.
+ */
+static nrf_802154_irq_latency_t * entry_get(nrf_802154_irq_latency_event_t event)
+{
+    switch (event)
+    {
+        case NRF_802154_IRQ_LATENCY_EVENT_FRAMESTART:
+            return &m_stats.framestart;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_BCMATCH:
+            return &m_stats.bcmatch;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_CRCOK:
+            return &m_stats.crcok;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_PHYEND:
+            return &m_stats.phyend;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_END:
+            return &m_stats.end;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_DISABLED:
+            return &m_stats.disabled;
+
+        case NRF_802154_IRQ_LATENCY_EVENT_CCAIDLE:
+            return &m_stats.ccaidle;
+
+        default:
+            assert(false);
+            return &m_stats.framestart;
+    }
+}
+
+/**
+ * @brief Account a measured latency.
+ *
+ * @note This function must be called with interrupts disabled.
+ *
+ * @param[in]  event    Measured event.
+ * @param[in]  latency  Latency of the event, in microseconds.
+ */
+static void latency_account(nrf_802154_irq_latency_event_t event, uint32_t latency)
+{
+    nrf_802154_irq_latency_t * p_entry = entry_get(event);
+    uint32_t                   bin     = 32 - __CLZ(latency);
+
+    if (bin >= NRF_802154_IRQ_LATENCY_HIST_BINS)
+    {
+        bin = NRF_802154_IRQ_LATENCY_HIST_BINS - 1;
+    }
+
+    p_entry->count++;
+    p_entry->sum += latency;
+    p_entry->hist[bin]++;
+
+    if (latency > p_entry->max)
+    {
+        p_entry->max = latency;
+    }
+}
+
+void nrf_802154_irq_latency_init(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    m_armed = NRF_802154_IRQ_LATENCY_EVENT_NONE;
+
+    nrf_ppi_channel_disable(PPI_LATENCY);
+    nrf_ppi_channel_endpoint_setup(PPI_LATENCY, 0, 0);
+}
+
+void nrf_802154_irq_latency_deinit(void)
+{
+    m_armed = NRF_802154_IRQ_LATENCY_EVENT_NONE;
+
+    nrf_ppi_channel_disable(PPI_LATENCY);
+    nrf_ppi_channel_endpoint_setup(PPI_LATENCY, 0, 0);
+}
+
+void nrf_802154_irq_latency_arm(nrf_802154_irq_latency_event_t event)
+{
+    if (event == m_armed)
+    {
+        return;
+    }
+
+    nrf_ppi_channel_disable(PPI_LATENCY);
+
+    m_armed = event;
+
+    if (event != NRF_802154_IRQ_LATENCY_EVENT_NONE)
+    {
+        nrf_ppi_channel_endpoint_setup(
+            PPI_LATENCY,
+            (uint32_t)nrf_radio_event_address_get(radio_event_get(event)),
+            nrf_802154_hp_timer_latency_task_get());
+
+        nrf_802154_hp_timer_latency_prepare();
+        nrf_ppi_channel_enable(PPI_LATENCY);
+    }
+}
+
+void nrf_802154_irq_latency_measure(nrf_802154_irq_latency_event_t event)
+{
+    uint32_t now;
+    uint32_t event_time;
+
+    if (event != m_armed)
+    {
+        return;
+    }
+
+    now = nrf_802154_hp_timer_current_time_get();
+
+    if (nrf_802154_hp_timer_latency_time_get(&event_time))
+    {
+        uint32_t primask = __get_PRIMASK();
+
+        __disable_irq();
+
+        latency_account(event, now - event_time);
+
+        __set_PRIMASK(primask);
+    }
+
+    // Detect the next occurrence of the event.
+    nrf_802154_hp_timer_latency_prepare();
+}
+
+void nrf_802154_irq_latency_get(nrf_802154_irq_latency_stats_t * p_stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    *p_stats = m_stats;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_irq_latency_reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    __set_PRIMASK(primask);
+}
+
+#endif // NRF_802154_IRQ_LATENCY_STATS_ENABLED
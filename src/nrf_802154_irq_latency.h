@@ -0,0 +1,118 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that measures the latency of the RADIO IRQ handler.
+ *
+ */
+
+#ifndef NRF_802154_IRQ_LATENCY_H__
+#define NRF_802154_IRQ_LATENCY_H__
+
+#include "nrf_802154_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_irq_latency 802.15.4 driver RADIO IRQ latency measurement
+ * @{
+ * @ingroup nrf_802154
+ * @brief Measurement of the time between a RADIO event and its processing by the IRQ handler.
+ *
+ * A single PPI channel captures the time of the RADIO event the core is waiting for in its
+ * current state. The core arms the channel with that event, and reports the start of the
+ * processing of each RADIO event. The latency is measured only if the reported event is the
+ * armed one and its time was captured.
+ */
+
+/**
+ * @brief RADIO events whose latency can be measured.
+ */
+typedef enum
+{
+    NRF_802154_IRQ_LATENCY_EVENT_NONE,       ///< No event is measured.
+    NRF_802154_IRQ_LATENCY_EVENT_FRAMESTART, ///< FRAMESTART (ADDRESS) event.
+    NRF_802154_IRQ_LATENCY_EVENT_BCMATCH,    ///< BCMATCH event.
+    NRF_802154_IRQ_LATENCY_EVENT_CRCOK,      ///< CRCOK event.
+    NRF_802154_IRQ_LATENCY_EVENT_PHYEND,     ///< PHYEND event.
+    NRF_802154_IRQ_LATENCY_EVENT_END,        ///< END event.
+    NRF_802154_IRQ_LATENCY_EVENT_DISABLED,   ///< DISABLED event.
+    NRF_802154_IRQ_LATENCY_EVENT_CCAIDLE,    ///< CCAIDLE event.
+} nrf_802154_irq_latency_event_t;
+
+/**
+ * @brief Initializes the IRQ latency measurement module.
+ */
+void nrf_802154_irq_latency_init(void);
+
+/**
+ * @brief Deinitializes the IRQ latency measurement module.
+ */
+void nrf_802154_irq_latency_deinit(void);
+
+/**
+ * @brief Selects the RADIO event whose time is to be captured.
+ *
+ * If @p event is already armed, the time captured so far is kept.
+ *
+ * @param[in]  event  Event the core is waiting for, or @ref NRF_802154_IRQ_LATENCY_EVENT_NONE.
+ */
+void nrf_802154_irq_latency_arm(nrf_802154_irq_latency_event_t event);
+
+/**
+ * @brief Notifies the module that the IRQ handler starts processing a RADIO event.
+ *
+ * @param[in]  event  Event being processed.
+ */
+void nrf_802154_irq_latency_measure(nrf_802154_irq_latency_event_t event);
+
+/**
+ * @brief Gets the latency statistics.
+ *
+ * @param[out]  p_stats  Structure to be filled with the statistics.
+ */
+void nrf_802154_irq_latency_get(nrf_802154_irq_latency_stats_t * p_stats);
+
+/**
+ * @brief Resets the latency statistics.
+ */
+void nrf_802154_irq_latency_reset(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_IRQ_LATENCY_H__
@@ -129,6 +129,18 @@ void nrf_802154_notify_cca(bool is_free);
  */
 void nrf_802154_notify_cca_failed(nrf_802154_cca_error_t error);
 
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+/**
+ * @brief Notifies the next higher layer that a receive window of the duty-cycled reception ended.
+ *
+ * @param[in]  p_stats  Pointer to the statistics of the window that has ended. The statistics are
+ *                      copied, so the pointer does not need to be valid after the function returns.
+ */
+void nrf_802154_notify_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats);
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
+
 /**
  *@}
  **/
@@ -0,0 +1,479 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements notifications written into a ring drained by the higher layer thread.
+ *
+ * The ring has a single consumer, which is the context calling
+ * @ref nrf_802154_notification_ring_drain. The notifications are produced by the RADIO IRQ handler
+ * and by the contexts calling the driver API directly, so the producers are serialized with
+ * a short interrupt-disabled section, while the consumer never blocks the producers.
+ *
+ */
+
+#include "nrf_802154_notification.h"
+#include "nrf_802154_notification_ring.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf.h"
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+
+#define RING_SIZE          NRF_802154_NOTIFICATION_RING_SIZE ///< Number of slots in the ring.
+#define RING_MASK          (RING_SIZE - 1)                   ///< Mask converting index into slot number.
+
+#if (RING_SIZE & RING_MASK) != 0
+#error NRF_802154_NOTIFICATION_RING_SIZE must be a power of two.
+#endif
+
+#if RING_SIZE < (NRF_802154_RX_BUFFERS + 3)
+#error NRF_802154_NOTIFICATION_RING_SIZE must be greater than NRF_802154_RX_BUFFERS + 2.
+#endif
+
+#define RING_RESERVED      (NRF_802154_RX_BUFFERS + 2)       ///< Number of slots reserved for the notifications which cannot be dropped.
+
+#define RAW_LENGTH_OFFSET  0
+#define RAW_PAYLOAD_OFFSET 1
+
+/// Types of notifications in the ring.
+typedef enum
+{
+    NTF_TYPE_RECEIVED,                ///< Frame received
+    NTF_TYPE_RECEIVE_FAILED,          ///< Frame reception failed
+    NTF_TYPE_TRANSMITTED,             ///< Frame transmitted
+    NTF_TYPE_TRANSMIT_FAILED,         ///< Frame transmission failure
+    NTF_TYPE_ENERGY_DETECTED,         ///< Energy detection procedure ended
+    NTF_TYPE_ENERGY_DETECTION_FAILED, ///< Energy detection procedure failed
+    NTF_TYPE_CCA,                     ///< CCA procedure ended
+    NTF_TYPE_CCA_FAILED,              ///< CCA procedure failed
+    NTF_TYPE_RX_WINDOW_ENDED,         ///< Receive window of the duty-cycled reception ended
+} nrf_802154_ntf_type_t;
+
+/// Notification data in the ring.
+typedef struct
+{
+    nrf_802154_ntf_type_t type; ///< Notification type.
+
+    union
+    {
+        struct
+        {
+            uint8_t * p_data; ///< Pointer to a buffer containing PHR and PSDU of the received frame.
+            int8_t    power;  ///< RSSI of received frame.
+            uint8_t   lqi;    ///< LQI of received frame.
+        } received;           ///< Received frame details.
+
+        struct
+        {
+            nrf_802154_rx_error_t error; ///< An error code that indicates reason of the failure.
+        } receive_failed;
+
+        struct
+        {
+            const uint8_t * p_frame; ///< Pointer to frame that was transmitted.
+            uint8_t       * p_data;  ///< Pointer to a buffer containing PHR and PSDU of the received ACK or NULL.
+            int8_t          power;   ///< RSSI of received ACK or 0.
+            uint8_t         lqi;     ///< LQI of received ACK or 0.
+        } transmitted;               ///< Transmitted frame details.
+
+        struct
+        {
+            const uint8_t       * p_frame; ///< Pointer to frame that was requested to be transmitted, but failed.
+            nrf_802154_tx_error_t error;   ///< An error code that indicates reason of the failure.
+        } transmit_failed;
+
+        struct
+        {
+            int8_t result; ///< Energy detection result.
+        } energy_detected; ///< Energy detection details.
+
+        struct
+        {
+            nrf_802154_ed_error_t error; ///< An error code that indicates reason of the failure.
+        } energy_detection_failed;       ///< Energy detection failure details.
+
+        struct
+        {
+            bool result; ///< CCA result.
+        } cca;           ///< CCA details.
+
+        struct
+        {
+            nrf_802154_cca_error_t error; ///< An error code that indicates reason of the failure.
+        } cca_failed;                     ///< CCA failure details.
+
+        struct
+        {
+            nrf_802154_rx_window_stats_t stats; ///< Statistics of the window that has ended.
+        } rx_window_ended;                      ///< Receive window end details.
+    } data;                                     ///< Notification data depending on it's type.
+} nrf_802154_ntf_data_t;
+
+static nrf_802154_ntf_data_t m_ring[RING_SIZE]; ///< Ring of the notifications.
+static volatile uint32_t     m_r_idx;           ///< Free-running index of the next slot to be drained.
+static volatile uint32_t     m_w_idx;           ///< Free-running index of the next slot to be written.
+static uint32_t              m_dropped;         ///< Number of the notifications dropped because the ring was close to full.
+
+/**
+ * Process the notification from given slot.
+ *
+ * @param[in]  p_slot  Pointer to the slot containing the notification.
+ */
+static void ntf_process(const nrf_802154_ntf_data_t * p_slot)
+{
+    switch (p_slot->type)
+    {
+        case NTF_TYPE_RECEIVED:
+#if NRF_802154_USE_RAW_API
+            nrf_802154_received_raw(p_slot->data.received.p_data,
+                                    p_slot->data.received.power,
+                                    p_slot->data.received.lqi);
+#else // NRF_802154_USE_RAW_API
+            nrf_802154_received(p_slot->data.received.p_data + RAW_PAYLOAD_OFFSET,
+                                p_slot->data.received.p_data[RAW_LENGTH_OFFSET],
+                                p_slot->data.received.power,
+                                p_slot->data.received.lqi);
+#endif
+            break;
+
+        case NTF_TYPE_RECEIVE_FAILED:
+            nrf_802154_receive_failed(p_slot->data.receive_failed.error);
+            break;
+
+        case NTF_TYPE_TRANSMITTED:
+#if NRF_802154_USE_RAW_API
+            nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
+                                       p_slot->data.transmitted.p_data,
+                                       p_slot->data.transmitted.power,
+                                       p_slot->data.transmitted.lqi);
+#else // NRF_802154_USE_RAW_API
+            nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
+                                   p_slot->data.transmitted.p_data == NULL ? NULL :
+                                   p_slot->data.transmitted.p_data + RAW_PAYLOAD_OFFSET,
+                                   p_slot->data.transmitted.p_data == NULL ? 0 :
+                                   p_slot->data.transmitted.p_data[RAW_LENGTH_OFFSET],
+                                   p_slot->data.transmitted.power,
+                                   p_slot->data.transmitted.lqi);
+#endif
+            break;
+
+        case NTF_TYPE_TRANSMIT_FAILED:
+#if NRF_802154_USE_RAW_API
+            nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
+                                       p_slot->data.transmit_failed.error);
+#else // NRF_802154_USE_RAW_API
+            nrf_802154_transmit_failed(
+                p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
+                p_slot->data.transmit_failed.error);
+#endif
+            break;
+
+        case NTF_TYPE_ENERGY_DETECTED:
+            nrf_802154_energy_detected(p_slot->data.energy_detected.result);
+            break;
+
+        case NTF_TYPE_ENERGY_DETECTION_FAILED:
+            nrf_802154_energy_detection_failed(p_slot->data.energy_detection_failed.error);
+            break;
+
+        case NTF_TYPE_CCA:
+            nrf_802154_cca_done(p_slot->data.cca.result);
+            break;
+
+        case NTF_TYPE_CCA_FAILED:
+            nrf_802154_cca_failed(p_slot->data.cca_failed.error);
+            break;
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+        case NTF_TYPE_RX_WINDOW_ENDED:
+            nrf_802154_rx_window_ended(&p_slot->data.rx_window_ended.stats);
+            break;
+#endif
+
+        default:
+            assert(false);
+    }
+}
+
+/**
+ * Check if the reception failure can be dropped when the ring is close to full.
+ *
+ * The failures caused by the received frames or by other operations have no limit in number, while
+ * the failures of the delayed reception end a request of the higher layer and must be delivered.
+ *
+ * @param[in]  error  Reason of the reception failure.
+ *
+ * @retval  true   The notification can be dropped.
+ * @retval  false  The notification must be delivered.
+ */
+static bool receive_failed_is_droppable(nrf_802154_rx_error_t error)
+{
+    switch (error)
+    {
+        case NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED:
+        case NRF_802154_RX_ERROR_DELAYED_TIMEOUT:
+        case NRF_802154_RX_ERROR_DELAYED_ABORTED:
+            return false;
+
+        default:
+            return true;
+    }
+}
+
+/**
+ * Write the notification into the ring and wake up the consumer if the ring was empty.
+ *
+ * The number of the notifications which carry a receive buffer or end a request of the higher layer
+ * is limited by the number of the receive buffers and the requests, so @ref RING_RESERVED slots are
+ * kept for them. The droppable notifications, like the reception failures caused by noise, are
+ * dropped and counted when only the reserved slots are free. If the consumer does not drain
+ * the ring and it is full anyway, the notification that cannot be dropped is processed directly
+ * in the calling context.
+ *
+ * @note This function disables interrupts while the slot is written, so that producers running
+ *       at different priorities do not interleave.
+ *
+ * @param[in]  p_ntf      Pointer to the notification to be written.
+ * @param[in]  droppable  If the notification can be dropped when the ring is close to full.
+ */
+static void ntf_post(const nrf_802154_ntf_data_t * p_ntf, bool droppable)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t limit   = droppable ? (RING_SIZE - RING_RESERVED) : RING_SIZE;
+    uint32_t w_idx;
+    bool     wake;
+
+    __disable_irq();
+
+    w_idx = m_w_idx;
+
+    if ((w_idx - m_r_idx) >= limit)
+    {
+        if (droppable)
+        {
+            m_dropped++;
+        }
+
+        __set_PRIMASK(primask);
+
+        if (!droppable)
+        {
+            ntf_process(p_ntf);
+        }
+
+        return;
+    }
+
+    m_ring[w_idx & RING_MASK] = *p_ntf;
+    w_idx++;
+
+    // Make the slot content visible before the write index.
+    __DMB();
+    m_w_idx = w_idx;
+    // Read the read index only after the write index is published, so that the consumer either
+    // sees the new notification or the producer sees the ring emptied by the consumer.
+    __DMB();
+
+    // The consumer is woken up only if the ring was empty, because a non-empty ring is guaranteed
+    // to be drained by the consumer before it waits for the next wake-up.
+    wake = ((w_idx - m_r_idx) == 1);
+    __set_PRIMASK(primask);
+
+    if (wake)
+    {
+        nrf_802154_notification_ring_wake();
+    }
+}
+
+void nrf_802154_notification_init(void)
+{
+    m_r_idx   = 0;
+    m_w_idx   = 0;
+    m_dropped = 0;
+}
+
+uint32_t nrf_802154_notification_ring_drain(uint32_t max_count)
+{
+    uint32_t r_idx = m_r_idx;
+    uint32_t w_idx = m_w_idx;
+    uint32_t count = 0;
+
+    while ((max_count == 0) || (count < max_count))
+    {
+        if (r_idx == w_idx)
+        {
+            // Refresh the write index only when the previously read batch is drained.
+            w_idx = m_w_idx;
+
+            if (r_idx == w_idx)
+            {
+                break;
+            }
+        }
+
+        // Read the slot content only after the write index.
+        __DMB();
+
+        ntf_process(&m_ring[r_idx & RING_MASK]);
+
+        r_idx++;
+        count++;
+
+        // Release the slot only after its content is consumed.
+        __DMB();
+        m_r_idx = r_idx;
+    }
+
+    return count;
+}
+
+uint32_t nrf_802154_notification_ring_dropped_get(void)
+{
+    return m_dropped;
+}
+
+bool nrf_802154_notification_ring_is_pending(void)
+{
+    uint32_t r_idx = m_r_idx;
+
+    // Pairs with the barrier in ntf_exit: the consumer that released the last slot must see
+    // the write index published by a producer which did not request a wake-up.
+    __DMB();
+
+    return m_w_idx != r_idx;
+}
+
+void nrf_802154_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type                 = NTF_TYPE_RECEIVED;
+    ntf.data.received.p_data = p_data;
+    ntf.data.received.power  = power;
+    ntf.data.received.lqi    = lqi;
+
+    ntf_post(&ntf, false);
+}
+
+void nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type                      = NTF_TYPE_RECEIVE_FAILED;
+    ntf.data.receive_failed.error = error;
+
+    ntf_post(&ntf, receive_failed_is_droppable(error));
+}
+
+void nrf_802154_notify_transmitted(const uint8_t * p_frame,
+                                   uint8_t       * p_ack,
+                                   int8_t          power,
+                                   uint8_t         lqi)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type                     = NTF_TYPE_TRANSMITTED;
+    ntf.data.transmitted.p_frame = p_frame;
+    ntf.data.transmitted.p_data  = p_ack;
+    ntf.data.transmitted.power   = power;
+    ntf.data.transmitted.lqi     = lqi;
+
+    ntf_post(&ntf, false);
+}
+
+void nrf_802154_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type                         = NTF_TYPE_TRANSMIT_FAILED;
+    ntf.data.transmit_failed.p_frame = p_frame;
+    ntf.data.transmit_failed.error   = error;
+
+    ntf_post(&ntf, false);
+}
+
+void nrf_802154_notify_energy_detected(uint8_t result)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type                        = NTF_TYPE_ENERGY_DETECTED;
+    ntf.data.energy_detected.result = result;
+
+    ntf_post(&ntf, false);
+}
+
+void nrf_802154_notify_energy_detection_failed(nrf_802154_ed_error_t error)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type                               = NTF_TYPE_ENERGY_DETECTION_FAILED;
+    ntf.data.energy_detection_failed.error = error;
+
+    ntf_post(&ntf, false);
+}
+
+void nrf_802154_notify_cca(bool is_free)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type            = NTF_TYPE_CCA;
+    ntf.data.cca.result = is_free;
+
+    ntf_post(&ntf, false);
+}
+
+void nrf_802154_notify_cca_failed(nrf_802154_cca_error_t error)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type                  = NTF_TYPE_CCA_FAILED;
+    ntf.data.cca_failed.error = error;
+
+    ntf_post(&ntf, false);
+}
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+void nrf_802154_notify_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats)
+{
+    nrf_802154_ntf_data_t ntf;
+
+    ntf.type                       = NTF_TYPE_RX_WINDOW_ENDED;
+    ntf.data.rx_window_ended.stats = *p_stats;
+
+    // The statistics of every window are also accumulated in the duty-cycled reception module.
+    ntf_post(&ntf, true);
+}
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
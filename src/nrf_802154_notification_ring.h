@@ -0,0 +1,114 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that defines the consumer interface of the notification ring backend.
+ *
+ */
+
+#ifndef NRF_802154_NOTIFICATION_RING_H__
+#define NRF_802154_NOTIFICATION_RING_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_notification_ring 802.15.4 driver notification ring
+ * @{
+ * @ingroup nrf_802154
+ * @brief Notification backend that lets the higher layer thread drain notifications in batches.
+ *
+ * When nrf_802154_notification_ring.c is used instead of nrf_802154_notification_swi.c or
+ * nrf_802154_notification_direct.c, the driver does not use any interrupt to deliver
+ * notifications. The notifications are written into a single-consumer ring, and
+ * @ref nrf_802154_notification_ring_wake is called when the ring becomes non-empty. The higher
+ * layer (for example, the stack thread of an RTOS) calls @ref nrf_802154_notification_ring_drain,
+ * which issues the notification callbacks of @ref nrf_802154_calls in the calling context.
+ *
+ * The reception failures caused by the received frames (for example, by noise) have no limit in
+ * number, so they are dropped when the ring is close to full and the consumer is too slow.
+ * The ends of the duty-cycled reception windows are dropped as well, because their statistics are
+ * also accumulated by the driver. The number of the dropped notifications can be read with @ref nrf_802154_notification_ring_dropped_get. The remaining slots are
+ * reserved for the notifications which carry a receive buffer or end a request. If the ring is full
+ * anyway, such a notification is issued directly in the context of the driver.
+ *
+ * @note Only one context may drain the ring at a time.
+ */
+
+/**
+ * @brief Issues the callbacks of the pending notifications in the calling context.
+ *
+ * @param[in]  max_count  Maximum number of notifications to be processed. 0 means no limit.
+ *
+ * @returns Number of processed notifications.
+ */
+uint32_t nrf_802154_notification_ring_drain(uint32_t max_count);
+
+/**
+ * @brief Gets the number of the notifications dropped because the ring was close to full.
+ *
+ * @returns Number of the dropped notifications since the driver initialization.
+ */
+uint32_t nrf_802154_notification_ring_dropped_get(void);
+
+/**
+ * @brief Checks if there are any pending notifications.
+ *
+ * @retval  true   There is at least one pending notification.
+ * @retval  false  There are no pending notifications.
+ */
+bool nrf_802154_notification_ring_is_pending(void);
+
+/**
+ * @brief Requests the consumer of the notification ring to drain it.
+ *
+ * This function is called by the driver when a notification is written into an empty ring. It is
+ * called from the context issuing the notification, often the RADIO IRQ handler, and it should
+ * only signal the consumer (for example, post a semaphore).
+ *
+ * @note A wake-up is not requested for notifications written into a non-empty ring, so
+ *       the consumer must drain the ring until @ref nrf_802154_notification_ring_is_pending returns
+ *       false before it waits for the next wake-up.
+ */
+extern void nrf_802154_notification_ring_wake(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_NOTIFICATION_RING_H__
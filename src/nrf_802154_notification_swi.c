@@ -89,3 +89,12 @@ void nrf_802154_notify_cca_failed(nrf_802154_cca_error_t error)
 {
     nrf_802154_swi_notify_cca_failed(error);
 }
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+void nrf_802154_notify_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats)
+{
+    nrf_802154_swi_notify_rx_window_ended(p_stats);
+}
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
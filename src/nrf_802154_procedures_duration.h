@@ -48,6 +48,15 @@
 #define MAX_RAMP_DOWN_TIME                6  // us
 #define RX_TX_TURNAROUND_TIME             20 // us
 
+/* The following time is the sum of 70us RTC_IRQHandler processing time, 40us of time that elapses
+ * from the moment a board starts transmission to the moment other boards (e.g. sniffer) are able
+ * to detect that frame and in case of TX - 50us that accounts for a delay of yet unknown origin.
+ * These are worst-case values. They are used as upper bounds of the setup times calibrated at
+ * runtime by the setup time calibration module.
+ */
+#define TX_SETUP_TIME                     160u ///< Time needed to prepare TX procedure [us]. It does not include TX ramp-up time.
+#define RX_SETUP_TIME                     110u ///< Time needed to prepare RX procedure [us]. It does not include RX ramp-up time.
+
 #define A_CCA_DURATION_SYMBOLS            8  // sym
 #define A_TURNAROUND_TIME_SYMBOLS         12 // sym
 #define A_UNIT_BACKOFF_SYMBOLS            20 // sym
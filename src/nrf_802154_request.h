@@ -102,6 +102,38 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                                  bool                           immediate,
                                  nrf_802154_notification_func_t notify_function);
 
+/**
+ * @brief Requests entering the @ref RADIO_STATE_TX state without waiting for the result.
+ *
+ * If the request is issued from a context with priority lower than the request processing
+ * priority, it is queued and @p done is called when it is processed. Otherwise, the request is
+ * processed and @p done is called before this function returns.
+ *
+ * @param[in]  term_lvl         Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig         Module that originates this request.
+ * @param[in]  p_data           Pointer to a buffer that contains PHR and PSDU of the frame to be
+ *                              transmitted.
+ * @param[in]  cca              If the driver should perform the CCA procedure before transmission.
+ * @param[in]  immediate        If true, the driver schedules transmission immediately or never;
+ *                              if false, the transmission may be postponed until TX preconditions
+ *                              are met.
+ * @param[in]  notify_function  Function called to notify the status of this procedure. May be NULL.
+ * @param[in]  done             Function called with the result of entering the transmit state.
+ *                              May be NULL.
+ * @param[in]  p_context        Context passed to @p done.
+ *
+ * @retval  true   The request was accepted.
+ * @retval  false  The request cannot be accepted because the request queue is full.
+ */
+bool nrf_802154_request_transmit_async(nrf_802154_term_t              term_lvl,
+                                       req_originator_t               req_orig,
+                                       const uint8_t                * p_data,
+                                       bool                           cca,
+                                       bool                           immediate,
+                                       nrf_802154_notification_func_t notify_function,
+                                       nrf_802154_request_done_t      done,
+                                       void                         * p_context);
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state.
  *
@@ -140,11 +172,45 @@ bool nrf_802154_request_continuous_carrier(nrf_802154_term_t term_lvl);
  */
 bool nrf_802154_request_buffer_free(uint8_t * p_data);
 
+/**
+ * @brief Requests the driver to free the given buffer without waiting for the result.
+ *
+ * @param[in]  p_data     Pointer to the buffer to be freed.
+ * @param[in]  done       Function called with the result of freeing the buffer. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was accepted.
+ * @retval  false  The request cannot be accepted because the request queue is full.
+ */
+bool nrf_802154_request_buffer_free_async(uint8_t                 * p_data,
+                                          nrf_802154_request_done_t done,
+                                          void                    * p_context);
+
+/**
+ * @brief Requests the driver to free the given buffers in a single request.
+ *
+ * @param[in]  pp_data  Array of pointers to the buffers to be freed.
+ * @param[in]  count    Number of pointers in @p pp_data.
+ */
+bool nrf_802154_request_buffers_free(uint8_t * const * pp_data, uint8_t count);
+
 /**
  * @brief Requests the driver to update the channel number used by the RADIO peripheral.
  */
 bool nrf_802154_request_channel_update(void);
 
+/**
+ * @brief Requests the driver to update the channel number used by the RADIO peripheral without
+ *        waiting for the result.
+ *
+ * @param[in]  done       Function called with the result of the channel update. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was accepted.
+ * @retval  false  The request cannot be accepted because the request queue is full.
+ */
+bool nrf_802154_request_channel_update_async(nrf_802154_request_done_t done, void * p_context);
+
 /**
  * @brief Requests the driver to update the CCA configuration used by the RADIO peripheral.
  */
@@ -49,6 +49,18 @@
                                          \
     return result;
 
+#define REQUEST_FUNCTION_ASYNC(func_core, done, p_context, ...) \
+    bool result;                                               \
+                                                               \
+    result = func_core(__VA_ARGS__);                           \
+                                                               \
+    if (done != NULL)                                          \
+    {                                                          \
+        done(result, p_context);                               \
+    }                                                          \
+                                                               \
+    return true;
+
 void nrf_802154_request_init(void)
 {
     // Intentionally empty
@@ -83,6 +95,26 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                      notify_function)
 }
 
+bool nrf_802154_request_transmit_async(nrf_802154_term_t              term_lvl,
+                                       req_originator_t               req_orig,
+                                       const uint8_t                * p_data,
+                                       bool                           cca,
+                                       bool                           immediate,
+                                       nrf_802154_notification_func_t notify_function,
+                                       nrf_802154_request_done_t      done,
+                                       void                         * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_transmit,
+                           done,
+                           p_context,
+                           term_lvl,
+                           req_orig,
+                           p_data,
+                           cca,
+                           immediate,
+                           notify_function)
+}
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
 {
     REQUEST_FUNCTION(nrf_802154_core_energy_detection, term_lvl, time_us)
@@ -103,11 +135,28 @@ bool nrf_802154_request_buffer_free(uint8_t * p_data)
     REQUEST_FUNCTION(nrf_802154_core_notify_buffer_free, p_data)
 }
 
+bool nrf_802154_request_buffer_free_async(uint8_t                 * p_data,
+                                          nrf_802154_request_done_t done,
+                                          void                    * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_notify_buffer_free, done, p_context, p_data)
+}
+
+bool nrf_802154_request_buffers_free(uint8_t * const * pp_data, uint8_t count)
+{
+    REQUEST_FUNCTION(nrf_802154_core_notify_buffers_free, pp_data, count)
+}
+
 bool nrf_802154_request_channel_update(void)
 {
     REQUEST_FUNCTION(nrf_802154_core_channel_update)
 }
 
+bool nrf_802154_request_channel_update_async(nrf_802154_request_done_t done, void * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_channel_update, done, p_context)
+}
+
 bool nrf_802154_request_cca_cfg_update(void)
 {
     REQUEST_FUNCTION(nrf_802154_core_cca_cfg_update)
@@ -87,6 +87,38 @@ static inline void assert_interrupt_status(void)
                                                       \
     return result;
 
+#define REQUEST_FUNCTION_ASYNC(func_core, func_swi, done, p_context, ...) \
+    if (active_vector_priority_is_high())                                 \
+    {                                                                     \
+        bool result = func_core(__VA_ARGS__);                             \
+                                                                          \
+        if (done != NULL)                                                 \
+        {                                                                 \
+            done(result, p_context);                                      \
+        }                                                                 \
+                                                                          \
+        return true;                                                      \
+    }                                                                     \
+                                                                          \
+    assert_interrupt_status();                                            \
+    return func_swi(__VA_ARGS__, done, p_context);
+
+#define REQUEST_FUNCTION_ASYNC_NO_ARGS(func_core, func_swi, done, p_context) \
+    if (active_vector_priority_is_high())                                    \
+    {                                                                        \
+        bool result = func_core();                                           \
+                                                                             \
+        if (done != NULL)                                                    \
+        {                                                                    \
+            done(result, p_context);                                         \
+        }                                                                    \
+                                                                             \
+        return true;                                                         \
+    }                                                                        \
+                                                                             \
+    assert_interrupt_status();                                               \
+    return func_swi(done, p_context);
+
 /** Check if active vector priority is high enough to call requests directly.
  *
  *  @retval  true   Active vector priority is greater or equal to SWI priority.
@@ -138,6 +170,27 @@ bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
                      notify_function)
 }
 
+bool nrf_802154_request_transmit_async(nrf_802154_term_t              term_lvl,
+                                       req_originator_t               req_orig,
+                                       const uint8_t                * p_data,
+                                       bool                           cca,
+                                       bool                           immediate,
+                                       nrf_802154_notification_func_t notify_function,
+                                       nrf_802154_request_done_t      done,
+                                       void                         * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_transmit,
+                           nrf_802154_swi_transmit_async,
+                           done,
+                           p_context,
+                           term_lvl,
+                           req_orig,
+                           p_data,
+                           cca,
+                           immediate,
+                           notify_function)
+}
+
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                                          uint32_t          time_us)
 {
@@ -163,11 +216,36 @@ bool nrf_802154_request_buffer_free(uint8_t * p_data)
     REQUEST_FUNCTION(nrf_802154_core_notify_buffer_free, nrf_802154_swi_buffer_free, p_data)
 }
 
+bool nrf_802154_request_buffer_free_async(uint8_t                 * p_data,
+                                          nrf_802154_request_done_t done,
+                                          void                    * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(nrf_802154_core_notify_buffer_free,
+                           nrf_802154_swi_buffer_free_async,
+                           done,
+                           p_context,
+                           p_data)
+}
+
+bool nrf_802154_request_buffers_free(uint8_t * const * pp_data, uint8_t count)
+{
+    REQUEST_FUNCTION(nrf_802154_core_notify_buffers_free, nrf_802154_swi_buffers_free, pp_data,
+                     count)
+}
+
 bool nrf_802154_request_channel_update(void)
 {
     REQUEST_FUNCTION_NO_ARGS(nrf_802154_core_channel_update, nrf_802154_swi_channel_update)
 }
 
+bool nrf_802154_request_channel_update_async(nrf_802154_request_done_t done, void * p_context)
+{
+    REQUEST_FUNCTION_ASYNC_NO_ARGS(nrf_802154_core_channel_update,
+                                   nrf_802154_swi_channel_update_async,
+                                   done,
+                                   p_context)
+}
+
 bool nrf_802154_request_cca_cfg_update(void)
 {
     REQUEST_FUNCTION_NO_ARGS(nrf_802154_core_cca_cfg_update, nrf_802154_swi_cca_cfg_update)
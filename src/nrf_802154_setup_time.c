@@ -0,0 +1,152 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the setup time calibration for delayed operations.
+ *
+ * The estimate is the largest setup time needed by the operations measured in the current and
+ * the previous block of @ref EST_WINDOW measurements. Unlike a percentile, the maximum of a recent
+ * window does not let a fixed share of the operations start late. A rare long setup time is
+ * forgotten after at most two blocks.
+ *
+ */
+
+#include "nrf_802154_setup_time.h"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_procedures_duration.h"
+
+#define EST_WINDOW 32 ///< Number of measurements in a block.
+#define EST_MARGIN 10 ///< Margin added to the estimate to cover measurement jitter [us].
+
+#if NRF_802154_SETUP_TIME_CALIBRATION_ENABLED
+
+typedef struct
+{
+    uint32_t prev_max; ///< Largest setup time needed in the previous block [us].
+    uint32_t cur_max;  ///< Largest setup time needed so far in the current block [us].
+    uint32_t count;    ///< Number of measurements in the current block.
+} estimate_t;
+
+static estimate_t m_estimates[NRF_802154_SETUP_TIME_NUM]; ///< Estimated setup times.
+
+/**
+ * @brief Gets the upper bound of the setup time of the given operation.
+ *
+ * @param[in]  op  Type of the operation.
+ *
+ * @returns  Upper bound of the setup time [us].
+ */
+static uint32_t upper_bound_get(nrf_802154_setup_time_op_t op)
+{
+    return (op == NRF_802154_SETUP_TIME_TX) ? TX_SETUP_TIME : RX_SETUP_TIME;
+}
+
+void nrf_802154_setup_time_init(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_SETUP_TIME_NUM; i++)
+    {
+        m_estimates[i].prev_max = upper_bound_get((nrf_802154_setup_time_op_t)i);
+        m_estimates[i].cur_max  = 0;
+        m_estimates[i].count    = 0;
+    }
+}
+
+uint32_t nrf_802154_setup_time_get(nrf_802154_setup_time_op_t op)
+{
+    assert(op < NRF_802154_SETUP_TIME_NUM);
+
+    const estimate_t * p_estimate  = &m_estimates[op];
+    uint32_t           upper_bound = upper_bound_get(op);
+    uint32_t           window_max  = (p_estimate->prev_max > p_estimate->cur_max) ?
+                                     p_estimate->prev_max : p_estimate->cur_max;
+    uint32_t           setup_time  = window_max + EST_MARGIN;
+
+    return (setup_time < upper_bound) ? setup_time : upper_bound;
+}
+
+void nrf_802154_setup_time_measured(nrf_802154_setup_time_op_t op,
+                                    uint32_t                   setup_used,
+                                    int32_t                    delay)
+{
+    assert(op < NRF_802154_SETUP_TIME_NUM);
+
+    estimate_t * p_estimate  = &m_estimates[op];
+    uint32_t     upper_bound = upper_bound_get(op);
+    int32_t      needed      = (int32_t)setup_used + delay;
+
+    if ((needed < 0) || (needed > (int32_t)(2 * upper_bound)))
+    {
+        // The measurement is implausible. The operation was most likely delayed or preempted by
+        // a higher priority activity.
+        return;
+    }
+
+    if ((uint32_t)needed > p_estimate->cur_max)
+    {
+        p_estimate->cur_max = (uint32_t)needed;
+    }
+
+    if (++p_estimate->count >= EST_WINDOW)
+    {
+        p_estimate->prev_max = p_estimate->cur_max;
+        p_estimate->cur_max  = 0;
+        p_estimate->count    = 0;
+    }
+}
+
+#else // NRF_802154_SETUP_TIME_CALIBRATION_ENABLED
+
+void nrf_802154_setup_time_init(void)
+{
+    // Intentionally empty
+}
+
+uint32_t nrf_802154_setup_time_get(nrf_802154_setup_time_op_t op)
+{
+    return (op == NRF_802154_SETUP_TIME_TX) ? TX_SETUP_TIME : RX_SETUP_TIME;
+}
+
+void nrf_802154_setup_time_measured(nrf_802154_setup_time_op_t op,
+                                    uint32_t                   setup_used,
+                                    int32_t                    delay)
+{
+    (void)op;
+    (void)setup_used;
+    (void)delay;
+
+    // Intentionally empty
+}
+
+#endif // NRF_802154_SETUP_TIME_CALIBRATION_ENABLED
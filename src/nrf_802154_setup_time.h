@@ -0,0 +1,105 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that estimates the time needed to prepare delayed radio operations.
+ *
+ */
+
+#ifndef NRF_802154_SETUP_TIME_H_
+#define NRF_802154_SETUP_TIME_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_setup_time Setup time calibration
+ * @{
+ * @ingroup nrf_802154
+ * @brief Calibration of the time needed to prepare delayed radio operations.
+ *
+ * A delayed operation is started by a timer that fires the setup time before the operation is
+ * to start. The setup time covers the interrupt latency and the processing needed to start
+ * the radio ramp-up. This module measures the setup time that was actually needed by
+ * the performed operations and uses the maximum over the recent operations, so that
+ * the margin adapts to the device. The worst-case constants @ref TX_SETUP_TIME and
+ * @ref RX_SETUP_TIME are used as upper bounds.
+ */
+
+/**
+ * @brief Types of delayed operations with a calibrated setup time.
+ */
+typedef enum
+{
+    NRF_802154_SETUP_TIME_TX,  ///< Delayed transmission. The setup time does not include TX ramp-up time.
+    NRF_802154_SETUP_TIME_RX,  ///< Delayed reception. The setup time does not include RX ramp-up time.
+
+    NRF_802154_SETUP_TIME_NUM, ///< Number of operation types.
+} nrf_802154_setup_time_op_t;
+
+/**
+ * @brief Initializes the setup time calibration module.
+ */
+void nrf_802154_setup_time_init(void);
+
+/**
+ * @brief Gets the setup time to be used to schedule an operation.
+ *
+ * @param[in]  op  Type of the operation.
+ *
+ * @returns  Setup time in microseconds.
+ */
+uint32_t nrf_802154_setup_time_get(nrf_802154_setup_time_op_t op);
+
+/**
+ * @brief Adds a measurement of the setup time to the estimate.
+ *
+ * @param[in]  op          Type of the measured operation.
+ * @param[in]  setup_used  Setup time used to schedule the operation, in microseconds.
+ * @param[in]  delay       Difference between the actual and the requested time of the operation
+ *                         start, in microseconds. A negative value means that the operation
+ *                         started too early.
+ */
+void nrf_802154_setup_time_measured(nrf_802154_setup_time_op_t op,
+                                    uint32_t                   setup_used,
+                                    int32_t                    delay);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SETUP_TIME_H_ */
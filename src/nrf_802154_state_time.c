@@ -0,0 +1,241 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the accounting of the time spent by the 802.15.4 driver in each state.
+ *
+ */
+
+#include "nrf_802154_state_time.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_energy.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#if NRF_802154_STATE_TIME_STATS_ENABLED
+
+static nrf_802154_state_time_stats_t m_stats;                   ///< Accounted time.
+static radio_state_t                 m_state;                   ///< Current state of the driver.
+static bool                          m_granted;                 ///< If the radio timeslot is currently granted.
+static bool                          m_requested;               ///< If the preconditions of the radio timeslot are currently requested.
+static bool                          m_approved[RSCH_PREC_CNT]; ///< If each precondition is currently approved.
+static uint64_t                      m_last_time;               ///< Time of the last accounting.
+
+/**
+ * @brief Get the statistics entry of the given state.
+ *
+ * @param[in]  state  State of the driver.
+ *
+ * @returns  Pointer to the statistics entry.
+ */
+static nrf_802154_state_time_t * entry_get(radio_state_t state)
+{
+    switch (state)
+    {
+        case RADIO_STATE_SLEEP:
+            return &m_stats.sleep;
+
+        case RADIO_STATE_FALLING_ASLEEP:
+            return &m_stats.falling_asleep;
+
+        case RADIO_STATE_RX:
+            return &m_stats.rx;
+
+        case RADIO_STATE_TX_ACK:
+            return &m_stats.tx_ack;
+
+        case RADIO_STATE_CCA_TX:
+            return &m_stats.cca_tx;
+
+        case RADIO_STATE_TX:
+            return &m_stats.tx;
+
+        case RADIO_STATE_RX_ACK:
+            return &m_stats.rx_ack;
+
+        case RADIO_STATE_ED:
+            return &m_stats.ed;
+
+        case RADIO_STATE_CCA:
+            return &m_stats.cca;
+
+        case RADIO_STATE_CONTINUOUS_CARRIER:
+            return &m_stats.continuous_carrier;
+    }
+
+    assert(false);
+    return &m_stats.sleep;
+}
+
+/**
+ * @brief Account the time elapsed since the last accounting to the current state.
+ *
+ * @note This function must be called with interrupts disabled.
+ */
+static void time_account(void)
+{
+    nrf_802154_state_time_t * p_entry = entry_get(m_state);
+    uint64_t                  now     = nrf_802154_timer_sched_time64_get();
+    uint64_t                  elapsed = now - m_last_time;
+
+    p_entry->time += elapsed;
+
+    if (m_requested && !m_granted)
+    {
+        p_entry->waiting_time += elapsed;
+
+        if (!m_approved[RSCH_PREC_HFCLK])
+        {
+            p_entry->waiting_hfclk_time += elapsed;
+        }
+
+        if (!m_approved[RSCH_PREC_RAAL])
+        {
+            p_entry->waiting_raal_time += elapsed;
+        }
+
+        if (!m_approved[RSCH_PREC_COEX])
+        {
+            p_entry->waiting_coex_time += elapsed;
+        }
+    }
+
+#if NRF_802154_ENERGY_STATS_ENABLED
+    nrf_802154_energy_account(m_state, m_granted, m_approved[RSCH_PREC_HFCLK], elapsed);
+#endif // NRF_802154_ENERGY_STATS_ENABLED
+
+    m_last_time = now;
+}
+
+void nrf_802154_state_time_init(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    memset(m_approved, 0, sizeof(m_approved));
+
+    m_state     = RADIO_STATE_SLEEP;
+    m_granted   = false;
+    m_requested = false;
+    m_last_time = nrf_802154_timer_sched_time64_get();
+}
+
+void nrf_802154_state_time_state_set(radio_state_t state)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    time_account();
+
+    if (state != m_state)
+    {
+        entry_get(state)->entries++;
+        m_state = state;
+    }
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_state_time_timeslot_set(bool granted)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    time_account();
+    m_granted = granted;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_state_time_request_set(bool requested)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    time_account();
+    m_requested = requested;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_state_time_prec_set(rsch_prec_t prec, bool approved)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    assert(prec < RSCH_PREC_CNT);
+
+    __disable_irq();
+
+    time_account();
+    m_approved[prec] = approved;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_state_time_get(nrf_802154_state_time_stats_t * p_stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    time_account();
+    *p_stats = m_stats;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_state_time_update(void)
+{
+    time_account();
+}
+
+void nrf_802154_state_time_reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    // The period until now is still passed to the energy estimator, which is reset separately.
+    time_account();
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    __set_PRIMASK(primask);
+}
+
+#endif // NRF_802154_STATE_TIME_STATS_ENABLED
@@ -0,0 +1,127 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that accounts the time spent by the 802.15.4 driver in each state.
+ *
+ */
+
+#ifndef NRF_802154_STATE_TIME_H__
+#define NRF_802154_STATE_TIME_H__
+
+#include <stdbool.h>
+
+#include "nrf_802154_core.h"
+#include "nrf_802154_types.h"
+#include "rsch/nrf_802154_rsch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_state_time 802.15.4 driver state time accounting
+ * @{
+ * @ingroup nrf_802154
+ * @brief Accounting of the time spent by the 802.15.4 driver in each state.
+ *
+ * The time is measured with the Timer Scheduler time base. Because the time is accounted at each
+ * transition, the resolution of the time base does not accumulate into an error of the totals.
+ *
+ * The waiting time is accounted only while the radio timeslot is requested from the Radio Scheduler
+ * and not granted. It is also accounted separately for each precondition that is not approved.
+ * The preconditions are requested in parallel, so the separate parts may overlap.
+ */
+
+/**
+ * @brief Initializes the state time accounting module.
+ *
+ * The driver is assumed to be in the @ref RADIO_STATE_SLEEP state without the radio timeslot and
+ * without any precondition requested.
+ */
+void nrf_802154_state_time_init(void);
+
+/**
+ * @brief Notifies the module that the driver changed its state.
+ *
+ * @param[in]  state  New state of the driver.
+ */
+void nrf_802154_state_time_state_set(radio_state_t state);
+
+/**
+ * @brief Notifies the module that the radio timeslot was granted or revoked.
+ *
+ * @param[in]  granted  If the radio timeslot is currently granted.
+ */
+void nrf_802154_state_time_timeslot_set(bool granted);
+
+/**
+ * @brief Notifies the module that the preconditions of the radio timeslot were requested or released.
+ *
+ * @param[in]  requested  If the preconditions are currently requested.
+ */
+void nrf_802154_state_time_request_set(bool requested);
+
+/**
+ * @brief Notifies the module that a precondition of the radio timeslot was approved or denied.
+ *
+ * @param[in]  prec      Precondition that changed.
+ * @param[in]  approved  If the precondition is currently approved.
+ */
+void nrf_802154_state_time_prec_set(rsch_prec_t prec, bool approved);
+
+/**
+ * @brief Gets the time spent in each state, including the time spent in the current state so far.
+ *
+ * @param[out]  p_stats  Structure to be filled with the statistics.
+ */
+void nrf_802154_state_time_get(nrf_802154_state_time_stats_t * p_stats);
+
+/**
+ * @brief Accounts the time spent in the current state so far.
+ *
+ * @note This function must be called with interrupts disabled.
+ */
+void nrf_802154_state_time_update(void);
+
+/**
+ * @brief Resets the time spent in each state.
+ */
+void nrf_802154_state_time_reset(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_STATE_TIME_H__
@@ -0,0 +1,93 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the counters of the events in the 802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_stats.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf.h"
+
+#if NRF_802154_STATS_ENABLED
+
+static nrf_802154_stats_t m_stats; ///< Counters of the events.
+
+void nrf_802154_stats_init(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+void nrf_802154_stats_counter_inc(size_t offset)
+{
+    assert((offset % sizeof(uint32_t)) == 0);
+    assert(offset < sizeof(m_stats));
+
+    uint32_t * p_counter = (uint32_t *)((uint8_t *)&m_stats + offset);
+    uint32_t   primask   = __get_PRIMASK();
+
+    // Counters are incremented from interrupt handlers of different priorities.
+    __disable_irq();
+
+    (*p_counter)++;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_stats_counters_get(nrf_802154_stats_t * p_stats)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    *p_stats = m_stats;
+
+    __set_PRIMASK(primask);
+}
+
+void nrf_802154_stats_counters_reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    __set_PRIMASK(primask);
+}
+
+#endif // NRF_802154_STATS_ENABLED
@@ -0,0 +1,107 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that counts the events in the 802.15.4 driver.
+ *
+ */
+
+#ifndef NRF_802154_STATS_H__
+#define NRF_802154_STATS_H__
+
+#include <stddef.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_stats 802.15.4 driver statistics
+ * @{
+ * @ingroup nrf_802154
+ * @brief Counters of the events in the 802.15.4 driver.
+ *
+ * The counters include the frames dropped by the driver without notifying the higher layer.
+ */
+
+#if NRF_802154_STATS_ENABLED
+
+/**
+ * @brief Increments a counter of the statistics.
+ *
+ * @param[in]  field  Name of the counter in the @ref nrf_802154_stats_t structure.
+ */
+#define nrf_802154_stats_inc(field) \
+    nrf_802154_stats_counter_inc(offsetof(nrf_802154_stats_t, field))
+
+/**
+ * @brief Initializes the statistics module.
+ */
+void nrf_802154_stats_init(void);
+
+/**
+ * @brief Increments the counter located at the given offset of the statistics.
+ *
+ * @note Use the @ref nrf_802154_stats_inc macro instead of calling this function directly.
+ *
+ * @param[in]  offset  Offset of the counter in the @ref nrf_802154_stats_t structure.
+ */
+void nrf_802154_stats_counter_inc(size_t offset);
+
+/**
+ * @brief Gets a consistent snapshot of the counters.
+ *
+ * @param[out]  p_stats  Structure to be filled with the counters.
+ */
+void nrf_802154_stats_counters_get(nrf_802154_stats_t * p_stats);
+
+/**
+ * @brief Resets all counters at once.
+ */
+void nrf_802154_stats_counters_reset(void);
+
+#else // NRF_802154_STATS_ENABLED
+
+#define nrf_802154_stats_inc(field)
+
+#endif // NRF_802154_STATS_ENABLED
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_STATS_H__
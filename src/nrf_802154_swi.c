@@ -48,17 +48,28 @@
 #include "nrf_egu.h"
 #include "platform/clock/nrf_802154_clock.h"
 
-/** Size of notification queue.
+/** Size of notification queue of the high priority lane.
  *
- * One slot for each receive buffer, one for transmission, one for busy channel and one for energy
- * detection.
+ * One slot for transmission, one for busy channel and one for energy detection. One slot of
+ * a queue always remains empty.
  */
-#define NTF_QUEUE_SIZE     (NRF_802154_RX_BUFFERS + 3)
+#define NTF_HIGH_QUEUE_SIZE 4
+/** Size of notification queue of the reception lane.
+ *
+ * One slot for each receive buffer, one for reception failure and, if the duty-cycled reception
+ * is enabled, one for the end of a receive window. One slot of a queue always remains empty.
+ */
+#define NTF_RX_QUEUE_SIZE   (NRF_802154_RX_BUFFERS + 2 + NRF_802154_RX_DUTY_CYCLE_ENABLED)
 /** Size of requests queue.
  *
- * Two is minimal queue size. It is not expected in current implementation to queue a few requests.
+ * The size must be a power of two, so that the slot index is continuous when the queue indexes
+ * wrap around.
  */
-#define REQ_QUEUE_SIZE     2
+#define REQ_QUEUE_SIZE     NRF_802154_SWI_REQUEST_QUEUE_SIZE
+
+#if (REQ_QUEUE_SIZE < 2) || ((REQ_QUEUE_SIZE & (REQ_QUEUE_SIZE - 1)) != 0)
+#error NRF_802154_SWI_REQUEST_QUEUE_SIZE must be a power of two greater than 1.
+#endif
 
 #define SWI_EGU            NRF_802154_SWI_EGU_INSTANCE ///< Label of SWI peripheral.
 #define SWI_IRQn           NRF_802154_SWI_IRQN         ///< Symbol of SWI IRQ number.
@@ -90,8 +101,18 @@ typedef enum
     NTF_TYPE_ENERGY_DETECTION_FAILED, ///< Energy detection procedure failed
     NTF_TYPE_CCA,                     ///< CCA procedure ended
     NTF_TYPE_CCA_FAILED,              ///< CCA procedure failed
+    NTF_TYPE_RX_WINDOW_ENDED,         ///< Receive window of the duty-cycled reception ended
 } nrf_802154_ntf_type_t;
 
+/// Notification lanes, in the order in which they are drained.
+typedef enum
+{
+    NTF_LANE_HIGH, ///< Results of time-critical procedures: transmission, CCA and energy detection.
+    NTF_LANE_RX,   ///< Results of reception.
+
+    NTF_LANE_CNT,  ///< Number of notification lanes.
+} nrf_802154_ntf_lane_id_t;
+
 /// Notification data in the notification queue.
 typedef struct
 {
@@ -144,9 +165,23 @@ typedef struct
         {
             nrf_802154_cca_error_t error; ///< An error code that indicates reason of the failure.
         } cca_failed;                     ///< CCA failure details.
-    } data;                               ///< Notification data depending on it's type.
+
+        struct
+        {
+            nrf_802154_rx_window_stats_t stats; ///< Statistics of the window that has ended.
+        } rx_window_ended;                      ///< Receive window end details.
+    } data;                                     ///< Notification data depending on it's type.
 } nrf_802154_ntf_data_t;
 
+/// Notification lane.
+typedef struct
+{
+    nrf_802154_ntf_data_t * p_queue; ///< Notification queue of the lane.
+    uint8_t                 size;    ///< Number of slots in the notification queue.
+    uint8_t                 r_ptr;   ///< Notification queue read index.
+    uint8_t                 w_ptr;   ///< Notification queue write index.
+} nrf_802154_ntf_lane_t;
+
 /// Type of requests in request queue.
 typedef enum
 {
@@ -157,23 +192,35 @@ typedef enum
     REQ_TYPE_CCA,
     REQ_TYPE_CONTINUOUS_CARRIER,
     REQ_TYPE_BUFFER_FREE,
+    REQ_TYPE_BUFFERS_FREE,
     REQ_TYPE_CHANNEL_UPDATE,
     REQ_TYPE_CCA_CFG_UPDATE,
     REQ_TYPE_RSSI_MEASURE,
     REQ_TYPE_RSSI_GET,
 } nrf_802154_req_type_t;
 
+/// States of a slot in request queue.
+typedef enum
+{
+    REQ_SLOT_FREE,      ///< Slot is free or is being filled by the requesting context.
+    REQ_SLOT_COMMITTED, ///< Slot contains a request waiting to be processed.
+    REQ_SLOT_PROCESSED, ///< Request in the slot was processed, the slot waits to be released.
+} nrf_802154_req_slot_state_t;
+
 /// Request data in request queue.
 typedef struct
 {
-    nrf_802154_req_type_t type; ///< Type of the request.
+    volatile nrf_802154_req_slot_state_t state;     ///< State of the slot.
+    nrf_802154_req_type_t                type;      ///< Type of the request.
+    bool                               * p_result;  ///< Request result or NULL if the result is not stored.
+    nrf_802154_request_done_t            done;      ///< Function called when the request is processed or NULL.
+    void                               * p_context; ///< Context passed to @p done.
 
     union
     {
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
-            bool            * p_result; ///< Sleep request result.
         } sleep;                        ///< Sleep request details.
 
         struct
@@ -182,7 +229,6 @@ typedef struct
             nrf_802154_term_t              term_lvl;    ///< Request priority.
             req_originator_t               req_orig;    ///< Request originator.
             bool                           notif_abort; ///< If function termination should be notified.
-            bool                         * p_result;    ///< Receive request result.
         } receive;                                      ///< Receive request details.
 
         struct
@@ -193,64 +239,54 @@ typedef struct
             const uint8_t                * p_data;     ///< Pointer to a buffer containing PHR and PSDU of the frame to transmit.
             bool                           cca;        ///< If CCA was requested prior to transmission.
             bool                           immediate;  ///< If TX procedure must be performed immediately.
-            bool                         * p_result;   ///< Transmit request result.
         } transmit;                                    ///< Transmit request details.
 
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
-            bool            * p_result; ///< Energy detection request result.
             uint32_t          time_us;  ///< Requested time of energy detection procedure.
         } energy_detection;             ///< Energy detection request details.
 
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
-            bool            * p_result; ///< CCA request result.
         } cca;                          ///< CCA request details.
 
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
-            bool            * p_result; ///< Continuous carrier request result.
         } continuous_carrier;           ///< Continuous carrier request details.
 
         struct
         {
-            uint8_t * p_data;   ///< Pointer to receive buffer to free.
-            bool    * p_result; ///< Buffer free request result.
-        } buffer_free;          ///< Buffer free request details.
-
-        struct
-        {
-            bool * p_result; ///< Channel update request result.
-        } channel_update;    ///< Channel update request details.
-
-        struct
-        {
-            bool * p_result; ///< CCA config update request result.
-        } cca_cfg_update;    ///< CCA config update request details.
+            uint8_t * p_data; ///< Pointer to receive buffer to free.
+        } buffer_free;        ///< Buffer free request details.
 
         struct
         {
-            bool * p_result; ///< RSSI measurement request result.
-        } rssi_measure;      ///< RSSI measurement request details.
+            uint8_t * const * pp_data; ///< Array of pointers to receive buffers to free.
+            uint8_t           count;   ///< Number of pointers in the array.
+        } buffers_free;                ///< Multiple buffers free request details.
 
         struct
         {
-            int8_t * p_rssi;                              ///< RSSI measurement result.
-            bool   * p_result;                            ///< RSSI measurement status.
-        } rssi_get;                                       ///< Details of the getter that retrieves the RSSI measurement result.
-    } data;                                               ///< Request data depending on its type.
+            int8_t * p_rssi; ///< RSSI measurement result.
+        } rssi_get;          ///< Details of the getter that retrieves the RSSI measurement result.
+    } data;                  ///< Request data depending on its type.
 } nrf_802154_req_data_t;
 
-static nrf_802154_ntf_data_t m_ntf_queue[NTF_QUEUE_SIZE]; ///< Notification queue.
-static uint8_t               m_ntf_r_ptr;                 ///< Notification queue read index.
-static uint8_t               m_ntf_w_ptr;                 ///< Notification queue write index.
+static nrf_802154_ntf_data_t m_ntf_high_queue[NTF_HIGH_QUEUE_SIZE]; ///< Notification queue of the high priority lane.
+static nrf_802154_ntf_data_t m_ntf_rx_queue[NTF_RX_QUEUE_SIZE];     ///< Notification queue of the reception lane.
+
+static nrf_802154_ntf_lane_t m_ntf_lanes[NTF_LANE_CNT] =            ///< Notification lanes.
+{
+    [NTF_LANE_HIGH] = {.p_queue = m_ntf_high_queue, .size = NTF_HIGH_QUEUE_SIZE},
+    [NTF_LANE_RX]   = {.p_queue = m_ntf_rx_queue, .size = NTF_RX_QUEUE_SIZE},
+};
 
 static nrf_802154_req_data_t m_req_queue[REQ_QUEUE_SIZE]; ///< Request queue.
-static uint8_t               m_req_r_ptr;                 ///< Request queue read index.
-static uint8_t               m_req_w_ptr;                 ///< Request queue write index.
+static volatile uint32_t     m_req_r_idx;                 ///< Request queue read index. Slots before it are free.
+static volatile uint32_t     m_req_w_idx;                 ///< Request queue write index. Slots before it are claimed.
 
 /**
  * Increment given index for any queue.
@@ -306,35 +342,58 @@ static bool queue_is_empty(uint8_t r_ptr, uint8_t w_ptr)
 }
 
 /**
- * Increment given index associated with notification queue.
+ * Increment given index associated with notification queue of given lane.
  *
- * @param[inout]  p_ptr  Pointer to the index to increment.
+ * @param[in]     p_lane  Pointer to the notification lane.
+ * @param[inout]  p_ptr   Pointer to the index to increment.
  */
-static void ntf_queue_ptr_increment(uint8_t * p_ptr)
+static void ntf_queue_ptr_increment(const nrf_802154_ntf_lane_t * p_lane, uint8_t * p_ptr)
 {
-    queue_ptr_increment(p_ptr, NTF_QUEUE_SIZE);
+    queue_ptr_increment(p_ptr, p_lane->size);
 }
 
 /**
- * Check if notification queue is full.
+ * Check if notification queue of given lane is full.
+ *
+ * @param[in]  p_lane  Pointer to the notification lane.
  *
  * @retval  true   Notification queue is full.
  * @retval  false  Notification queue is not full.
  */
-static bool ntf_queue_is_full(void)
+static bool ntf_queue_is_full(const nrf_802154_ntf_lane_t * p_lane)
 {
-    return queue_is_full(m_ntf_r_ptr, m_ntf_w_ptr, NTF_QUEUE_SIZE);
+    return queue_is_full(p_lane->r_ptr, p_lane->w_ptr, p_lane->size);
 }
 
 /**
- * Check if notification queue is empty.
+ * Check if notification queue of given lane is empty.
+ *
+ * @param[in]  p_lane  Pointer to the notification lane.
  *
  * @retval  true   Notification queue is empty.
  * @retval  false  Notification queue is not empty.
  */
-static bool ntf_queue_is_empty(void)
+static bool ntf_queue_is_empty(const nrf_802154_ntf_lane_t * p_lane)
+{
+    return queue_is_empty(p_lane->r_ptr, p_lane->w_ptr);
+}
+
+/**
+ * Get the lane with the highest priority that has pending notifications.
+ *
+ * @return Pointer to the notification lane or NULL if there are no pending notifications.
+ */
+static nrf_802154_ntf_lane_t * ntf_lane_pending_get(void)
 {
-    return queue_is_empty(m_ntf_r_ptr, m_ntf_w_ptr);
+    for (uint32_t i = 0; i < NTF_LANE_CNT; i++)
+    {
+        if (!ntf_queue_is_empty(&m_ntf_lanes[i]))
+        {
+            return &m_ntf_lanes[i];
+        }
+    }
+
+    return NULL;
 }
 
 /**
@@ -343,18 +402,22 @@ static bool ntf_queue_is_empty(void)
  * This is a helper function used in all notification functions to atomically
  * find an empty slot in the notification queue and allow atomic slot update.
  *
+ * @param[in]  lane  Lane of the notification.
+ *
  * @return Pointer to an empty slot in the notification queue.
  */
-static nrf_802154_ntf_data_t * ntf_enter(void)
+static nrf_802154_ntf_data_t * ntf_enter(nrf_802154_ntf_lane_id_t lane)
 {
+    nrf_802154_ntf_lane_t * p_lane = &m_ntf_lanes[lane];
+
     __disable_irq();
     __DSB();
     __ISB();
 
-    assert(!ntf_queue_is_full());
-    (void)ntf_queue_is_full();
+    assert(!ntf_queue_is_full(p_lane));
+    (void)ntf_queue_is_full(p_lane);
 
-    return &m_ntf_queue[m_ntf_w_ptr];
+    return &p_lane->p_queue[p_lane->w_ptr];
 }
 
 /**
@@ -362,10 +425,14 @@ static nrf_802154_ntf_data_t * ntf_enter(void)
  *
  * This is a helper function used in all notification functions to end atomic slot update
  * and trigger SWI to process the notification from the slot.
+ *
+ * @param[in]  lane  Lane of the notification.
  */
-static void ntf_exit(void)
+static void ntf_exit(nrf_802154_ntf_lane_id_t lane)
 {
-    ntf_queue_ptr_increment(&m_ntf_w_ptr);
+    nrf_802154_ntf_lane_t * p_lane = &m_ntf_lanes[lane];
+
+    ntf_queue_ptr_increment(p_lane, &p_lane->w_ptr);
 
     nrf_egu_task_trigger(SWI_EGU, NTF_TASK);
 
@@ -373,78 +440,107 @@ static void ntf_exit(void)
 }
 
 /**
- * Increment given index associated with request queue.
+ * Get the request queue slot for given index.
  *
- * @param[inout]  p_ptr  Pointer to the index to increment.
- */
-static void req_queue_ptr_increment(uint8_t * p_ptr)
-{
-    queue_ptr_increment(p_ptr, REQ_QUEUE_SIZE);
-}
-
-/**
- * Check if request queue is full.
+ * @param[in]  idx  Request queue index.
  *
- * @retval  true   Request queue is full.
- * @retval  false  Request queue is not full.
+ * @return Pointer to the slot.
  */
-static bool req_queue_is_full(void)
+static inline nrf_802154_req_data_t * req_slot_get(uint32_t idx)
 {
-    return queue_is_full(m_req_r_ptr, m_req_w_ptr, REQ_QUEUE_SIZE);
+    return &m_req_queue[idx & (REQ_QUEUE_SIZE - 1)];
 }
 
 /**
- * Check if request queue is empty.
+ * Enter request block.
+ *
+ * This is a helper function used in all request functions to claim a slot in the request queue.
+ * The slot is claimed without disabling interrupts: contexts of any priority lower than SWI can
+ * claim slots concurrently, because the write index is incremented with an exclusive access.
  *
- * @retval  true   Request queue is empty.
- * @retval  false  Request queue is not empty.
+ * @param[in]  p_result   Pointer to store the request result or NULL.
+ * @param[in]  done       Function to be called when the request is processed or NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @return Pointer to the claimed slot or NULL if the request queue is full.
  */
-static bool req_queue_is_empty(void)
+static nrf_802154_req_data_t * req_enter(bool                    * p_result,
+                                         nrf_802154_request_done_t done,
+                                         void                    * p_context)
 {
-    return queue_is_empty(m_req_r_ptr, m_req_w_ptr);
+    nrf_802154_req_data_t * p_slot;
+    uint32_t                idx;
+
+    do
+    {
+        idx = __LDREXW(&m_req_w_idx);
+
+        if ((idx - m_req_r_idx) >= REQ_QUEUE_SIZE)
+        {
+            __CLREX();
+            return NULL;
+        }
+    }
+    while (__STREXW(idx + 1, &m_req_w_idx));
+
+    __DMB();
+
+    p_slot = req_slot_get(idx);
+    assert(p_slot->state == REQ_SLOT_FREE);
+
+    p_slot->p_result  = p_result;
+    p_slot->done      = done;
+    p_slot->p_context = p_context;
+
+    return p_slot;
 }
 
 /**
- * Enter request block.
+ * Enter request block of a synchronous request.
  *
- * This is a helper function used in all request functions to atomically
- * find an empty slot in request queue and allow atomic slot update.
+ * @param[in]  p_result  Pointer to store the request result.
  *
- * @return Pointer to an empty slot in the request queue.
+ * @return Pointer to the claimed slot.
  */
-static nrf_802154_req_data_t * req_enter(void)
+static nrf_802154_req_data_t * req_enter_sync(bool * p_result)
 {
-    __disable_irq();
-    __DSB();
-    __ISB();
+    nrf_802154_req_data_t * p_slot = req_enter(p_result, NULL, NULL);
 
-    assert(!req_queue_is_full());
-    (void)req_queue_is_full();
+    assert(p_slot != NULL);
 
-    return &m_req_queue[m_req_w_ptr];
+    return p_slot;
 }
 
 /**
  * Exit request block.
  *
- * This is a helper function used in all request functions to end atomic slot update
- * and trigger SWI to process the request from the slot.
+ * This is a helper function used in all request functions to commit the filled slot and trigger
+ * SWI to process the request from the slot. SWI preempts the requesting context, so the request is
+ * processed before this function returns unless interrupts are disabled.
+ *
+ * @param[in]  p_slot  Pointer to the filled slot.
  */
-static void req_exit(void)
+static void req_exit(nrf_802154_req_data_t * p_slot)
 {
-    req_queue_ptr_increment(&m_req_w_ptr);
+    __DMB();
+    p_slot->state = REQ_SLOT_COMMITTED;
 
     nrf_egu_task_trigger(SWI_EGU, REQ_TASK);
 
-    __enable_irq();
     __DSB();
     __ISB();
 }
 
 void nrf_802154_swi_init(void)
 {
-    m_ntf_r_ptr = 0;
-    m_ntf_w_ptr = 0;
+    for (uint32_t i = 0; i < NTF_LANE_CNT; i++)
+    {
+        m_ntf_lanes[i].r_ptr = 0;
+        m_ntf_lanes[i].w_ptr = 0;
+    }
+
+    m_req_r_idx = 0;
+    m_req_w_idx = 0;
 
     nrf_egu_int_enable(SWI_EGU, NTF_INT | HFCLK_STOP_INT | REQ_INT);
 
@@ -458,24 +554,24 @@ void nrf_802154_swi_init(void)
 
 void nrf_802154_swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_RX);
 
     p_slot->type                 = NTF_TYPE_RECEIVED;
     p_slot->data.received.p_data = p_data;
     p_slot->data.received.power  = power;
     p_slot->data.received.lqi    = lqi;
 
-    ntf_exit();
+    ntf_exit(NTF_LANE_RX);
 }
 
 void nrf_802154_swi_notify_receive_failed(nrf_802154_rx_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_RX);
 
     p_slot->type                      = NTF_TYPE_RECEIVE_FAILED;
     p_slot->data.receive_failed.error = error;
 
-    ntf_exit();
+    ntf_exit(NTF_LANE_RX);
 }
 
 void nrf_802154_swi_notify_transmitted(const uint8_t * p_frame,
@@ -483,7 +579,7 @@ void nrf_802154_swi_notify_transmitted(const uint8_t * p_frame,
                                        int8_t          power,
                                        uint8_t         lqi)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_HIGH);
 
     p_slot->type                     = NTF_TYPE_TRANSMITTED;
     p_slot->data.transmitted.p_frame = p_frame;
@@ -491,60 +587,74 @@ void nrf_802154_swi_notify_transmitted(const uint8_t * p_frame,
     p_slot->data.transmitted.power   = power;
     p_slot->data.transmitted.lqi     = lqi;
 
-    ntf_exit();
+    ntf_exit(NTF_LANE_HIGH);
 }
 
 void nrf_802154_swi_notify_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_HIGH);
 
     p_slot->type                         = NTF_TYPE_TRANSMIT_FAILED;
     p_slot->data.transmit_failed.p_frame = p_frame;
     p_slot->data.transmit_failed.error   = error;
 
-    ntf_exit();
+    ntf_exit(NTF_LANE_HIGH);
 }
 
 void nrf_802154_swi_notify_energy_detected(uint8_t result)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_HIGH);
 
     p_slot->type                        = NTF_TYPE_ENERGY_DETECTED;
     p_slot->data.energy_detected.result = result;
 
-    ntf_exit();
+    ntf_exit(NTF_LANE_HIGH);
 }
 
 void nrf_802154_swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_HIGH);
 
     p_slot->type                               = NTF_TYPE_ENERGY_DETECTION_FAILED;
     p_slot->data.energy_detection_failed.error = error;
 
-    ntf_exit();
+    ntf_exit(NTF_LANE_HIGH);
 }
 
 void nrf_802154_swi_notify_cca(bool channel_free)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_HIGH);
 
     p_slot->type            = NTF_TYPE_CCA;
     p_slot->data.cca.result = channel_free;
 
-    ntf_exit();
+    ntf_exit(NTF_LANE_HIGH);
 }
 
 void nrf_802154_swi_notify_cca_failed(nrf_802154_cca_error_t error)
 {
-    nrf_802154_ntf_data_t * p_slot = ntf_enter();
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_HIGH);
 
     p_slot->type                  = NTF_TYPE_CCA_FAILED;
     p_slot->data.cca_failed.error = error;
 
-    ntf_exit();
+    ntf_exit(NTF_LANE_HIGH);
+}
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+void nrf_802154_swi_notify_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats)
+{
+    nrf_802154_ntf_data_t * p_slot = ntf_enter(NTF_LANE_RX);
+
+    p_slot->type                       = NTF_TYPE_RX_WINDOW_ENDED;
+    p_slot->data.rx_window_ended.stats = *p_stats;
+
+    ntf_exit(NTF_LANE_RX);
 }
 
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
+
 void nrf_802154_swi_hfclk_stop(void)
 {
     assert(!nrf_egu_event_check(SWI_EGU, HFCLK_STOP_EVENT));
@@ -557,15 +667,117 @@ void nrf_802154_swi_hfclk_stop_terminate(void)
     nrf_egu_event_clear(SWI_EGU, HFCLK_STOP_EVENT);
 }
 
+/**
+ * Queue transmit request.
+ *
+ * @param[in]  term_lvl         Termination level of this request.
+ * @param[in]  req_orig         Module that originates this request.
+ * @param[in]  p_data           Pointer to a buffer containing PHR and PSDU of the frame.
+ * @param[in]  cca              If the driver should perform CCA procedure before transmission.
+ * @param[in]  immediate        If TX procedure must be performed immediately.
+ * @param[in]  notify_function  Function called to notify the status of this procedure.
+ * @param[in]  p_result         Pointer to store the request result or NULL.
+ * @param[in]  done             Function to be called when the request is processed or NULL.
+ * @param[in]  p_context        Context passed to @p done.
+ *
+ * @retval  true   Request was queued.
+ * @retval  false  Request queue is full.
+ */
+static bool transmit_req(nrf_802154_term_t              term_lvl,
+                         req_originator_t               req_orig,
+                         const uint8_t                * p_data,
+                         bool                           cca,
+                         bool                           immediate,
+                         nrf_802154_notification_func_t notify_function,
+                         bool                         * p_result,
+                         nrf_802154_request_done_t      done,
+                         void                         * p_context)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(p_result, done, p_context);
+
+    if (p_slot == NULL)
+    {
+        return false;
+    }
+
+    p_slot->type                     = REQ_TYPE_TRANSMIT;
+    p_slot->data.transmit.term_lvl   = term_lvl;
+    p_slot->data.transmit.req_orig   = req_orig;
+    p_slot->data.transmit.p_data     = p_data;
+    p_slot->data.transmit.cca        = cca;
+    p_slot->data.transmit.immediate  = immediate;
+    p_slot->data.transmit.notif_func = notify_function;
+
+    req_exit(p_slot);
+
+    return true;
+}
+
+/**
+ * Queue buffer free request.
+ *
+ * @param[in]  p_data     Pointer to receive buffer to free.
+ * @param[in]  p_result   Pointer to store the request result or NULL.
+ * @param[in]  done       Function to be called when the request is processed or NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   Request was queued.
+ * @retval  false  Request queue is full.
+ */
+static bool buffer_free_req(uint8_t                 * p_data,
+                            bool                    * p_result,
+                            nrf_802154_request_done_t done,
+                            void                    * p_context)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(p_result, done, p_context);
+
+    if (p_slot == NULL)
+    {
+        return false;
+    }
+
+    p_slot->type                    = REQ_TYPE_BUFFER_FREE;
+    p_slot->data.buffer_free.p_data = p_data;
+
+    req_exit(p_slot);
+
+    return true;
+}
+
+/**
+ * Queue channel update request.
+ *
+ * @param[in]  p_result   Pointer to store the request result or NULL.
+ * @param[in]  done       Function to be called when the request is processed or NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   Request was queued.
+ * @retval  false  Request queue is full.
+ */
+static bool channel_update_req(bool * p_result, nrf_802154_request_done_t done, void * p_context)
+{
+    nrf_802154_req_data_t * p_slot = req_enter(p_result, done, p_context);
+
+    if (p_slot == NULL)
+    {
+        return false;
+    }
+
+    p_slot->type = REQ_TYPE_CHANNEL_UPDATE;
+
+    req_exit(p_slot);
+
+    return true;
+}
+
 void nrf_802154_swi_sleep(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
     p_slot->type                = REQ_TYPE_SLEEP;
     p_slot->data.sleep.term_lvl = term_lvl;
-    p_slot->data.sleep.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_receive(nrf_802154_term_t              term_lvl,
@@ -574,16 +786,15 @@ void nrf_802154_swi_receive(nrf_802154_term_t              term_lvl,
                             bool                           notify_abort,
                             bool                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
     p_slot->type                     = REQ_TYPE_RECEIVE;
     p_slot->data.receive.term_lvl    = term_lvl;
     p_slot->data.receive.req_orig    = req_orig;
     p_slot->data.receive.notif_func  = notify_function;
     p_slot->data.receive.notif_abort = notify_abort;
-    p_slot->data.receive.p_result    = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
@@ -594,186 +805,358 @@ void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
                              nrf_802154_notification_func_t notify_function,
                              bool                         * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
-
-    p_slot->type                     = REQ_TYPE_TRANSMIT;
-    p_slot->data.transmit.term_lvl   = term_lvl;
-    p_slot->data.transmit.req_orig   = req_orig;
-    p_slot->data.transmit.p_data     = p_data;
-    p_slot->data.transmit.cca        = cca;
-    p_slot->data.transmit.immediate  = immediate;
-    p_slot->data.transmit.notif_func = notify_function;
-    p_slot->data.transmit.p_result   = p_result;
+    bool queued = transmit_req(term_lvl,
+                               req_orig,
+                               p_data,
+                               cca,
+                               immediate,
+                               notify_function,
+                               p_result,
+                               NULL,
+                               NULL);
+
+    assert(queued);
+    (void)queued;
+}
 
-    req_exit();
+bool nrf_802154_swi_transmit_async(nrf_802154_term_t              term_lvl,
+                                   req_originator_t               req_orig,
+                                   const uint8_t                * p_data,
+                                   bool                           cca,
+                                   bool                           immediate,
+                                   nrf_802154_notification_func_t notify_function,
+                                   nrf_802154_request_done_t      done,
+                                   void                         * p_context)
+{
+    return transmit_req(term_lvl,
+                        req_orig,
+                        p_data,
+                        cca,
+                        immediate,
+                        notify_function,
+                        NULL,
+                        done,
+                        p_context);
 }
 
 void nrf_802154_swi_energy_detection(nrf_802154_term_t term_lvl,
                                      uint32_t          time_us,
                                      bool            * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
     p_slot->type                           = REQ_TYPE_ENERGY_DETECTION;
     p_slot->data.energy_detection.term_lvl = term_lvl;
     p_slot->data.energy_detection.time_us  = time_us;
-    p_slot->data.energy_detection.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_cca(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
     p_slot->type              = REQ_TYPE_CCA;
     p_slot->data.cca.term_lvl = term_lvl;
-    p_slot->data.cca.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_continuous_carrier(nrf_802154_term_t term_lvl, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
     p_slot->type                             = REQ_TYPE_CONTINUOUS_CARRIER;
     p_slot->data.continuous_carrier.term_lvl = term_lvl;
-    p_slot->data.continuous_carrier.p_result = p_result;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_buffer_free(uint8_t * p_data, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    bool queued = buffer_free_req(p_data, p_result, NULL, NULL);
+
+    assert(queued);
+    (void)queued;
+}
+
+bool nrf_802154_swi_buffer_free_async(uint8_t                 * p_data,
+                                      nrf_802154_request_done_t done,
+                                      void                    * p_context)
+{
+    return buffer_free_req(p_data, NULL, done, p_context);
+}
+
+void nrf_802154_swi_buffers_free(uint8_t * const * pp_data, uint8_t count, bool * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
-    p_slot->type                      = REQ_TYPE_BUFFER_FREE;
-    p_slot->data.buffer_free.p_data   = p_data;
-    p_slot->data.buffer_free.p_result = p_result;
+    p_slot->type                      = REQ_TYPE_BUFFERS_FREE;
+    p_slot->data.buffers_free.pp_data = pp_data;
+    p_slot->data.buffers_free.count   = count;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_channel_update(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    bool queued = channel_update_req(p_result, NULL, NULL);
 
-    p_slot->type                         = REQ_TYPE_CHANNEL_UPDATE;
-    p_slot->data.channel_update.p_result = p_result;
+    assert(queued);
+    (void)queued;
+}
 
-    req_exit();
+bool nrf_802154_swi_channel_update_async(nrf_802154_request_done_t done, void * p_context)
+{
+    return channel_update_req(NULL, done, p_context);
 }
 
 void nrf_802154_swi_cca_cfg_update(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
-    p_slot->type                         = REQ_TYPE_CCA_CFG_UPDATE;
-    p_slot->data.cca_cfg_update.p_result = p_result;
+    p_slot->type = REQ_TYPE_CCA_CFG_UPDATE;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_rssi_measure(bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
-    p_slot->type                       = REQ_TYPE_RSSI_MEASURE;
-    p_slot->data.rssi_measure.p_result = p_result;
+    p_slot->type = REQ_TYPE_RSSI_MEASURE;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
 void nrf_802154_swi_rssi_measurement_get(int8_t * p_rssi, bool * p_result)
 {
-    nrf_802154_req_data_t * p_slot = req_enter();
+    nrf_802154_req_data_t * p_slot = req_enter_sync(p_result);
 
-    p_slot->type                   = REQ_TYPE_RSSI_GET;
-    p_slot->data.rssi_get.p_rssi   = p_rssi;
-    p_slot->data.rssi_get.p_result = p_result;
+    p_slot->type                 = REQ_TYPE_RSSI_GET;
+    p_slot->data.rssi_get.p_rssi = p_rssi;
 
-    req_exit();
+    req_exit(p_slot);
 }
 
-void SWI_IRQHandler(void)
+/**
+ * Process the request from given slot.
+ *
+ * @param[in]  p_slot  Pointer to the slot containing the request.
+ */
+static void req_process(const nrf_802154_req_data_t * p_slot)
 {
-    if (nrf_egu_event_check(SWI_EGU, NTF_EVENT))
+    bool result = false;
+
+    switch (p_slot->type)
     {
-        nrf_egu_event_clear(SWI_EGU, NTF_EVENT);
+        case REQ_TYPE_SLEEP:
+            result = nrf_802154_core_sleep(p_slot->data.sleep.term_lvl);
+            break;
+
+        case REQ_TYPE_RECEIVE:
+            result = nrf_802154_core_receive(p_slot->data.receive.term_lvl,
+                                             p_slot->data.receive.req_orig,
+                                             p_slot->data.receive.notif_func,
+                                             p_slot->data.receive.notif_abort);
+            break;
+
+        case REQ_TYPE_TRANSMIT:
+            result = nrf_802154_core_transmit(p_slot->data.transmit.term_lvl,
+                                              p_slot->data.transmit.req_orig,
+                                              p_slot->data.transmit.p_data,
+                                              p_slot->data.transmit.cca,
+                                              p_slot->data.transmit.immediate,
+                                              p_slot->data.transmit.notif_func);
+            break;
+
+        case REQ_TYPE_ENERGY_DETECTION:
+            result = nrf_802154_core_energy_detection(p_slot->data.energy_detection.term_lvl,
+                                                      p_slot->data.energy_detection.time_us);
+            break;
+
+        case REQ_TYPE_CCA:
+            result = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
+            break;
+
+        case REQ_TYPE_CONTINUOUS_CARRIER:
+            result = nrf_802154_core_continuous_carrier(p_slot->data.continuous_carrier.term_lvl);
+            break;
+
+        case REQ_TYPE_BUFFER_FREE:
+            result = nrf_802154_core_notify_buffer_free(p_slot->data.buffer_free.p_data);
+            break;
+
+        case REQ_TYPE_BUFFERS_FREE:
+            result = nrf_802154_core_notify_buffers_free(p_slot->data.buffers_free.pp_data,
+                                                         p_slot->data.buffers_free.count);
+            break;
+
+        case REQ_TYPE_CHANNEL_UPDATE:
+            result = nrf_802154_core_channel_update();
+            break;
+
+        case REQ_TYPE_CCA_CFG_UPDATE:
+            result = nrf_802154_core_cca_cfg_update();
+            break;
+
+        case REQ_TYPE_RSSI_MEASURE:
+            result = nrf_802154_core_rssi_measure();
+            break;
+
+        case REQ_TYPE_RSSI_GET:
+            result = nrf_802154_core_last_rssi_measurement_get(p_slot->data.rssi_get.p_rssi);
+            break;
+
+        default:
+            assert(false);
+    }
+
+    if (p_slot->p_result != NULL)
+    {
+        *(p_slot->p_result) = result;
+    }
+
+    if (p_slot->done != NULL)
+    {
+        p_slot->done(result, p_slot->p_context);
+    }
+}
+
+/**
+ * Process all committed requests from the request queue and release the processed slots.
+ *
+ * A slot claimed by a context preempted before committing it does not block processing of
+ * the slots committed after it. Such slot is processed when the claiming context commits it.
+ * Slots are released in order, so the preempted slot delays only reuse of the following slots.
+ */
+static void req_queue_process(void)
+{
+    uint32_t w_idx = m_req_w_idx;
+    uint32_t r_idx = m_req_r_idx;
+
+    __DMB();
+
+    for (uint32_t idx = r_idx; idx != w_idx; idx++)
+    {
+        nrf_802154_req_data_t * p_slot = req_slot_get(idx);
 
-        while (!ntf_queue_is_empty())
+        if (p_slot->state == REQ_SLOT_COMMITTED)
         {
-            nrf_802154_ntf_data_t * p_slot = &m_ntf_queue[m_ntf_r_ptr];
+            __DMB();
+
+            req_process(p_slot);
+
+            p_slot->state = REQ_SLOT_PROCESSED;
+        }
+    }
+
+    while ((r_idx != w_idx) && (req_slot_get(r_idx)->state == REQ_SLOT_PROCESSED))
+    {
+        req_slot_get(r_idx)->state = REQ_SLOT_FREE;
+        r_idx++;
+    }
+
+    __DMB();
+
+    m_req_r_idx = r_idx;
+}
 
-            switch (p_slot->type)
-            {
-                case NTF_TYPE_RECEIVED:
+/**
+ * Process the notification from given slot.
+ *
+ * @param[in]  p_slot  Pointer to the slot containing the notification.
+ */
+static void ntf_process(const nrf_802154_ntf_data_t * p_slot)
+{
+    switch (p_slot->type)
+    {
+        case NTF_TYPE_RECEIVED:
 #if NRF_802154_USE_RAW_API
-                    nrf_802154_received_raw(p_slot->data.received.p_data,
-                                            p_slot->data.received.power,
-                                            p_slot->data.received.lqi);
+            nrf_802154_received_raw(p_slot->data.received.p_data,
+                                    p_slot->data.received.power,
+                                    p_slot->data.received.lqi);
 #else // NRF_802154_USE_RAW_API
-                    nrf_802154_received(p_slot->data.received.p_data + RAW_PAYLOAD_OFFSET,
-                                        p_slot->data.received.p_data[RAW_LENGTH_OFFSET],
-                                        p_slot->data.received.power,
-                                        p_slot->data.received.lqi);
+            nrf_802154_received(p_slot->data.received.p_data + RAW_PAYLOAD_OFFSET,
+                                p_slot->data.received.p_data[RAW_LENGTH_OFFSET],
+                                p_slot->data.received.power,
+                                p_slot->data.received.lqi);
 #endif
-                    break;
+            break;
 
-                case NTF_TYPE_RECEIVE_FAILED:
-                    nrf_802154_receive_failed(p_slot->data.receive_failed.error);
-                    break;
+        case NTF_TYPE_RECEIVE_FAILED:
+            nrf_802154_receive_failed(p_slot->data.receive_failed.error);
+            break;
 
-                case NTF_TYPE_TRANSMITTED:
+        case NTF_TYPE_TRANSMITTED:
 #if NRF_802154_USE_RAW_API
-                    nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
-                                               p_slot->data.transmitted.p_data,
-                                               p_slot->data.transmitted.power,
-                                               p_slot->data.transmitted.lqi);
+            nrf_802154_transmitted_raw(p_slot->data.transmitted.p_frame,
+                                       p_slot->data.transmitted.p_data,
+                                       p_slot->data.transmitted.power,
+                                       p_slot->data.transmitted.lqi);
 #else // NRF_802154_USE_RAW_API
-                    nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
-                                           p_slot->data.transmitted.p_data == NULL ? NULL :
-                                           p_slot->data.transmitted.p_data + RAW_PAYLOAD_OFFSET,
-                                           p_slot->data.transmitted.p_data[RAW_LENGTH_OFFSET],
-                                           p_slot->data.transmitted.power,
-                                           p_slot->data.transmitted.lqi);
+            nrf_802154_transmitted(p_slot->data.transmitted.p_frame + RAW_PAYLOAD_OFFSET,
+                                   p_slot->data.transmitted.p_data == NULL ? NULL :
+                                   p_slot->data.transmitted.p_data + RAW_PAYLOAD_OFFSET,
+                                   p_slot->data.transmitted.p_data[RAW_LENGTH_OFFSET],
+                                   p_slot->data.transmitted.power,
+                                   p_slot->data.transmitted.lqi);
 #endif
-                    break;
+            break;
 
-                case NTF_TYPE_TRANSMIT_FAILED:
+        case NTF_TYPE_TRANSMIT_FAILED:
 #if NRF_802154_USE_RAW_API
-                    nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
-                                               p_slot->data.transmit_failed.error);
+            nrf_802154_transmit_failed(p_slot->data.transmit_failed.p_frame,
+                                       p_slot->data.transmit_failed.error);
 #else // NRF_802154_USE_RAW_API
-                    nrf_802154_transmit_failed(
-                        p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
-                        p_slot->data.transmit_failed.error);
+            nrf_802154_transmit_failed(
+                p_slot->data.transmit_failed.p_frame + RAW_PAYLOAD_OFFSET,
+                p_slot->data.transmit_failed.error);
 #endif
-                    break;
+            break;
+
+        case NTF_TYPE_ENERGY_DETECTED:
+            nrf_802154_energy_detected(p_slot->data.energy_detected.result);
+            break;
+
+        case NTF_TYPE_ENERGY_DETECTION_FAILED:
+            nrf_802154_energy_detection_failed(p_slot->data.energy_detection_failed.error);
+            break;
+
+        case NTF_TYPE_CCA:
+            nrf_802154_cca_done(p_slot->data.cca.result);
+            break;
 
-                case NTF_TYPE_ENERGY_DETECTED:
-                    nrf_802154_energy_detected(p_slot->data.energy_detected.result);
-                    break;
+        case NTF_TYPE_CCA_FAILED:
+            nrf_802154_cca_failed(p_slot->data.cca_failed.error);
+            break;
 
-                case NTF_TYPE_ENERGY_DETECTION_FAILED:
-                    nrf_802154_energy_detection_failed(
-                        p_slot->data.energy_detection_failed.error);
-                    break;
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+        case NTF_TYPE_RX_WINDOW_ENDED:
+            nrf_802154_rx_window_ended(&p_slot->data.rx_window_ended.stats);
+            break;
+#endif
+
+        default:
+            assert(false);
+    }
+}
 
-                case NTF_TYPE_CCA:
-                    nrf_802154_cca_done(p_slot->data.cca.result);
-                    break;
+void SWI_IRQHandler(void)
+{
+    if (nrf_egu_event_check(SWI_EGU, NTF_EVENT))
+    {
+        nrf_802154_ntf_lane_t * p_lane;
 
-                case NTF_TYPE_CCA_FAILED:
-                    nrf_802154_cca_failed(p_slot->data.cca_failed.error);
-                    break;
+        nrf_egu_event_clear(SWI_EGU, NTF_EVENT);
 
-                default:
-                    assert(false);
-            }
+        // Lanes are checked again after each notification, so that notifications of higher
+        // priority issued meanwhile do not wait for the lower priority lanes to be drained.
+        while ((p_lane = ntf_lane_pending_get()) != NULL)
+        {
+            ntf_process(&p_lane->p_queue[p_lane->r_ptr]);
 
-            ntf_queue_ptr_increment(&m_ntf_r_ptr);
+            ntf_queue_ptr_increment(p_lane, &p_lane->r_ptr);
         }
     }
 
@@ -788,79 +1171,6 @@ void SWI_IRQHandler(void)
     {
         nrf_egu_event_clear(SWI_EGU, REQ_EVENT);
 
-        while (!req_queue_is_empty())
-        {
-            nrf_802154_req_data_t * p_slot = &m_req_queue[m_req_r_ptr];
-
-            switch (p_slot->type)
-            {
-                case REQ_TYPE_SLEEP:
-                    *(p_slot->data.sleep.p_result) =
-                        nrf_802154_core_sleep(p_slot->data.sleep.term_lvl);
-                    break;
-
-                case REQ_TYPE_RECEIVE:
-                    *(p_slot->data.receive.p_result) =
-                        nrf_802154_core_receive(p_slot->data.receive.term_lvl,
-                                                p_slot->data.receive.req_orig,
-                                                p_slot->data.receive.notif_func,
-                                                p_slot->data.receive.notif_abort);
-                    break;
-
-                case REQ_TYPE_TRANSMIT:
-                    *(p_slot->data.transmit.p_result) =
-                        nrf_802154_core_transmit(p_slot->data.transmit.term_lvl,
-                                                 p_slot->data.transmit.req_orig,
-                                                 p_slot->data.transmit.p_data,
-                                                 p_slot->data.transmit.cca,
-                                                 p_slot->data.transmit.immediate,
-                                                 p_slot->data.transmit.notif_func);
-                    break;
-
-                case REQ_TYPE_ENERGY_DETECTION:
-                    *(p_slot->data.energy_detection.p_result) =
-                        nrf_802154_core_energy_detection(
-                            p_slot->data.energy_detection.term_lvl,
-                            p_slot->data.energy_detection.time_us);
-                    break;
-
-                case REQ_TYPE_CCA:
-                    *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
-                    break;
-
-                case REQ_TYPE_CONTINUOUS_CARRIER:
-                    *(p_slot->data.continuous_carrier.p_result) =
-                        nrf_802154_core_continuous_carrier(
-                            p_slot->data.continuous_carrier.term_lvl);
-                    break;
-
-                case REQ_TYPE_BUFFER_FREE:
-                    *(p_slot->data.buffer_free.p_result) =
-                        nrf_802154_core_notify_buffer_free(p_slot->data.buffer_free.p_data);
-                    break;
-
-                case REQ_TYPE_CHANNEL_UPDATE:
-                    *(p_slot->data.channel_update.p_result) = nrf_802154_core_channel_update();
-                    break;
-
-                case REQ_TYPE_CCA_CFG_UPDATE:
-                    *(p_slot->data.cca_cfg_update.p_result) = nrf_802154_core_cca_cfg_update();
-                    break;
-
-                case REQ_TYPE_RSSI_MEASURE:
-                    *(p_slot->data.rssi_measure.p_result) = nrf_802154_core_rssi_measure();
-                    break;
-
-                case REQ_TYPE_RSSI_GET:
-                    *(p_slot->data.rssi_get.p_result) =
-                        nrf_802154_core_last_rssi_measurement_get(p_slot->data.rssi_get.p_rssi);
-                    break;
-
-                default:
-                    assert(false);
-            }
-
-            req_queue_ptr_increment(&m_req_r_ptr);
-        }
+        req_queue_process();
     }
 }
@@ -132,6 +132,19 @@ void nrf_802154_swi_notify_cca(bool channel_free);
  */
 void nrf_802154_swi_notify_cca_failed(nrf_802154_cca_error_t error);
 
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+/**
+ * @brief Notifies the next higher layer that a receive window of the duty-cycled reception ended.
+ *
+ * The notification is triggered from the SWI priority level.
+ *
+ * @param[in]  p_stats  Pointer to the statistics of the window that has ended.
+ */
+void nrf_802154_swi_notify_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats);
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
+
 /**
  * @brief Requests a stop of the HF clock.
  *
@@ -197,6 +210,36 @@ void nrf_802154_swi_transmit(nrf_802154_term_t              term_lvl,
                              nrf_802154_notification_func_t notify_function,
                              bool                         * p_result);
 
+/**
+ * @brief Queues the request to enter the @ref RADIO_STATE_TX state without waiting for its result.
+ *
+ * @param[in]  term_lvl         Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig         Module that originates this request.
+ * @param[in]  p_data           Pointer to a buffer that contains PHR and PSDU of the frame to be
+ *                              transmitted.
+ * @param[in]  cca              If the driver should perform the CCA procedure before transmission.
+ * @param[in]  immediate        If true, the driver schedules transmission immediately or never;
+ *                              if false, the transmission may be postponed until TX preconditions
+ *                              are met.
+ * @param[in]  notify_function  Function called to notify the status of this procedure instead of
+ *                              the default notification. If NULL, the default notification
+ *                              is used.
+ * @param[in]  done             Function called from the SWI priority with the result of entering
+ *                              the transmit state. May be NULL.
+ * @param[in]  p_context        Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The request queue is full.
+ */
+bool nrf_802154_swi_transmit_async(nrf_802154_term_t              term_lvl,
+                                   req_originator_t               req_orig,
+                                   const uint8_t                * p_data,
+                                   bool                           cca,
+                                   bool                           immediate,
+                                   nrf_802154_notification_func_t notify_function,
+                                   nrf_802154_request_done_t      done,
+                                   void                         * p_context);
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_ED state from the SWI priority.
  *
@@ -231,11 +274,49 @@ void nrf_802154_swi_continuous_carrier(nrf_802154_term_t term_lvl, bool * p_resu
  */
 void nrf_802154_swi_buffer_free(uint8_t * p_data, bool * p_result);
 
+/**
+ * @brief Queues the notification that the given buffer is not used anymore without waiting for
+ *        the result.
+ *
+ * @param[in]  p_data     Pointer to the buffer to be freed.
+ * @param[in]  done       Function called from the SWI priority with the result of freeing
+ *                        the buffer. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The request queue is full.
+ */
+bool nrf_802154_swi_buffer_free_async(uint8_t                 * p_data,
+                                      nrf_802154_request_done_t done,
+                                      void                    * p_context);
+
+/**
+ * @brief Notifies the core module that the given buffers are not used anymore and can be freed.
+ *
+ * @param[in]   pp_data   Array of pointers to the buffers to be freed.
+ * @param[in]   count     Number of pointers in @p pp_data.
+ * @param[out]  p_result  Result of freeing the buffers.
+ */
+void nrf_802154_swi_buffers_free(uint8_t * const * pp_data, uint8_t count, bool * p_result);
+
 /**
  * @brief Notifies the core module that the next higher layer has requested a channel change.
  */
 void nrf_802154_swi_channel_update(bool * p_result);
 
+/**
+ * @brief Queues the notification that the next higher layer has requested a channel change
+ *        without waiting for the result.
+ *
+ * @param[in]  done       Function called from the SWI priority with the result of the channel
+ *                        update. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The request queue is full.
+ */
+bool nrf_802154_swi_channel_update_async(nrf_802154_request_done_t done, void * p_context);
+
 /**
  * @brief Notifies the core module that the next higher layer has requested a CCA configuration
  * change.
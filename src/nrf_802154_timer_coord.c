@@ -39,6 +39,7 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_debug.h"
@@ -52,10 +53,17 @@
                                   DIV_ROUND_NEGATIVE(n, d) : \
                                   DIV_ROUND_POSITIVE(n, d))
 
-#define TIME_BASE                (1UL << 22)     ///< Unit used to calculate PPTB (Point per Time Base). It is not equal million to speed up computations and increase precision.
-#define FIRST_RESYNC_TIME        TIME_BASE       ///< Delay of the first resynchronization. The first resynchronization is needed to measure timers drift.
-#define RESYNC_TIME              (4 * TIME_BASE) ///< Delay of following resynchronizations.
-#define EWMA_COEF                (8)             ///< Weight used in the EWMA algorithm.
+#define TIME_BASE                (1UL << 22)      ///< Unit used to calculate PPTB (Point per Time Base). It is not equal million to speed up computations and increase precision.
+#define FIRST_RESYNC_TIME        TIME_BASE        ///< Delay of the first resynchronization. The first resynchronization is needed to measure timers drift.
+#define RESYNC_TIME              (4 * TIME_BASE)  ///< Delay of following resynchronizations while the drift estimate is not tight.
+#define MAX_RESYNC_TIME          (32 * TIME_BASE) ///< Maximal delay of resynchronization used when the drift estimate is tight.
+#define RESYNC_ERROR_TARGET      (8)              ///< Timestamp error [us] allowed to be accumulated between resynchronizations due to the drift uncertainty.
+#define DRIFT_BASE               (1UL << 26)      ///< Unit used to express the drift [parts per DRIFT_BASE]. It is finer than TIME_BASE to keep timestamps precise between distant resynchronizations.
+#define DRIFT_WINDOW_SIZE        (8)              ///< Number of common timepoints used to estimate the drift.
+#define DRIFT_X_SHIFT            (10)             ///< Scaling of the LP timer time used in the regression, to keep the sums in 64 bits.
+#define DRIFT_UNKNOWN            UINT32_MAX       ///< Drift uncertainty value used when it cannot be estimated.
+#define RESIDUAL_FRAC_BITS       (4)              ///< Number of fractional bits of the residuals used to calculate the drift uncertainty.
+#define PPB_PER_UNIT             (1000000000LL)   ///< Number of parts per billion in a unit.
 
 #define PPI_CH0                  NRF_PPI_CHANNEL13
 #define PPI_CH1                  NRF_PPI_CHANNEL14
@@ -71,21 +79,309 @@ typedef struct
 {
     uint32_t lp_timer_time; ///< LP Timer time of common timepoint.
     uint32_t hp_timer_time; ///< HP Timer time of common timepoint.
+    bool     first;         ///< If this is the first timepoint since the HP timer was started.
 } common_timepoint_t;
 
+// Sums over the timepoints gathered while the HP timer was running continuously.
+typedef struct
+{
+    int64_t n;      ///< Number of timepoints.
+    int64_t sum_x;  ///< Sum of the LP timer time elapsed from the first timepoint, scaled by DRIFT_X_SHIFT.
+    int64_t sum_y;  ///< Sum of the differences between the HP timer and the LP timer time elapsed from the first timepoint.
+    int64_t sum_xx; ///< Sum of the squared scaled LP timer time.
+    int64_t sum_xy; ///< Sum of the products of the scaled LP timer time and the time differences.
+    int64_t sum_lp; ///< Sum of the LP timer time elapsed from the first timepoint.
+} segment_sums_t;
+
 // Static variables.
-static common_timepoint_t m_last_sync;    ///< Common timepoint of last synchronization event.
-static volatile bool      m_synchronized; ///< If timers were synchronized since last start.
-static bool               m_drift_known;  ///< If timer drift value is known.
-static int32_t            m_drift;        ///< Drift of the HP timer relatively to the LP timer [PPTB].
+static common_timepoint_t m_last_sync;                     ///< Common timepoint of last synchronization event.
+static volatile bool      m_synchronized;                  ///< If timers were synchronized since last start.
+static bool               m_drift_known;                   ///< If timer drift value is known.
+static int32_t            m_drift;                         ///< Drift of the HP timer relatively to the LP timer [parts per DRIFT_BASE].
+static uint32_t           m_drift_uncertainty;             ///< Standard error of the drift estimate [parts per DRIFT_BASE].
+static common_timepoint_t m_timepoints[DRIFT_WINDOW_SIZE]; ///< Common timepoints of recent synchronization events.
+static uint8_t            m_timepoints_head;               ///< Index in @ref m_timepoints to store the next timepoint at.
+static uint8_t            m_timepoints_count;              ///< Number of valid timepoints in @ref m_timepoints.
+static bool               m_hp_timer_restarted;            ///< If the HP timer was started after the last timepoint was stored.
+
+/**
+ * @brief Calculates the integer square root of the given value, rounded up.
+ *
+ * @param[in]  value  Value to calculate the square root of.
+ *
+ * @returns  Square root of @p value.
+ */
+static uint32_t sqrt_u64(uint64_t value)
+{
+    uint64_t result = 0;
+    uint64_t bit    = 1ULL << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+
+    while (bit != 0)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+        {
+            result >>= 1;
+        }
+
+        bit >>= 2;
+    }
+
+    if (value != 0)
+    {
+        result++;
+    }
+
+    return (uint32_t)result;
+}
+
+/**
+ * @brief Stores a common timepoint in the sliding window used to estimate the drift.
+ *
+ * @param[in]  p_timepoint  Pointer to the timepoint to be stored.
+ */
+static void timepoint_store(const common_timepoint_t * p_timepoint)
+{
+    m_timepoints[m_timepoints_head]       = *p_timepoint;
+    m_timepoints[m_timepoints_head].first = m_hp_timer_restarted;
+    m_timepoints_head                     = (m_timepoints_head + 1) % DRIFT_WINDOW_SIZE;
+    m_hp_timer_restarted                  = false;
+
+    if (m_timepoints_count < DRIFT_WINDOW_SIZE)
+    {
+        m_timepoints_count++;
+    }
+}
+
+/**
+ * @brief Gets a stored timepoint.
+ *
+ * @param[in]  index  Index of the timepoint, counted from the oldest stored one.
+ *
+ * @returns  Pointer to the timepoint.
+ */
+static const common_timepoint_t * timepoint_get(uint8_t index)
+{
+    uint8_t first = (m_timepoints_head + DRIFT_WINDOW_SIZE - m_timepoints_count) % DRIFT_WINDOW_SIZE;
+
+    return &m_timepoints[(first + index) % DRIFT_WINDOW_SIZE];
+}
+
+/**
+ * @brief Gets the number of stored timepoints gathered while the HP timer was running continuously.
+ *
+ * @param[in]  start  Index of the first timepoint of the segment, counted from the oldest stored one.
+ *
+ * @returns  Number of timepoints in the segment starting at @p start.
+ */
+static uint8_t segment_length_get(uint8_t start)
+{
+    uint8_t end = start + 1;
+
+    while ((end < m_timepoints_count) && !timepoint_get(end)->first)
+    {
+        end++;
+    }
+
+    return end - start;
+}
+
+/**
+ * @brief Calculates the sums over the timepoints of a segment used by the least squares method.
+ *
+ * The times are counted from the first timepoint of the segment, as the HP timer times of
+ * different segments cannot be compared.
+ *
+ * @param[in]   start   Index of the first timepoint of the segment, counted from the oldest stored one.
+ * @param[in]   length  Number of timepoints in the segment.
+ * @param[out]  p_sums  Calculated sums.
+ */
+static void segment_sums_get(uint8_t start, uint8_t length, segment_sums_t * p_sums)
+{
+    const common_timepoint_t * p_origin = timepoint_get(start);
+
+    memset(p_sums, 0, sizeof(*p_sums));
+    p_sums->n = length;
+
+    for (uint8_t i = start; i < start + length; i++)
+    {
+        const common_timepoint_t * p_point = timepoint_get(i);
+
+        uint32_t lp_delta = p_point->lp_timer_time - p_origin->lp_timer_time;
+        uint32_t hp_delta = p_point->hp_timer_time - p_origin->hp_timer_time;
+        int64_t  x        = lp_delta >> DRIFT_X_SHIFT;
+        int64_t  y        = (int32_t)(hp_delta - lp_delta);
+
+        p_sums->sum_x  += x;
+        p_sums->sum_y  += y;
+        p_sums->sum_xx += x * x;
+        p_sums->sum_xy += x * y;
+        p_sums->sum_lp += lp_delta;
+    }
+}
+
+/**
+ * @brief Estimates the timers drift with the least squares method over the stored timepoints.
+ *
+ * The difference between the HP timer and the LP timer time elapsed from the first timepoint of
+ * each segment is fit with parallel lines as a function of the LP timer time. Each segment holds
+ * the timepoints gathered while the HP timer was running continuously, so the line of each segment
+ * has its own offset. The common slope of the lines is the drift. Its uncertainty is the standard
+ * error of the slope.
+ *
+ * @param[out]  p_drift        Estimated drift [parts per DRIFT_BASE].
+ * @param[out]  p_uncertainty  Standard error of @p p_drift [parts per DRIFT_BASE], or @ref DRIFT_UNKNOWN if there
+ *                             are not enough timepoints to estimate it.
+ *
+ * @retval true   The drift has been estimated.
+ * @retval false  There are not enough timepoints to estimate the drift.
+ */
+static bool drift_estimate(int32_t * p_drift, uint32_t * p_uncertainty)
+{
+    const uint8_t  n        = m_timepoints_count;
+    segment_sums_t sums;
+    uint8_t        length;
+    uint8_t        segments = 0;
+    int64_t        s_xx     = 0;
+    int64_t        s_xy     = 0;
+    int64_t        dof;
+    uint64_t       ssr      = 0;
+    int32_t        drift;
+
+    // Centered sums of squares and products, pooled over the segments.
+    for (uint8_t start = 0; start < n; start += length)
+    {
+        length = segment_length_get(start);
+        segment_sums_get(start, length, &sums);
+
+        s_xx += DIV_ROUND(sums.n * sums.sum_xx - sums.sum_x * sums.sum_x, sums.n);
+        s_xy += DIV_ROUND((sums.n * sums.sum_xy - sums.sum_x * sums.sum_y) *
+                          (int64_t)(DRIFT_BASE >> DRIFT_X_SHIFT),
+                          sums.n);
+        segments++;
+    }
+
+    if (s_xx <= 0)
+    {
+        return false;
+    }
+
+    drift    = (int32_t)DIV_ROUND(s_xy, s_xx);
+    *p_drift = drift;
+
+    // Each segment fixes one offset and all of them fix the slope.
+    dof = (int64_t)n - segments - 1;
+
+    if (dof < 1)
+    {
+        *p_uncertainty = DRIFT_UNKNOWN;
+        return true;
+    }
+
+    // Sum of squared residuals with RESIDUAL_FRAC_BITS fractional bits. The residuals are
+    // multiplied by the number of timepoints in the segment to avoid rounding of the means.
+    for (uint8_t start = 0; start < n; start += length)
+    {
+        const common_timepoint_t * p_origin = timepoint_get(start);
+
+        length = segment_length_get(start);
+        segment_sums_get(start, length, &sums);
+
+        for (uint8_t i = start; i < start + length; i++)
+        {
+            const common_timepoint_t * p_point = timepoint_get(i);
+
+            uint32_t lp_delta   = p_point->lp_timer_time - p_origin->lp_timer_time;
+            uint32_t hp_delta   = p_point->hp_timer_time - p_origin->hp_timer_time;
+            int64_t  y          = (int32_t)(hp_delta - lp_delta);
+            int64_t  x_centered = sums.n * (int64_t)lp_delta - sums.sum_lp;
+            int64_t  residual_n = sums.n * y - sums.sum_y -
+                                  DIV_ROUND((int64_t)drift * x_centered, (int64_t)DRIFT_BASE);
+            int64_t  residual   = DIV_ROUND(residual_n * (1 << RESIDUAL_FRAC_BITS), sums.n);
+
+            ssr += (uint64_t)(residual * residual);
+        }
+    }
+
+    // Variance of the slope is SSR / dof / Sxx. The slope is scaled from the units of
+    // 2^DRIFT_X_SHIFT us to DRIFT_BASE.
+    if (ssr >= (1ULL << (63 - (2 * (26 - DRIFT_X_SHIFT) - 2 * RESIDUAL_FRAC_BITS))))
+    {
+        *p_uncertainty = DRIFT_UNKNOWN;
+    }
+    else
+    {
+        uint64_t variance = (ssr << (2 * (26 - DRIFT_X_SHIFT) - 2 * RESIDUAL_FRAC_BITS)) /
+                            ((uint64_t)dof * (uint64_t)s_xx);
+
+        *p_uncertainty = sqrt_u64(variance);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Gets the delay of the next resynchronization.
+ *
+ * The delay is extended when the drift estimate is tight enough to keep the timestamp error
+ * accumulated until the next resynchronization below @ref RESYNC_ERROR_TARGET.
+ *
+ * @returns  Delay of the next resynchronization [us].
+ */
+static uint32_t resync_time_get(void)
+{
+    uint64_t resync_time;
+
+    if (!m_drift_known)
+    {
+        return FIRST_RESYNC_TIME;
+    }
+
+    if ((m_timepoints_count < DRIFT_WINDOW_SIZE) || (m_drift_uncertainty == DRIFT_UNKNOWN))
+    {
+        return RESYNC_TIME;
+    }
+
+    if (m_drift_uncertainty == 0)
+    {
+        return MAX_RESYNC_TIME;
+    }
+
+    resync_time = ((uint64_t)RESYNC_ERROR_TARGET * DRIFT_BASE) / m_drift_uncertainty;
+
+    if (resync_time < RESYNC_TIME)
+    {
+        resync_time = RESYNC_TIME;
+    }
+    else if (resync_time > MAX_RESYNC_TIME)
+    {
+        resync_time = MAX_RESYNC_TIME;
+    }
+
+    return (uint32_t)resync_time;
+}
 
 void nrf_802154_timer_coord_init(void)
 {
     uint32_t sync_event;
     uint32_t sync_task;
 
-    m_drift       = 0;
-    m_drift_known = 0;
+    m_drift             = 0;
+    m_drift_known       = false;
+    m_drift_uncertainty = DRIFT_UNKNOWN;
+    m_timepoints_head   = 0;
+    m_timepoints_count  = 0;
+
+    m_hp_timer_restarted = true;
 
     nrf_802154_hp_timer_init();
 
@@ -114,6 +410,11 @@ void nrf_802154_timer_coord_start(void)
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TCOOR_START);
 
     m_synchronized = false;
+
+    // The HP timer is restarted, so the new timepoints start a new segment with its own offset.
+    // The LP timer keeps running, so the stored timepoints still contribute to the drift estimate.
+    m_hp_timer_restarted = true;
+
     nrf_802154_hp_timer_start();
     nrf_802154_hp_timer_sync_prepare();
     nrf_802154_lp_timer_sync_start_now();
@@ -146,24 +447,33 @@ void nrf_802154_timer_coord_timestamp_prepare(uint32_t event_addr)
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_TCOOR_TIMESTAMP_PREPARE);
 }
 
+/**
+ * @brief Converts the HP timer time to the absolute time of the LP timer.
+ *
+ * @param[in]  hp_time  HP timer time to convert.
+ *
+ * @returns  Absolute time corresponding to @p hp_time [us].
+ */
+static uint32_t hp_time_convert(uint32_t hp_time)
+{
+    uint32_t hp_delta = hp_time - m_last_sync.hp_timer_time;
+    int32_t  drift    = m_drift_known ?
+                        (DIV_ROUND(((int64_t)m_drift * hp_delta), ((int64_t)DRIFT_BASE + m_drift))) :
+                        0;
+
+    return m_last_sync.lp_timer_time + hp_delta - drift;
+}
+
 bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
 {
-    uint32_t hp_timestamp;
-    uint32_t hp_delta;
-    int32_t  drift;
-    bool     result = false;
+    bool result = false;
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TCOOR_TIMESTAMP_GET);
     assert(p_timestamp != NULL);
 
     if (m_synchronized)
     {
-        hp_timestamp = nrf_802154_hp_timer_timestamp_get();
-        hp_delta     = hp_timestamp - m_last_sync.hp_timer_time;
-        drift        = m_drift_known ?
-                       (DIV_ROUND(((int64_t)m_drift * hp_delta), ((int64_t)TIME_BASE + m_drift))) :
-                       0;
-        *p_timestamp = m_last_sync.lp_timer_time + hp_delta - drift;
+        *p_timestamp = hp_time_convert(nrf_802154_hp_timer_timestamp_get());
         result       = true;
     }
 
@@ -171,14 +481,55 @@ bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
     return result;
 }
 
+bool nrf_802154_timer_coord_time_get(uint32_t * p_time)
+{
+    bool result = false;
+
+    assert(p_time != NULL);
+
+    if (m_synchronized)
+    {
+        *p_time = hp_time_convert(nrf_802154_hp_timer_current_time_get());
+        result  = true;
+    }
+
+    return result;
+}
+
+bool nrf_802154_timer_coord_drift_get(int32_t * p_drift, uint32_t * p_uncertainty)
+{
+    int32_t  drift;
+    uint32_t uncertainty;
+    bool     result;
+
+    assert(p_drift != NULL);
+    assert(p_uncertainty != NULL);
+
+    nrf_802154_lp_timer_critical_section_enter();
+
+    result      = m_drift_known;
+    drift       = m_drift;
+    uncertainty = m_drift_uncertainty;
+
+    nrf_802154_lp_timer_critical_section_exit();
+
+    if (result)
+    {
+        *p_drift       = (int32_t)DIV_ROUND((int64_t)drift * PPB_PER_UNIT, (int64_t)DRIFT_BASE);
+        *p_uncertainty = (uncertainty == DRIFT_UNKNOWN) ?
+                         UINT32_MAX :
+                         (uint32_t)DIV_ROUND_POSITIVE((uint64_t)uncertainty * PPB_PER_UNIT,
+                                                      DRIFT_BASE);
+    }
+
+    return result;
+}
+
 void nrf_802154_lp_timer_synchronized(void)
 {
     common_timepoint_t sync_time;
-    uint32_t           lp_delta;
-    uint32_t           hp_delta;
-    int32_t            timers_diff;
     int32_t            drift;
-    int32_t            tb_fraction_of_lp_delta;
+    uint32_t           uncertainty;
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_TCOOR_SYNCHRONIZED);
 
@@ -187,24 +538,13 @@ void nrf_802154_lp_timer_synchronized(void)
         sync_time.lp_timer_time = nrf_802154_lp_timer_sync_time_get();
 
         // Calculate timers drift
-        if (m_synchronized)
+        timepoint_store(&sync_time);
+
+        if (drift_estimate(&drift, &uncertainty))
         {
-            lp_delta                = sync_time.lp_timer_time - m_last_sync.lp_timer_time;
-            hp_delta                = sync_time.hp_timer_time - m_last_sync.hp_timer_time;
-            tb_fraction_of_lp_delta = DIV_ROUND_POSITIVE(lp_delta, TIME_BASE);
-            timers_diff             = hp_delta - lp_delta;
-            drift                   = DIV_ROUND(timers_diff, tb_fraction_of_lp_delta); // Drift in PPTB
-
-            if (m_drift_known)
-            {
-                m_drift = DIV_ROUND((m_drift * (EWMA_COEF - 1) + drift), EWMA_COEF);
-            }
-            else
-            {
-                m_drift = drift;
-            }
-
-            m_drift_known = true;
+            m_drift             = drift;
+            m_drift_uncertainty = uncertainty;
+            m_drift_known       = true;
         }
 
         /* To avoid possible race when nrf_802154_timer_coord_timestamp_get
@@ -219,8 +559,7 @@ void nrf_802154_lp_timer_synchronized(void)
         m_synchronized = true;
 
         nrf_802154_hp_timer_sync_prepare();
-        nrf_802154_lp_timer_sync_start_at(m_last_sync.lp_timer_time,
-                                          m_drift_known ? RESYNC_TIME : FIRST_RESYNC_TIME);
+        nrf_802154_lp_timer_sync_start_at(m_last_sync.lp_timer_time, resync_time_get());
     }
     else
     {
@@ -269,4 +608,23 @@ bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp)
     return false;
 }
 
+bool nrf_802154_timer_coord_time_get(uint32_t * p_time)
+{
+    (void)p_time;
+
+    // Intentionally empty
+
+    return false;
+}
+
+bool nrf_802154_timer_coord_drift_get(int32_t * p_drift, uint32_t * p_uncertainty)
+{
+    (void)p_drift;
+    (void)p_uncertainty;
+
+    // Intentionally empty
+
+    return false;
+}
+
 #endif // NRF_802154_FRAME_TIMESTAMP_ENABLED
@@ -106,6 +106,36 @@ void nrf_802154_timer_coord_timestamp_prepare(uint32_t event_addr);
  */
 bool nrf_802154_timer_coord_timestamp_get(uint32_t * p_timestamp);
 
+/**
+ * @brief Gets the current time with the precision of the HP timer.
+ *
+ * If the HP timer is not running or not synchronized, this function returns false.
+ *
+ * @param[out]  p_time  Precise absolute current time, in microseconds (us).
+ *
+ * @retval true   Current time is available.
+ * @retval false  Current time is unavailable.
+ */
+bool nrf_802154_timer_coord_time_get(uint32_t * p_time);
+
+/**
+ * @brief Gets the estimated drift of the HP timer relatively to the LP timer.
+ *
+ * The drift is estimated with the least squares method over a sliding window of the recent
+ * synchronization timepoints, including the ones gathered in the previous timeslots. Its
+ * uncertainty is the standard error of the estimate. The interval between resynchronizations is
+ * extended when the uncertainty is low.
+ *
+ * @param[out]  p_drift        Estimated drift, in parts per billion (ppb). A positive value means
+ *                             that the HP timer runs faster than the LP timer.
+ * @param[out]  p_uncertainty  Standard error of @p p_drift, in parts per billion (ppb). It is set
+ *                             to UINT32_MAX if it cannot be estimated yet.
+ *
+ * @retval true   The drift is known.
+ * @retval false  The drift is not known yet.
+ */
+bool nrf_802154_timer_coord_drift_get(int32_t * p_drift, uint32_t * p_uncertainty);
+
 /**
  *@}
  **/
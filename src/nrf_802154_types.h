@@ -31,6 +31,7 @@
 #ifndef NRF_802154_TYPES_H__
 #define NRF_802154_TYPES_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "nrf_radio.h"
@@ -119,6 +120,14 @@ typedef uint8_t nrf_802154_term_t;
 #define NRF_802154_TERM_NONE   0x00 // !< Request is skipped if another operation is ongoing.
 #define NRF_802154_TERM_802154 0x01 // !< Request terminates the ongoing 802.15.4 operation.
 
+/**
+ * @brief Function called when an asynchronous request has been processed by the driver.
+ *
+ * @param[in]  result     Result of the request, the same as the synchronous variant would return.
+ * @param[in]  p_context  Context passed with the request.
+ */
+typedef void (* nrf_802154_request_done_t)(bool result, void * p_context);
+
 /**
  * @brief Structure for configuring CCA.
  */
@@ -144,6 +153,138 @@ typedef uint8_t nrf_802154_ack_data_t;
 
 #define NRF_802154_RSSI_INVALID INT8_MAX
 
+/**
+ * @brief Statistics of a single window of the duty-cycled reception.
+ */
+typedef struct
+{
+    uint32_t start;          // !< Scheduled start time of the window, in microseconds. It uses the Timer Scheduler time base.
+    uint32_t listen_time;    // !< Time during which the radio was in the receive state in the window, in microseconds.
+    uint8_t  frames_started; // !< Number of frame receptions started in the window.
+    bool     skipped;        // !< If the window was skipped because the radio was busy.
+    bool     extended;       // !< If the window was extended due to an ongoing frame reception.
+} nrf_802154_rx_window_stats_t;
+
+/**
+ * @brief Cumulative statistics of the duty-cycled reception.
+ */
+typedef struct
+{
+    nrf_802154_rx_window_stats_t last_window;      // !< Statistics of the most recently closed window.
+    uint32_t                     windows;          // !< Number of closed windows.
+    uint32_t                     windows_skipped;  // !< Number of windows skipped because the radio was busy.
+    uint32_t                     windows_extended; // !< Number of windows extended due to an ongoing frame reception.
+    uint32_t                     frames_started;   // !< Number of frame receptions started in the windows.
+    uint64_t                     listen_time;      // !< Total time during which the radio was in the receive state in the windows, in microseconds.
+} nrf_802154_rx_duty_cycle_stats_t;
+
+/**
+ * @brief Time spent by the driver in a single state.
+ */
+typedef struct
+{
+    uint64_t time;               // !< Total time spent in the state, in microseconds.
+    uint64_t waiting_time;       // !< Part of @c time during which the radio timeslot was requested but not granted, in microseconds.
+    uint64_t waiting_hfclk_time; // !< Part of @c waiting_time during which the high-frequency clock was not running, in microseconds.
+    uint64_t waiting_raal_time;  // !< Part of @c waiting_time during which the RAAL did not grant the timeslot, in microseconds.
+    uint64_t waiting_coex_time;  // !< Part of @c waiting_time during which the Wi-Fi coexistence arbiter did not grant the medium, in microseconds.
+    uint32_t entries;            // !< Number of times the state was entered.
+} nrf_802154_state_time_t;
+
+/**
+ * @brief Time spent by the driver in each of its states.
+ */
+typedef struct
+{
+    nrf_802154_state_time_t sleep;              // !< Sleep state.
+    nrf_802154_state_time_t falling_asleep;     // !< Waiting for the ongoing operation to finish before the sleep state.
+    nrf_802154_state_time_t rx;                 // !< Receiving frames.
+    nrf_802154_state_time_t tx_ack;             // !< Transmitting ACK for a received frame.
+    nrf_802154_state_time_t cca_tx;             // !< Performing CCA before a frame transmission.
+    nrf_802154_state_time_t tx;                 // !< Transmitting a frame.
+    nrf_802154_state_time_t rx_ack;             // !< Receiving ACK for a transmitted frame.
+    nrf_802154_state_time_t ed;                 // !< Performing the energy detection procedure.
+    nrf_802154_state_time_t cca;                // !< Performing the stand-alone CCA procedure.
+    nrf_802154_state_time_t continuous_carrier; // !< Emitting the continuous carrier wave.
+} nrf_802154_state_time_stats_t;
+
+/**
+ * @brief Counters of the events in the driver.
+ */
+typedef struct
+{
+    uint32_t rx_accepted;                   // !< Number of frames passed to the higher layer.
+    uint32_t rx_filtered_invalid_frame;     // !< Number of frames dropped by the filter because they were malformed.
+    uint32_t rx_filtered_invalid_dest_addr; // !< Number of frames dropped by the filter because they were destined to another node.
+    uint32_t rx_filtered_invalid_length;    // !< Number of frames dropped by the filter because of an invalid length.
+    uint32_t rx_filtered_ack;               // !< Number of ACK frames dropped because they were received outside of the transmit procedure.
+    uint32_t rx_crc_errors;                 // !< Number of frames received with an invalid checksum.
+    uint32_t rx_runtime_errors;             // !< Number of frames dropped because the filtering did not complete in time.
+    uint32_t rx_buffer_overruns;            // !< Number of times the receiver was stopped because all receive buffers were in use.
+    uint32_t rx_timeslot_denials;           // !< Number of frames dropped because the timeslot to receive the frame was denied.
+    uint32_t rx_timeslot_ended;             // !< Number of frames dropped because the timeslot ended during the reception.
+    uint32_t ack_sent;                      // !< Number of transmitted ACK frames.
+    uint32_t ack_create_failures;           // !< Number of requested ACK frames that could not be created.
+    uint32_t ack_timeslot_denials;          // !< Number of received frames not acknowledged because the timeslot to transmit the ACK was denied.
+    uint32_t tx_attempts;                   // !< Number of started transmissions, including retransmissions and CSMA-CA attempts.
+    uint32_t tx_success;                    // !< Number of successfully transmitted frames.
+    uint32_t tx_cca_busy;                   // !< Number of transmissions not started due to a busy channel.
+    uint32_t tx_no_ack;                     // !< Number of transmitted frames with no ACK received before the timeout.
+    uint32_t tx_invalid_ack;                // !< Number of transmitted frames with an unexpected frame received instead of the ACK.
+    uint32_t tx_no_mem;                     // !< Number of transmitted frames with no receive buffer available for the ACK.
+    uint32_t tx_timeslot_denials;           // !< Number of transmissions not started due to a denied timeslot request.
+    uint32_t tx_timeslot_ended;             // !< Number of transmissions interrupted by the end of the timeslot.
+} nrf_802154_stats_t;
+
+/**
+ * @brief Number of bins in the histogram of the RADIO IRQ latency.
+ *
+ * Bin 0 counts the latencies shorter than 1 us, bin n counts the latencies from 2^(n-1) us to
+ * 2^n us, and the last bin counts also all longer latencies.
+ */
+#define NRF_802154_IRQ_LATENCY_HIST_BINS 10
+
+/**
+ * @brief Latency of the RADIO IRQ handler for a single RADIO event.
+ */
+typedef struct
+{
+    uint32_t count;                                  // !< Number of the measured events.
+    uint32_t max;                                    // !< Worst-case latency, in microseconds.
+    uint64_t sum;                                    // !< Sum of the latencies, in microseconds.
+    uint32_t hist[NRF_802154_IRQ_LATENCY_HIST_BINS]; // !< Histogram of the latencies.
+} nrf_802154_irq_latency_t;
+
+/**
+ * @brief Latency of the RADIO IRQ handler for each measured RADIO event.
+ */
+typedef struct
+{
+    nrf_802154_irq_latency_t framestart; // !< FRAMESTART (ADDRESS) event of a transmitted frame.
+    nrf_802154_irq_latency_t bcmatch;    // !< BCMATCH event of a received frame.
+    nrf_802154_irq_latency_t crcok;      // !< CRCOK event of a received frame.
+    nrf_802154_irq_latency_t phyend;     // !< PHYEND event of a transmitted frame or ACK.
+    nrf_802154_irq_latency_t end;        // !< END event of a received ACK.
+    nrf_802154_irq_latency_t disabled;   // !< DISABLED event before the sleep state.
+    nrf_802154_irq_latency_t ccaidle;    // !< CCAIDLE event of the stand-alone CCA procedure.
+} nrf_802154_irq_latency_stats_t;
+
+/**
+ * @brief Estimate of the charge drawn by the radio subsystem.
+ */
+typedef struct
+{
+    uint64_t time;            // !< Time covered by the estimate, in microseconds.
+    uint64_t rx_time;         // !< Time during which the radio was receiving, in microseconds. It includes CCA and energy detection.
+    uint64_t tx_time;         // !< Time during which the radio was transmitting, in microseconds.
+    uint64_t hfclk_time;      // !< Time during which the high-frequency clock was running, in microseconds.
+    uint64_t charge;          // !< Total charge drawn, in microampere-microseconds (picocoulombs).
+    uint64_t rx_charge;       // !< Part of @c charge drawn when receiving, including the FEM LNA.
+    uint64_t tx_charge;       // !< Part of @c charge drawn when transmitting, including the FEM PA.
+    uint64_t hfclk_charge;    // !< Part of @c charge drawn by the high-frequency clock.
+    uint32_t average_current; // !< Average current over @c time, in microamperes.
+} nrf_802154_energy_stats_t;
+
 /**
  *@}
  **/
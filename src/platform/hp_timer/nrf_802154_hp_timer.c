@@ -52,6 +52,9 @@
 #define TIMER                 NRF_TIMER0
 
 /**@brief Timer compare channel definitions. */
+#define TIMER_CC_LATENCY      NRF_TIMER_CC_CHANNEL0
+#define TIMER_CC_LATENCY_TASK NRF_TIMER_TASK_CAPTURE0
+
 #define TIMER_CC_CAPTURE      NRF_TIMER_CC_CHANNEL1
 #define TIMER_CC_CAPTURE_TASK NRF_TIMER_TASK_CAPTURE1
 
@@ -67,6 +70,9 @@
 /**@brief Unexpected value in the sync compare channel. */
 static uint32_t m_unexpected_sync;
 
+/**@brief Unexpected value in the latency compare channel. */
+static uint32_t m_unexpected_latency;
+
 /**@brief Get current time on the Timer. */
 static inline uint32_t timer_time_get(void)
 {
@@ -101,6 +107,11 @@ void nrf_802154_hp_timer_stop(void)
 #endif // !RAAL_SOFTDEVICE && !RAAL_SIMULATOR && !RAAL_REM
 }
 
+uint32_t nrf_802154_hp_timer_current_time_get(void)
+{
+    return timer_time_get();
+}
+
 uint32_t nrf_802154_hp_timer_sync_task_get(void)
 {
     return (uint32_t)nrf_timer_task_address_get(TIMER, TIMER_CC_SYNC_TASK);
@@ -139,3 +150,32 @@ uint32_t nrf_802154_hp_timer_timestamp_get(void)
 {
     return nrf_timer_cc_read(TIMER, TIMER_CC_EVT);
 }
+
+uint32_t nrf_802154_hp_timer_latency_task_get(void)
+{
+    return (uint32_t)nrf_timer_task_address_get(TIMER, TIMER_CC_LATENCY_TASK);
+}
+
+void nrf_802154_hp_timer_latency_prepare(void)
+{
+    uint32_t past_time = timer_time_get() - 1;
+
+    m_unexpected_latency = past_time;
+    nrf_timer_cc_write(TIMER, TIMER_CC_LATENCY, past_time);
+}
+
+bool nrf_802154_hp_timer_latency_time_get(uint32_t * p_timestamp)
+{
+    bool     result       = false;
+    uint32_t latency_time = nrf_timer_cc_read(TIMER, TIMER_CC_LATENCY);
+
+    assert(p_timestamp != NULL);
+
+    if (latency_time != m_unexpected_latency)
+    {
+        *p_timestamp = latency_time;
+        result       = true;
+    }
+
+    return result;
+}
@@ -137,6 +137,30 @@ uint32_t nrf_802154_hp_timer_timestamp_task_get(void);
  */
 uint32_t nrf_802154_hp_timer_timestamp_get(void);
 
+/**
+ * @brief Gets the task used to capture the time of a RADIO event for the IRQ latency measurement.
+ *
+ * This function is to be used to configure PPI.
+ *
+ * @returns  Address of the task.
+ */
+uint32_t nrf_802154_hp_timer_latency_task_get(void);
+
+/**
+ * @brief Configures the timer to detect if the latency capture task was triggered.
+ */
+void nrf_802154_hp_timer_latency_prepare(void);
+
+/**
+ * @brief Gets the time captured by the latency capture task.
+ *
+ * @param[out]  p_timestamp  Time of the event that triggered the latency capture task.
+ *
+ * @retval true   The task was triggered and @p p_timestamp is valid.
+ * @retval false  The task was not triggered. @p p_timestamp was not modified.
+ */
+bool nrf_802154_hp_timer_latency_time_get(uint32_t * p_timestamp);
+
 /**
  *@}
  **/
@@ -109,6 +109,20 @@ void nrf_802154_lp_timer_critical_section_exit(void);
  */
 uint32_t nrf_802154_lp_timer_time_get(void);
 
+/**
+ * @brief Gets the current time as a 64-bit value.
+ *
+ * The 32 least significant bits of the returned value are equal to the value returned by
+ * @ref nrf_802154_lp_timer_time_get. The returned value does not wrap around during
+ * the lifetime of the device.
+ *
+ * @pre Before getting the current time, the timer must be initialized with
+ * @ref nrf_802154_lp_timer_init().
+ *
+ * @returns Current time in microseconds.
+ */
+uint64_t nrf_802154_lp_timer_time64_get(void);
+
 /**
  * @brief Gets the granularity of the timer.
  *
@@ -133,6 +147,16 @@ uint32_t nrf_802154_lp_timer_granularity_get(void);
  */
 void nrf_802154_lp_timer_start(uint32_t t0, uint32_t dt);
 
+/**
+ * @brief Starts a one-shot timer that expires at the specified 64-bit time.
+ *
+ * This function works like @ref nrf_802154_lp_timer_start, but the expiration time is given as
+ * a 64-bit value in the time base of @ref nrf_802154_lp_timer_time64_get.
+ *
+ * @param[in]  time  Time of the timer expiration, in microseconds.
+ */
+void nrf_802154_lp_timer_start64(uint64_t time);
+
 /**
  * @brief Stops the currently running timer.
  */
@@ -349,25 +349,16 @@ static uint64_t round_up_to_timer_ticks_multiply(uint64_t time)
 /**
  * @brief Start one-shot timer that expires at specified time on desired channel.
  *
- * Start one-shot timer that will expire @p dt microseconds after @p t0 time on channel @p channel.
- *
- * @param[in]  channel  Compare channel on which timer will be started.
- * @param[in]  t0       Number of microseconds representing timer start time.
- * @param[in]  dt       Time of timer expiration as time elapsed from @p t0 [us].
- * @param[in]  p_now    Pointer to data with the current time.
+ * @param[in]  channel      Compare channel on which timer will be started.
+ * @param[in]  target_time  Time of timer expiration [us].
  */
-static void timer_start_at(compare_channel_t channel,
-                           uint32_t          t0,
-                           uint32_t          dt,
-                           const uint64_t  * p_now)
+static void timer_start_at(compare_channel_t channel, uint64_t target_time)
 {
     uint64_t target_counter;
-    uint64_t target_time;
 
     nrf_rtc_int_disable(NRF_802154_RTC_INSTANCE, m_cmp_ch[channel].int_mask);
     nrf_rtc_event_enable(NRF_802154_RTC_INSTANCE, m_cmp_ch[channel].event_mask);
 
-    target_time    = convert_to_64bit_time(t0, dt, p_now);
     target_counter = time_to_ticks(target_time);
 
     m_target_times[channel] = round_up_to_timer_ticks_multiply(target_time);
@@ -384,7 +375,7 @@ static void timer_start_at(compare_channel_t channel,
  */
 static void timer_sync_start_at(uint32_t t0, uint32_t dt, const uint64_t * p_now)
 {
-    timer_start_at(SYNC_CHANNEL, t0, dt, p_now);
+    timer_start_at(SYNC_CHANNEL, convert_to_64bit_time(t0, dt, p_now));
 
     nrf_rtc_int_enable(NRF_802154_RTC_INSTANCE, m_cmp_ch[SYNC_CHANNEL].int_mask);
 }
@@ -472,6 +463,11 @@ uint32_t nrf_802154_lp_timer_time_get(void)
     return (uint32_t)curr_time_get();
 }
 
+uint64_t nrf_802154_lp_timer_time64_get(void)
+{
+    return curr_time_get();
+}
+
 uint32_t nrf_802154_lp_timer_granularity_get(void)
 {
     return NRF_802154_US_PER_TICK;
@@ -479,19 +475,18 @@ uint32_t nrf_802154_lp_timer_granularity_get(void)
 
 void nrf_802154_lp_timer_start(uint32_t t0, uint32_t dt)
 {
-    uint32_t offset;
-    uint32_t rtc_value;
-    uint64_t now;
+    uint64_t now = curr_time_get();
 
-    offset_and_counter_get(&offset, &rtc_value);
-    now = time_get(offset, rtc_value);
+    nrf_802154_lp_timer_start64(convert_to_64bit_time(t0, dt, &now));
+}
+
+void nrf_802154_lp_timer_start64(uint64_t time)
+{
+    uint64_t now;
 
-    timer_start_at(LP_TIMER_CHANNEL, t0, dt, &now);
+    timer_start_at(LP_TIMER_CHANNEL, time);
 
-    if (rtc_value != counter_get())
-    {
-        now = curr_time_get();
-    }
+    now = curr_time_get();
 
     if (shall_strike(now + MIN_RTC_COMPARE_EVENT_DT))
     {
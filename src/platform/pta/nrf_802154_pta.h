@@ -0,0 +1,116 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that defines the Packet Traffic Arbitration signals abstraction for the 802.15.4
+ *        driver.
+ *
+ */
+
+#ifndef NRF_802154_PTA_H_
+#define NRF_802154_PTA_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_pta Packet Traffic Arbitration signals abstraction for the 802.15.4 driver
+ * @{
+ * @ingroup nrf_802154_pta
+ * @brief The Packet Traffic Arbitration signals abstraction interface for the 802.15.4 driver.
+ *
+ * The Packet Traffic Arbitration (PTA) signals abstraction drives the REQUEST and PRIORITY signals
+ * of the PTA interface defined in the 802.15.2 and reports changes of the GRANT signal. It is used
+ * by the Wi-Fi Coexistence module, which implements the PTA client logic.
+ *
+ */
+
+/**
+ * @brief Initializes the PTA signals.
+ *
+ * After the initialization, the REQUEST signal is deasserted and the PRIORITY signal indicates
+ * the low priority.
+ */
+void nrf_802154_pta_init(void);
+
+/**
+ * @brief Deinitializes the PTA signals.
+ */
+void nrf_802154_pta_uninit(void);
+
+/**
+ * @brief Sets the state of the REQUEST signal.
+ *
+ * @param[in]  active  True if the radio access is to be requested from the arbiter.
+ */
+void nrf_802154_pta_request_set(bool active);
+
+/**
+ * @brief Sets the state of the PRIORITY signal.
+ *
+ * @param[in]  high  True if the request is to be signalled as the high-priority one.
+ */
+void nrf_802154_pta_priority_set(bool high);
+
+/**
+ * @brief Checks the state of the GRANT signal.
+ *
+ * @retval true   The arbiter grants the radio access.
+ * @retval false  The arbiter denies the radio access.
+ */
+bool nrf_802154_pta_grant_get(void);
+
+/**
+ * @brief Gets the address of a hardware event generated when the arbiter revokes the grant.
+ *
+ * @returns Address of the grant revocation event or NULL if there is no such event.
+ */
+void * nrf_802154_pta_deny_event_addr_get(void);
+
+/**
+ * @brief Callback function executed when the state of the GRANT signal changes.
+ *
+ * The current state of the GRANT signal is to be read with @ref nrf_802154_pta_grant_get.
+ */
+extern void nrf_802154_pta_grant_changed(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_PTA_H_ */
@@ -0,0 +1,179 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the Packet Traffic Arbitration signals abstraction with GPIO and GPIOTE.
+ *
+ * The GRANT signal is detected with a single GPIOTE channel. The channel polarity is switched after
+ * each detected edge, so that while the radio access is granted the channel generates events only
+ * when the arbiter revokes the grant. This event can be connected with PPI to stop the radio
+ * immediately.
+ *
+ */
+
+#include "nrf_802154_pta.h"
+#include "nrf_802154_pta_gpiote.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_gpio.h"
+#include "nrf_gpiote.h"
+
+#include <nrf.h>
+
+#if NRF_802154_WIFI_COEX_ENABLED
+
+#define GPIOTE_CH        NRF_802154_WIFI_COEX_GPIOTE_CHANNEL          ///< GPIOTE channel detecting GRANT changes.
+#define GPIOTE_CH_INT    (GPIOTE_INTENSET_IN0_Msk << GPIOTE_CH)       ///< Interrupt mask of the GPIOTE channel.
+#define GPIOTE_CH_EVENT  (NRF_GPIOTE->EVENTS_IN[GPIOTE_CH])           ///< Event of the GPIOTE channel.
+
+#if NRF_802154_WIFI_COEX_GRANT_ACTIVE_HIGH
+#define GRANT_EDGE       NRF_GPIOTE_POLARITY_LOTOHI ///< Polarity of the edge asserting GRANT.
+#define DENY_EDGE        NRF_GPIOTE_POLARITY_HITOLO ///< Polarity of the edge deasserting GRANT.
+#else
+#define GRANT_EDGE       NRF_GPIOTE_POLARITY_HITOLO
+#define DENY_EDGE        NRF_GPIOTE_POLARITY_LOTOHI
+#endif
+
+static bool m_granted; ///< GRANT state the GPIOTE channel polarity is configured for.
+
+/** @brief Read the current state of the GRANT signal. */
+static inline bool grant_pin_read(void)
+{
+    return nrf_gpio_pin_read(NRF_802154_WIFI_COEX_GRANT_PIN) ==
+           (NRF_802154_WIFI_COEX_GRANT_ACTIVE_HIGH ? 1UL : 0UL);
+}
+
+/** @brief Configure the GPIOTE channel to detect the next edge of the GRANT signal.
+ *
+ * @retval true   GRANT state changed since the last configuration.
+ * @retval false  GRANT state did not change.
+ */
+static bool grant_edge_update(void)
+{
+    bool changed = false;
+    bool granted = grant_pin_read();
+
+    // The signal can change while the polarity is reconfigured. Repeat until it is stable.
+    while (granted != m_granted)
+    {
+        m_granted = granted;
+        changed   = true;
+
+        nrf_gpiote_event_configure(GPIOTE_CH,
+                                   NRF_802154_WIFI_COEX_GRANT_PIN,
+                                   granted ? DENY_EDGE : GRANT_EDGE);
+        GPIOTE_CH_EVENT = 0;
+        (void)GPIOTE_CH_EVENT;
+
+        granted = grant_pin_read();
+    }
+
+    return changed;
+}
+
+void nrf_802154_pta_init(void)
+{
+    nrf_gpio_pin_clear(NRF_802154_WIFI_COEX_REQUEST_PIN);
+    nrf_gpio_cfg_output(NRF_802154_WIFI_COEX_REQUEST_PIN);
+    nrf_gpio_pin_clear(NRF_802154_WIFI_COEX_PRIORITY_PIN);
+    nrf_gpio_cfg_output(NRF_802154_WIFI_COEX_PRIORITY_PIN);
+    nrf_gpio_cfg_input(NRF_802154_WIFI_COEX_GRANT_PIN, NRF_GPIO_PIN_NOPULL);
+
+    m_granted = false;
+
+    nrf_gpiote_event_configure(GPIOTE_CH, NRF_802154_WIFI_COEX_GRANT_PIN, GRANT_EDGE);
+    GPIOTE_CH_EVENT = 0;
+    nrf_gpiote_event_enable(GPIOTE_CH);
+    (void)grant_edge_update();
+
+    NRF_GPIOTE->INTENSET = GPIOTE_CH_INT;
+    NVIC_SetPriority(GPIOTE_IRQn, NRF_802154_IRQ_PRIORITY);
+    NVIC_ClearPendingIRQ(GPIOTE_IRQn);
+    NVIC_EnableIRQ(GPIOTE_IRQn);
+}
+
+void nrf_802154_pta_uninit(void)
+{
+    NRF_GPIOTE->INTENCLR = GPIOTE_CH_INT;
+    nrf_gpiote_event_disable(GPIOTE_CH);
+    GPIOTE_CH_EVENT = 0;
+
+    nrf_gpio_pin_clear(NRF_802154_WIFI_COEX_REQUEST_PIN);
+    nrf_gpio_pin_clear(NRF_802154_WIFI_COEX_PRIORITY_PIN);
+}
+
+void nrf_802154_pta_request_set(bool active)
+{
+    nrf_gpio_pin_write(NRF_802154_WIFI_COEX_REQUEST_PIN, active ? 1 : 0);
+}
+
+void nrf_802154_pta_priority_set(bool high)
+{
+    nrf_gpio_pin_write(NRF_802154_WIFI_COEX_PRIORITY_PIN, high ? 1 : 0);
+}
+
+bool nrf_802154_pta_grant_get(void)
+{
+    return grant_pin_read();
+}
+
+void * nrf_802154_pta_deny_event_addr_get(void)
+{
+    return (void *)&GPIOTE_CH_EVENT;
+}
+
+void nrf_802154_pta_gpiote_irq_handler(void)
+{
+    if (GPIOTE_CH_EVENT && (NRF_GPIOTE->INTENSET & GPIOTE_CH_INT))
+    {
+        GPIOTE_CH_EVENT = 0;
+        (void)GPIOTE_CH_EVENT;
+
+        if (grant_edge_update())
+        {
+            nrf_802154_pta_grant_changed();
+        }
+    }
+}
+
+#if NRF_802154_WIFI_COEX_INTERNAL_GPIOTE_IRQ_HANDLING
+void GPIOTE_IRQHandler(void)
+{
+    nrf_802154_pta_gpiote_irq_handler();
+}
+
+#endif // NRF_802154_WIFI_COEX_INTERNAL_GPIOTE_IRQ_HANDLING
+
+#endif // NRF_802154_WIFI_COEX_ENABLED
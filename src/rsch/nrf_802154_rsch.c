@@ -4,8 +4,11 @@
 #include <stddef.h>
 #include <nrf.h>
 
+#include "../nrf_802154_config.h"
 #include "../nrf_802154_debug.h"
+#include "../nrf_802154_state_time.h"
 #include "nrf_802154_priority_drop.h"
+#include "nrf_802154_wifi_coex.h"
 #include "platform/clock/nrf_802154_clock.h"
 #include "raal/nrf_raal_api.h"
 #include "timer_scheduler/nrf_802154_timer_sched.h"
@@ -46,25 +49,66 @@
                                                 PREC_RAMP_UP_MARGIN)
 #endif
 
+/* The following macro defines how long before a delayed timeslot its preconditions are requested
+ * [us]. Besides the ramp-up time, the Wi-Fi arbiter must be requested early enough to be able to
+ * grant the medium on time.
+ */
+#if NRF_802154_WIFI_COEX_ENABLED && (NRF_802154_WIFI_COEX_REQUEST_LEAD_TIME > PREC_RAMP_UP_TIME)
+#define PREC_LEAD_TIME NRF_802154_WIFI_COEX_REQUEST_LEAD_TIME
+#else
+#define PREC_LEAD_TIME PREC_RAMP_UP_TIME
+#endif
+
+/** @brief Bitmask of priority levels above @ref RSCH_PRIO_IDLE up to @p prio (inclusive).
+ *
+ * Bit (n - 1) represents priority level n, so the highest priority level in a mask is the index of
+ * its most significant bit set plus one and an empty mask represents @ref RSCH_PRIO_IDLE.
+ */
+#define PRIO_MASK(prio)           ((1UL << (prio)) - 1UL)
+
+/** @brief Bit representing delayed timeslot @p id requiring preconditions at priority level @p prio.
+ *
+ * Bits are grouped by priority levels, so that the highest priority level required by any delayed
+ * timeslot can be found from the most significant bit set.
+ */
+#define DLY_TS_PREC_BIT(prio, id) (1UL << ((((prio) - 1) * RSCH_DLY_TS_NUM) + (id)))
+
 static volatile uint8_t     m_ntf_mutex;                     ///< Mutex for notyfying core.
 static volatile uint8_t     m_ntf_mutex_monitor;             ///< Mutex monitor, incremented every failed ntf mutex lock.
 static volatile uint8_t     m_req_mutex;                     ///< Mutex for requesting preconditions.
 static volatile uint8_t     m_req_mutex_monitor;             ///< Mutex monitor, incremented every failed req mutex lock.
 static volatile rsch_prio_t m_last_notified_prio;            ///< Last reported approved priority level.
-static volatile rsch_prio_t m_approved_prios[RSCH_PREC_CNT]; ///< Priority levels approved by each precondition.
+static volatile uint32_t    m_approved_masks[RSCH_PREC_CNT]; ///< Priority levels approved by each precondition, see @ref PRIO_MASK.
+static volatile uint32_t    m_dly_ts_prec_mask;              ///< Delayed timeslots requiring preconditions now, see @ref DLY_TS_PREC_BIT.
 static rsch_prio_t          m_requested_prio;                ///< Priority requested from all preconditions.
 static rsch_prio_t          m_cont_mode_prio;                ///< Continuous mode priority level. If continuous mode is not requested equal to @ref RSCH_PRIO_IDLE.
 
 typedef struct
 {
-    rsch_prio_t        prio;  ///< Delayed timeslot priority level. If delayed timeslot is not scheduled equal to @ref RSCH_PRIO_IDLE.
-    uint32_t           t0;    ///< Time base of the delayed timeslot trigger time.
-    uint32_t           dt;    ///< Time delta of the delayed timeslot trigger time.
-    nrf_802154_timer_t timer; ///< Timer used to trigger delayed timeslot.
+    rsch_prio_t        prio;   ///< Delayed timeslot priority level. If delayed timeslot is not scheduled equal to @ref RSCH_PRIO_IDLE.
+    uint32_t           t0;     ///< Time base of the delayed timeslot trigger time.
+    uint32_t           dt;     ///< Time delta of the delayed timeslot trigger time.
+    uint32_t           length; ///< Requested length of the delayed timeslot.
+    nrf_802154_timer_t timer;  ///< Timer used to trigger delayed timeslot.
 } dly_ts_t;
 
 static dly_ts_t m_dly_ts[RSCH_DLY_TS_NUM];
 
+#if NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+
+#define PRED_LENGTH_DECAY_SHIFT 3 ///< Weight of a shorter request in the predicted length, as a power of 2.
+#define PRED_INTERVAL_AVG_SHIFT 2 ///< Weight of a new interval in the averaged request interval, as a power of 2.
+
+static volatile uint8_t  m_pred_mutex;         ///< Mutex for updating the traffic prediction.
+static volatile uint8_t  m_pred_mutex_monitor; ///< Mutex monitor, incremented every failed pred mutex lock.
+static volatile uint32_t m_pred_gen;           ///< Generation of the prediction inputs, incremented on every change.
+static uint32_t          m_pred_length;        ///< Decaying peak of the recently requested timeslot lengths.
+static uint32_t          m_pred_interval;      ///< Averaged interval between unrelated timeslot requests. Zero if traffic is not periodic.
+static uint32_t          m_pred_last_req;      ///< Time of the last timeslot request.
+static uint32_t          m_pred_last_len;      ///< Length of the last timeslot request. Zero if there was no request yet.
+
+#endif // NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+
 /** @brief Non-blocking mutex for notifying core.
  *
  *  @param[inout]  p_mutex          Pointer to the mutex data.
@@ -112,37 +156,74 @@ static inline void mutex_unlock(volatile uint8_t * p_mutex)
     nrf_802154_log_exit(mutex_unlock, 2);
 }
 
-/** @brief Check maximal priority level required by any of delayed timeslots at the moment.
+/** @brief Get the highest priority level represented in the given priority mask.
  *
- * To meet delayed timeslot timing requirements there is a time window in which radio
- * preconditions should be requested. This function is used to prevent releasing preconditions
- * in this time window.
+ * @param[in]  mask  Priority mask, see @ref PRIO_MASK.
  *
- * @return  Maximal priority level required by delayed timeslots.
+ * @return  Highest priority level in @p mask or @ref RSCH_PRIO_IDLE if @p mask is empty.
  */
-static rsch_prio_t max_prio_for_delayed_timeslot_get(void)
+static inline rsch_prio_t prio_from_mask_get(uint32_t mask)
 {
-    nrf_802154_log_entry(max_prio_for_delayed_timeslot_get, 2);
+    return (rsch_prio_t)(32UL - __CLZ(mask));
+}
 
-    rsch_prio_t result = RSCH_PRIO_IDLE;
-    uint32_t    now    = nrf_802154_timer_sched_time_get();
+/** @brief Atomically modify the mask of delayed timeslots requiring preconditions.
+ *
+ * @param[in]  set    Bits to be set, see @ref DLY_TS_PREC_BIT.
+ * @param[in]  clear  Bits to be cleared, see @ref DLY_TS_PREC_BIT.
+ */
+static inline void dly_ts_prec_mask_modify(uint32_t set, uint32_t clear)
+{
+    uint32_t mask;
 
-    for (uint32_t i = 0; i < RSCH_DLY_TS_NUM; i++)
+    do
     {
-        dly_ts_t * p_dly_ts = &m_dly_ts[i];
-        uint32_t   t0       = p_dly_ts->t0;
-        uint32_t   dt       = p_dly_ts->dt - PREC_RAMP_UP_TIME -
-                              nrf_802154_timer_sched_granularity_get();
+        mask = __LDREXW(&m_dly_ts_prec_mask);
+        mask = (mask & ~clear) | set;
+    }
+    while (__STREXW(mask, &m_dly_ts_prec_mask));
 
-        if ((p_dly_ts->prio > result) && !nrf_802154_timer_sched_time_is_in_future(now, t0, dt))
-        {
-            result = p_dly_ts->prio;
-        }
+    __DMB();
+}
+
+/** @brief Mark that delayed timeslot requires preconditions from now on.
+ *
+ * To meet delayed timeslot timing requirements there is a time window in which radio
+ * preconditions should be requested. Delayed timeslot is marked on the beginning of this time
+ * window to prevent releasing preconditions until the timeslot is started or cancelled.
+ *
+ * @param[in]  dly_ts_id  Type of the delayed timeslot.
+ */
+static inline void dly_ts_prec_require(rsch_dly_ts_id_t dly_ts_id)
+{
+    dly_ts_prec_mask_modify(DLY_TS_PREC_BIT(m_dly_ts[dly_ts_id].prio, dly_ts_id), 0UL);
+}
+
+/** @brief Mark that delayed timeslot does not require preconditions anymore.
+ *
+ * @param[in]  dly_ts_id  Type of the delayed timeslot.
+ */
+static inline void dly_ts_prec_release(rsch_dly_ts_id_t dly_ts_id)
+{
+    uint32_t bits = 0UL;
+
+    for (uint32_t prio = RSCH_PRIO_MIN_APPROVED; prio <= RSCH_PRIO_MAX; prio++)
+    {
+        bits |= DLY_TS_PREC_BIT(prio, dly_ts_id);
     }
 
-    nrf_802154_log_exit(max_prio_for_delayed_timeslot_get, 2);
+    dly_ts_prec_mask_modify(0UL, bits);
+}
 
-    return result;
+/** @brief Check maximal priority level required by any of delayed timeslots at the moment.
+ *
+ * @return  Maximal priority level required by delayed timeslots.
+ */
+static inline rsch_prio_t max_prio_for_delayed_timeslot_get(void)
+{
+    uint32_t msb = 32UL - __CLZ(m_dly_ts_prec_mask);
+
+    return (rsch_prio_t)((msb + RSCH_DLY_TS_NUM - 1) / RSCH_DLY_TS_NUM);
 }
 
 static rsch_prio_t required_prio_lvl_get(void)
@@ -181,9 +262,13 @@ static inline void prec_approved_prio_set(rsch_prec_t prec, rsch_prio_t prio)
         return;
     }
 
-    assert((m_approved_prios[prec] != prio) || (prio == RSCH_PRIO_IDLE));
+    assert((m_approved_masks[prec] != PRIO_MASK(prio)) || (prio == RSCH_PRIO_IDLE));
 
-    m_approved_prios[prec] = prio;
+    m_approved_masks[prec] = PRIO_MASK(prio);
+
+#if NRF_802154_STATE_TIME_STATS_ENABLED
+    nrf_802154_state_time_prec_set(prec, prio != RSCH_PRIO_IDLE);
+#endif // NRF_802154_STATE_TIME_STATS_ENABLED
 
     nrf_802154_log_exit(prec_approved_prio_set, 2);
 }
@@ -213,6 +298,10 @@ static inline void all_prec_update(void)
         {
             m_requested_prio = new_prio;
 
+#if NRF_802154_STATE_TIME_STATS_ENABLED
+            nrf_802154_state_time_request_set(new_prio != RSCH_PRIO_IDLE);
+#endif // NRF_802154_STATE_TIME_STATS_ENABLED
+
             if (new_prio == RSCH_PRIO_IDLE)
             {
                 nrf_802154_priority_drop_hfclk_stop();
@@ -220,12 +309,16 @@ static inline void all_prec_update(void)
 
                 nrf_raal_continuous_mode_exit();
                 prec_approved_prio_set(RSCH_PREC_RAAL, RSCH_PRIO_IDLE);
+
+                nrf_802154_wifi_coex_prio_req(RSCH_PRIO_IDLE);
+                prec_approved_prio_set(RSCH_PREC_COEX, RSCH_PRIO_IDLE);
             }
             else
             {
                 nrf_802154_priority_drop_hfclk_stop_terminate();
                 nrf_802154_clock_hfclk_start();
                 nrf_raal_continuous_mode_enter();
+                nrf_802154_wifi_coex_prio_req(new_prio);
             }
         }
 
@@ -244,19 +337,16 @@ static inline rsch_prio_t approved_prio_lvl_get(void)
 {
     nrf_802154_log_entry(approved_prio_lvl_get, 2);
 
-    rsch_prio_t result = RSCH_PRIO_MAX;
+    uint32_t mask = PRIO_MASK(RSCH_PRIO_MAX);
 
     for (uint32_t i = 0; i < RSCH_PREC_CNT; i++)
     {
-        if (m_approved_prios[i] < result)
-        {
-            result = m_approved_prios[i];
-        }
+        mask &= m_approved_masks[i];
     }
 
     nrf_802154_log_exit(approved_prio_lvl_get, 2);
 
-    return result;
+    return prio_from_mask_get(mask);
 }
 
 /** @brief Check if all preconditions are requested or met at given priority level or higher.
@@ -312,6 +402,197 @@ static inline void notify_core(void)
     nrf_802154_log_exit(notify_core, 2);
 }
 
+#if NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+
+/** @brief Marks the prediction inputs as changed, so that concurrently computed hints are repeated. */
+static void prediction_inputs_changed(void)
+{
+    uint32_t gen;
+
+    __DMB();
+
+    do
+    {
+        gen = __LDREXW(&m_pred_gen);
+    }
+    while (__STREXW(gen + 1, &m_pred_gen));
+
+    __DMB();
+}
+
+/** @brief Updates the traffic prediction with a timeslot request.
+ *
+ * Requests following the previous one before the previously requested timeslot ended belong to
+ * the same radio exchange (i.e. a frame and its ACK) and do not affect the request interval.
+ *
+ * The update takes constant time. If it preempted another update, the request is not accounted
+ * in the prediction.
+ *
+ * @param[in]  now        Current time.
+ * @param[in]  length_us  Requested timeslot length.
+ */
+static void prediction_update(uint32_t now, uint32_t length_us)
+{
+    if (!mutex_trylock(&m_pred_mutex, &m_pred_mutex_monitor))
+    {
+        return;
+    }
+
+    uint32_t interval = now - m_pred_last_req;
+
+    if (length_us >= m_pred_length)
+    {
+        m_pred_length = length_us;
+    }
+    else
+    {
+        m_pred_length -= (m_pred_length - length_us) >> PRED_LENGTH_DECAY_SHIFT;
+    }
+
+    if ((m_pred_last_len == 0) || (interval >= m_pred_last_len))
+    {
+        if ((m_pred_last_len == 0) || (interval > NRF_802154_RSCH_PREDICTIVE_LOOKAHEAD_MAX))
+        {
+            // Traffic is too sparse to predict next request.
+            m_pred_interval = 0;
+        }
+        else if (m_pred_interval == 0)
+        {
+            m_pred_interval = interval;
+        }
+        else
+        {
+            m_pred_interval -= m_pred_interval >> PRED_INTERVAL_AVG_SHIFT;
+            m_pred_interval += interval >> PRED_INTERVAL_AVG_SHIFT;
+        }
+
+        m_pred_last_req = now;
+    }
+
+    m_pred_last_len = (length_us > 0) ? length_us : 1;
+
+    mutex_unlock(&m_pred_mutex);
+    prediction_inputs_changed();
+}
+
+/** @brief Predicts radio time needed by the core from now on.
+ *
+ * The prediction covers the expected next timeslot request and all pending delayed timeslots
+ * starting within @ref NRF_802154_RSCH_PREDICTIVE_LOOKAHEAD_MAX.
+ *
+ * @param[in]  now  Current time.
+ *
+ * @returns  Predicted radio time in microseconds.
+ */
+static uint32_t prediction_get(uint32_t now)
+{
+    uint32_t result = m_pred_length;
+
+    if (m_pred_interval != 0)
+    {
+        uint32_t elapsed = now - m_pred_last_req;
+
+        if (elapsed < m_pred_interval)
+        {
+            result += m_pred_interval - elapsed;
+        }
+    }
+
+    for (uint32_t i = 0; i < RSCH_DLY_TS_NUM; i++)
+    {
+        dly_ts_t * p_dly_ts = &m_dly_ts[i];
+        uint32_t   time_to_start;
+
+        if (p_dly_ts->prio == RSCH_PRIO_IDLE)
+        {
+            continue;
+        }
+
+        time_to_start = p_dly_ts->t0 + p_dly_ts->dt - now;
+
+        if (nrf_802154_timer_sched_time_is_in_future(now, p_dly_ts->t0, p_dly_ts->dt) &&
+            (time_to_start <= NRF_802154_RSCH_PREDICTIVE_LOOKAHEAD_MAX) &&
+            (time_to_start + p_dly_ts->length > result))
+        {
+            result = time_to_start + p_dly_ts->length;
+        }
+    }
+
+    return result;
+}
+
+/** @brief Checks if the prediction depends on the current time.
+ *
+ * @retval true   The traffic is periodic or a delayed timeslot is pending.
+ * @retval false  The prediction is the expected length of the next timeslot request only.
+ */
+static bool prediction_is_time_dependent(void)
+{
+    if (m_pred_interval != 0)
+    {
+        return true;
+    }
+
+    for (uint32_t i = 0; i < RSCH_DLY_TS_NUM; i++)
+    {
+        if (m_dly_ts[i].prio != RSCH_PRIO_IDLE)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** @brief Passes predicted radio time to RAAL, so it can extend the timeslot in advance.
+ *
+ * The hint is repeated if the prediction inputs changed in the meantime, so that the last hint
+ * passed to RAAL always reflects the last change. If the prediction is being updated by
+ * a preempted context, that context passes the hint when the update is finished.
+ *
+ * @param[in]  p_now  Pointer to the current time. If NULL, the time is read only if the prediction
+ *                    depends on it.
+ */
+static void prediction_hint(const uint32_t * p_now)
+{
+    uint32_t gen;
+    uint32_t now;
+
+    do
+    {
+        gen = m_pred_gen;
+        __DMB();
+
+        if (m_pred_mutex)
+        {
+            return;
+        }
+
+        if (p_now != NULL)
+        {
+            now = *p_now;
+        }
+        else
+        {
+            now = prediction_is_time_dependent() ? nrf_802154_timer_sched_time_get() : 0;
+        }
+
+        nrf_raal_timeslot_extension_hint(prediction_get(now));
+
+        __DMB();
+    }
+    while (gen != m_pred_gen);
+}
+
+__WEAK void nrf_raal_timeslot_extension_hint(uint32_t length_us)
+{
+    (void)length_us;
+
+    // Intentionally empty.
+}
+
+#endif // NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+
 /** Timer callback used to trigger delayed timeslot.
  *
  * @param[in]  p_context  Index of the delayed timeslot operation (TX or RX).
@@ -326,6 +607,11 @@ static void delayed_timeslot_start(void * p_context)
     nrf_802154_rsch_delayed_timeslot_started(dly_ts_id);
 
     p_dly_ts->prio = RSCH_PRIO_IDLE;
+    dly_ts_prec_release(dly_ts_id);
+
+#if NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+    prediction_inputs_changed();
+#endif
 
     all_prec_update();
     notify_core();
@@ -344,6 +630,7 @@ static void delayed_timeslot_prec_request(void * p_context)
 
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RSCH_TIMER_DELAYED_PREC);
 
+    dly_ts_prec_require(dly_ts_id);
     all_prec_update();
 
     p_dly_ts->timer.t0        = p_dly_ts->t0;
@@ -363,6 +650,7 @@ static void delayed_timeslot_prec_request(void * p_context)
 void nrf_802154_rsch_init(void)
 {
     nrf_raal_init();
+    nrf_802154_wifi_coex_init();
 
     m_ntf_mutex          = 0;
     m_req_mutex          = 0;
@@ -377,8 +665,19 @@ void nrf_802154_rsch_init(void)
 
     for (uint32_t i = 0; i < RSCH_PREC_CNT; i++)
     {
-        m_approved_prios[i] = RSCH_PRIO_IDLE;
+        m_approved_masks[i] = PRIO_MASK(RSCH_PRIO_IDLE);
     }
+
+    m_dly_ts_prec_mask = 0UL;
+
+#if NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+    m_pred_mutex    = 0;
+    m_pred_gen      = 0;
+    m_pred_length   = 0;
+    m_pred_interval = 0;
+    m_pred_last_req = 0;
+    m_pred_last_len = 0;
+#endif
 }
 
 void nrf_802154_rsch_uninit(void)
@@ -388,6 +687,7 @@ void nrf_802154_rsch_uninit(void)
         nrf_802154_timer_sched_remove(&m_dly_ts[i].timer, NULL);
     }
 
+    nrf_802154_wifi_coex_uninit();
     nrf_raal_uninit();
 }
 
@@ -413,7 +713,25 @@ void nrf_802154_rsch_continuous_ended(void)
 
 bool nrf_802154_rsch_timeslot_request(uint32_t length_us)
 {
-    return nrf_raal_timeslot_request(length_us);
+    nrf_802154_profile_begin(RSCH_TIMESLOT_REQUEST);
+
+    bool result = nrf_raal_timeslot_request(length_us);
+
+    if (result)
+    {
+        nrf_802154_wifi_coex_frame_started(length_us);
+    }
+
+#if NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+    uint32_t now = nrf_802154_timer_sched_time_get();
+
+    prediction_update(now, length_us);
+    prediction_hint(&now);
+#endif
+
+    nrf_802154_profile_end(RSCH_TIMESLOT_REQUEST);
+
+    return result;
 }
 
 bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
@@ -422,14 +740,12 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
                                               rsch_prio_t      prio,
                                               rsch_dly_ts_id_t dly_ts_id)
 {
-    (void)length;
-
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RSCH_DELAYED_TIMESLOT_REQ);
     assert(dly_ts_id < RSCH_DLY_TS_NUM);
 
     dly_ts_t * p_dly_ts = &m_dly_ts[dly_ts_id];
     uint32_t   now      = nrf_802154_timer_sched_time_get();
-    uint32_t   req_dt   = dt - PREC_RAMP_UP_TIME;
+    uint32_t   req_dt   = dt - PREC_LEAD_TIME;
     bool       result;
 
     assert(!nrf_802154_timer_sched_is_running(&p_dly_ts->timer));
@@ -438,9 +754,10 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
 
     if (nrf_802154_timer_sched_time_is_in_future(now, t0, req_dt))
     {
-        p_dly_ts->prio = prio;
-        p_dly_ts->t0   = t0;
-        p_dly_ts->dt   = dt;
+        p_dly_ts->prio   = prio;
+        p_dly_ts->t0     = t0;
+        p_dly_ts->dt     = dt;
+        p_dly_ts->length = length;
 
         p_dly_ts->timer.t0        = t0;
         p_dly_ts->timer.dt        = req_dt;
@@ -454,15 +771,18 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
     else if (requested_prio_lvl_is_at_least(RSCH_PRIO_MAX) &&
              nrf_802154_timer_sched_time_is_in_future(now, t0, dt))
     {
-        p_dly_ts->prio = prio;
-        p_dly_ts->t0   = t0;
-        p_dly_ts->dt   = dt;
+        p_dly_ts->prio   = prio;
+        p_dly_ts->t0     = t0;
+        p_dly_ts->dt     = dt;
+        p_dly_ts->length = length;
 
         p_dly_ts->timer.t0        = t0;
         p_dly_ts->timer.dt        = dt;
         p_dly_ts->timer.callback  = delayed_timeslot_start;
         p_dly_ts->timer.p_context = (void *)dly_ts_id;
 
+        dly_ts_prec_require(dly_ts_id);
+
         nrf_802154_timer_sched_add(&p_dly_ts->timer, true);
 
         result = true;
@@ -472,11 +792,24 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
         result = false;
     }
 
+#if NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+    if (result)
+    {
+        prediction_inputs_changed();
+        prediction_hint(&now);
+    }
+#endif
+
     nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RSCH_DELAYED_TIMESLOT_REQ);
 
     return result;
 }
 
+uint32_t nrf_802154_rsch_delayed_timeslot_lead_time_get(void)
+{
+    return PREC_LEAD_TIME;
+}
+
 bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id)
 {
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RSCH_DELAYED_TIMESLOT_CANCEL);
@@ -489,6 +822,12 @@ bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id)
     nrf_802154_timer_sched_remove(&p_dly_ts->timer, &was_running);
 
     p_dly_ts->prio = RSCH_PRIO_IDLE;
+    dly_ts_prec_release(dly_ts_id);
+
+#if NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+    prediction_inputs_changed();
+#endif
+
     all_prec_update();
     notify_core();
 
@@ -501,24 +840,20 @@ bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id)
 
 bool nrf_802154_rsch_timeslot_is_requested(void)
 {
-    bool result = false;
+    uint32_t mask = 0UL;
 
     for (uint32_t i = 0; i < RSCH_PREC_CNT; i++)
     {
-        if (m_approved_prios[i] > RSCH_PRIO_IDLE)
-        {
-            result = true;
-            break;
-        }
+        mask |= m_approved_masks[i];
     }
 
-    return result;
+    return mask != 0UL;
 }
 
 bool nrf_802154_rsch_prec_is_approved(rsch_prec_t prec, rsch_prio_t prio)
 {
     assert(prec < RSCH_PREC_CNT);
-    return m_approved_prios[prec] >= prio;
+    return (m_approved_masks[prec] & PRIO_MASK(prio)) == PRIO_MASK(prio);
 }
 
 uint32_t nrf_802154_rsch_timeslot_us_left_get(void)
@@ -532,6 +867,11 @@ void nrf_raal_timeslot_started(void)
 {
     nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RSCH_TIMESLOT_STARTED);
 
+#if NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED
+    // Reading the time is skipped if the prediction does not depend on it.
+    prediction_hint(NULL);
+#endif
+
     prec_approved_prio_set(RSCH_PREC_RAAL, RSCH_PRIO_MAX);
     notify_core();
 
@@ -553,3 +893,9 @@ void nrf_802154_clock_hfclk_ready(void)
     prec_approved_prio_set(RSCH_PREC_HFCLK, RSCH_PRIO_MAX);
     notify_core();
 }
+
+void nrf_802154_wifi_coex_prio_changed(rsch_prio_t priority)
+{
+    prec_approved_prio_set(RSCH_PREC_COEX, priority);
+    notify_core();
+}
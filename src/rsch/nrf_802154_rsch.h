@@ -54,7 +54,7 @@ extern "C" {
  * the core module.
  *
  * Examples of the radio activity preconditions are: High-Frequency Clock running, radio arbiter (RAAL)
- * granted access to the RADIO peripheral.
+ * granted access to the RADIO peripheral, Wi-Fi arbiter (PTA) granted access to the medium.
  */
 
 /**
@@ -64,6 +64,7 @@ typedef enum
 {
     RSCH_PREC_HFCLK,
     RSCH_PREC_RAAL,
+    RSCH_PREC_COEX,
     RSCH_PREC_CNT,
 } rsch_prec_t;
 
@@ -87,10 +88,11 @@ typedef enum
  */
 typedef enum
 {
-    RSCH_DLY_TX,     ///< Timeslot for delayed TX operation.
-    RSCH_DLY_RX,     ///< Timeslot for delayed RX operation.
+    RSCH_DLY_TX,            ///< Timeslot for delayed TX operation.
+    RSCH_DLY_RX,            ///< Timeslot for delayed RX operation.
+    RSCH_DLY_RX_DUTY_CYCLE, ///< Timeslot for duty-cycled RX window.
 
-    RSCH_DLY_TS_NUM, ///< Number of delayed timeslots.
+    RSCH_DLY_TS_NUM,        ///< Number of delayed timeslots.
 } rsch_dly_ts_id_t;
 
 /**
@@ -140,6 +142,10 @@ void nrf_802154_rsch_continuous_ended(void);
  * This function is to be called only after @ref nrf_802154_rsch_prec_is_approved indicated the
  * start of a timeslot.
  *
+ * @note If @ref NRF_802154_RSCH_PREDICTIVE_EXTENSION_ENABLED is set, the lengths and timing of
+ *       the requests are used to predict the radio time needed by the core, so that the timeslot
+ *       can be extended before the next request.
+ *
  * @param[in] length_us  Requested radio timeslot length in microseconds.
  *
  * @retval true   Radio driver has now exclusive access to the RADIO peripheral for the
@@ -176,6 +182,16 @@ bool nrf_802154_rsch_delayed_timeslot_request(uint32_t         t0,
                                               rsch_prio_t      prio,
                                               rsch_dly_ts_id_t dly_ts);
 
+/**
+ * @brief Gets the time by which a delayed timeslot must be requested in advance.
+ *
+ * A delayed timeslot requested later than this time before its start is scheduled only if
+ * the preconditions are already requested with the highest priority.
+ *
+ * @returns  Minimal time between the request and the start of a delayed timeslot, in microseconds.
+ */
+uint32_t nrf_802154_rsch_delayed_timeslot_lead_time_get(void);
+
 /**
  * @brief Cancels a requested future timeslot.
  *
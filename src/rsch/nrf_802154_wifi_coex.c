@@ -0,0 +1,448 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the Wi-Fi Coexistence module (the PTA client).
+ *
+ */
+
+#include "nrf_802154_wifi_coex.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "platform/pta/nrf_802154_pta.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#include <nrf.h>
+
+static nrf_802154_wifi_coex_cfg_t   m_config;                  ///< Current configuration.
+static nrf_802154_wifi_coex_stats_t m_stats[RSCH_PRIO_MAX + 1]; ///< Statistics of the requests at each priority level.
+
+#if NRF_802154_WIFI_COEX_ENABLED
+
+static volatile uint8_t     m_mutex;         ///< Mutex for processing the module state.
+static volatile uint8_t     m_mutex_monitor; ///< Mutex monitor, incremented every failed mutex lock.
+static volatile rsch_prio_t m_req_prio;      ///< Priority level requested by the Radio Scheduler.
+static volatile bool        m_frame_active;  ///< Indicates if any frame was started.
+static volatile uint32_t    m_frame_t0;      ///< Base time of the end of the last frame.
+static volatile uint32_t    m_frame_dt;      ///< Duration of the last frame.
+
+static rsch_prio_t          m_approved_prio; ///< Priority level last reported as approved.
+static bool                 m_req_active;    ///< Indicates if the REQUEST signal is asserted.
+static bool                 m_waiting;       ///< Indicates if the request waits for the grant.
+static rsch_prio_t          m_wait_prio;     ///< Priority level of the request waiting for the grant.
+static uint32_t             m_wait_time;     ///< Time since the request waits for the grant.
+static bool                 m_grant_seen;    ///< Indicates if the GRANT signal is asserted for the current request.
+static uint32_t             m_grant_time;    ///< Time since the GRANT signal is asserted.
+static bool                 m_deny_deferred; ///< Indicates if the revoked grant is deferred until the end of a frame.
+static nrf_802154_timer_t   m_timer;         ///< Timer used to wake up the state processing.
+
+static void state_update(void);
+
+/** @brief Non-blocking mutex for processing the module state.
+ *
+ * @retval  true   Mutex was acquired.
+ * @retval  false  Mutex could not be acquired.
+ */
+static inline bool mutex_trylock(void)
+{
+    do
+    {
+        uint8_t mutex_value = __LDREXB(&m_mutex);
+
+        if (mutex_value)
+        {
+            __CLREX();
+
+            m_mutex_monitor++;
+
+            return false;
+        }
+    }
+    while (__STREXB(1, &m_mutex));
+
+    __DMB();
+
+    return true;
+}
+
+/** @brief Release mutex. */
+static inline void mutex_unlock(void)
+{
+    __DMB();
+    m_mutex = 0;
+}
+
+/** @brief Timer callback used to process the state at a scheduled time. */
+static void timer_fired(void * p_context)
+{
+    (void)p_context;
+
+    state_update();
+}
+
+/** @brief Schedule processing of the state at the given time.
+ *
+ * @param[in]  wakeup  True if the processing is to be scheduled, false if it is to be cancelled.
+ * @param[in]  t0      Base time of the processing.
+ * @param[in]  dt      Time delta between @p t0 and the processing.
+ */
+static void wakeup_set(bool wakeup, uint32_t t0, uint32_t dt)
+{
+    bool running = nrf_802154_timer_sched_is_running(&m_timer);
+
+    if (running && wakeup && (m_timer.t0 == t0) && (m_timer.dt == dt))
+    {
+        return;
+    }
+
+    if (running)
+    {
+        nrf_802154_timer_sched_remove(&m_timer, NULL);
+    }
+
+    if (wakeup)
+    {
+        m_timer.t0        = t0;
+        m_timer.dt        = dt;
+        m_timer.callback  = timer_fired;
+        m_timer.p_context = NULL;
+
+        nrf_802154_timer_sched_add(&m_timer, true);
+    }
+}
+
+/** @brief Start waiting for the grant.
+ *
+ * @param[in]  prio  Priority level of the request.
+ * @param[in]  now   Current time.
+ */
+static void wait_start(rsch_prio_t prio, uint32_t now)
+{
+    m_waiting   = true;
+    m_wait_prio = prio;
+    m_wait_time = now;
+}
+
+/** @brief Update the REQUEST and PRIORITY signals with the requested priority level.
+ *
+ * @param[in]  prio  Requested priority level.
+ * @param[in]  now   Current time.
+ */
+static void request_update(rsch_prio_t prio, uint32_t now)
+{
+    if (prio == RSCH_PRIO_IDLE)
+    {
+        if (m_req_active)
+        {
+            nrf_802154_pta_request_set(false);
+            nrf_802154_pta_priority_set(false);
+
+            m_req_active    = false;
+            m_waiting       = false;
+            m_grant_seen    = false;
+            m_deny_deferred = false;
+        }
+
+        return;
+    }
+
+    // The arbiter samples PRIORITY when REQUEST is asserted, so it is set first.
+    nrf_802154_pta_priority_set(prio >= m_config.priority_threshold);
+
+    if (!m_req_active)
+    {
+        nrf_802154_pta_request_set(true);
+
+        m_req_active = true;
+        m_stats[prio].requests++;
+        wait_start(prio, now);
+    }
+}
+
+/** @brief Account the grant received by the waiting request.
+ *
+ * @param[in]  now  Current time.
+ */
+static void grant_account(uint32_t now)
+{
+    nrf_802154_wifi_coex_stats_t * p_stats = &m_stats[m_wait_prio];
+    uint32_t                       latency = now - m_wait_time;
+
+    p_stats->grants++;
+    p_stats->latency_sum += latency;
+
+    if (latency > p_stats->latency_max)
+    {
+        p_stats->latency_max = latency;
+    }
+
+    m_waiting = false;
+}
+
+/** @brief Check if the last started frame is still in progress.
+ *
+ * @param[in]  now  Current time.
+ */
+static inline bool frame_in_progress(uint32_t now)
+{
+    return m_frame_active && nrf_802154_timer_sched_time_is_in_future(now, m_frame_t0, m_frame_dt);
+}
+
+/** @brief Process the module state: drive the PTA signals and approve the priority level. */
+static void state_process(void)
+{
+    rsch_prio_t prio      = m_req_prio;
+    uint32_t    now       = nrf_802154_timer_sched_time_get();
+    rsch_prio_t approved  = RSCH_PRIO_IDLE;
+    bool        wakeup    = false;
+    uint32_t    wakeup_t0 = 0;
+    uint32_t    wakeup_dt = 0;
+
+    request_update(prio, now);
+
+    if (m_req_active && nrf_802154_pta_grant_get())
+    {
+        if (!m_grant_seen)
+        {
+            m_grant_seen = true;
+            m_grant_time = now;
+
+            if (m_waiting)
+            {
+                grant_account(now);
+            }
+        }
+
+        m_deny_deferred = false;
+
+        if ((now - m_grant_time) >= m_config.grant_settle_time)
+        {
+            approved = prio;
+        }
+        else
+        {
+            wakeup    = true;
+            wakeup_t0 = m_grant_time;
+            wakeup_dt = m_config.grant_settle_time;
+        }
+    }
+    else if (m_req_active)
+    {
+        m_grant_seen = false;
+
+        if (m_approved_prio != RSCH_PRIO_IDLE)
+        {
+            if (!m_deny_deferred)
+            {
+                m_stats[m_approved_prio].denials++;
+            }
+
+            if ((m_config.deny_mode == NRF_802154_WIFI_COEX_DENY_MODE_DEFER) &&
+                frame_in_progress(now))
+            {
+                if (!m_deny_deferred)
+                {
+                    m_stats[m_approved_prio].deferred_denials++;
+                    m_deny_deferred = true;
+                }
+
+                approved  = prio;
+                wakeup    = true;
+                wakeup_t0 = m_frame_t0;
+                wakeup_dt = m_frame_dt;
+            }
+            else
+            {
+                m_deny_deferred = false;
+            }
+        }
+
+        if ((approved == RSCH_PRIO_IDLE) && !m_waiting)
+        {
+            wait_start(prio, now);
+        }
+    }
+
+    wakeup_set(wakeup, wakeup_t0, wakeup_dt);
+
+    if (approved != m_approved_prio)
+    {
+        m_approved_prio = approved;
+
+        nrf_802154_wifi_coex_prio_changed(approved);
+    }
+}
+
+/** @brief Process the module state unless it is being processed by a preempted context. */
+static void state_update(void)
+{
+    uint8_t monitor;
+
+    do
+    {
+        if (!mutex_trylock())
+        {
+            return;
+        }
+
+        monitor = m_mutex_monitor;
+        state_process();
+
+        mutex_unlock();
+    }
+    while (monitor != m_mutex_monitor);
+}
+
+void nrf_802154_wifi_coex_init(void)
+{
+    m_config.priority_threshold = NRF_802154_WIFI_COEX_PRIORITY_THRESHOLD;
+    m_config.grant_settle_time  = NRF_802154_WIFI_COEX_GRANT_SETTLE_TIME;
+    m_config.deny_mode          = NRF_802154_WIFI_COEX_DENY_MODE;
+
+    m_mutex         = 0;
+    m_req_prio      = RSCH_PRIO_IDLE;
+    m_frame_active  = false;
+    m_approved_prio = RSCH_PRIO_IDLE;
+    m_req_active    = false;
+    m_waiting       = false;
+    m_grant_seen    = false;
+    m_deny_deferred = false;
+
+    nrf_802154_wifi_coex_stats_reset();
+
+    nrf_802154_pta_init();
+}
+
+void nrf_802154_wifi_coex_uninit(void)
+{
+    nrf_802154_timer_sched_remove(&m_timer, NULL);
+
+    nrf_802154_pta_uninit();
+}
+
+void nrf_802154_wifi_coex_prio_req(rsch_prio_t priority)
+{
+    assert(priority <= RSCH_PRIO_MAX);
+
+    m_req_prio = priority;
+    __DMB();
+
+    state_update();
+}
+
+void * nrf_802154_wifi_coex_deny_event_addr_get(void)
+{
+    return nrf_802154_pta_deny_event_addr_get();
+}
+
+void nrf_802154_wifi_coex_frame_started(uint32_t length_us)
+{
+    m_frame_active = false;
+    __DMB();
+
+    m_frame_t0 = nrf_802154_timer_sched_time_get();
+    m_frame_dt = length_us;
+    __DMB();
+
+    m_frame_active = true;
+}
+
+void nrf_802154_pta_grant_changed(void)
+{
+    state_update();
+}
+
+#else // NRF_802154_WIFI_COEX_ENABLED
+
+void nrf_802154_wifi_coex_init(void)
+{
+    m_config.priority_threshold = NRF_802154_WIFI_COEX_PRIORITY_THRESHOLD;
+    m_config.grant_settle_time  = NRF_802154_WIFI_COEX_GRANT_SETTLE_TIME;
+    m_config.deny_mode          = NRF_802154_WIFI_COEX_DENY_MODE;
+
+    nrf_802154_wifi_coex_stats_reset();
+}
+
+void nrf_802154_wifi_coex_uninit(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_wifi_coex_prio_req(rsch_prio_t priority)
+{
+    // Without the arbiter every requested priority level is approved immediately.
+    nrf_802154_wifi_coex_prio_changed(priority);
+}
+
+void * nrf_802154_wifi_coex_deny_event_addr_get(void)
+{
+    return NULL;
+}
+
+void nrf_802154_wifi_coex_frame_started(uint32_t length_us)
+{
+    (void)length_us;
+}
+
+#endif // NRF_802154_WIFI_COEX_ENABLED
+
+void nrf_802154_wifi_coex_config_set(const nrf_802154_wifi_coex_cfg_t * p_cfg)
+{
+    assert(p_cfg != NULL);
+
+    m_config = *p_cfg;
+}
+
+void nrf_802154_wifi_coex_config_get(nrf_802154_wifi_coex_cfg_t * p_cfg)
+{
+    assert(p_cfg != NULL);
+
+    *p_cfg = m_config;
+}
+
+void nrf_802154_wifi_coex_stats_get(rsch_prio_t priority, nrf_802154_wifi_coex_stats_t * p_stats)
+{
+    assert(priority <= RSCH_PRIO_MAX);
+    assert(p_stats != NULL);
+
+    *p_stats = m_stats[priority];
+}
+
+void nrf_802154_wifi_coex_stats_reset(void)
+{
+    memset(m_stats, 0, sizeof(m_stats));
+}
@@ -36,6 +36,8 @@
 #ifndef NRF_802154_WIFI_COEX_H_
 #define NRF_802154_WIFI_COEX_H_
 
+#include <stdint.h>
+
 #include "nrf_802154_rsch.h"
 
 #ifdef __cplusplus
@@ -50,7 +52,43 @@ extern "C" {
  *
  * The Wi-Fi Coexistence module is a client of the PTA (defined in the 802.15.2). It manages GPIO
  * to assert pins and respond to pin state changes.
+ *
+ * The module is a precondition of the Radio Scheduler. The requested priority level is signalled
+ * to the arbiter with the REQUEST and PRIORITY signals, and is approved when the arbiter asserts
+ * the GRANT signal.
+ */
+
+/**
+ * @brief Handling of the grant revoked by the arbiter during a frame.
+ */
+typedef enum
+{
+    NRF_802154_WIFI_COEX_DENY_MODE_ABORT, ///< Approved priority is dropped immediately, the frame in progress is aborted.
+    NRF_802154_WIFI_COEX_DENY_MODE_DEFER, ///< Approved priority is dropped when the frame in progress ends.
+} nrf_802154_wifi_coex_deny_mode_t;
+
+/**
+ * @brief Configuration of the Wi-Fi Coexistence module.
  */
+typedef struct
+{
+    rsch_prio_t                      priority_threshold; ///< Lowest priority level signalled to the arbiter as the high priority.
+    uint32_t                         grant_settle_time;  ///< Time the GRANT signal must remain asserted before the priority is approved, in microseconds.
+    nrf_802154_wifi_coex_deny_mode_t deny_mode;          ///< Handling of the grant revoked during a frame.
+} nrf_802154_wifi_coex_cfg_t;
+
+/**
+ * @brief Statistics of the requests at a single priority level.
+ */
+typedef struct
+{
+    uint64_t latency_sum;      ///< Sum of the times from asserting the request to the grant, in microseconds.
+    uint32_t latency_max;      ///< Maximum time from asserting the request to the grant, in microseconds.
+    uint32_t requests;         ///< Number of requests asserted at the priority level.
+    uint32_t grants;           ///< Number of grants received, including grants following a denial.
+    uint32_t denials;          ///< Number of grants revoked by the arbiter while the priority was approved.
+    uint32_t deferred_denials; ///< Number of denials deferred until the end of the frame in progress.
+} nrf_802154_wifi_coex_stats_t;
 
 /**
  * @brief Initializes the Wi-Fi Coexistence module.
@@ -87,6 +125,43 @@ void nrf_802154_wifi_coex_prio_req(rsch_prio_t priority);
  */
 void * nrf_802154_wifi_coex_deny_event_addr_get(void);
 
+/**
+ * @brief Sets the configuration of the Wi-Fi Coexistence module.
+ *
+ * @param[in]  p_cfg  Pointer to the new configuration.
+ */
+void nrf_802154_wifi_coex_config_set(const nrf_802154_wifi_coex_cfg_t * p_cfg);
+
+/**
+ * @brief Gets the configuration of the Wi-Fi Coexistence module.
+ *
+ * @param[out]  p_cfg  Pointer to the structure to be filled with the current configuration.
+ */
+void nrf_802154_wifi_coex_config_get(nrf_802154_wifi_coex_cfg_t * p_cfg);
+
+/**
+ * @brief Notifies the Wi-Fi Coexistence module that a frame has just started.
+ *
+ * With @ref NRF_802154_WIFI_COEX_DENY_MODE_DEFER, a grant revoked by the arbiter before the frame
+ * ends does not drop the approved priority until the frame ends.
+ *
+ * @param[in]  length_us  Duration of the frame (including its ACK, if any), in microseconds.
+ */
+void nrf_802154_wifi_coex_frame_started(uint32_t length_us);
+
+/**
+ * @brief Gets statistics of the requests at the given priority level.
+ *
+ * @param[in]   priority  Priority level the requests were asserted at.
+ * @param[out]  p_stats   Pointer to the structure to be filled with the statistics.
+ */
+void nrf_802154_wifi_coex_stats_get(rsch_prio_t priority, nrf_802154_wifi_coex_stats_t * p_stats);
+
+/**
+ * @brief Resets statistics of the requests at all priority levels.
+ */
+void nrf_802154_wifi_coex_stats_reset(void);
+
 /**
  * @brief Notifies about the approved priority change.
  *
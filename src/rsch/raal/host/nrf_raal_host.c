@@ -0,0 +1,325 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the Radio Arbiter Abstraction Layer for host builds.
+ *
+ * The radio activity of the other protocol is replayed from a trace on a virtual clock, which
+ * makes the timeslots, and any benchmark built on top of them, fully deterministic.
+ *
+ */
+
+#include "rsch/raal/nrf_raal_api.h"
+#include "nrf_raal_host.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "rsch/raal/nrf_raal_config.h"
+
+#define TIME_NEVER UINT64_MAX ///< Time of a boundary that never occurs.
+
+static const nrf_raal_host_trace_t * mp_trace;        ///< Replayed trace.
+static uint64_t                      m_trace_base;    ///< Virtual time the trace replay started.
+
+static uint64_t                      m_now;           ///< Current virtual time.
+static uint64_t                      m_window_idx;    ///< Index of the current window, i.e. the gap before the trace event with the same index.
+static uint64_t                      m_window_start;  ///< Time the current window starts.
+static uint64_t                      m_window_end;    ///< Time the current window ends.
+static bool                          m_in_window;     ///< Indicates if the current window has started.
+
+static bool                          m_continuous_requested;
+static bool                          m_continuous_granted;
+static uint64_t                      m_granted_start; ///< Time the current timeslot started.
+
+static nrf_raal_host_stats_t         m_stats;         ///< Statistics of the host RAAL.
+
+/** @brief Get the start time of the trace event with the given index.
+ *
+ * Indexes greater than the number of events refer to the subsequent periods of the trace.
+ */
+static uint64_t event_start_get(uint64_t idx)
+{
+    uint64_t cycle;
+
+    if ((mp_trace == NULL) || (mp_trace->events_num == 0))
+    {
+        return TIME_NEVER;
+    }
+
+    cycle = idx / mp_trace->events_num;
+
+    if ((cycle > 0) && (mp_trace->period == 0))
+    {
+        return TIME_NEVER;
+    }
+
+    return m_trace_base + cycle * mp_trace->period +
+           mp_trace->p_events[idx % mp_trace->events_num].start;
+}
+
+/** @brief Get the end time of the trace event with the given index. */
+static uint64_t event_end_get(uint64_t idx)
+{
+    uint64_t start = event_start_get(idx);
+
+    if (start == TIME_NEVER)
+    {
+        return TIME_NEVER;
+    }
+
+    return start + mp_trace->p_events[idx % mp_trace->events_num].duration;
+}
+
+/** @brief Set up the window with the given index. */
+static void window_set(uint64_t idx)
+{
+    uint64_t next_start = event_start_get(idx);
+
+    m_window_idx   = idx;
+    m_window_start = (idx == 0) ? m_trace_base : event_end_get(idx - 1);
+    m_window_end   = (next_start == TIME_NEVER) ? TIME_NEVER :
+                     (next_start - NRF_RAAL_MAX_CLEAN_UP_TIME_US);
+    m_in_window    = false;
+
+    if ((next_start != TIME_NEVER) && (next_start < m_window_start + NRF_RAAL_MAX_CLEAN_UP_TIME_US))
+    {
+        // The gap is too short to fit the clean-up time, no timeslot in this window.
+        m_window_end = m_window_start;
+    }
+}
+
+static void continuous_grant(void)
+{
+    if (m_continuous_requested && !m_continuous_granted && (m_now < m_window_end))
+    {
+        m_continuous_granted = true;
+        m_granted_start      = m_now;
+        m_stats.timeslots++;
+
+        nrf_raal_timeslot_started();
+    }
+}
+
+static void continuous_revoke(void)
+{
+    if (m_continuous_requested && m_continuous_granted)
+    {
+        m_continuous_granted = false;
+        m_stats.granted_time += m_now - m_granted_start;
+
+        nrf_raal_timeslot_ended();
+    }
+}
+
+/** @brief Check trace consistency. */
+static bool trace_is_valid(const nrf_raal_host_trace_t * p_trace)
+{
+    uint32_t prev_end = 0;
+
+    for (uint32_t i = 0; i < p_trace->events_num; i++)
+    {
+        const nrf_raal_host_event_t * p_event = &p_trace->p_events[i];
+
+        if (p_event->start < prev_end)
+        {
+            return false;
+        }
+
+        prev_end = p_event->start + p_event->duration;
+    }
+
+    return (p_trace->period == 0) || (prev_end <= p_trace->period + p_trace->p_events[0].start);
+}
+
+void nrf_raal_host_trace_set(const nrf_raal_host_trace_t * p_trace)
+{
+    assert((p_trace == NULL) || (p_trace->events_num == 0) || (p_trace->p_events != NULL));
+    assert((p_trace == NULL) || trace_is_valid(p_trace));
+
+    continuous_revoke();
+
+    mp_trace     = p_trace;
+    m_trace_base = m_now;
+
+    window_set(0);
+    nrf_raal_host_time_advance(m_now);
+}
+
+uint64_t nrf_raal_host_time_get(void)
+{
+    return m_now;
+}
+
+uint64_t nrf_raal_host_next_event_time_get(void)
+{
+    if (!m_in_window)
+    {
+        return m_window_start;
+    }
+
+    return m_window_end;
+}
+
+void nrf_raal_host_time_advance(uint64_t time)
+{
+    assert(time >= m_now);
+
+    while (true)
+    {
+        if (!m_in_window && (m_window_start <= time))
+        {
+            m_now       = m_window_start;
+            m_in_window = true;
+
+            continuous_grant();
+        }
+        else if (m_in_window && (m_window_end <= time))
+        {
+            m_now = m_window_end;
+
+            continuous_revoke();
+
+            window_set(m_window_idx + 1);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    m_now = time;
+}
+
+void nrf_raal_host_stats_get(nrf_raal_host_stats_t * p_stats)
+{
+    assert(p_stats != NULL);
+
+    *p_stats = m_stats;
+
+    if (m_continuous_granted)
+    {
+        p_stats->granted_time += m_now - m_granted_start;
+    }
+}
+
+void nrf_raal_host_stats_reset(void)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    m_granted_start = m_now;
+}
+
+void nrf_raal_init(void)
+{
+    m_continuous_requested = false;
+    m_continuous_granted   = false;
+
+    nrf_raal_host_stats_reset();
+    nrf_raal_host_trace_set(mp_trace);
+}
+
+void nrf_raal_uninit(void)
+{
+    // Intentionally empty.
+}
+
+void nrf_raal_continuous_mode_enter(void)
+{
+    assert(!m_continuous_requested);
+
+    m_continuous_requested = true;
+
+    if (m_in_window)
+    {
+        continuous_grant();
+    }
+}
+
+void nrf_raal_continuous_mode_exit(void)
+{
+    assert(m_continuous_requested);
+
+    if (m_continuous_granted)
+    {
+        m_stats.granted_time += m_now - m_granted_start;
+    }
+
+    m_continuous_requested = false;
+    m_continuous_granted   = false;
+}
+
+void nrf_raal_continuous_ended(void)
+{
+    // Intentionally empty.
+}
+
+bool nrf_raal_timeslot_request(uint32_t length_us)
+{
+    bool result;
+
+    assert(m_continuous_requested);
+
+    m_stats.requests++;
+
+    result = m_continuous_granted && (m_now + length_us < m_window_end);
+
+    if (!result)
+    {
+        m_stats.denied_requests++;
+    }
+
+    return result;
+}
+
+uint32_t nrf_raal_timeslot_us_left_get(void)
+{
+    uint64_t left;
+
+    if (!m_continuous_granted)
+    {
+        return 0;
+    }
+
+    left = m_window_end - m_now;
+
+    return (left > UINT32_MAX) ? UINT32_MAX : (uint32_t)left;
+}
+
+void nrf_raal_timeslot_extension_hint(uint32_t length_us)
+{
+    (void)length_us;
+
+    // Intentionally empty: timeslots follow the trace.
+}
@@ -0,0 +1,146 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Module that defines the Radio Arbiter Abstraction Layer interface for host builds,
+ *        in which the other radio activity is replayed from a timeslot trace.
+ *
+ */
+
+#ifndef NRF_RAAL_HOST_H_
+#define NRF_RAAL_HOST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_raal_host Host RAAL
+ * @{
+ * @ingroup nrf_raal
+ * @brief Radio Arbiter Abstraction Layer implementation for host builds.
+ *
+ * The host RAAL runs on a virtual clock advanced explicitly by the host program. The other radio
+ * activity (for example, BLE connection events recorded on a device) is described by a trace of
+ * events. Timeslots are granted to the radio driver in the gaps between the events and end
+ * @ref NRF_RAAL_MAX_CLEAN_UP_TIME_US microseconds before the next event starts, so
+ * @ref nrf_raal_timeslot_started and @ref nrf_raal_timeslot_ended are called deterministically.
+ */
+
+/**
+ * @brief Activity of the other radio protocol that blocks the radio driver.
+ */
+typedef struct
+{
+    uint32_t start;    ///< Start of the activity since the beginning of the trace, in microseconds.
+    uint32_t duration; ///< Duration of the activity, in microseconds.
+} nrf_raal_host_event_t;
+
+/**
+ * @brief Trace of the activity of the other radio protocol.
+ *
+ * The events must be sorted by their start time and must not overlap.
+ */
+typedef struct
+{
+    const nrf_raal_host_event_t * p_events;   ///< Pointer to the array of the events.
+    uint32_t                      events_num; ///< Number of the events.
+    uint32_t                      period;     ///< Period with which the trace is repeated, in microseconds. The trace is replayed once if 0.
+} nrf_raal_host_trace_t;
+
+/**
+ * @brief Statistics of the host RAAL.
+ */
+typedef struct
+{
+    uint32_t timeslots;        ///< Number of timeslots started.
+    uint32_t requests;         ///< Number of timeslot requests.
+    uint32_t denied_requests;  ///< Number of timeslot requests that were denied.
+    uint64_t granted_time;     ///< Total duration of the started timeslots, in microseconds.
+} nrf_raal_host_stats_t;
+
+/**
+ * @brief Sets the trace of the activity of the other radio protocol.
+ *
+ * The trace is replayed from the current virtual time. It is not copied, so it must remain valid
+ * until another trace is set. Without any trace, the radio driver is never blocked.
+ *
+ * @param[in]  p_trace  Pointer to the trace or NULL to remove the current trace.
+ */
+void nrf_raal_host_trace_set(const nrf_raal_host_trace_t * p_trace);
+
+/**
+ * @brief Gets the current virtual time.
+ *
+ * @returns Current virtual time, in microseconds.
+ */
+uint64_t nrf_raal_host_time_get(void);
+
+/**
+ * @brief Gets the virtual time of the next timeslot boundary.
+ *
+ * @returns Time of the next timeslot start or end, in microseconds, or UINT64_MAX if there is none.
+ */
+uint64_t nrf_raal_host_next_event_time_get(void);
+
+/**
+ * @brief Advances the virtual time.
+ *
+ * The timeslot boundaries passed are processed in order, with the virtual time set to the time
+ * of each boundary when @ref nrf_raal_timeslot_started or @ref nrf_raal_timeslot_ended is called.
+ *
+ * @param[in]  time  New virtual time, in microseconds. Must not be earlier than the current one.
+ */
+void nrf_raal_host_time_advance(uint64_t time);
+
+/**
+ * @brief Gets the statistics of the host RAAL.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_raal_host_stats_get(nrf_raal_host_stats_t * p_stats);
+
+/**
+ * @brief Resets the statistics of the host RAAL.
+ */
+void nrf_raal_host_stats_reset(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_RAAL_HOST_H_ */
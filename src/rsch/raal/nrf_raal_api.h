@@ -117,6 +117,21 @@ bool nrf_raal_timeslot_request(uint32_t length_us);
  */
 uint32_t nrf_raal_timeslot_us_left_get(void);
 
+/**
+ * @brief Hints the arbiter how much radio time the driver expects to need soon.
+ *
+ * The arbiter may use this hint to extend the current timeslot ahead of the schedule, so that
+ * a subsequent @p nrf_raal_timeslot_request call for up to @p length_us microseconds is more
+ * likely to succeed. The hint does not guarantee any radio time and can be ignored by the arbiter.
+ *
+ * @note Implementing this function is optional. The Radio Scheduler provides a weak default that
+ *       ignores the hint.
+ *
+ * @param[in] length_us  Radio time, in microseconds, expected to be needed from now on.
+ *
+ */
+void nrf_raal_timeslot_extension_hint(uint32_t length_us);
+
 /**
  * @brief Notifies the radio driver about the start of a timeslot. Called by the RAAL client.
  *
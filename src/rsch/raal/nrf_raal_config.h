@@ -59,6 +59,17 @@ extern "C" {
 #define NRF_RAAL_MAX_CLEAN_UP_TIME_US 91
 #endif
 
+/**
+ * @def NRF_RAAL_SOFTDEVICE_ADAPTIVE_LENGTH_ENABLED
+ *
+ * Indicates whether the SoftDevice RAAL is to adapt the length of the requested timeslots and
+ * extensions to the observed BLE activity. If disabled, the configured timeslot length is used.
+ *
+ */
+#ifndef NRF_RAAL_SOFTDEVICE_ADAPTIVE_LENGTH_ENABLED
+#define NRF_RAAL_SOFTDEVICE_ADAPTIVE_LENGTH_ENABLED 1
+#endif
+
 /**
  *@}
  **/
@@ -184,6 +184,13 @@ uint32_t nrf_raal_timeslot_us_left_get(void)
            (m_margin_timestamp - timer) : 0;
 }
 
+void nrf_raal_timeslot_extension_hint(uint32_t length_us)
+{
+    (void)length_us;
+
+    // Intentionally empty: simulated timeslots have fixed length.
+}
+
 void TIMER0_IRQHandler(void)
 {
     uint32_t ev_timestamp;
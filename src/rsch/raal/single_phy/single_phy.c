@@ -87,3 +87,10 @@ uint32_t nrf_raal_timeslot_us_left_get(void)
 {
     return UINT32_MAX;
 }
+
+void nrf_raal_timeslot_extension_hint(uint32_t length_us)
+{
+    (void)length_us;
+
+    // Intentionally empty: the timeslot never ends.
+}
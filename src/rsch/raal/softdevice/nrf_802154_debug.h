@@ -66,6 +66,7 @@ extern "C" {
 #define FUNCTION_RAAL_EVT_SESSION_IDLE         0x0409UL
 #define FUNCTION_RAAL_EVT_HFCLK_READY          0x040AUL
 #define FUNCTION_RAAL_SIG_EVENT_MARGIN_MOVE    0x040BUL
+#define FUNCTION_RAAL_SIG_EVENT_EXTEND_HINT    0x040DUL
 
 #ifdef __cplusplus
 }
@@ -49,6 +49,7 @@
 #include <nrf_802154_utils.h>
 #include <nrf_timer.h>
 #include <rsch/raal/nrf_raal_api.h>
+#include <rsch/raal/nrf_raal_config.h>
 
 #if defined(__GNUC__)
 _Pragma("GCC diagnostic push")
@@ -116,6 +117,12 @@ _Pragma("GCC diagnostic pop")
 #define MINIMUM_TIMESLOT_LENGTH_EXTENSION_TIME_TICKS NRF_802154_US_TO_RTC_TICKS( \
         NRF_RADIO_MINIMUM_TIMESLOT_LENGTH_EXTENSION_TIME_US)
 
+/**@brief Timeslot length adaptation constants. */
+#define ADAPT_AVG_SHIFT                              2     ///< Weight of a new sample in the averaged durations, as a power of 2.
+#define ADAPT_EXTENSIONS_PER_TIMESLOT                4     ///< Number of extensions expected to fit in an average timeslot.
+#define ADAPT_MAX_LENGTH                             25600 ///< Maximum adapted timeslot length in microseconds.
+#define ADAPT_HISTORY_LENGTH                         8     ///< Number of the recent extensions whose outcome is taken into account.
+
 /**@brief PPM constants. */
 #define PPM_UNIT                                     1000000UL
 #define MAX_HFCLK_PPM                                40
@@ -166,6 +173,9 @@ static uint16_t m_timeslot_length;
 /**@brief Previously granted timeslot length. */
 static uint16_t m_prev_timeslot_length;
 
+/**@brief Timeslot length currently used for requests and extensions. */
+static uint16_t m_base_length;
+
 /**@brief Interval between successive timeslot extensions. */
 static uint16_t m_extension_interval;
 
@@ -175,6 +185,27 @@ static volatile uint16_t m_timeslot_extend_tries;
 /**@brief Defines if timeslot releasing works correctly on given SoftDevice version. */
 static bool m_timeslot_releasing;
 
+/**@brief Radio time in microseconds the driver expects to need soon. */
+static volatile uint32_t m_extension_hint;
+
+/**@brief RTC0 counter value captured at the start of the last timeslot. */
+static uint32_t m_timeslot_start_ticks;
+
+/**@brief RTC0 counter value captured when the last timeslot was ended by other radio activity. */
+static uint32_t m_timeslot_end_ticks;
+
+/**@brief Defines if @ref m_timeslot_end_ticks holds the end of the last timeslot. */
+static bool m_timeslot_end_valid;
+
+/**@brief Outcomes of the recent extensions. A bit is set for each failed extension, the latest in the LSB. */
+static uint8_t m_extension_history;
+
+/**@brief Number of failed extensions recorded in @ref m_extension_history. */
+static uint8_t m_extension_history_failures;
+
+/**@brief Statistics of the current radio session. */
+static nrf_raal_softdevice_stats_t m_stats;
+
 /***************************************************************************************************
  * @section Drift calculations
  **************************************************************************************************/
@@ -186,9 +217,135 @@ static uint32_t time_corrected_for_drift_get(uint32_t time)
     return time - NRF_802154_DIVIDE_AND_CEIL(time * ppm, PPM_UNIT);
 }
 
+/**@brief Set length of the requested timeslots and extensions. */
+static void base_length_set(uint32_t length)
+{
+    m_base_length           = length;
+    m_extension_interval    = time_corrected_for_drift_get(length);
+    m_stats.timeslot_length = length;
+}
+
 static void calculate_config(void)
 {
-    m_extension_interval = time_corrected_for_drift_get(m_config.timeslot_length);
+    base_length_set(m_config.timeslot_length);
+
+    m_stats.avg_timeslot_duration = m_config.timeslot_length * ADAPT_EXTENSIONS_PER_TIMESLOT;
+}
+
+/***************************************************************************************************
+ * @section Timeslot length adaptation and statistics.
+ **************************************************************************************************/
+
+/**@brief Get time elapsed since the given RTC0 counter value, in microseconds. */
+static inline uint32_t rtc_time_elapsed_get(uint32_t ticks)
+{
+    uint32_t elapsed = (NRF_RTC0->COUNTER - ticks) & RTC_COUNTER_COUNTER_Msk;
+
+    return (uint32_t)NRF_802154_RTC_TICKS_TO_US((uint64_t)elapsed);
+}
+
+/**@brief Update averaged duration with a new sample. */
+static inline void avg_update(uint32_t * p_avg, uint32_t sample)
+{
+    *p_avg -= *p_avg >> ADAPT_AVG_SHIFT;
+    *p_avg += sample >> ADAPT_AVG_SHIFT;
+}
+
+/**@brief Record the outcome of a timeslot extension in the extension history.
+ *
+ * @param[in]  failed  True if the extension failed, false if it succeeded.
+ */
+static void extension_history_add(bool failed)
+{
+    uint8_t oldest = (m_extension_history >> (ADAPT_HISTORY_LENGTH - 1)) & 1U;
+
+    m_extension_history           = (uint8_t)((m_extension_history << 1) | (failed ? 1U : 0U));
+    m_extension_history_failures += (failed ? 1U : 0U);
+    m_extension_history_failures -= oldest;
+}
+
+/**@brief Adapt length of the requested timeslots and extensions to the observed BLE activity.
+ *
+ * Timeslots are extended in steps that let a few extensions fit in an average window between
+ * BLE events. Short windows require short steps to be granted at all and to waste little time
+ * when an extension collides with a BLE event. Long windows are covered with long steps to
+ * reduce the extension overhead. Each failed extension among the recent ones shows a step that
+ * did not fit before the next BLE event, so it shortens the steps by a further
+ * 1 / (2 * @ref ADAPT_HISTORY_LENGTH). The length is never shorter than needed to receive
+ * the longest frame with its ACK between two extensions.
+ */
+static void timeslot_length_adapt(void)
+{
+#if NRF_RAAL_SOFTDEVICE_ADAPTIVE_LENGTH_ENABLED
+    uint32_t min_length = nrf_802154_rx_duration_get(MAX_PACKET_SIZE, true) +
+                          m_config.timeslot_safe_margin + NRF_RADIO_START_JITTER_US;
+    uint32_t max_length = ADAPT_MAX_LENGTH;
+    uint32_t length     = m_stats.avg_timeslot_duration / ADAPT_EXTENSIONS_PER_TIMESLOT;
+
+    length -= (length * m_extension_history_failures) / (2 * ADAPT_HISTORY_LENGTH);
+
+    min_length = (m_config.timeslot_length < min_length) ? m_config.timeslot_length : min_length;
+    max_length = (m_config.timeslot_length > max_length) ? m_config.timeslot_length : max_length;
+
+    if (length < min_length)
+    {
+        length = min_length;
+    }
+    else if (length > max_length)
+    {
+        length = max_length;
+    }
+
+    if (length != m_base_length)
+    {
+        base_length_set(length);
+    }
+#endif // NRF_RAAL_SOFTDEVICE_ADAPTIVE_LENGTH_ENABLED
+}
+
+/**@brief Account the start of a timeslot. */
+static void timeslot_start_account(void)
+{
+    if (m_timeslot_end_valid)
+    {
+        avg_update(&m_stats.avg_gap_duration, rtc_time_elapsed_get(m_timeslot_end_ticks));
+        m_timeslot_end_valid = false;
+    }
+
+    m_timeslot_start_ticks = NRF_RTC0->COUNTER;
+}
+
+/**@brief Account the end of a granted timeslot.
+ *
+ * @param[in]  preempted  True if the timeslot was ended by other radio activity, false if it was
+ *                        released by the driver.
+ */
+static void timeslot_end_account(bool preempted)
+{
+    uint32_t duration = rtc_time_elapsed_get(m_timeslot_start_ticks);
+
+    m_stats.radio_time += duration;
+
+    if (preempted)
+    {
+        avg_update(&m_stats.avg_timeslot_duration, duration);
+
+        m_timeslot_end_ticks = NRF_RTC0->COUNTER;
+        m_timeslot_end_valid = true;
+
+        timeslot_length_adapt();
+    }
+}
+
+/**@brief Account the timeslot request blocked or cancelled by the SoftDevice. */
+static void timeslot_blocked_account(void)
+{
+    m_stats.requests_blocked++;
+
+    // Blocked request indicates that the BLE-free windows are shorter than expected.
+    m_stats.avg_timeslot_duration -= m_stats.avg_timeslot_duration >> ADAPT_AVG_SHIFT;
+
+    timeslot_length_adapt();
 }
 
 /***************************************************************************************************
@@ -302,7 +459,7 @@ static void timer_on_extend_update(void)
     }
     else
     {
-        uint16_t extension_interval = (m_prev_timeslot_length == m_config.timeslot_length) ?
+        uint16_t extension_interval = (m_prev_timeslot_length == m_base_length) ?
                                       m_extension_interval :
                                       time_corrected_for_drift_get(m_prev_timeslot_length);
 
@@ -320,7 +477,7 @@ static void timer_on_extend_update(void)
 static inline void timeslot_data_init(void)
 {
     m_timeslot_extend_tries = 0;
-    m_timeslot_length       = m_config.timeslot_length;
+    m_timeslot_length       = m_base_length;
 }
 
 /**@brief Indicate if timeslot is in idle state. */
@@ -414,6 +571,29 @@ static void timeslot_next_extend(void)
     }
 }
 
+/**@brief Extend timeslot ahead of the schedule if the hinted radio time exceeds the time left.
+ *
+ * @note This function is to be called from the signal handler, just before it returns.
+ */
+static void timeslot_hinted_extend(void)
+{
+    if (m_continuous &&
+        timeslot_is_granted() &&
+        !timer_is_set_to_margin() &&
+        (m_ret_param.callback_action == NRF_RADIO_SIGNAL_CALLBACK_ACTION_NONE) &&
+        (safe_time_to_timeslot_end_get() < m_extension_hint) &&
+        (nrf_timer_cc_read(RAAL_TIMER, TIMER_CC_ACTION) +
+         m_base_length < m_config.timeslot_max_length))
+    {
+        nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RAAL_SIG_EVENT_EXTEND_HINT);
+
+        // Extension timer is moved forward on success, just like for the scheduled extension.
+        timeslot_extend(m_base_length);
+
+        nrf_802154_log(EVENT_TRACE_EXIT, FUNCTION_RAAL_SIG_EVENT_EXTEND_HINT);
+    }
+}
+
 /***************************************************************************************************
  * @section RAAL TIMER interrupt handler.
  **************************************************************************************************/
@@ -438,6 +618,8 @@ static void timer_irq_handle(void)
                 // Ignore any other events.
                 timer_reset();
 
+                timeslot_end_account(true);
+
                 // Return and wait for NRF_EVT_RADIO_SESSION_IDLE event.
                 m_ret_param.callback_action = NRF_RADIO_SIGNAL_CALLBACK_ACTION_NONE;
 
@@ -461,10 +643,10 @@ static void timer_irq_handle(void)
 
             if (m_continuous &&
                 (nrf_timer_cc_read(RAAL_TIMER, TIMER_CC_ACTION) +
-                 m_config.timeslot_length < m_config.timeslot_max_length))
+                 m_base_length < m_config.timeslot_max_length))
             {
                 // Try to extend timeslot.
-                timeslot_extend(m_config.timeslot_length);
+                timeslot_extend(m_base_length);
             }
             else
             {
@@ -501,6 +683,11 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
         nrf_802154_pin_clr(PIN_DBG_TIMESLOT_ACTIVE);
         nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RAAL_SIG_EVENT_ENDED);
 
+        if (timeslot_is_granted())
+        {
+            timeslot_end_account(false);
+        }
+
         m_timeslot_state = TIMESLOT_STATE_IDLE;
 
         m_ret_param.callback_action = m_timeslot_releasing ? NRF_RADIO_SIGNAL_CALLBACK_ACTION_END :
@@ -520,6 +707,8 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
 
             assert(m_timeslot_state == TIMESLOT_STATE_REQUESTED);
 
+            timeslot_start_account();
+
             // Set up timer first with requested timeslot length.
             timer_start();
 
@@ -550,6 +739,7 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
                 if (!timer_is_margin_reached())
                 {
                     nrf_802154_radio_irq_handler();
+                    timeslot_hinted_extend();
                 }
                 else
                 {
@@ -570,6 +760,9 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
             nrf_802154_pin_tgl(PIN_DBG_TIMESLOT_FAILED);
             nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RAAL_SIG_EVENT_EXTEND_FAIL);
 
+            m_stats.extensions_failed++;
+            extension_history_add(true);
+
             if (!timer_is_set_to_margin())
             {
                 timer_to_margin_set();
@@ -583,6 +776,9 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
         case NRF_RADIO_CALLBACK_SIGNAL_TYPE_EXTEND_SUCCEEDED: /**< This signal indicates extend action succeeded. */
             nrf_802154_log(EVENT_TRACE_ENTER, FUNCTION_RAAL_SIG_EVENT_EXTEND_SUCCESS);
 
+            m_stats.extensions_succeeded++;
+            extension_history_add(false);
+
             if ((!timer_is_set_to_margin()) &&
                 (ticks_to_timeslot_end_get() <
                  MINIMUM_TIMESLOT_LENGTH_EXTENSION_TIME_TICKS))
@@ -605,6 +801,8 @@ static nrf_radio_signal_callback_return_param_t * signal_handler(uint8_t signal_
 
             if (!timeslot_is_granted())
             {
+                m_stats.timeslots++;
+
                 m_timeslot_state = TIMESLOT_STATE_GRANTED;
                 timeslot_started_notify();
             }
@@ -635,6 +833,8 @@ void nrf_raal_softdevice_soc_evt_handler(uint32_t evt_id)
 
             m_timeslot_state = TIMESLOT_STATE_IDLE;
 
+            timeslot_blocked_account();
+
             if (m_continuous)
             {
                 if (m_timeslot_extend_tries < m_config.timeslot_alloc_iters)
@@ -706,6 +906,11 @@ void nrf_raal_init(void)
     m_config.timeslot_timeout     = NRF_RAAL_TIMESLOT_DEFAULT_TIMEOUT;
     m_config.lf_clk_accuracy_ppm  = NRF_RAAL_DEFAULT_LF_CLK_ACCURACY_PPM;
 
+    memset(&m_stats, 0, sizeof(m_stats));
+    m_extension_history          = 0;
+    m_extension_history_failures = 0;
+    m_timeslot_end_valid = false;
+
     calculate_config();
 
     uint32_t err_code = sd_radio_session_open(signal_handler);
@@ -736,7 +941,8 @@ void nrf_raal_init(void)
         m_timeslot_releasing = true;
     }
 
-    m_initialized = true;
+    m_extension_hint = 0;
+    m_initialized    = true;
 }
 
 void nrf_raal_uninit(void)
@@ -828,3 +1034,24 @@ uint32_t nrf_raal_timeslot_us_left_get(void)
 {
     return timeslot_is_granted() ? safe_time_to_timeslot_end_get() : 0;
 }
+
+void nrf_raal_timeslot_extension_hint(uint32_t length_us)
+{
+    m_extension_hint = length_us;
+}
+
+void nrf_raal_softdevice_stats_get(nrf_raal_softdevice_stats_t * p_stats)
+{
+    assert(p_stats);
+
+    *p_stats = m_stats;
+}
+
+void nrf_raal_softdevice_stats_reset(void)
+{
+    m_stats.radio_time           = 0;
+    m_stats.timeslots            = 0;
+    m_stats.requests_blocked     = 0;
+    m_stats.extensions_succeeded = 0;
+    m_stats.extensions_failed    = 0;
+}
@@ -118,6 +118,19 @@ typedef struct
     uint16_t lf_clk_accuracy_ppm;
 } nrf_raal_softdevice_cfg_t;
 
+/** @brief RAAL SoftDevice statistics of the radio session. */
+typedef struct
+{
+    uint64_t radio_time;            ///< Total duration of the granted timeslots, in microseconds.
+    uint32_t timeslots;             ///< Number of timeslots granted to the radio driver.
+    uint32_t requests_blocked;      ///< Number of timeslot requests blocked or cancelled by the SoftDevice.
+    uint32_t extensions_succeeded;  ///< Number of successful timeslot extensions.
+    uint32_t extensions_failed;     ///< Number of failed timeslot extensions.
+    uint32_t timeslot_length;       ///< Length of the requested timeslots and extensions currently in use, in microseconds.
+    uint32_t avg_timeslot_duration; ///< Averaged duration of the timeslots ended by other radio activity, in microseconds.
+    uint32_t avg_gap_duration;      ///< Averaged time between the end of a timeslot and the start of the next one, in microseconds.
+} nrf_raal_softdevice_stats_t;
+
 /**
  * @brief Informs the RAAL client about the SoftDevice SoC events.
  *
@@ -130,6 +143,24 @@ void nrf_raal_softdevice_soc_evt_handler(uint32_t evt_id);
  */
 void nrf_raal_softdevice_config(const nrf_raal_softdevice_cfg_t * p_cfg);
 
+/**
+ * @brief Gets statistics of the current radio session.
+ *
+ * The statistics are updated from the SoftDevice radio signal handler. If this function is
+ * preempted by the handler, the returned values can be inconsistent with each other.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled with the statistics.
+ */
+void nrf_raal_softdevice_stats_get(nrf_raal_softdevice_stats_t * p_stats);
+
+/**
+ * @brief Resets the counters of the radio session statistics.
+ *
+ * The averaged durations and the timeslot length in use describe the state of the timeslot length
+ * adaptation and are not reset.
+ */
+void nrf_raal_softdevice_stats_reset(void);
+
 /**
  *@}
  **/
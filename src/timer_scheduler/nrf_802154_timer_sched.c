@@ -104,21 +104,6 @@ static inline void queue_cntr_bump(void)
     __DMB();
 }
 
-/**
- * @brief Check if @p time_1 is before @p time_2.
- *
- * @param[in]  time_1  First time to compare.
- * @param[in]  time_2  Second time to compare.
- *
- * @return  True if @p time_1 is before @p time_2, false otherwise.
- */
-static inline bool is_time_before(uint32_t time_1, uint32_t time_2)
-{
-    int32_t diff = time_1 - time_2;
-
-    return diff < 0;
-}
-
 /**
  * @brief Check if @p p_timer_1 shall strike earlier than @p p_timer_2.
  *
@@ -130,7 +115,7 @@ static inline bool is_time_before(uint32_t time_1, uint32_t time_2)
 static inline bool is_timer_prior(const nrf_802154_timer_t * p_timer_1,
                                   const nrf_802154_timer_t * p_timer_2)
 {
-    return is_time_before(p_timer_1->t0 + p_timer_1->dt, p_timer_2->t0 + p_timer_2->dt);
+    return p_timer_1->expiry < p_timer_2->expiry;
 }
 
 /**
@@ -154,14 +139,13 @@ static inline void handle_timer(void)
             }
             else
             {
-                uint32_t t0 = p_head->t0;
-                uint32_t dt = p_head->dt;
+                uint64_t expiry = p_head->expiry;
 
-                // Set the timer only if current HEAD wasn't removed - otherwise t0 and dt might've been modified
-                // between reading t0 and dt and not be a valid combination.
+                // Set the timer only if current HEAD wasn't removed - otherwise expiry might've been modified
+                // while it was being read and not be a valid value.
                 if (p_head == mp_head)
                 {
-                    nrf_802154_lp_timer_start(t0, dt);
+                    nrf_802154_lp_timer_start64(expiry);
                 }
             }
 
@@ -302,6 +286,34 @@ uint32_t nrf_802154_timer_sched_time_get(void)
     return nrf_802154_lp_timer_time_get();
 }
 
+uint64_t nrf_802154_timer_sched_time64_get(void)
+{
+    return nrf_802154_lp_timer_time64_get();
+}
+
+uint64_t nrf_802154_timer_sched_time64_from_time(uint32_t time)
+{
+    uint64_t now  = nrf_802154_lp_timer_time64_get();
+    int32_t  diff = time - (uint32_t)now;
+
+    return now + diff;
+}
+
+bool nrf_802154_timer_sched_time64_to_t0_dt(uint64_t time, uint32_t * p_t0, uint32_t * p_dt)
+{
+    uint64_t now = nrf_802154_lp_timer_time64_get();
+
+    if ((time <= now) || ((time - now) > NRF_802154_TIMER_SCHED_DT_MAX))
+    {
+        return false;
+    }
+
+    *p_t0 = (uint32_t)now;
+    *p_dt = (uint32_t)(time - now);
+
+    return true;
+}
+
 uint32_t nrf_802154_timer_sched_granularity_get(void)
 {
     return nrf_802154_lp_timer_granularity_get();
@@ -319,17 +331,20 @@ uint32_t nrf_802154_timer_sched_remaining_time_get(const nrf_802154_timer_t * p_
 {
     assert(p_timer != NULL);
 
-    uint32_t now        = nrf_802154_lp_timer_time_get();
-    uint32_t expiration = p_timer->t0 + p_timer->dt;
-    int32_t  remaining  = expiration - now;
+    uint64_t now        = nrf_802154_lp_timer_time64_get();
+    uint64_t expiration = p_timer->expiry;
 
-    if (remaining > 0)
+    if (expiration <= now)
     {
-        return (uint32_t)remaining;
+        return 0ul;
+    }
+    else if (expiration - now > UINT32_MAX)
+    {
+        return UINT32_MAX;
     }
     else
     {
-        return 0ul;
+        return (uint32_t)(expiration - now);
     }
 }
 
@@ -350,6 +365,8 @@ void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
         handle_timer();
     }
 
+    p_timer->expiry = nrf_802154_timer_sched_time64_from_time(p_timer->t0) + p_timer->dt;
+
     nrf_802154_timer_t ** pp_item;
     nrf_802154_timer_t  * p_next;
     uint8_t               queue_cntr;
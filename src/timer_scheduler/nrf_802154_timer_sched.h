@@ -57,6 +57,14 @@ extern "C" {
  *
  */
 
+/**
+ * @brief Maximal delta of a time in the future from the current time, in microseconds [us].
+ *
+ * Times are compared in the 32-bit time base, so a time more than 2^31 - 1 microseconds (about
+ * 35 minutes) ahead of the current time would be taken as a time in the past.
+ */
+#define NRF_802154_TIMER_SCHED_DT_MAX INT32_MAX
+
 /**
  * @brief Type of function called when the timer expires.
  *
@@ -79,6 +87,7 @@ struct nrf_802154_timer_s
     nrf_802154_timer_callback_t callback;  ///< Callback function called when timer expires.
     void                      * p_context; ///< User-defined context passed to the callback function.
     nrf_802154_timer_t        * p_next;    ///< Pointer to the next running timer.
+    uint64_t                    expiry;    ///< 64-bit expiration time of the timer, in microseconds. Set by the scheduler when the timer is added.
 };
 
 /**
@@ -100,6 +109,44 @@ void nrf_802154_timer_sched_deinit(void);
  */
 uint32_t nrf_802154_timer_sched_time_get(void);
 
+/**
+ * @brief Gets the current time as a 64-bit value.
+ *
+ * The 32 least significant bits of the returned value are equal to the value returned by
+ * @ref nrf_802154_timer_sched_time_get. The returned value does not wrap around.
+ *
+ * @returns Current time in microseconds [us].
+ */
+uint64_t nrf_802154_timer_sched_time64_get(void);
+
+/**
+ * @brief Converts a 32-bit time to the 64-bit time base.
+ *
+ * The 32-bit time is expanded to the 64-bit time that is the closest to the current time.
+ * Therefore, @p time must be within 2^31 microseconds (about 35 minutes) from the current time.
+ *
+ * @param[in]  time  32-bit time to convert, in microseconds [us].
+ *
+ * @returns 64-bit time corresponding to @p time, in microseconds [us].
+ */
+uint64_t nrf_802154_timer_sched_time64_from_time(uint32_t time);
+
+/**
+ * @brief Converts a 64-bit time to the base and delta used by the timer scheduler.
+ *
+ * The base is the current time. Times are compared in the 32-bit time base, so @p time must be
+ * in the future and at most @ref NRF_802154_TIMER_SCHED_DT_MAX microseconds ahead of the current
+ * time.
+ *
+ * @param[in]   time  64-bit time to convert, in microseconds [us].
+ * @param[out]  p_t0  Base of the time, in microseconds [us].
+ * @param[out]  p_dt  Delta of the time from @p p_t0, in microseconds [us].
+ *
+ * @retval  true   The time has been converted.
+ * @retval  false  The time is in the past or too far in the future.
+ */
+bool nrf_802154_timer_sched_time64_to_t0_dt(uint64_t time, uint32_t * p_t0, uint32_t * p_dt);
+
 /**
  * @brief Gets the granularity of the timer that runs the timer scheduler.
  *
@@ -0,0 +1,169 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mock_nrf_802154_rx_duty_cycle.h"
+
+#include "mac_features/nrf_802154_csl.c"
+
+#define TEST_PERIOD  625      ///< CSL period used in the tests [10 symbols].
+#define TEST_CHANNEL 20       ///< Channel used in the tests.
+#define TEST_T0      10000UL  ///< Base time of the first window [us].
+#define TEST_DT      30000UL  ///< Delta between the base time and the start of the first window [us].
+#define TEST_NOW     123456UL ///< End of the frame containing the CSL IE [us].
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+    m_period = 0;
+}
+
+static void csl_start(void)
+{
+    nrf_802154_rx_duty_cycle_start_ExpectAndReturn(TEST_T0,
+                                                   TEST_DT,
+                                                   TEST_PERIOD * CSL_UNIT,
+                                                   NRF_802154_CSL_RX_WINDOW_DURATION,
+                                                   TEST_CHANNEL,
+                                                   true);
+
+    TEST_ASSERT_TRUE(nrf_802154_csl_receive_start(TEST_T0, TEST_DT, TEST_PERIOD, TEST_CHANNEL));
+}
+
+static uint16_t phase_get(uint32_t time_to_window)
+{
+    uint8_t ie[CSL_IE_SIZE];
+
+    nrf_802154_rx_duty_cycle_time_to_window_get_ExpectAndReturn(TEST_NOW, time_to_window);
+
+    nrf_802154_csl_ie_write(ie, TEST_NOW);
+
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)TEST_PERIOD, ie[4]);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)(TEST_PERIOD >> 8), ie[5]);
+
+    return (uint16_t)(ie[2] | (ie[3] << 8));
+}
+
+/***********************************************************************************/
+/********************************** START/STOP TESTS *******************************/
+/***********************************************************************************/
+
+void test_ShouldStartDutyCycleWithPeriodInMicroseconds(void)
+{
+    csl_start();
+
+    TEST_ASSERT_TRUE(nrf_802154_csl_is_running());
+}
+
+void test_ShouldNotStartWithZeroPeriod(void)
+{
+    TEST_ASSERT_FALSE(nrf_802154_csl_receive_start(TEST_T0, TEST_DT, 0, TEST_CHANNEL));
+    TEST_ASSERT_FALSE(nrf_802154_csl_is_running());
+}
+
+void test_ShouldNotRunWhenDutyCycleFailsToStart(void)
+{
+    nrf_802154_rx_duty_cycle_start_ExpectAnyArgsAndReturn(false);
+
+    TEST_ASSERT_FALSE(nrf_802154_csl_receive_start(TEST_T0, TEST_DT, TEST_PERIOD, TEST_CHANNEL));
+    TEST_ASSERT_FALSE(nrf_802154_csl_is_running());
+}
+
+void test_ShouldStopDutyCycleWhenStopped(void)
+{
+    csl_start();
+
+    nrf_802154_rx_duty_cycle_stop_ExpectAndReturn(true);
+
+    TEST_ASSERT_TRUE(nrf_802154_csl_receive_stop());
+    TEST_ASSERT_FALSE(nrf_802154_csl_is_running());
+}
+
+void test_ShouldNotStopDutyCycleWhenNotRunning(void)
+{
+    TEST_ASSERT_FALSE(nrf_802154_csl_receive_stop());
+}
+
+/***********************************************************************************/
+/********************************** CSL IE TESTS ***********************************/
+/***********************************************************************************/
+
+void test_ShouldWriteCslIeDescriptor(void)
+{
+    uint8_t  ie[CSL_IE_SIZE];
+    uint16_t descriptor;
+
+    csl_start();
+
+    nrf_802154_rx_duty_cycle_time_to_window_get_ExpectAndReturn(TEST_NOW, CSL_UNIT);
+
+    nrf_802154_csl_ie_write(ie, TEST_NOW);
+
+    descriptor = (uint16_t)(ie[0] | (ie[1] << 8));
+
+    TEST_ASSERT_EQUAL_UINT16(CSL_IE_CONTENT_SIZE, descriptor & IE_HEADER_LENGTH_MASK);
+    TEST_ASSERT_EQUAL_UINT16(IE_CSL_ELEMENT_ID, descriptor >> IE_ELEMENT_ID_SHIFT);
+}
+
+void test_ShouldRoundPhaseUp(void)
+{
+    csl_start();
+
+    TEST_ASSERT_EQUAL_UINT16(1, phase_get(1));
+    TEST_ASSERT_EQUAL_UINT16(1, phase_get(CSL_UNIT));
+    TEST_ASSERT_EQUAL_UINT16(2, phase_get(CSL_UNIT + 1));
+}
+
+void test_ShouldReturnPeriodWhenWindowIsWholePeriodAway(void)
+{
+    csl_start();
+
+    TEST_ASSERT_EQUAL_UINT16(TEST_PERIOD, phase_get(TEST_PERIOD * CSL_UNIT));
+    TEST_ASSERT_EQUAL_UINT16(TEST_PERIOD, phase_get((TEST_PERIOD - 1) * CSL_UNIT + 1));
+}
+
+void test_ShouldWrapPhaseWhenFirstWindowIsMoreThanPeriodAway(void)
+{
+    csl_start();
+
+    TEST_ASSERT_EQUAL_UINT16(3, phase_get((TEST_PERIOD + 3) * CSL_UNIT));
+    TEST_ASSERT_EQUAL_UINT16(TEST_PERIOD, phase_get(2 * TEST_PERIOD * CSL_UNIT));
+}
@@ -0,0 +1,297 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+
+#include "nrf_802154_notification_ring.c"
+
+#define TEST_NTF_MAX (2 * RING_SIZE) ///< Maximal number of notifications recorded in a test.
+
+static nrf_802154_ntf_type_t m_ntf_types[TEST_NTF_MAX]; ///< Types of the issued notifications.
+static uint32_t              m_ntf_values[TEST_NTF_MAX]; ///< Values carried by the issued notifications.
+static uint32_t              m_ntf_count;                ///< Number of the issued notifications.
+static uint32_t              m_wake_count;               ///< Number of the requested wake-ups.
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    nrf_802154_notification_init();
+
+    m_ntf_count  = 0;
+    m_wake_count = 0;
+}
+
+void tearDown(void)
+{
+
+}
+
+/***************************************************************************************************
+ * @section Notifications
+ **************************************************************************************************/
+
+static void ntf_record(nrf_802154_ntf_type_t type, uint32_t value)
+{
+    TEST_ASSERT_LESS_THAN(TEST_NTF_MAX, m_ntf_count);
+
+    m_ntf_types[m_ntf_count]  = type;
+    m_ntf_values[m_ntf_count] = value;
+    m_ntf_count++;
+}
+
+void nrf_802154_notification_ring_wake(void)
+{
+    m_wake_count++;
+}
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    ntf_record(NTF_TYPE_RECEIVED, lqi);
+}
+
+void nrf_802154_received(uint8_t * p_data, uint8_t length, int8_t power, uint8_t lqi)
+{
+    ntf_record(NTF_TYPE_RECEIVED, lqi);
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+{
+    ntf_record(NTF_TYPE_RECEIVE_FAILED, error);
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame, uint8_t * p_ack, int8_t power, uint8_t lqi)
+{
+    ntf_record(NTF_TYPE_TRANSMITTED, lqi);
+}
+
+void nrf_802154_transmitted(const uint8_t * p_frame, uint8_t * p_ack, uint8_t length, int8_t power, uint8_t lqi)
+{
+    ntf_record(NTF_TYPE_TRANSMITTED, lqi);
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    ntf_record(NTF_TYPE_TRANSMIT_FAILED, error);
+}
+
+void nrf_802154_energy_detected(uint8_t result)
+{
+    ntf_record(NTF_TYPE_ENERGY_DETECTED, result);
+}
+
+void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
+{
+    ntf_record(NTF_TYPE_ENERGY_DETECTION_FAILED, error);
+}
+
+void nrf_802154_cca_done(bool channel_free)
+{
+    ntf_record(NTF_TYPE_CCA, channel_free);
+}
+
+void nrf_802154_cca_failed(nrf_802154_cca_error_t error)
+{
+    ntf_record(NTF_TYPE_CCA_FAILED, error);
+}
+
+void nrf_802154_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats)
+{
+    ntf_record(NTF_TYPE_RX_WINDOW_ENDED, p_stats->frames_started);
+}
+
+/***************************************************************************************************
+ * @section Notification ring tests
+ **************************************************************************************************/
+
+void test_ShouldDeliverNotificationsInOrderAndWakeOnlyWhenRingWasEmpty(void)
+{
+    uint8_t buffer[MAX_PACKET_SIZE + 1];
+    uint8_t frame[MAX_PACKET_SIZE + 1];
+
+    nrf_802154_notify_received(buffer, -50, 1);
+    nrf_802154_notify_transmitted(frame, NULL, 0, 2);
+    nrf_802154_notify_cca(true);
+
+    TEST_ASSERT_EQUAL_UINT32(1, m_wake_count);
+    TEST_ASSERT_EQUAL_UINT32(0, m_ntf_count);
+    TEST_ASSERT_TRUE(nrf_802154_notification_ring_is_pending());
+
+    TEST_ASSERT_EQUAL_UINT32(3, nrf_802154_notification_ring_drain(0));
+
+    TEST_ASSERT_FALSE(nrf_802154_notification_ring_is_pending());
+    TEST_ASSERT_EQUAL_UINT32(3, m_ntf_count);
+    TEST_ASSERT_EQUAL(NTF_TYPE_RECEIVED, m_ntf_types[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, m_ntf_values[0]);
+    TEST_ASSERT_EQUAL(NTF_TYPE_TRANSMITTED, m_ntf_types[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, m_ntf_values[1]);
+    TEST_ASSERT_EQUAL(NTF_TYPE_CCA, m_ntf_types[2]);
+
+    nrf_802154_notify_cca(false);
+
+    TEST_ASSERT_EQUAL_UINT32(2, m_wake_count);
+}
+
+void test_ShouldDrainInBatches(void)
+{
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        nrf_802154_notify_energy_detected(i);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(2, nrf_802154_notification_ring_drain(2));
+    TEST_ASSERT_EQUAL_UINT32(2, nrf_802154_notification_ring_drain(2));
+    TEST_ASSERT_EQUAL_UINT32(1, nrf_802154_notification_ring_drain(2));
+    TEST_ASSERT_EQUAL_UINT32(0, nrf_802154_notification_ring_drain(2));
+
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(i, m_ntf_values[i]);
+    }
+}
+
+void test_ShouldDropReceiveFailuresWhenOnlyReservedSlotsAreFree(void)
+{
+    uint32_t limit = RING_SIZE - RING_RESERVED;
+
+    for (uint32_t i = 0; i < limit + 3; i++)
+    {
+        nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_INVALID_FCS);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(3, nrf_802154_notification_ring_dropped_get());
+    TEST_ASSERT_EQUAL_UINT32(0, m_ntf_count);
+
+    TEST_ASSERT_EQUAL_UINT32(limit, nrf_802154_notification_ring_drain(0));
+    TEST_ASSERT_EQUAL_UINT32(limit, m_ntf_count);
+
+    // Slots freed by the consumer are used again.
+    nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_INVALID_FCS);
+
+    TEST_ASSERT_EQUAL_UINT32(1, nrf_802154_notification_ring_drain(0));
+    TEST_ASSERT_EQUAL_UINT32(3, nrf_802154_notification_ring_dropped_get());
+}
+
+void test_ShouldCopyWindowStatisticsAndDropThemWhenOnlyReservedSlotsAreFree(void)
+{
+    nrf_802154_rx_window_stats_t stats = {.frames_started = 7};
+    uint32_t                     limit = RING_SIZE - RING_RESERVED;
+
+    for (uint32_t i = 0; i < limit + 1; i++)
+    {
+        nrf_802154_notify_rx_window_ended(&stats);
+        stats.frames_started = 0;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(1, nrf_802154_notification_ring_dropped_get());
+
+    TEST_ASSERT_EQUAL_UINT32(limit, nrf_802154_notification_ring_drain(0));
+    TEST_ASSERT_EQUAL(NTF_TYPE_RX_WINDOW_ENDED, m_ntf_types[0]);
+    TEST_ASSERT_EQUAL_UINT32(7, m_ntf_values[0]);
+}
+
+void test_ShouldKeepReservedSlotsForReceivedFramesWhenRingOverflowsWithReceiveFailures(void)
+{
+    static uint8_t buffers[NRF_802154_RX_BUFFERS][MAX_PACKET_SIZE + 1];
+
+    // Noise overflows the ring while the consumer is stalled.
+    for (uint32_t i = 0; i < RING_SIZE; i++)
+    {
+        nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_INVALID_FRAME);
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    {
+        nrf_802154_notify_received(buffers[i], -50, i);
+    }
+
+    nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_TIMEOUT);
+
+    // Nothing is delivered in the producer context and no received frame is lost.
+    TEST_ASSERT_EQUAL_UINT32(0, m_ntf_count);
+    TEST_ASSERT_EQUAL_UINT32(RING_RESERVED, nrf_802154_notification_ring_dropped_get());
+
+    TEST_ASSERT_EQUAL_UINT32(RING_SIZE - 1, nrf_802154_notification_ring_drain(0));
+
+    for (uint32_t i = 0; i < NRF_802154_RX_BUFFERS; i++)
+    {
+        uint32_t idx = RING_SIZE - RING_RESERVED + i;
+
+        TEST_ASSERT_EQUAL(NTF_TYPE_RECEIVED, m_ntf_types[idx]);
+        TEST_ASSERT_EQUAL_UINT32(i, m_ntf_values[idx]);
+    }
+
+    TEST_ASSERT_EQUAL(NTF_TYPE_RECEIVE_FAILED, m_ntf_types[RING_SIZE - 2]);
+    TEST_ASSERT_EQUAL_UINT32(NRF_802154_RX_ERROR_DELAYED_TIMEOUT, m_ntf_values[RING_SIZE - 2]);
+}
+
+void test_ShouldProcessNotificationDirectlyInsteadOfOverwritingWhenRingIsFull(void)
+{
+    for (uint32_t i = 0; i < RING_SIZE; i++)
+    {
+        nrf_802154_notify_energy_detected(i);
+    }
+
+    nrf_802154_notify_energy_detected(RING_SIZE);
+
+    // The notification that cannot be dropped is issued in the producer context.
+    TEST_ASSERT_EQUAL_UINT32(1, m_ntf_count);
+    TEST_ASSERT_EQUAL_UINT32(RING_SIZE, m_ntf_values[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, nrf_802154_notification_ring_dropped_get());
+
+    // The notifications in the ring are not overwritten.
+    TEST_ASSERT_EQUAL_UINT32(RING_SIZE, nrf_802154_notification_ring_drain(0));
+
+    for (uint32_t i = 0; i < RING_SIZE; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(i, m_ntf_values[i + 1]);
+    }
+}
+
+void test_ShouldHandleIndexWrapAround(void)
+{
+    m_r_idx = UINT32_MAX - 1;
+    m_w_idx = UINT32_MAX - 1;
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        nrf_802154_notify_energy_detected(i);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(1, m_wake_count);
+    TEST_ASSERT_EQUAL_UINT32(2, m_w_idx);
+    TEST_ASSERT_EQUAL_UINT32(4, nrf_802154_notification_ring_drain(0));
+    TEST_ASSERT_EQUAL_UINT32(3, m_ntf_values[3]);
+}
@@ -0,0 +1,510 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mock_nrf_802154.h"
+#include "mock_nrf_802154_critical_section.h"
+#include "mock_nrf_802154_frame_parser.h"
+#include "mock_nrf_802154_notification.h"
+#include "mock_nrf_802154_pib.h"
+#include "mock_nrf_802154_procedures_duration.h"
+#include "mock_nrf_802154_request.h"
+#include "mock_nrf_802154_rsch.h"
+#include "mock_nrf_802154_setup_time.h"
+#include "mock_nrf_802154_timer_coord.h"
+#include "mock_nrf_802154_timer_sched.h"
+
+#define __LDREXB(ptr)           (*(ptr))
+#define __STREXB(value, ptr)    ((*(ptr) = (value)), 0)
+#define __CLREX()
+
+#include "mac_features/nrf_802154_rx_duty_cycle.c"
+
+#define TEST_PERIOD      100000UL ///< Period of the windows used in the tests [us].
+#define TEST_WINDOW      5000UL   ///< Duration of the windows used in the tests [us].
+#define TEST_SETUP_TIME  300UL    ///< Setup time returned by the setup time module [us].
+#define TEST_RX_DURATION 4500UL   ///< Duration of the longest frame reception [us].
+#define TEST_CHANNEL     15       ///< Channel used in the tests.
+#define TEST_WINDOW_T0   20000UL  ///< Base time of the first window [us].
+#define TEST_WINDOW_DT   50000UL  ///< Delta between the base time and the start of the first window [us].
+#define TEST_LEAD_TIME   1500UL   ///< Lead time of the delayed timeslot returned by the scheduler [us].
+#define TEST_FIRST_START (TEST_WINDOW_T0 + TEST_WINDOW_DT) ///< Start of the first window [us].
+
+static uint32_t m_windows_ended; ///< Number of calls to @ref nrf_802154_notify_rx_window_ended.
+
+static void notify_rx_window_ended_stub(const nrf_802154_rx_window_stats_t * p_stats,
+                                        int                                  cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    TEST_ASSERT_EQUAL_MEMORY(&m_stats.last_window, p_stats, sizeof(*p_stats));
+
+    m_windows_ended++;
+}
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    m_windows_ended = 0;
+
+    nrf_802154_notify_rx_window_ended_StubWithCallback(notify_rx_window_ended_stub);
+
+    nrf_802154_rsch_delayed_timeslot_lead_time_get_IgnoreAndReturn(TEST_LEAD_TIME);
+}
+
+void tearDown(void)
+{
+    m_state     = RXDC_STATE_STOPPED;
+    m_sleep_req = false;
+    memset(&m_stats, 0, sizeof(m_stats));
+    memset(&m_window_stats, 0, sizeof(m_window_stats));
+    memset((void *)&m_rx_frame, 0, sizeof(m_rx_frame));
+}
+
+static void window_request_expect(uint32_t t0, uint32_t dt)
+{
+    nrf_802154_rx_duration_get_ExpectAndReturn(MAX_PACKET_SIZE, true, TEST_RX_DURATION);
+    nrf_802154_setup_time_get_ExpectAndReturn(NRF_802154_SETUP_TIME_RX, TEST_SETUP_TIME);
+    nrf_802154_rsch_delayed_timeslot_request_ExpectAndReturn(t0,
+                                                             dt - TEST_SETUP_TIME - RX_RAMP_UP_TIME,
+                                                             TEST_WINDOW + TEST_RX_DURATION,
+                                                             RSCH_PRIO_MAX,
+                                                             RSCH_DLY_RX_DUTY_CYCLE,
+                                                             true);
+}
+
+static void duty_cycle_start(void)
+{
+    window_request_expect(TEST_WINDOW_T0, TEST_WINDOW_DT);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_start(TEST_WINDOW_T0,
+                                                    TEST_WINDOW_DT,
+                                                    TEST_PERIOD,
+                                                    TEST_WINDOW,
+                                                    TEST_CHANNEL));
+    TEST_ASSERT_EQUAL(RXDC_STATE_WAITING, m_state);
+}
+
+static void window_open(uint32_t now)
+{
+    uint32_t window_start = TEST_WINDOW_T0 + TEST_WINDOW_DT;
+
+    nrf_802154_pib_channel_set_Expect(TEST_CHANNEL);
+    nrf_802154_request_channel_update_ExpectAndReturn(true);
+    nrf_802154_request_receive_ExpectAndReturn(NRF_802154_TERM_NONE,
+                                               REQ_ORIG_RX_DUTY_CYCLE,
+                                               window_started_callback,
+                                               false,
+                                               true);
+
+    nrf_802154_rx_duty_cycle_timeslot_started();
+
+    nrf_802154_timer_coord_time_get_ExpectAnyArgsAndReturn(false);
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now);
+    nrf_802154_timer_sched_add_Expect(&m_window_timer, true);
+
+    window_started_callback(true);
+
+    TEST_ASSERT_EQUAL(RXDC_STATE_LISTENING, m_state);
+    TEST_ASSERT_EQUAL_UINT32(window_start, m_window_timer.t0);
+    TEST_ASSERT_EQUAL_UINT32(TEST_WINDOW, m_window_timer.dt);
+}
+
+static void next_window_request_expect(uint32_t now)
+{
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now);
+    nrf_802154_setup_time_get_ExpectAndReturn(NRF_802154_SETUP_TIME_RX, TEST_SETUP_TIME);
+    window_request_expect(TEST_FIRST_START, TEST_PERIOD);
+}
+
+static bool own_sleep_request_stub(nrf_802154_term_t term_lvl, int cmock_num_calls)
+{
+    (void)cmock_num_calls;
+
+    // The core aborts the window on behalf of the sleep request issued by the module itself.
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_abort(term_lvl, REQ_ORIG_CORE));
+    TEST_ASSERT_EQUAL(RXDC_STATE_LISTENING, m_state);
+
+    return true;
+}
+
+/***********************************************************************************/
+/**************************** WINDOW TRANSITIONS TESTS *****************************/
+/***********************************************************************************/
+
+void test_ShouldListenWhenReceiveRequestSucceeds(void)
+{
+    duty_cycle_start();
+    window_open(TEST_WINDOW_T0 + TEST_WINDOW_DT);
+
+    TEST_ASSERT_FALSE(m_window_stats.skipped);
+    TEST_ASSERT_EQUAL_UINT32(TEST_WINDOW_T0 + TEST_WINDOW_DT, m_window_stats.start);
+}
+
+void test_ShouldSkipWindowWhenReceiveRequestFails(void)
+{
+    duty_cycle_start();
+
+    nrf_802154_pib_channel_set_Expect(TEST_CHANNEL);
+    nrf_802154_request_channel_update_ExpectAndReturn(false);
+    nrf_802154_timer_sched_add_Expect(&m_window_timer, true);
+
+    nrf_802154_rx_duty_cycle_timeslot_started();
+
+    TEST_ASSERT_EQUAL(RXDC_STATE_WAITING, m_state);
+    TEST_ASSERT_TRUE(m_window_stats.skipped);
+
+    next_window_request_expect(TEST_FIRST_START + TEST_WINDOW);
+
+    window_close(NULL);
+
+    TEST_ASSERT_EQUAL(RXDC_STATE_WAITING, m_state);
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.windows);
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.windows_skipped);
+    TEST_ASSERT_EQUAL_UINT32(1, m_windows_ended);
+}
+
+void test_ShouldPutRadioToSleepWhenWindowEnds(void)
+{
+    uint32_t now = TEST_WINDOW_T0 + TEST_WINDOW_DT;
+
+    duty_cycle_start();
+    window_open(now);
+
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now + TEST_WINDOW);
+    nrf_802154_rx_duration_get_ExpectAndReturn(0, false, 0);
+    nrf_802154_timer_sched_time_is_in_future_ExpectAndReturn(now + TEST_WINDOW, now, 0, false);
+    nrf_802154_request_sleep_StubWithCallback(own_sleep_request_stub);
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now + TEST_WINDOW);
+    next_window_request_expect(now + TEST_WINDOW);
+
+    window_close(NULL);
+
+    TEST_ASSERT_EQUAL(RXDC_STATE_WAITING, m_state);
+    TEST_ASSERT_FALSE(m_sleep_req);
+    TEST_ASSERT_EQUAL_UINT32(TEST_WINDOW, m_stats.listen_time);
+    TEST_ASSERT_EQUAL_UINT32(1, m_windows_ended);
+    TEST_ASSERT_EQUAL_UINT32(TEST_WINDOW_T0 + TEST_WINDOW_DT + TEST_PERIOD, m_window_start);
+}
+
+void test_ShouldExtendWindowWhenFrameIsBeingReceived(void)
+{
+    uint32_t now      = TEST_WINDOW_T0 + TEST_WINDOW_DT;
+    uint32_t sof_time = now + TEST_WINDOW - 100;
+    uint8_t  frame[]  = { 20, 0x61, 0x88 };
+
+    duty_cycle_start();
+    window_open(now);
+
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(sof_time);
+    nrf_802154_frame_parser_ar_bit_is_set_ExpectAndReturn(frame, true);
+
+    nrf_802154_rx_duty_cycle_rx_started_hook(frame);
+
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now + TEST_WINDOW);
+    nrf_802154_rx_duration_get_ExpectAndReturn(frame[PHR_OFFSET], true, 1000);
+    nrf_802154_timer_sched_time_is_in_future_ExpectAndReturn(now + TEST_WINDOW, sof_time, 1000, true);
+    nrf_802154_timer_sched_add_Expect(&m_window_timer, true);
+
+    window_close(NULL);
+
+    TEST_ASSERT_EQUAL(RXDC_STATE_LISTENING, m_state);
+    TEST_ASSERT_TRUE(m_window_stats.extended);
+    TEST_ASSERT_EQUAL_UINT8(1, m_window_stats.frames_started);
+    TEST_ASSERT_EQUAL_UINT32(sof_time, m_window_timer.t0);
+    TEST_ASSERT_EQUAL_UINT32(1000, m_window_timer.dt);
+    TEST_ASSERT_EQUAL_UINT32(0, m_stats.windows);
+    TEST_ASSERT_EQUAL_UINT32(0, m_windows_ended);
+}
+
+/***********************************************************************************/
+/******************************* WINDOW ABORT TESTS ********************************/
+/***********************************************************************************/
+
+void test_ShouldLeaveRadioToHigherLayerRequestAbortingWindow(void)
+{
+    uint32_t now = TEST_WINDOW_T0 + TEST_WINDOW_DT;
+
+    duty_cycle_start();
+    window_open(now);
+
+    // Higher layer requests sleep, energy detection, CCA or continuous carrier.
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now + 1000);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_abort(NRF_802154_TERM_802154, REQ_ORIG_CORE));
+    TEST_ASSERT_EQUAL(RXDC_STATE_WAITING, m_state);
+    TEST_ASSERT_EQUAL_UINT32(1000, m_window_stats.listen_time);
+
+    // The window ends without a sleep request.
+    next_window_request_expect(now + TEST_WINDOW);
+
+    window_close(NULL);
+
+    TEST_ASSERT_EQUAL(RXDC_STATE_WAITING, m_state);
+    TEST_ASSERT_EQUAL_UINT32(1, m_stats.windows);
+    TEST_ASSERT_EQUAL_UINT32(1, m_windows_ended);
+}
+
+void test_ShouldLeaveRadioToOtherModuleAbortingWindow(void)
+{
+    uint32_t now = TEST_WINDOW_T0 + TEST_WINDOW_DT;
+
+    duty_cycle_start();
+    window_open(now);
+
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now + 2000);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_abort(NRF_802154_TERM_NONE, REQ_ORIG_CSMA_CA));
+    TEST_ASSERT_EQUAL(RXDC_STATE_WAITING, m_state);
+    TEST_ASSERT_EQUAL_UINT32(2000, m_window_stats.listen_time);
+}
+
+void test_ShouldKeepListeningWhenOwnReceiveRequestAbortsWindow(void)
+{
+    duty_cycle_start();
+    window_open(TEST_WINDOW_T0 + TEST_WINDOW_DT);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_abort(NRF_802154_TERM_NONE, REQ_ORIG_RX_DUTY_CYCLE));
+    TEST_ASSERT_EQUAL(RXDC_STATE_LISTENING, m_state);
+}
+
+void test_ShouldIgnoreAbortWhenNotListening(void)
+{
+    duty_cycle_start();
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_abort(NRF_802154_TERM_802154, REQ_ORIG_CORE));
+    TEST_ASSERT_EQUAL(RXDC_STATE_WAITING, m_state);
+}
+
+/***********************************************************************************/
+/****************************** WINDOW SCHEDULE TESTS ******************************/
+/***********************************************************************************/
+
+void test_ShouldRejectPeriodNotLeavingTimeForNextRequest(void)
+{
+    uint32_t period = TEST_WINDOW + RX_SETUP_TIME + RX_RAMP_UP_TIME + TEST_LEAD_TIME;
+
+    TEST_ASSERT_FALSE(nrf_802154_rx_duty_cycle_start(TEST_WINDOW_T0,
+                                                     TEST_WINDOW_DT,
+                                                     period,
+                                                     TEST_WINDOW,
+                                                     TEST_CHANNEL));
+    TEST_ASSERT_EQUAL(RXDC_STATE_STOPPED, m_state);
+
+    window_request_expect(TEST_WINDOW_T0, TEST_WINDOW_DT);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_start(TEST_WINDOW_T0,
+                                                    TEST_WINDOW_DT,
+                                                    period + 1,
+                                                    TEST_WINDOW,
+                                                    TEST_CHANNEL));
+}
+
+void test_ShouldRejectFirstWindowStartingBeforeSetupEnds(void)
+{
+    nrf_802154_rx_duration_get_ExpectAndReturn(MAX_PACKET_SIZE, true, TEST_RX_DURATION);
+    nrf_802154_setup_time_get_ExpectAndReturn(NRF_802154_SETUP_TIME_RX, TEST_SETUP_TIME);
+
+    TEST_ASSERT_FALSE(nrf_802154_rx_duty_cycle_start(TEST_WINDOW_T0,
+                                                     TEST_SETUP_TIME + RX_RAMP_UP_TIME,
+                                                     TEST_PERIOD,
+                                                     TEST_WINDOW,
+                                                     TEST_CHANNEL));
+    TEST_ASSERT_EQUAL(RXDC_STATE_STOPPED, m_state);
+}
+
+void test_ShouldSkipMissedWindowsWithSingleRequest(void)
+{
+    uint32_t now = TEST_FIRST_START + 3 * TEST_PERIOD + TEST_PERIOD / 2;
+
+    duty_cycle_start();
+
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now);
+    nrf_802154_setup_time_get_ExpectAndReturn(NRF_802154_SETUP_TIME_RX, TEST_SETUP_TIME);
+    window_request_expect(TEST_FIRST_START + 3 * TEST_PERIOD, TEST_PERIOD);
+
+    next_window_request();
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_FIRST_START + 4 * TEST_PERIOD, m_window_start);
+}
+
+void test_ShouldSkipWindowWhoseRequestWouldBeLate(void)
+{
+    uint32_t lead = TEST_SETUP_TIME + RX_RAMP_UP_TIME + TEST_LEAD_TIME;
+    uint32_t now  = TEST_FIRST_START + TEST_PERIOD - lead;
+
+    duty_cycle_start();
+
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(now);
+    nrf_802154_setup_time_get_ExpectAndReturn(NRF_802154_SETUP_TIME_RX, TEST_SETUP_TIME);
+    window_request_expect(TEST_FIRST_START + TEST_PERIOD, TEST_PERIOD);
+
+    next_window_request();
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_FIRST_START + 2 * TEST_PERIOD, m_window_start);
+}
+
+void test_ShouldRequestFollowingWindowWhenRequestIsDelayed(void)
+{
+    duty_cycle_start();
+
+    nrf_802154_timer_sched_time_get_ExpectAndReturn(TEST_FIRST_START + TEST_WINDOW);
+    nrf_802154_setup_time_get_ExpectAndReturn(NRF_802154_SETUP_TIME_RX, TEST_SETUP_TIME);
+    nrf_802154_rx_duration_get_ExpectAndReturn(MAX_PACKET_SIZE, true, TEST_RX_DURATION);
+    nrf_802154_setup_time_get_ExpectAndReturn(NRF_802154_SETUP_TIME_RX, TEST_SETUP_TIME);
+    nrf_802154_rsch_delayed_timeslot_request_ExpectAnyArgsAndReturn(false);
+    window_request_expect(TEST_FIRST_START + TEST_PERIOD, TEST_PERIOD);
+
+    next_window_request();
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_FIRST_START + 2 * TEST_PERIOD, m_window_start);
+}
+
+void test_ShouldPointAtNextWindowWhenWindowStartsNow(void)
+{
+    duty_cycle_start();
+
+    nrf_802154_timer_sched_time_is_in_future_ExpectAndReturn(TEST_FIRST_START,
+                                                             TEST_FIRST_START,
+                                                             0,
+                                                             false);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_PERIOD,
+                             nrf_802154_rx_duty_cycle_time_to_window_get(TEST_FIRST_START));
+
+    nrf_802154_timer_sched_time_is_in_future_ExpectAndReturn(TEST_FIRST_START - 10,
+                                                             TEST_FIRST_START,
+                                                             0,
+                                                             true);
+
+    TEST_ASSERT_EQUAL_UINT32(10,
+                             nrf_802154_rx_duty_cycle_time_to_window_get(TEST_FIRST_START - 10));
+}
+
+/***********************************************************************************/
+/*********************************** STOP TESTS ************************************/
+/***********************************************************************************/
+
+void test_ShouldCancelTimeslotAndTimerWhenStopped(void)
+{
+    duty_cycle_start();
+
+    nrf_802154_rsch_delayed_timeslot_cancel_ExpectAndReturn(RSCH_DLY_RX_DUTY_CYCLE, true);
+    nrf_802154_timer_sched_remove_Expect(&m_window_timer, NULL);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_stop());
+    TEST_ASSERT_FALSE(nrf_802154_rx_duty_cycle_is_running());
+
+    nrf_802154_rsch_delayed_timeslot_cancel_ExpectAndReturn(RSCH_DLY_RX_DUTY_CYCLE, false);
+    nrf_802154_timer_sched_remove_Expect(&m_window_timer, NULL);
+
+    TEST_ASSERT_FALSE(nrf_802154_rx_duty_cycle_stop());
+}
+
+void test_ShouldNotOpenWindowWhenTimeslotStartsAfterStop(void)
+{
+    duty_cycle_start();
+
+    nrf_802154_rsch_delayed_timeslot_cancel_ExpectAndReturn(RSCH_DLY_RX_DUTY_CYCLE, false);
+    nrf_802154_timer_sched_remove_Expect(&m_window_timer, NULL);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_stop());
+
+    nrf_802154_rx_duty_cycle_timeslot_started();
+
+    TEST_ASSERT_EQUAL(RXDC_STATE_STOPPED, m_state);
+}
+
+void test_ShouldKeepRadioReceivingAndNotRequestNextWindowWhenStoppedDuringWindow(void)
+{
+    duty_cycle_start();
+    window_open(TEST_FIRST_START);
+
+    nrf_802154_rsch_delayed_timeslot_cancel_ExpectAndReturn(RSCH_DLY_RX_DUTY_CYCLE, false);
+    nrf_802154_timer_sched_remove_Expect(&m_window_timer, NULL);
+
+    TEST_ASSERT_TRUE(nrf_802154_rx_duty_cycle_stop());
+
+    // A window timer that fired concurrently with the stop does not touch the radio.
+    window_close(NULL);
+
+    TEST_ASSERT_EQUAL(RXDC_STATE_STOPPED, m_state);
+    TEST_ASSERT_EQUAL_UINT32(0, m_windows_ended);
+}
+
+/***********************************************************************************/
+/********************************* STATISTICS TESTS ********************************/
+/***********************************************************************************/
+
+void test_ShouldCopyStatisticsInCriticalSection(void)
+{
+    nrf_802154_rx_duty_cycle_stats_t stats;
+
+    m_stats.windows     = 3;
+    m_stats.listen_time = 3 * TEST_WINDOW;
+
+    nrf_802154_critical_section_enter_ExpectAndReturn(true);
+    nrf_802154_critical_section_exit_Expect();
+
+    nrf_802154_rx_duty_cycle_stats_get(&stats);
+
+    TEST_ASSERT_EQUAL_MEMORY(&m_stats, &stats, sizeof(stats));
+}
+
+void test_ShouldCopyStatisticsWhenCriticalSectionIsHeldByPreemptedContext(void)
+{
+    nrf_802154_rx_duty_cycle_stats_t stats;
+
+    m_stats.windows = 3;
+
+    nrf_802154_critical_section_enter_ExpectAndReturn(false);
+
+    nrf_802154_rx_duty_cycle_stats_get(&stats);
+
+    TEST_ASSERT_EQUAL_UINT32(3, stats.windows);
+}
+
+void test_ShouldResetStatisticsInCriticalSection(void)
+{
+    m_stats.windows = 3;
+
+    nrf_802154_critical_section_enter_ExpectAndReturn(true);
+    nrf_802154_critical_section_exit_Expect();
+
+    nrf_802154_rx_duty_cycle_stats_reset();
+
+    TEST_ASSERT_EQUAL_UINT32(0, m_stats.windows);
+}
@@ -0,0 +1,162 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_procedures_duration.h"
+
+#include "nrf_802154_setup_time.c"
+
+#define TEST_SETUP_TIME 60 ///< Setup time needed by the measured operations [us].
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    nrf_802154_setup_time_init();
+}
+
+void tearDown(void)
+{
+
+}
+
+static void measure(nrf_802154_setup_time_op_t op, uint32_t needed, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        // The operation was scheduled with the current estimate and started with a delay or
+        // in advance, depending on the setup time it needed.
+        uint32_t setup_used = nrf_802154_setup_time_get(op);
+
+        nrf_802154_setup_time_measured(op, setup_used, (int32_t)needed - (int32_t)setup_used);
+    }
+}
+
+/***********************************************************************************/
+/*********************************** ESTIMATE TESTS ********************************/
+/***********************************************************************************/
+
+void test_ShouldStartWithWorstCaseSetupTimes(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(TX_SETUP_TIME, nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX));
+    TEST_ASSERT_EQUAL_UINT32(RX_SETUP_TIME, nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_RX));
+}
+
+void test_ShouldKeepWorstCaseSetupTimeDuringFirstWindow(void)
+{
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, EST_WINDOW - 1);
+
+    TEST_ASSERT_EQUAL_UINT32(TX_SETUP_TIME, nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX));
+}
+
+void test_ShouldUseLongestMeasurementWithMarginAfterFirstWindow(void)
+{
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, EST_WINDOW - 1);
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME + 5, 1);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_SETUP_TIME + 5 + EST_MARGIN,
+                             nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX));
+}
+
+void test_ShouldNotLetAnyOperationStartLateWithinWindow(void)
+{
+    uint32_t late = 0;
+
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, EST_WINDOW);
+
+    for (uint32_t i = 0; i < 10 * EST_WINDOW; i++)
+    {
+        uint32_t needed     = TEST_SETUP_TIME - 10 + (i % 20);
+        uint32_t setup_used = nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX);
+
+        if (needed > setup_used)
+        {
+            late++;
+        }
+
+        nrf_802154_setup_time_measured(NRF_802154_SETUP_TIME_TX,
+                                       setup_used,
+                                       (int32_t)needed - (int32_t)setup_used);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, late);
+}
+
+void test_ShouldForgetLongMeasurementAfterTwoWindows(void)
+{
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, EST_WINDOW);
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME + 50, 1);
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, EST_WINDOW - 1);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_SETUP_TIME + 50 + EST_MARGIN,
+                             nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX));
+
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, EST_WINDOW - 1);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_SETUP_TIME + 50 + EST_MARGIN,
+                             nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX));
+
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, 1);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_SETUP_TIME + EST_MARGIN,
+                             nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX));
+}
+
+void test_ShouldNotExceedWorstCaseSetupTime(void)
+{
+    measure(NRF_802154_SETUP_TIME_RX, RX_SETUP_TIME + 20, EST_WINDOW);
+
+    TEST_ASSERT_EQUAL_UINT32(RX_SETUP_TIME, nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_RX));
+}
+
+void test_ShouldIgnoreImplausibleMeasurements(void)
+{
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, EST_WINDOW);
+
+    nrf_802154_setup_time_measured(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, -TEST_SETUP_TIME - 1);
+    nrf_802154_setup_time_measured(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, 2 * TX_SETUP_TIME);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_SETUP_TIME + EST_MARGIN,
+                             nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX));
+    TEST_ASSERT_EQUAL_UINT32(0, m_estimates[NRF_802154_SETUP_TIME_TX].count);
+}
+
+void test_ShouldEstimateOperationsIndependently(void)
+{
+    measure(NRF_802154_SETUP_TIME_TX, TEST_SETUP_TIME, EST_WINDOW);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_SETUP_TIME + EST_MARGIN,
+                             nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_TX));
+    TEST_ASSERT_EQUAL_UINT32(RX_SETUP_TIME, nrf_802154_setup_time_get(NRF_802154_SETUP_TIME_RX));
+}
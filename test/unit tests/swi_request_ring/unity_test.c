@@ -0,0 +1,263 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mock_nrf_802154_clock.h"
+#include "mock_nrf_802154_core.h"
+#include "mock_nrf_802154_rx_buffer.h"
+#include "mock_nrf_egu.h"
+
+#define __LDREXW(ptr)           (*(ptr))
+#define __STREXW(value, ptr)    ((*(ptr) = (value)), 0)
+#define __CLREX()
+
+#include "nrf_802154_swi.c"
+
+#define TEST_DONE_MAX 16 ///< Maximal number of done callbacks recorded in a test.
+
+static bool   m_done_results[TEST_DONE_MAX];  ///< Results passed to the done callbacks.
+static void * m_done_contexts[TEST_DONE_MAX]; ///< Contexts passed to the done callbacks.
+static int    m_done_count;                   ///< Number of done callbacks called.
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+    m_req_r_idx  = 0;
+    m_req_w_idx  = 0;
+    m_done_count = 0;
+    memset(m_req_queue, 0, sizeof(m_req_queue));
+}
+
+void tearDown(void)
+{
+
+}
+
+/***************************************************************************************************
+ * @section Notifications
+ **************************************************************************************************/
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi){}
+void nrf_802154_received(uint8_t * p_data, uint8_t length, int8_t power, uint8_t lqi){}
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error){}
+void nrf_802154_transmitted_raw(const uint8_t * p_frame, uint8_t * p_ack, int8_t power, uint8_t lqi){}
+void nrf_802154_transmitted(const uint8_t * p_frame, uint8_t * p_ack, uint8_t length, int8_t power, uint8_t lqi){}
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error){}
+void nrf_802154_energy_detected(uint8_t result){}
+void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error){}
+void nrf_802154_cca_done(bool channel_free){}
+void nrf_802154_cca_failed(nrf_802154_cca_error_t error){}
+void nrf_802154_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats){}
+
+/***************************************************************************************************
+ * @section Helpers
+ **************************************************************************************************/
+
+static void request_done(bool result, void * p_context)
+{
+    TEST_ASSERT_LESS_THAN(TEST_DONE_MAX, m_done_count);
+
+    m_done_results[m_done_count]  = result;
+    m_done_contexts[m_done_count] = p_context;
+    m_done_count++;
+}
+
+static void request_trigger_expect(void)
+{
+    nrf_egu_task_trigger_Expect(SWI_EGU, REQ_TASK);
+}
+
+static void swi_irq_expect(void)
+{
+    nrf_egu_event_check_ExpectAndReturn(SWI_EGU, NTF_EVENT, false);
+    nrf_egu_event_check_ExpectAndReturn(SWI_EGU, HFCLK_STOP_EVENT, false);
+    nrf_egu_event_check_ExpectAndReturn(SWI_EGU, REQ_EVENT, true);
+    nrf_egu_event_clear_Expect(SWI_EGU, REQ_EVENT);
+}
+
+/***************************************************************************************************
+ * @section Request ring tests
+ **************************************************************************************************/
+
+void test_ShouldProcessSynchronousRequestInSwi(void)
+{
+    bool result = false;
+
+    request_trigger_expect();
+    nrf_802154_swi_sleep(NRF_802154_TERM_802154, &result);
+
+    TEST_ASSERT_EQUAL_UINT32(1, m_req_w_idx);
+    TEST_ASSERT_EQUAL(REQ_SLOT_COMMITTED, m_req_queue[0].state);
+
+    swi_irq_expect();
+    nrf_802154_core_sleep_ExpectAndReturn(NRF_802154_TERM_802154, true);
+
+    SWI_IRQHandler();
+
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL_UINT32(1, m_req_r_idx);
+    TEST_ASSERT_EQUAL(REQ_SLOT_FREE, m_req_queue[0].state);
+}
+
+void test_ShouldProcessQueuedRequestsInOrder(void)
+{
+    uint8_t buffer[MAX_PACKET_SIZE + 1];
+    uint8_t frame[MAX_PACKET_SIZE + 1];
+
+    request_trigger_expect();
+    TEST_ASSERT_TRUE(nrf_802154_swi_channel_update_async(request_done, (void *)1));
+    request_trigger_expect();
+    TEST_ASSERT_TRUE(nrf_802154_swi_buffer_free_async(buffer, request_done, (void *)2));
+    request_trigger_expect();
+    TEST_ASSERT_TRUE(nrf_802154_swi_transmit_async(NRF_802154_TERM_NONE,
+                                                   REQ_ORIG_HIGHER_LAYER,
+                                                   frame,
+                                                   true,
+                                                   false,
+                                                   NULL,
+                                                   request_done,
+                                                   (void *)3));
+
+    TEST_ASSERT_EQUAL(0, m_done_count);
+
+    swi_irq_expect();
+    nrf_802154_core_channel_update_ExpectAndReturn(true);
+    nrf_802154_core_notify_buffer_free_ExpectAndReturn(buffer, false);
+    nrf_802154_core_transmit_ExpectAndReturn(NRF_802154_TERM_NONE,
+                                             REQ_ORIG_HIGHER_LAYER,
+                                             frame,
+                                             true,
+                                             false,
+                                             NULL,
+                                             true);
+
+    SWI_IRQHandler();
+
+    TEST_ASSERT_EQUAL(3, m_done_count);
+    TEST_ASSERT_TRUE(m_done_results[0]);
+    TEST_ASSERT_FALSE(m_done_results[1]);
+    TEST_ASSERT_TRUE(m_done_results[2]);
+    TEST_ASSERT_EQUAL_PTR((void *)1, m_done_contexts[0]);
+    TEST_ASSERT_EQUAL_PTR((void *)2, m_done_contexts[1]);
+    TEST_ASSERT_EQUAL_PTR((void *)3, m_done_contexts[2]);
+    TEST_ASSERT_EQUAL_UINT32(3, m_req_r_idx);
+}
+
+void test_ShouldRejectAsyncRequestWhenRingIsFull(void)
+{
+    for (uint32_t i = 0; i < REQ_QUEUE_SIZE; i++)
+    {
+        request_trigger_expect();
+        TEST_ASSERT_TRUE(nrf_802154_swi_channel_update_async(request_done, NULL));
+    }
+
+    TEST_ASSERT_FALSE(nrf_802154_swi_channel_update_async(request_done, NULL));
+    TEST_ASSERT_EQUAL_UINT32(REQ_QUEUE_SIZE, m_req_w_idx);
+
+    swi_irq_expect();
+    nrf_802154_core_channel_update_IgnoreAndReturn(true);
+
+    SWI_IRQHandler();
+
+    TEST_ASSERT_EQUAL(REQ_QUEUE_SIZE, m_done_count);
+    TEST_ASSERT_EQUAL_UINT32(REQ_QUEUE_SIZE, m_req_r_idx);
+
+    request_trigger_expect();
+    TEST_ASSERT_TRUE(nrf_802154_swi_channel_update_async(request_done, NULL));
+}
+
+void test_ShouldNotBlockCommittedRequestsOnPreemptedProducer(void)
+{
+    nrf_802154_req_data_t * p_preempted;
+    bool                    result = false;
+
+    // A producer claims a slot and gets preempted before committing it.
+    p_preempted = req_enter(&result, NULL, NULL);
+    TEST_ASSERT_NOT_NULL(p_preempted);
+
+    request_trigger_expect();
+    TEST_ASSERT_TRUE(nrf_802154_swi_channel_update_async(request_done, NULL));
+
+    swi_irq_expect();
+    nrf_802154_core_channel_update_ExpectAndReturn(true);
+
+    SWI_IRQHandler();
+
+    // The committed request is processed, but its slot waits for the preceding one.
+    TEST_ASSERT_EQUAL(1, m_done_count);
+    TEST_ASSERT_EQUAL_UINT32(0, m_req_r_idx);
+    TEST_ASSERT_EQUAL(REQ_SLOT_PROCESSED, m_req_queue[1].state);
+
+    // The preempted producer resumes and commits its slot.
+    p_preempted->type = REQ_TYPE_CCA_CFG_UPDATE;
+    request_trigger_expect();
+    req_exit(p_preempted);
+
+    swi_irq_expect();
+    nrf_802154_core_cca_cfg_update_ExpectAndReturn(true);
+
+    SWI_IRQHandler();
+
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL(1, m_done_count);
+    TEST_ASSERT_EQUAL_UINT32(2, m_req_r_idx);
+    TEST_ASSERT_EQUAL(REQ_SLOT_FREE, m_req_queue[0].state);
+    TEST_ASSERT_EQUAL(REQ_SLOT_FREE, m_req_queue[1].state);
+}
+
+void test_ShouldProcessRequestsWhenIndexesWrapAround(void)
+{
+    m_req_r_idx = UINT32_MAX - 1;
+    m_req_w_idx = UINT32_MAX - 1;
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        request_trigger_expect();
+        TEST_ASSERT_TRUE(nrf_802154_swi_channel_update_async(request_done, (void *)i));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(2, m_req_w_idx);
+
+    swi_irq_expect();
+    nrf_802154_core_channel_update_IgnoreAndReturn(true);
+
+    SWI_IRQHandler();
+
+    TEST_ASSERT_EQUAL(4, m_done_count);
+    TEST_ASSERT_EQUAL_PTR((void *)0, m_done_contexts[0]);
+    TEST_ASSERT_EQUAL_PTR((void *)3, m_done_contexts[3]);
+    TEST_ASSERT_EQUAL_UINT32(2, m_req_r_idx);
+}
@@ -0,0 +1,207 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "nrf_802154_config.h"
+#include "mock_nrf_802154_debug.h"
+#include "mock_nrf_802154_hp_timer.h"
+#include "mock_nrf_802154_lp_timer.h"
+#include "mock_nrf_ppi.h"
+
+#include "nrf_802154_timer_coord.c"
+
+#define TEST_SYNC_PERIOD (1UL << 22) ///< Interval between the synchronizations used in the tests [us].
+#define TEST_DRIFT_PPB   40000       ///< Drift of the HP timer used in the tests [ppb].
+#define TEST_DRIFT_MAX   120         ///< Allowed error of the estimated drift due to the rounding of the HP timer time to 1 us [ppb].
+
+static uint32_t m_lp_time;   ///< Current LP timer time used in the tests [us].
+static uint32_t m_hp_offset; ///< HP timer time at the last start of the HP timer.
+static uint32_t m_lp_start;  ///< LP timer time at the last start of the HP timer [us].
+static uint32_t m_resync_dt; ///< Delay of the last requested resynchronization [us].
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+static void lp_timer_sync_start_at_stub(uint32_t t0, uint32_t dt, int cmock_num_calls)
+{
+    (void)t0;
+    (void)cmock_num_calls;
+
+    m_resync_dt = dt;
+}
+
+static void hp_timer_start(uint32_t hp_offset)
+{
+    nrf_802154_hp_timer_start_Expect();
+    nrf_802154_hp_timer_sync_prepare_Expect();
+    nrf_802154_lp_timer_sync_start_now_Expect();
+
+    nrf_802154_timer_coord_start();
+
+    m_hp_offset = hp_offset;
+    m_lp_start  = m_lp_time;
+}
+
+static void sync(void)
+{
+    uint64_t lp_elapsed = m_lp_time - m_lp_start;
+    uint32_t hp_time    = m_hp_offset + (uint32_t)(lp_elapsed +
+                                                   (lp_elapsed * TEST_DRIFT_PPB + 500000000ULL) /
+                                                   1000000000ULL);
+
+    nrf_802154_hp_timer_sync_time_get_ExpectAnyArgsAndReturn(true);
+    nrf_802154_hp_timer_sync_time_get_ReturnThruPtr_p_timestamp(&hp_time);
+    nrf_802154_lp_timer_sync_time_get_ExpectAndReturn(m_lp_time);
+    nrf_802154_hp_timer_sync_prepare_Expect();
+
+    nrf_802154_lp_timer_synchronized();
+
+    m_lp_time += TEST_SYNC_PERIOD;
+}
+
+void setUp(void)
+{
+    nrf_802154_hp_timer_init_Expect();
+    nrf_802154_lp_timer_sync_event_get_ExpectAndReturn(0);
+    nrf_802154_hp_timer_sync_task_get_ExpectAndReturn(0);
+    nrf_ppi_channel_endpoint_setup_Ignore();
+    nrf_ppi_channel_enable_Ignore();
+    nrf_ppi_channel_include_in_group_Ignore();
+    nrf_802154_lp_timer_critical_section_enter_Ignore();
+    nrf_802154_lp_timer_critical_section_exit_Ignore();
+    nrf_802154_lp_timer_sync_start_at_StubWithCallback(lp_timer_sync_start_at_stub);
+
+    nrf_802154_timer_coord_init();
+
+    m_lp_time   = 123456UL << DRIFT_X_SHIFT;
+    m_resync_dt = 0;
+    hp_timer_start(0);
+}
+
+void tearDown(void)
+{
+
+}
+
+/***********************************************************************************/
+/***************************** DRIFT ESTIMATION TESTS ******************************/
+/***********************************************************************************/
+
+void test_ShouldNotKnowDriftBeforeSecondSynchronization(void)
+{
+    int32_t  drift;
+    uint32_t uncertainty;
+
+    TEST_ASSERT_FALSE(nrf_802154_timer_coord_drift_get(&drift, &uncertainty));
+
+    sync();
+
+    TEST_ASSERT_FALSE(nrf_802154_timer_coord_drift_get(&drift, &uncertainty));
+    TEST_ASSERT_EQUAL_UINT32(FIRST_RESYNC_TIME, m_resync_dt);
+}
+
+void test_ShouldEstimateDriftWithoutUncertaintyFromTwoSynchronizations(void)
+{
+    int32_t  drift;
+    uint32_t uncertainty;
+
+    sync();
+    sync();
+
+    TEST_ASSERT_TRUE(nrf_802154_timer_coord_drift_get(&drift, &uncertainty));
+    TEST_ASSERT_INT32_WITHIN(TEST_DRIFT_MAX, TEST_DRIFT_PPB, drift);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, uncertainty);
+    TEST_ASSERT_EQUAL_UINT32(RESYNC_TIME, m_resync_dt);
+}
+
+void test_ShouldExtendResyncTimeWhenDriftEstimateIsTight(void)
+{
+    int32_t  drift;
+    uint32_t uncertainty;
+
+    for (uint32_t i = 0; i < DRIFT_WINDOW_SIZE; i++)
+    {
+        sync();
+    }
+
+    TEST_ASSERT_TRUE(nrf_802154_timer_coord_drift_get(&drift, &uncertainty));
+    TEST_ASSERT_INT32_WITHIN(TEST_DRIFT_MAX, TEST_DRIFT_PPB, drift);
+    TEST_ASSERT_LESS_THAN(TEST_DRIFT_MAX, uncertainty);
+    TEST_ASSERT_GREATER_THAN(RESYNC_TIME, m_resync_dt);
+}
+
+void test_ShouldKeepDriftEstimateWhenHpTimerIsRestarted(void)
+{
+    int32_t  drift;
+    uint32_t uncertainty;
+    uint32_t resync_dt;
+
+    for (uint32_t i = 0; i < DRIFT_WINDOW_SIZE; i++)
+    {
+        sync();
+    }
+
+    resync_dt = m_resync_dt;
+
+    // The HP timer starts counting from an unrelated value in the next timeslot.
+    m_lp_time += 10 * TEST_SYNC_PERIOD;
+    hp_timer_start(0x80000000UL);
+
+    TEST_ASSERT_TRUE(nrf_802154_timer_coord_drift_get(&drift, &uncertainty));
+    TEST_ASSERT_INT32_WITHIN(TEST_DRIFT_MAX, TEST_DRIFT_PPB, drift);
+
+    sync();
+
+    TEST_ASSERT_TRUE(nrf_802154_timer_coord_drift_get(&drift, &uncertainty));
+    TEST_ASSERT_INT32_WITHIN(TEST_DRIFT_MAX, TEST_DRIFT_PPB, drift);
+    TEST_ASSERT_LESS_THAN(TEST_DRIFT_MAX, uncertainty);
+    TEST_ASSERT_EQUAL_UINT32(resync_dt, m_resync_dt);
+}
+
+void test_ShouldEstimateDriftOverTimepointsOfManyTimeslots(void)
+{
+    int32_t  drift;
+    uint32_t uncertainty;
+
+    // Two synchronizations in each timeslot, with the HP timer restarted in between.
+    for (uint32_t i = 0; i < DRIFT_WINDOW_SIZE / 2; i++)
+    {
+        hp_timer_start(i * 0x10000000UL + 12345);
+        sync();
+        sync();
+        m_lp_time += 3 * TEST_SYNC_PERIOD;
+    }
+
+    TEST_ASSERT_TRUE(nrf_802154_timer_coord_drift_get(&drift, &uncertainty));
+    TEST_ASSERT_INT32_WITHIN(TEST_DRIFT_MAX, TEST_DRIFT_PPB, drift);
+    TEST_ASSERT_LESS_THAN(TEST_DRIFT_MAX, uncertainty);
+}
@@ -0,0 +1,139 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include "unity.h"
+
+#include "mock_nrf_802154_lp_timer.h"
+
+#include "nrf_802154_timer_sched.c"
+
+#define TEST_NOW (((uint64_t)3 << 32) | 0xfffff000UL) ///< Current time, close to a 32-bit wrap [us].
+
+/***********************************************************************************/
+/***********************************************************************************/
+/***********************************************************************************/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+static bool time64_convert(uint64_t time, uint32_t * p_t0, uint32_t * p_dt)
+{
+    nrf_802154_lp_timer_time64_get_ExpectAndReturn(TEST_NOW);
+
+    return nrf_802154_timer_sched_time64_to_t0_dt(time, p_t0, p_dt);
+}
+
+/***********************************************************************************/
+/****************************** TIME64 TO T0/DT TESTS ******************************/
+/***********************************************************************************/
+
+void test_ShouldConvertTimeInNearFuture(void)
+{
+    uint32_t t0;
+    uint32_t dt;
+
+    TEST_ASSERT_TRUE(time64_convert(TEST_NOW + 1, &t0, &dt));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)TEST_NOW, t0);
+    TEST_ASSERT_EQUAL_UINT32(1, dt);
+}
+
+void test_ShouldConvertTimeAcross32BitWrap(void)
+{
+    uint32_t t0;
+    uint32_t dt;
+
+    TEST_ASSERT_TRUE(time64_convert(TEST_NOW + 0x2000UL, &t0, &dt));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)TEST_NOW, t0);
+    TEST_ASSERT_EQUAL_UINT32(0x2000UL, dt);
+    TEST_ASSERT_EQUAL_UINT32(0x1000UL, t0 + dt);
+}
+
+void test_ShouldConvertTimeAtLimit(void)
+{
+    uint32_t t0;
+    uint32_t dt;
+
+    TEST_ASSERT_TRUE(time64_convert(TEST_NOW + NRF_802154_TIMER_SCHED_DT_MAX, &t0, &dt));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)TEST_NOW, t0);
+    TEST_ASSERT_EQUAL_UINT32(NRF_802154_TIMER_SCHED_DT_MAX, dt);
+    TEST_ASSERT_TRUE(nrf_802154_timer_sched_time_is_in_future(t0, t0, dt));
+}
+
+void test_ShouldRejectTimeBeyondLimit(void)
+{
+    uint32_t t0 = 0;
+    uint32_t dt = 0;
+
+    TEST_ASSERT_FALSE(time64_convert(TEST_NOW + NRF_802154_TIMER_SCHED_DT_MAX + 1, &t0, &dt));
+    TEST_ASSERT_FALSE(time64_convert(TEST_NOW + ((uint64_t)1 << 32) + 1, &t0, &dt));
+    TEST_ASSERT_EQUAL_UINT32(0, t0);
+    TEST_ASSERT_EQUAL_UINT32(0, dt);
+}
+
+void test_ShouldRejectCurrentAndPastTime(void)
+{
+    uint32_t t0;
+    uint32_t dt;
+
+    TEST_ASSERT_FALSE(time64_convert(TEST_NOW, &t0, &dt));
+    TEST_ASSERT_FALSE(time64_convert(TEST_NOW - 1, &t0, &dt));
+    TEST_ASSERT_FALSE(time64_convert(0, &t0, &dt));
+}
+
+/***********************************************************************************/
+/***************************** TIME TO TIME64 TESTS ********************************/
+/***********************************************************************************/
+
+void test_ShouldExpandTimeAtLimitAheadOfNow(void)
+{
+    uint32_t time = (uint32_t)TEST_NOW + NRF_802154_TIMER_SCHED_DT_MAX;
+
+    nrf_802154_lp_timer_time64_get_ExpectAndReturn(TEST_NOW);
+
+    TEST_ASSERT_EQUAL_UINT64(TEST_NOW + NRF_802154_TIMER_SCHED_DT_MAX,
+                             nrf_802154_timer_sched_time64_from_time(time));
+}
+
+void test_ShouldExpandTimeAtLimitBehindNow(void)
+{
+    uint32_t time = (uint32_t)TEST_NOW - NRF_802154_TIMER_SCHED_DT_MAX - 1;
+
+    nrf_802154_lp_timer_time64_get_ExpectAndReturn(TEST_NOW);
+
+    TEST_ASSERT_EQUAL_UINT64(TEST_NOW - NRF_802154_TIMER_SCHED_DT_MAX - 1,
+                             nrf_802154_timer_sched_time64_from_time(time));
+}
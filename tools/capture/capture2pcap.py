@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+import argparse
+import re
+import struct
+import sys
+
+"""
+The script converts the frames captured by the driver built with NRF_802154_CAPTURE_ENABLED into
+a pcap file that can be opened in Wireshark.
+
+Two input forms are supported:
+ - a RAM dump of the whole `nrf_802154_capture_buffer` structure, for example:
+       nrfjprog --memrd <address of nrf_802154_capture_buffer> --n <size> > capture.txt
+   or, from GDB:
+       dump binary value capture.bin nrf_802154_capture_buffer
+ - with --stream, the raw stream of records returned by nrf_802154_capture_read(), for example
+   forwarded by the application over UART and logged to a file.
+"""
+
+CAPTURE_MAGIC = 0x50414350
+HEADER_FMT = '<5I'
+
+PCAP_MAGIC = 0xA1B2C3D4
+PCAP_VERSION = (2, 4)
+PCAP_SNAPLEN = 65535
+LINKTYPE_IEEE802_15_4_TAP = 283
+
+RECORD_HDR_FMT = '<4I'
+
+NRFJPROG_LINE_RE = re.compile(r'^0x[0-9A-Fa-f]+:\s+((?:[0-9A-Fa-f]{8}\s*)+)')
+
+
+def dump_load(path):
+    with open(path, 'rb') as file_handler:
+        data = file_handler.read()
+
+    # Text dumps of nrfjprog contain lines of the form "0x20001000: 50414350 00001000 ...".
+    try:
+        words = []
+
+        for line in data.decode('ascii').splitlines():
+            match = NRFJPROG_LINE_RE.match(line.strip())
+
+            if match:
+                words.extend(int(word, 16) for word in match.group(1).split())
+
+        if words:
+            return struct.pack('<{}I'.format(len(words)), *words)
+    except UnicodeDecodeError:
+        pass
+
+    return data
+
+
+def ring_extract(data):
+    header_size = struct.calcsize(HEADER_FMT)
+
+    if len(data) < header_size:
+        sys.exit('Dump is too short to contain the capture buffer header.')
+
+    magic, size, w_idx, r_idx, dropped = struct.unpack_from(HEADER_FMT, data)
+
+    if magic != CAPTURE_MAGIC:
+        sys.exit('Invalid capture magic 0x{:08X}. Is it a dump of nrf_802154_capture_buffer?'.format(magic))
+
+    if len(data) < header_size + size:
+        sys.exit('Dump is too short to contain {} bytes of the capture buffer.'.format(size))
+
+    count = (w_idx - r_idx) & 0xFFFFFFFF
+
+    if count > size:
+        sys.exit('Corrupted capture buffer indexes: write {}, read {}.'.format(w_idx, r_idx))
+
+    ring = data[header_size:header_size + size]
+    offset = r_idx % size
+    stream = (ring[offset:] + ring[:offset])[:count]
+
+    return stream, dropped
+
+
+def records_split(stream):
+    hdr_size = struct.calcsize(RECORD_HDR_FMT)
+    records = []
+    offset = 0
+
+    while offset + hdr_size <= len(stream):
+        _, _, incl_len, _ = struct.unpack_from(RECORD_HDR_FMT, stream, offset)
+
+        if incl_len > PCAP_SNAPLEN:
+            sys.exit('Invalid record length {} at offset {}.'.format(incl_len, offset))
+
+        end = offset + hdr_size + incl_len
+
+        if end > len(stream):
+            break
+
+        records.append(stream[offset:end])
+        offset = end
+
+    return records, len(stream) - offset
+
+
+def pcap_write(path, records):
+    with open(path, 'wb') as file_handler:
+        file_handler.write(struct.pack('<IHHiIII',
+                                       PCAP_MAGIC,
+                                       PCAP_VERSION[0],
+                                       PCAP_VERSION[1],
+                                       0,
+                                       0,
+                                       PCAP_SNAPLEN,
+                                       LINKTYPE_IEEE802_15_4_TAP))
+
+        for record in records:
+            file_handler.write(record)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert the nRF 802.15.4 driver frame capture to pcap.')
+    parser.add_argument('input', help='RAM dump of nrf_802154_capture_buffer, or the record stream with --stream')
+    parser.add_argument('-o', '--output', required=True, help='pcap file to be written')
+    parser.add_argument('--stream', action='store_true', help='input is the stream read with nrf_802154_capture_read()')
+    args = parser.parse_args()
+
+    if args.stream:
+        with open(args.input, 'rb') as file_handler:
+            stream = file_handler.read()
+
+        dropped = None
+    else:
+        stream, dropped = ring_extract(dump_load(args.input))
+
+    records, trailing = records_split(stream)
+    pcap_write(args.output, records)
+
+    print('{} frames written to {}.'.format(len(records), args.output))
+
+    if trailing:
+        print('{} bytes of an incomplete record at the end were skipped.'.format(trailing))
+
+    if dropped:
+        print('{} frames were dropped by the driver due to lack of space in the buffer.'.format(dropped))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,714 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements a host benchmark of the Wi-Fi Coexistence module.
+ *
+ * The Wi-Fi Coexistence module is linked with a software stand-in of the PTA arbiter and
+ * a discrete-event model of the Wi-Fi and 802.15.4 traffic. The time is simulated, so the results
+ * do not depend on the host load and are reproducible for the given seed.
+ *
+ */
+
+#include <assert.h>
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154_wifi_coex.h"
+#include "platform/pta/nrf_802154_pta.h"
+#include "timer_scheduler/nrf_802154_timer_sched.h"
+
+#define TIME_NEVER      UINT64_MAX ///< Time of an event that is not scheduled.
+#define FRAME_QUEUE_LEN 16         ///< Maximum number of frames waiting for transmission.
+
+/**
+ * @brief Parameters of a single benchmark run.
+ */
+typedef struct
+{
+    double                           wifi_load;      ///< Fraction of time the Wi-Fi has data to transmit.
+    uint32_t                         wifi_burst;     ///< Mean duration of the Wi-Fi activity burst, in microseconds.
+    bool                             wifi_yields;    ///< Indicates if the arbiter grants the high-priority requests during the Wi-Fi activity.
+    double                           frame_rate;     ///< Mean rate of the 802.15.4 frames, in frames per second.
+    uint32_t                         frame_length;   ///< Duration of the 802.15.4 frame, in microseconds.
+    uint32_t                         max_wait;       ///< Time after which a queued 802.15.4 frame is dropped, in microseconds.
+    uint32_t                         grant_latency;  ///< Reaction time of the arbiter, in microseconds.
+    uint32_t                         settle_time;    ///< Grant settle time of the Wi-Fi Coexistence module, in microseconds.
+    bool                             priority_high;  ///< Indicates if the 802.15.4 requests are signalled as the high-priority ones.
+    nrf_802154_wifi_coex_deny_mode_t deny_mode;      ///< Handling of the grant revoked during a frame.
+    uint64_t                         duration;       ///< Duration of the run, in microseconds.
+    uint64_t                         seed;           ///< Seed of the pseudo-random number generator.
+} bench_params_t;
+
+/**
+ * @brief Results of a single benchmark run.
+ */
+typedef struct
+{
+    uint32_t offered;   ///< Number of frames generated.
+    uint32_t ok;        ///< Number of frames transmitted without a collision.
+    uint32_t collided;  ///< Number of frames transmitted while the Wi-Fi was transmitting.
+    uint32_t aborted;   ///< Number of transmissions aborted due to the revoked grant.
+    uint32_t dropped;   ///< Number of frames dropped after waiting too long for the grant.
+    uint64_t wifi_air;  ///< Time the Wi-Fi was transmitting, in microseconds.
+} bench_results_t;
+
+static uint64_t             m_now;                   ///< Simulated time.
+static uint64_t             m_rng;                   ///< State of the pseudo-random number generator.
+static nrf_802154_timer_t * mp_timers;               ///< List of the running timers.
+
+static bool                 m_pta_request;           ///< State of the REQUEST signal.
+static bool                 m_pta_priority;          ///< State of the PRIORITY signal.
+static bool                 m_pta_grant;             ///< State of the GRANT signal.
+static bool                 m_pta_grant_target;      ///< State the GRANT signal is changing to.
+static uint64_t             m_pta_grant_time;        ///< Time of the pending GRANT signal change.
+
+static bool                 m_wifi_wants;            ///< Indicates if the Wi-Fi has data to transmit.
+static uint64_t             m_wifi_toggle_time;      ///< Time of the next Wi-Fi activity change.
+static uint64_t             m_wifi_air_start;        ///< Time the Wi-Fi started transmitting.
+
+static uint64_t             m_frames[FRAME_QUEUE_LEN]; ///< Arrival times of the queued frames.
+static uint32_t             m_frames_head;           ///< Index of the oldest queued frame.
+static uint32_t             m_frames_cnt;            ///< Number of the queued frames.
+static uint64_t             m_arrival_time;          ///< Time of the next frame arrival.
+static bool                 m_requested;             ///< Indicates if the priority is requested from the module.
+static rsch_prio_t          m_approved;              ///< Priority level approved by the module.
+static bool                 m_tx_active;             ///< Indicates if a frame is being transmitted.
+static bool                 m_tx_collided;           ///< Indicates if the Wi-Fi transmitted during the frame.
+static uint64_t             m_tx_end;                ///< Time the frame being transmitted ends.
+
+static const bench_params_t * mp_params;             ///< Parameters of the current run.
+static bench_results_t        m_results;             ///< Results of the current run.
+
+/***************************************************************************************************
+ * @section Pseudo-random number generator
+ **************************************************************************************************/
+
+static uint64_t rng_next(void)
+{
+    m_rng ^= m_rng << 13;
+    m_rng ^= m_rng >> 7;
+    m_rng ^= m_rng << 17;
+
+    return m_rng;
+}
+
+/** @brief Draw an exponentially distributed duration with the given mean. */
+static uint64_t rng_exp(double mean)
+{
+    double u = ((double)(rng_next() >> 11) + 1.0) / 9007199254740993.0;
+
+    return (uint64_t)(-mean * log(u)) + 1;
+}
+
+/***************************************************************************************************
+ * @section Timer Scheduler stand-in
+ **************************************************************************************************/
+
+uint32_t nrf_802154_timer_sched_time_get(void)
+{
+    return (uint32_t)m_now;
+}
+
+uint64_t nrf_802154_timer_sched_time64_get(void)
+{
+    return m_now;
+}
+
+uint32_t nrf_802154_timer_sched_granularity_get(void)
+{
+    return 1;
+}
+
+bool nrf_802154_timer_sched_time_is_in_future(uint32_t now, uint32_t t0, uint32_t dt)
+{
+    return (int32_t)(t0 + dt - now) > 0;
+}
+
+bool nrf_802154_timer_sched_is_running(nrf_802154_timer_t * p_timer)
+{
+    for (nrf_802154_timer_t * p_it = mp_timers; p_it != NULL; p_it = p_it->p_next)
+    {
+        if (p_it == p_timer)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void nrf_802154_timer_sched_remove(nrf_802154_timer_t * p_timer, bool * p_was_running)
+{
+    nrf_802154_timer_t ** pp_it   = &mp_timers;
+    bool                  running = false;
+
+    while (*pp_it != NULL)
+    {
+        if (*pp_it == p_timer)
+        {
+            *pp_it  = p_timer->p_next;
+            running = true;
+            break;
+        }
+
+        pp_it = &(*pp_it)->p_next;
+    }
+
+    if (p_was_running != NULL)
+    {
+        *p_was_running = running;
+    }
+}
+
+void nrf_802154_timer_sched_add(nrf_802154_timer_t * p_timer, bool round_up)
+{
+    uint32_t now = (uint32_t)m_now;
+
+    (void)round_up;
+
+    nrf_802154_timer_sched_remove(p_timer, NULL);
+
+    p_timer->expiry = m_now + (int32_t)(p_timer->t0 + p_timer->dt - now);
+    p_timer->p_next = mp_timers;
+    mp_timers       = p_timer;
+}
+
+/** @brief Get the time of the earliest timer expiration. */
+static uint64_t timers_next_get(void)
+{
+    uint64_t next = TIME_NEVER;
+
+    for (nrf_802154_timer_t * p_it = mp_timers; p_it != NULL; p_it = p_it->p_next)
+    {
+        if (p_it->expiry < next)
+        {
+            next = p_it->expiry;
+        }
+    }
+
+    return next;
+}
+
+/** @brief Fire all timers expired at the current time. */
+static void timers_process(void)
+{
+    bool fired;
+
+    do
+    {
+        fired = false;
+
+        for (nrf_802154_timer_t * p_it = mp_timers; p_it != NULL; p_it = p_it->p_next)
+        {
+            if (p_it->expiry <= m_now)
+            {
+                nrf_802154_timer_sched_remove(p_it, NULL);
+                p_it->callback(p_it->p_context);
+                fired = true;
+                break;
+            }
+        }
+    }
+    while (fired);
+}
+
+/***************************************************************************************************
+ * @section PTA arbiter stand-in
+ **************************************************************************************************/
+
+/** @brief Check if the Wi-Fi is transmitting. */
+static inline bool wifi_on_air(void)
+{
+    return m_wifi_wants && !m_pta_grant;
+}
+
+/** @brief Account the Wi-Fi airtime before the state of the medium changes. */
+static void wifi_air_account(bool was_on_air)
+{
+    bool on_air = wifi_on_air();
+
+    if (was_on_air && !on_air)
+    {
+        m_results.wifi_air += m_now - m_wifi_air_start;
+    }
+    else if (!was_on_air && on_air)
+    {
+        m_wifi_air_start = m_now;
+    }
+}
+
+/** @brief Evaluate the arbitration and schedule the GRANT signal change. */
+static void arbiter_update(void)
+{
+    bool yield   = m_pta_priority && mp_params->wifi_yields;
+    bool desired = m_pta_request && (!m_wifi_wants || yield);
+
+    if (desired == m_pta_grant)
+    {
+        m_pta_grant_time = TIME_NEVER;
+    }
+    else if ((m_pta_grant_time == TIME_NEVER) || (m_pta_grant_target != desired))
+    {
+        m_pta_grant_target = desired;
+        m_pta_grant_time   = m_now + mp_params->grant_latency;
+    }
+}
+
+/** @brief Apply the pending GRANT signal change. */
+static void arbiter_grant_apply(void)
+{
+    bool was_on_air = wifi_on_air();
+
+    m_pta_grant      = m_pta_grant_target;
+    m_pta_grant_time = TIME_NEVER;
+
+    wifi_air_account(was_on_air);
+
+    nrf_802154_pta_grant_changed();
+
+    if (m_tx_active && wifi_on_air())
+    {
+        m_tx_collided = true;
+    }
+}
+
+/** @brief Toggle the Wi-Fi activity. */
+static void wifi_toggle(void)
+{
+    bool   was_on_air = wifi_on_air();
+    double load       = mp_params->wifi_load;
+    double burst      = mp_params->wifi_burst;
+
+    m_wifi_wants       = !m_wifi_wants;
+    m_wifi_toggle_time = m_now + rng_exp(m_wifi_wants ? burst : burst * (1.0 - load) / load);
+
+    wifi_air_account(was_on_air);
+    arbiter_update();
+
+    if (m_tx_active && wifi_on_air())
+    {
+        m_tx_collided = true;
+    }
+}
+
+void nrf_802154_pta_init(void)
+{
+    m_pta_request    = false;
+    m_pta_priority   = false;
+    m_pta_grant      = false;
+    m_pta_grant_time = TIME_NEVER;
+}
+
+void nrf_802154_pta_uninit(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_pta_request_set(bool active)
+{
+    m_pta_request = active;
+    arbiter_update();
+}
+
+void nrf_802154_pta_priority_set(bool high)
+{
+    m_pta_priority = high;
+    arbiter_update();
+}
+
+bool nrf_802154_pta_grant_get(void)
+{
+    return m_pta_grant;
+}
+
+void * nrf_802154_pta_deny_event_addr_get(void)
+{
+    return NULL;
+}
+
+/***************************************************************************************************
+ * @section 802.15.4 traffic model
+ **************************************************************************************************/
+
+void nrf_802154_wifi_coex_prio_changed(rsch_prio_t priority)
+{
+    m_approved = priority;
+}
+
+/** @brief Remove the oldest frame from the queue. */
+static void frame_dequeue(void)
+{
+    assert(m_frames_cnt > 0);
+
+    m_frames_head = (m_frames_head + 1) % FRAME_QUEUE_LEN;
+    m_frames_cnt--;
+}
+
+/** @brief Queue a new frame and schedule the next arrival. */
+static void frame_arrive(void)
+{
+    m_results.offered++;
+
+    if (m_frames_cnt < FRAME_QUEUE_LEN)
+    {
+        m_frames[(m_frames_head + m_frames_cnt) % FRAME_QUEUE_LEN] = m_now;
+        m_frames_cnt++;
+    }
+    else
+    {
+        m_results.dropped++;
+    }
+
+    m_arrival_time = m_now + rng_exp(1000000.0 / mp_params->frame_rate);
+}
+
+/** @brief Finish the frame being transmitted. */
+static void tx_end(void)
+{
+    if (m_tx_collided)
+    {
+        m_results.collided++;
+    }
+    else
+    {
+        m_results.ok++;
+    }
+
+    m_tx_active = false;
+    frame_dequeue();
+}
+
+/** @brief Get the time the oldest queued frame is dropped. */
+static uint64_t drop_time_get(void)
+{
+    if ((m_frames_cnt == 0) || m_tx_active)
+    {
+        return TIME_NEVER;
+    }
+
+    return m_frames[m_frames_head] + mp_params->max_wait;
+}
+
+/** @brief Drive the requests and transmissions after any state change. */
+static void traffic_process(void)
+{
+    while (drop_time_get() <= m_now)
+    {
+        m_results.dropped++;
+        frame_dequeue();
+    }
+
+    if (m_tx_active && (m_approved == RSCH_PRIO_IDLE))
+    {
+        m_results.aborted++;
+        m_tx_active = false;
+    }
+
+    if ((m_frames_cnt > 0) && !m_requested)
+    {
+        m_requested = true;
+        nrf_802154_wifi_coex_prio_req(RSCH_PRIO_MAX);
+    }
+
+    if ((m_frames_cnt > 0) && !m_tx_active && (m_approved != RSCH_PRIO_IDLE))
+    {
+        nrf_802154_wifi_coex_frame_started(mp_params->frame_length);
+
+        m_tx_active   = true;
+        m_tx_collided = wifi_on_air();
+        m_tx_end      = m_now + mp_params->frame_length;
+    }
+
+    if ((m_frames_cnt == 0) && m_requested)
+    {
+        m_requested = false;
+        nrf_802154_wifi_coex_prio_req(RSCH_PRIO_IDLE);
+    }
+}
+
+/***************************************************************************************************
+ * @section Benchmark
+ **************************************************************************************************/
+
+static uint64_t min_time(uint64_t a, uint64_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/** @brief Run the simulation with the given parameters. */
+static void bench_run(const bench_params_t * p_params, bench_results_t * p_results)
+{
+    nrf_802154_wifi_coex_cfg_t cfg;
+
+    mp_params = p_params;
+    memset(&m_results, 0, sizeof(m_results));
+
+    m_now          = 0;
+    m_rng          = p_params->seed ? p_params->seed : 1;
+    mp_timers      = NULL;
+    m_wifi_wants   = false;
+    m_frames_head  = 0;
+    m_frames_cnt   = 0;
+    m_requested    = false;
+    m_approved     = RSCH_PRIO_IDLE;
+    m_tx_active    = false;
+    m_arrival_time = rng_exp(1000000.0 / p_params->frame_rate);
+
+    m_wifi_toggle_time = (p_params->wifi_load > 0.0) ? rng_exp(p_params->wifi_burst) : TIME_NEVER;
+
+    nrf_802154_wifi_coex_init();
+
+    nrf_802154_wifi_coex_config_get(&cfg);
+    cfg.priority_threshold = p_params->priority_high ? RSCH_PRIO_MAX :
+                             (rsch_prio_t)(RSCH_PRIO_MAX + 1);
+    cfg.grant_settle_time  = p_params->settle_time;
+    cfg.deny_mode          = p_params->deny_mode;
+    nrf_802154_wifi_coex_config_set(&cfg);
+
+    while (m_now < p_params->duration)
+    {
+        uint64_t next = m_arrival_time;
+
+        next = min_time(next, m_wifi_toggle_time);
+        next = min_time(next, m_pta_grant_time);
+        next = min_time(next, timers_next_get());
+        next = min_time(next, drop_time_get());
+        next = min_time(next, m_tx_active ? m_tx_end : TIME_NEVER);
+
+        m_now = next;
+
+        if (m_tx_active && (m_tx_end <= m_now))
+        {
+            tx_end();
+        }
+
+        if (m_pta_grant_time <= m_now)
+        {
+            arbiter_grant_apply();
+        }
+
+        if (m_wifi_toggle_time <= m_now)
+        {
+            wifi_toggle();
+        }
+
+        if (m_arrival_time <= m_now)
+        {
+            frame_arrive();
+        }
+
+        timers_process();
+        traffic_process();
+    }
+
+    if (wifi_on_air())
+    {
+        m_results.wifi_air += m_now - m_wifi_air_start;
+    }
+
+    nrf_802154_wifi_coex_uninit();
+
+    *p_results = m_results;
+}
+
+static void header_print(const bench_params_t * p_params)
+{
+    printf("# priority %s, Wi-Fi %s\n",
+           p_params->priority_high ? "high" : "low",
+           p_params->wifi_yields ? "yields to high priority" : "does not yield");
+    printf("%-6s %-5s %7s %7s %7s %7s %7s %9s %8s %8s %7s %7s %7s\n",
+           "load", "deny", "offered", "ok", "collid", "abort", "drop", "tput[%]",
+           "lat_avg", "lat_max", "denied", "defer", "wifi[%]");
+}
+
+static void results_print(const bench_params_t * p_params, const bench_results_t * p_results)
+{
+    nrf_802154_wifi_coex_stats_t stats;
+    double                       lat_avg;
+
+    nrf_802154_wifi_coex_stats_get(RSCH_PRIO_MAX, &stats);
+
+    lat_avg = stats.grants ? (double)stats.latency_sum / stats.grants : 0.0;
+
+    printf("%-6.2f %-5s %7u %7u %7u %7u %7u %9.1f %8.1f %8u %7u %7u %7.1f\n",
+           p_params->wifi_load,
+           (p_params->deny_mode == NRF_802154_WIFI_COEX_DENY_MODE_ABORT) ? "abort" : "defer",
+           p_results->offered,
+           p_results->ok,
+           p_results->collided,
+           p_results->aborted,
+           p_results->dropped,
+           p_results->offered ? 100.0 * p_results->ok / p_results->offered : 0.0,
+           lat_avg,
+           stats.latency_max,
+           stats.denials,
+           stats.deferred_denials,
+           100.0 * p_results->wifi_air / p_params->duration);
+}
+
+static void usage_print(const char * p_name)
+{
+    printf("Usage: %s [options]\n"
+           "  -l <load>     Wi-Fi load (0.0 - 1.0); sweeps the load and deny modes if omitted\n"
+           "  -b <us>       mean Wi-Fi burst duration (default 2000)\n"
+           "  -y            Wi-Fi yields to the high-priority requests\n"
+           "  -r <fps>      802.15.4 frame rate (default 50)\n"
+           "  -f <us>       802.15.4 frame duration (default 4256)\n"
+           "  -w <us>       maximum time a frame waits for the grant (default 20000)\n"
+           "  -g <us>       arbiter grant latency (default 50)\n"
+           "  -S <us>       grant settle time (default 0)\n"
+           "  -p high|low   signalled priority (default low)\n"
+           "  -d abort|defer deny handling (default abort)\n"
+           "  -t <s>        simulated duration (default 60)\n"
+           "  -s <seed>     random seed (default 1)\n",
+           p_name);
+}
+
+int main(int argc, char ** argv)
+{
+    static const double sweep_loads[] = {0.0, 0.1, 0.2, 0.4, 0.6, 0.8};
+
+    bench_params_t  params;
+    bench_results_t results;
+    bool            sweep = true;
+    int             opt;
+
+    params.wifi_load     = 0.0;
+    params.wifi_burst    = 2000;
+    params.wifi_yields   = false;
+    params.frame_rate    = 50.0;
+    params.frame_length  = 4256;
+    params.max_wait      = 20000;
+    params.grant_latency = 50;
+    params.settle_time   = 0;
+    params.priority_high = false;
+    params.deny_mode     = NRF_802154_WIFI_COEX_DENY_MODE_ABORT;
+    params.duration      = 60ULL * 1000000ULL;
+    params.seed          = 1;
+
+    while ((opt = getopt(argc, argv, "l:b:yr:f:w:g:S:p:d:t:s:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'l':
+                params.wifi_load = atof(optarg);
+                sweep            = false;
+                break;
+
+            case 'b':
+                params.wifi_burst = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'y':
+                params.wifi_yields = true;
+                break;
+
+            case 'r':
+                params.frame_rate = atof(optarg);
+                break;
+
+            case 'f':
+                params.frame_length = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'w':
+                params.max_wait = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'g':
+                params.grant_latency = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'S':
+                params.settle_time = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'p':
+                params.priority_high = (strcmp(optarg, "low") != 0);
+                break;
+
+            case 'd':
+                params.deny_mode = (strcmp(optarg, "defer") == 0) ?
+                                   NRF_802154_WIFI_COEX_DENY_MODE_DEFER :
+                                   NRF_802154_WIFI_COEX_DENY_MODE_ABORT;
+                break;
+
+            case 't':
+                params.duration = (uint64_t)(atof(optarg) * 1000000.0);
+                break;
+
+            case 's':
+                params.seed = strtoull(optarg, NULL, 0);
+                break;
+
+            default:
+                usage_print(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    if ((params.wifi_load < 0.0) || (params.wifi_load > 1.0) || (params.frame_rate <= 0.0))
+    {
+        usage_print(argv[0]);
+        return 1;
+    }
+
+    header_print(&params);
+
+    if (!sweep)
+    {
+        bench_run(&params, &results);
+        results_print(&params, &results);
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(sweep_loads) / sizeof(sweep_loads[0]); i++)
+    {
+        params.wifi_load = sweep_loads[i];
+
+        params.deny_mode = NRF_802154_WIFI_COEX_DENY_MODE_ABORT;
+        bench_run(&params, &results);
+        results_print(&params, &results);
+
+        params.deny_mode = NRF_802154_WIFI_COEX_DENY_MODE_DEFER;
+        bench_run(&params, &results);
+        results_print(&params, &results);
+    }
+
+    return 0;
+}
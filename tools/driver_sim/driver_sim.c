@@ -0,0 +1,330 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements a host simulation of the driver running on the peripheral model.
+ *
+ * The unmodified driver core is linked with the host peripheral model and exercised through its
+ * public API. A scripted peer injects frames on the air and acknowledges the frames transmitted by
+ * the driver. The scenarios check the reception with the automatic ACK, the transmission with
+ * and without the ACK, CCA and energy detection, and print the timing observed on the air.
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_host_model.h"
+
+#define CHANNEL          11     ///< Channel used by the scenarios.
+#define FREQUENCY        2405   ///< Center frequency of @ref CHANNEL, in MHz.
+#define PEER_POWER       (-50)  ///< Power of the frames of the peer at the driver, in dBm.
+#define PEER_LQI         200    ///< Raw LQI of the frames of the peer.
+#define TURNAROUND_TIME  192000 ///< aTurnaroundTime, in nanoseconds.
+#define TURNAROUND_ERROR 1000   ///< Accepted error of the ACK timing, in nanoseconds.
+#define SETTLE_TIME      5000000ULL ///< Time given to the driver to finish an operation, in nanoseconds.
+
+#define FCF_ACK_REQUEST  0x20   ///< Bit of the first byte of the Frame Control field requesting the ACK.
+#define FCF_TYPE_MASK    0x07   ///< Mask of the frame type in the first byte of the Frame Control field.
+#define FCF_TYPE_ACK     0x02   ///< Frame type of the ACK.
+
+/**
+ * @brief Observations of the scripted peer and the driver callbacks.
+ */
+typedef struct
+{
+    uint32_t received;      ///< Number of frames received by the driver.
+    int8_t   rx_power;      ///< Power reported with the last received frame.
+    uint8_t  rx_lqi;        ///< LQI reported with the last received frame.
+    uint32_t transmitted;   ///< Number of transmissions reported as successful.
+    bool     tx_acked;      ///< Indicates if the last transmission received the ACK.
+    uint32_t tx_failed;     ///< Number of transmissions reported as failed.
+    uint32_t tx_error;      ///< Error of the last failed transmission.
+    uint32_t cca_done;      ///< Number of finished CCA procedures.
+    bool     cca_free;      ///< Result of the last CCA procedure.
+    uint32_t ed_done;       ///< Number of finished energy detections.
+    uint8_t  ed_result;     ///< Result of the last energy detection.
+    uint32_t air_frames;    ///< Number of frames transmitted by the driver on the air.
+    uint64_t air_start;     ///< Start time of the last frame transmitted by the driver.
+    uint8_t  air_frame[128]; ///< Last frame transmitted by the driver.
+} sim_log_t;
+
+static sim_log_t m_log;         ///< Observations of the current scenario.
+static bool      m_peer_acks;   ///< Indicates if the peer acknowledges the frames of the driver.
+static uint32_t  m_failures;    ///< Number of failed checks.
+
+static const uint8_t m_pan_id[]        = {0x34, 0x12};
+static const uint8_t m_short_address[] = {0x01, 0x00};
+static const uint8_t m_ext_address[]   = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+
+/** Data frame with the ACK request from the peer 0x0002 to the driver, including the FCS. */
+static const uint8_t m_peer_frame[] =
+{
+    16, 0x61, 0x88, 0x5A, 0x34, 0x12, 0x01, 0x00, 0x02, 0x00, 'h', 'e', 'l', 'l', 'o', 0x00, 0x00
+};
+
+/** Data frame with the ACK request from the driver to the peer 0x0002, including the FCS. */
+static uint8_t m_driver_frame[] =
+{
+    16, 0x61, 0x88, 0xA5, 0x34, 0x12, 0x02, 0x00, 0x01, 0x00, 'w', 'o', 'r', 'l', 'd', 0x00, 0x00
+};
+
+/***************************************************************************************************
+ * @section Driver callouts
+ **************************************************************************************************/
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    m_log.received++;
+    m_log.rx_power = power;
+    m_log.rx_lqi   = lqi;
+
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame, uint8_t * p_ack, int8_t power, uint8_t lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    m_log.transmitted++;
+    m_log.tx_acked = (p_ack != NULL);
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+
+    m_log.tx_failed++;
+    m_log.tx_error = error;
+}
+
+void nrf_802154_cca_done(bool channel_free)
+{
+    m_log.cca_done++;
+    m_log.cca_free = channel_free;
+}
+
+void nrf_802154_energy_detected(uint8_t result)
+{
+    m_log.ed_done++;
+    m_log.ed_result = result;
+}
+
+/***************************************************************************************************
+ * @section Scripted peer
+ **************************************************************************************************/
+
+static void peer_inject(const uint8_t * p_data, int8_t power, uint64_t start_time)
+{
+    nrf_host_radio_frame_t frame =
+    {
+        .p_data     = p_data,
+        .frequency  = FREQUENCY,
+        .power      = power,
+        .lqi        = PEER_LQI,
+        .crc_ok     = true,
+        .start_time = start_time,
+    };
+
+    nrf_host_radio_frame_inject(&frame);
+}
+
+static void air_tx_handler(const nrf_host_radio_frame_t * p_frame, void * p_context)
+{
+    static uint8_t ack[] = {5, FCF_TYPE_ACK, 0x00, 0x00, 0x00, 0x00};
+    uint8_t        length = p_frame->p_data[0];
+
+    (void)p_context;
+
+    m_log.air_frames++;
+    m_log.air_start = p_frame->start_time;
+    memcpy(m_log.air_frame, p_frame->p_data, length + 1);
+
+    if (m_peer_acks &&
+        ((p_frame->p_data[1] & FCF_TYPE_MASK) != FCF_TYPE_ACK) &&
+        (p_frame->p_data[1] & FCF_ACK_REQUEST))
+    {
+        ack[3] = p_frame->p_data[3];
+        peer_inject(ack,
+                    PEER_POWER,
+                    p_frame->start_time + nrf_host_radio_frame_duration_get(length) +
+                    TURNAROUND_TIME);
+    }
+}
+
+/***************************************************************************************************
+ * @section Scenarios
+ **************************************************************************************************/
+
+static void check(bool condition, const char * p_description)
+{
+    printf("  [%s] %s\n", condition ? " ok " : "FAIL", p_description);
+
+    if (!condition)
+    {
+        m_failures++;
+    }
+}
+
+static void scenario_start(const char * p_name)
+{
+    printf("%s\n", p_name);
+    memset(&m_log, 0, sizeof(m_log));
+}
+
+static void scenario_rx_ack(void)
+{
+    uint64_t start = nrf_host_model_time_get() + 100000;
+    uint64_t end   = start + nrf_host_radio_frame_duration_get(m_peer_frame[0]);
+    int64_t  turnaround;
+
+    scenario_start("Reception with the automatic ACK");
+
+    peer_inject(m_peer_frame, PEER_POWER, start);
+    nrf_host_model_run_until(end + SETTLE_TIME);
+
+    turnaround = (int64_t)(m_log.air_start - end);
+
+    check(m_log.received == 1, "frame received");
+    check(m_log.rx_power == PEER_POWER, "RSSI of the frame reported");
+    check(m_log.air_frames == 1, "ACK transmitted");
+    check((m_log.air_frame[0] == 5) && ((m_log.air_frame[1] & FCF_TYPE_MASK) == FCF_TYPE_ACK) &&
+          (m_log.air_frame[3] == m_peer_frame[3]),
+          "ACK matches the sequence number");
+    check((turnaround > TURNAROUND_TIME - TURNAROUND_ERROR) &&
+          (turnaround < TURNAROUND_TIME + TURNAROUND_ERROR),
+          "ACK starts aTurnaroundTime after the frame");
+    printf("  ACK turnaround: %.3f us\n", turnaround / 1000.0);
+}
+
+static void scenario_tx(bool peer_acks)
+{
+    scenario_start(peer_acks ? "Transmission acknowledged by the peer" :
+                   "Transmission not acknowledged by the peer");
+
+    m_peer_acks = peer_acks;
+
+    check(nrf_802154_transmit_raw(m_driver_frame, true), "transmission requested");
+    nrf_host_model_run_for(SETTLE_TIME);
+
+    check(m_log.air_frames == 1, "frame transmitted on the air");
+
+    if (peer_acks)
+    {
+        check((m_log.transmitted == 1) && m_log.tx_acked, "transmission reported with the ACK");
+    }
+    else
+    {
+        check((m_log.tx_failed == 1) && (m_log.tx_error == NRF_802154_TX_ERROR_NO_ACK),
+              "transmission reported as not acknowledged");
+    }
+
+    m_peer_acks = false;
+}
+
+static void scenario_cca(bool busy)
+{
+    uint64_t start = nrf_host_model_time_get();
+
+    scenario_start(busy ? "CCA on a busy channel" : "CCA on a free channel");
+
+    if (busy)
+    {
+        peer_inject(m_peer_frame, PEER_POWER, start);
+    }
+
+    check(nrf_802154_cca(), "CCA requested");
+    nrf_host_model_run_for(SETTLE_TIME);
+
+    check(m_log.cca_done == 1, "CCA finished");
+    check(m_log.cca_free == !busy, busy ? "channel reported busy" : "channel reported free");
+}
+
+static void scenario_ed(void)
+{
+    uint64_t start = nrf_host_model_time_get();
+    int8_t   dbm;
+
+    scenario_start("Energy detection");
+
+    peer_inject(m_peer_frame, PEER_POWER, start);
+
+    check(nrf_802154_energy_detection(128), "energy detection requested");
+    nrf_host_model_run_for(SETTLE_TIME);
+
+    dbm = nrf_802154_dbm_from_energy_level_calculate(m_log.ed_result);
+
+    check(m_log.ed_done == 1, "energy detection finished");
+    check((dbm >= PEER_POWER - 2) && (dbm <= PEER_POWER + 2), "energy of the frame reported");
+    printf("  Energy level: %u (%d dBm)\n", m_log.ed_result, dbm);
+}
+
+int main(void)
+{
+    nrf_host_model_init(1);
+    nrf_host_radio_tx_handler_set(air_tx_handler, NULL);
+
+    nrf_802154_init();
+    nrf_802154_channel_set(CHANNEL);
+    nrf_802154_pan_id_set(m_pan_id);
+    nrf_802154_short_address_set(m_short_address);
+    nrf_802154_extended_address_set(m_ext_address);
+
+    if (!nrf_802154_receive())
+    {
+        printf("Receive request rejected.\n");
+        return EXIT_FAILURE;
+    }
+
+    nrf_host_model_run_for(SETTLE_TIME);
+
+    scenario_rx_ack();
+    scenario_tx(true);
+    scenario_tx(false);
+    scenario_cca(false);
+    scenario_cca(true);
+    scenario_ed();
+
+    printf("%u check(s) failed.\n", m_failures);
+
+    return (m_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
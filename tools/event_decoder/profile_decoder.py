@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+import argparse
+import os
+import re
+import struct
+import sys
+
+from trace_decoder import DRV_SRC_PATH, dump_load
+
+"""
+The script decodes a RAM dump of the `nrf_802154_debug_profile` structure written by the driver
+built with ENABLE_DEBUG_PROFILE. It prints the call count and the average, minimum, maximum and
+last duration of each profiling probe.
+
+The dump must contain the whole `nrf_802154_debug_profile` structure, for example:
+    nrfjprog --memrd <address of nrf_802154_debug_profile> --n <size> > profile.txt
+or, from GDB:
+    dump binary value profile.bin nrf_802154_debug_profile
+
+The names of the probes are taken from the `#define` directives in the debug headers of the driver
+sources.
+"""
+
+PROFILE_MAGIC = 0x464F5250
+HEADER_FMT = '<4I'
+PROBE_FMT = '<Q4I'
+
+DEFINE_RE = re.compile(r'^#define\s+PROFILE_(\w+)\s+(\d+)UL', re.MULTILINE)
+
+
+def names_load(src_path):
+    names = {}
+
+    with open(os.path.join(src_path, 'nrf_802154_debug_core.h')) as file_handler:
+        for name, value in DEFINE_RE.findall(file_handler.read()):
+            if name != 'PROBES_NUM':
+                names[int(value)] = name.lower()
+
+    return names
+
+
+def profile_parse(data):
+    header_size = struct.calcsize(HEADER_FMT)
+    probe_size = struct.calcsize(PROBE_FMT)
+
+    if len(data) < header_size:
+        sys.exit('Dump is too short to contain the profile header.')
+
+    magic, clock, probes_num, overhead = struct.unpack_from(HEADER_FMT, data)
+
+    if magic != PROFILE_MAGIC:
+        sys.exit('Invalid profile magic 0x{:08X}. Is it a dump of nrf_802154_debug_profile?'.format(magic))
+
+    if len(data) < header_size + probes_num * probe_size:
+        sys.exit('Dump is too short to contain {} probes.'.format(probes_num))
+
+    probes = [struct.unpack_from(PROBE_FMT, data, header_size + idx * probe_size)
+              for idx in range(probes_num)]
+
+    return clock, overhead, probes
+
+
+def report_print(clock, overhead, probes, names, raw):
+    unit = 'ticks' if raw else 'us'
+
+    def scale(value):
+        return value if raw else value * 1e6 / clock
+
+    print('Clock: {} Hz, probe overhead: {} ticks{}'.format(
+        clock, overhead, '' if raw else ' ({:.3f} us)'.format(scale(overhead))))
+    print()
+    print('{:<28} {:>8} {:>12} {:>12} {:>12} {:>12}'.format(
+        'probe', 'calls', 'avg[{}]'.format(unit), 'min[{}]'.format(unit),
+        'max[{}]'.format(unit), 'last[{}]'.format(unit)))
+
+    for idx, (total, count, minimum, maximum, last) in enumerate(probes):
+        name = names.get(idx, '#{}'.format(idx))
+
+        if count == 0:
+            print('{:<28} {:>8}'.format(name, 0))
+            continue
+
+        print('{:<28} {:>8} {:>12.3f} {:>12.3f} {:>12.3f} {:>12.3f}'.format(
+            name, count, scale(total / count), scale(minimum), scale(maximum), scale(last)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the nRF 802.15.4 driver profiling statistics.')
+    parser.add_argument('dump', help='binary or nrfjprog text dump of nrf_802154_debug_profile')
+    parser.add_argument('--src', default=DRV_SRC_PATH, help='path to the driver sources')
+    parser.add_argument('--raw', action='store_true', help='print the durations in clock ticks')
+    args = parser.parse_args()
+
+    clock, overhead, probes = profile_parse(dump_load(args.dump))
+
+    if clock == 0 and not args.raw:
+        sys.exit('Profiling clock frequency is not set. Was nrf_802154_debug_init() called?')
+
+    report_print(clock, overhead, probes, names_load(args.src), args.raw)
+
+
+if __name__ == '__main__':
+    main()
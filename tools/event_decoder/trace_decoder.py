@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+
+"""
+The script decodes a RAM dump of the `nrf_802154_debug_trace` buffer written by the driver built
+with ENABLE_DEBUG_TRACE. It prints the timeline of the traced events and the latency statistics of
+the traced functions.
+
+The dump must contain the whole `nrf_802154_debug_trace` structure, for example:
+    nrfjprog --memrd <address of nrf_802154_debug_trace> --n <size> > trace.txt
+or, from GDB:
+    dump binary value trace.bin nrf_802154_debug_trace
+
+The names of the events and functions are taken from the `#define` directives in the debug headers
+of the driver sources.
+"""
+
+TRACE_MAGIC = 0x4352544E
+HEADER_FMT = '<4I'
+ENTRY_FMT = '<2I'
+
+EVENT_TRACE_ENTER = 0x0001
+EVENT_TRACE_EXIT = 0x0002
+
+DEFINE_RE = re.compile(r'^#define\s+((?:EVENT|FUNCTION)_\w+)\s+(0x[0-9A-Fa-f]+)UL', re.MULTILINE)
+NRFJPROG_LINE_RE = re.compile(r'^0x[0-9A-Fa-f]+:\s+((?:[0-9A-Fa-f]{8}\s*)+)')
+
+DRV_SRC_PATH = os.path.normpath(os.path.join(os.path.dirname(os.path.realpath(__file__)), '../../src'))
+
+
+def names_load(src_path):
+    events = {}
+    functions = {}
+
+    for path in glob.glob(os.path.join(src_path, '**', 'nrf_802154_debug*.h'), recursive=True):
+        with open(path) as file_handler:
+            for name, value in DEFINE_RE.findall(file_handler.read()):
+                table = events if name.startswith('EVENT_') else functions
+                table.setdefault(int(value, 16), name)
+
+    return events, functions
+
+
+def dump_load(path):
+    with open(path, 'rb') as file_handler:
+        data = file_handler.read()
+
+    # Text dumps of nrfjprog contain lines of the form "0x20001000: 4352544E 00000400 ...".
+    try:
+        words = []
+
+        for line in data.decode('ascii').splitlines():
+            match = NRFJPROG_LINE_RE.match(line.strip())
+
+            if match:
+                words.extend(int(word, 16) for word in match.group(1).split())
+
+        if words:
+            return struct.pack('<{}I'.format(len(words)), *words)
+    except UnicodeDecodeError:
+        pass
+
+    return data
+
+
+def trace_parse(data):
+    header_size = struct.calcsize(HEADER_FMT)
+    entry_size = struct.calcsize(ENTRY_FMT)
+
+    if len(data) < header_size:
+        sys.exit('Dump is too short to contain the trace header.')
+
+    magic, length, clock, w_idx = struct.unpack_from(HEADER_FMT, data)
+
+    if magic != TRACE_MAGIC:
+        sys.exit('Invalid trace magic 0x{:08X}. Is it a dump of nrf_802154_debug_trace?'.format(magic))
+
+    if len(data) < header_size + length * entry_size:
+        sys.exit('Dump is too short to contain {} trace entries.'.format(length))
+
+    count = min(w_idx, length)
+    entries = []
+
+    # The entries are read from the oldest to the newest one. The cycle counter is unwrapped
+    # assuming that consecutive entries are less than 2^32 cycles apart.
+    time = 0
+    prev_raw = None
+
+    for idx in range(w_idx - count, w_idx):
+        raw, data_word = struct.unpack_from(ENTRY_FMT, data, header_size + (idx % length) * entry_size)
+
+        if prev_raw is not None:
+            time += (raw - prev_raw) & 0xFFFFFFFF
+
+        prev_raw = raw
+        entries.append((time, data_word & 0xFFFF, data_word >> 16))
+
+    return clock, w_idx - count, entries
+
+
+def timeline_print(clock, first_idx, entries, events, functions):
+    depth = 0
+    prev_time = 0
+
+    print('{:>8} {:>12} {:>10}  {}'.format('index', 'time[us]', 'delta[us]', 'event'))
+
+    for offset, (time, event, arg) in enumerate(entries):
+        if event == EVENT_TRACE_EXIT:
+            depth = max(depth - 1, 0)
+
+        if event in (EVENT_TRACE_ENTER, EVENT_TRACE_EXIT):
+            text = '{}{} {}'.format('  ' * depth,
+                                    '>' if event == EVENT_TRACE_ENTER else '<',
+                                    functions.get(arg, '0x{:04X}'.format(arg)))
+        else:
+            text = '{}{} {}'.format('  ' * depth, events.get(event, '0x{:04X}'.format(event)), arg)
+
+        print('{:>8} {:>12.3f} {:>10.3f}  {}'.format(first_idx + offset,
+                                                     time * 1e6 / clock,
+                                                     (time - prev_time) * 1e6 / clock,
+                                                     text))
+
+        if event == EVENT_TRACE_ENTER:
+            depth += 1
+
+        prev_time = time
+
+
+def stats_compute(entries):
+    stack = []
+    stats = {}
+    unmatched = 0
+
+    # The handlers preempting each other are properly nested, so a single stack matches the exits
+    # with their entries.
+    for time, event, arg in entries:
+        if event == EVENT_TRACE_ENTER:
+            stack.append((arg, time))
+        elif event == EVENT_TRACE_EXIT:
+            if not stack or stack[-1][0] != arg:
+                # The trace starts in the middle of the function, or an entry is missing. Drop
+                # the unfinished calls.
+                unmatched += 1
+                stack = [call for call in stack if call[0] != arg]
+                continue
+
+            _, start = stack.pop()
+            duration = time - start
+            count, total, minimum, maximum = stats.get(arg, (0, 0, None, 0))
+            stats[arg] = (count + 1,
+                          total + duration,
+                          duration if minimum is None else min(minimum, duration),
+                          max(maximum, duration))
+
+    return stats, unmatched
+
+
+def stats_print(clock, stats, unmatched, functions):
+    print()
+    print('{:<44} {:>7} {:>10} {:>10} {:>10} {:>12}'.format('function', 'calls', 'avg[us]',
+                                                            'min[us]', 'max[us]', 'total[us]'))
+
+    for arg, (count, total, minimum, maximum) in sorted(stats.items(), key=lambda item: -item[1][1]):
+        print('{:<44} {:>7} {:>10.3f} {:>10.3f} {:>10.3f} {:>12.3f}'.format(
+            functions.get(arg, '0x{:04X}'.format(arg)),
+            count,
+            total * 1e6 / clock / count,
+            minimum * 1e6 / clock,
+            maximum * 1e6 / clock,
+            total * 1e6 / clock))
+
+    if unmatched:
+        print('{} exits without a matching entry were skipped.'.format(unmatched))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the nRF 802.15.4 driver trace buffer.')
+    parser.add_argument('dump', help='binary or nrfjprog text dump of nrf_802154_debug_trace')
+    parser.add_argument('--src', default=DRV_SRC_PATH, help='path to the driver sources')
+    parser.add_argument('--no-timeline', action='store_true', help='print only the statistics')
+    parser.add_argument('--no-stats', action='store_true', help='print only the timeline')
+    args = parser.parse_args()
+
+    events, functions = names_load(args.src)
+    clock, first_idx, entries = trace_parse(dump_load(args.dump))
+
+    if clock == 0:
+        sys.exit('Cycle counter frequency is not set. Was nrf_802154_debug_init() called?')
+
+    if not args.no_timeline:
+        timeline_print(clock, first_idx, entries, events, functions)
+
+    if not args.no_stats:
+        stats, unmatched = stats_compute(entries)
+        stats_print(clock, stats, unmatched, functions)
+
+
+if __name__ == '__main__':
+    main()
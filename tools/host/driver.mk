@@ -0,0 +1,97 @@
+# Copyright (c) 2019, Nordic Semiconductor ASA
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#   1. Redistributions of source code must retain the above copyright notice, this
+#      list of conditions and the following disclaimer.
+#
+#   2. Redistributions in binary form must reproduce the above copyright notice,
+#      this list of conditions and the following disclaimer in the documentation
+#      and/or other materials provided with the distribution.
+#
+#   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+#      contributors may be used to endorse or promote products derived from
+#      this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Sources and flags of the driver built on the host peripheral model. Include this file from the
+# Makefile of a host tool after setting ROOT to the root of the repository.
+
+HOST_DRIVER_SRCS := \
+    $(ROOT)/src/nrf_802154.c \
+    $(ROOT)/src/nrf_802154_core.c \
+    $(ROOT)/src/nrf_802154_core_hooks.c \
+    $(ROOT)/src/nrf_802154_critical_section.c \
+    $(ROOT)/src/nrf_802154_debug.c \
+    $(ROOT)/src/nrf_802154_notification_direct.c \
+    $(ROOT)/src/nrf_802154_pib.c \
+    $(ROOT)/src/nrf_802154_priority_drop_direct.c \
+    $(ROOT)/src/nrf_802154_request_direct.c \
+    $(ROOT)/src/nrf_802154_rssi.c \
+    $(ROOT)/src/nrf_802154_rx_buffer.c \
+    $(ROOT)/src/nrf_802154_setup_time.c \
+    $(ROOT)/src/nrf_802154_state_time.c \
+    $(ROOT)/src/nrf_802154_stats.c \
+    $(ROOT)/src/nrf_802154_energy.c \
+    $(ROOT)/src/nrf_802154_capture.c \
+    $(ROOT)/src/nrf_802154_irq_latency.c \
+    $(ROOT)/src/nrf_802154_timer_coord.c \
+    $(ROOT)/src/fal/nrf_802154_fal.c \
+    $(ROOT)/src/mac_features/ack_generator/nrf_802154_ack_data.c \
+    $(ROOT)/src/mac_features/ack_generator/nrf_802154_ack_generator.c \
+    $(ROOT)/src/mac_features/ack_generator/nrf_802154_enh_ack_generator.c \
+    $(ROOT)/src/mac_features/ack_generator/nrf_802154_imm_ack_generator.c \
+    $(ROOT)/src/mac_features/nrf_802154_csl.c \
+    $(ROOT)/src/mac_features/nrf_802154_csma_ca.c \
+    $(ROOT)/src/mac_features/nrf_802154_delayed_trx.c \
+    $(ROOT)/src/mac_features/nrf_802154_filter.c \
+    $(ROOT)/src/mac_features/nrf_802154_frame_parser.c \
+    $(ROOT)/src/mac_features/nrf_802154_precise_ack_timeout.c \
+    $(ROOT)/src/mac_features/nrf_802154_rx_duty_cycle.c \
+    $(ROOT)/src/platform/clock/nrf_802154_clock_nodrv.c \
+    $(ROOT)/src/platform/hp_timer/nrf_802154_hp_timer.c \
+    $(ROOT)/src/platform/lp_timer/nrf_802154_lp_timer_nodrv.c \
+    $(ROOT)/src/platform/random/nrf_802154_random_stdlib.c \
+    $(ROOT)/src/platform/temperature/nrf_802154_temperature_none.c \
+    $(ROOT)/src/rsch/nrf_802154_rsch.c \
+    $(ROOT)/src/rsch/nrf_802154_rsch_crit_sect.c \
+    $(ROOT)/src/rsch/nrf_802154_wifi_coex.c \
+    $(ROOT)/src/rsch/raal/single_phy/single_phy.c \
+    $(ROOT)/src/timer_scheduler/nrf_802154_timer_sched.c
+
+HOST_MODEL_SRCS := \
+    $(ROOT)/tools/host/model/nrf_host_sim.c \
+    $(ROOT)/tools/host/model/nrf_host_clock.c \
+    $(ROOT)/tools/host/model/nrf_host_egu.c \
+    $(ROOT)/tools/host/model/nrf_host_ppi.c \
+    $(ROOT)/tools/host/model/nrf_host_radio.c \
+    $(ROOT)/tools/host/model/nrf_host_rtc.c \
+    $(ROOT)/tools/host/model/nrf_host_timer.c
+
+HOST_DRIVER_CFLAGS := \
+    -DNRF_HOST_MODEL=1 \
+    -I$(ROOT)/tools/host/include \
+    -I$(ROOT)/tools/host/model \
+    -I$(ROOT)/src \
+    -I$(ROOT)/src/fem/none \
+    -I$(ROOT)/src/rsch \
+    -I$(ROOT)/src/rsch/raal
+
+# The driver keeps pointers in 32-bit words, for example in the lock-free lists of the Timer
+# Scheduler. A non-PIE executable places the static data of the driver below 4 GB, where these
+# pointers fit.
+HOST_DRIVER_CFLAGS += -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+HOST_DRIVER_LDFLAGS := -no-pie
+HOST_DRIVER_LDLIBS  := -lm
@@ -0,0 +1,286 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file provides the subset of the device header used by the driver modules built natively
+ *   on a host (e.g. Linux) for simulations and benchmarks.
+ *
+ * Exclusive access instructions are emulated for a single-threaded host program, in which
+ * a context is never preempted between the load and the store.
+ *
+ * If NRF_HOST_MODEL is set, the core peripherals and the interrupt masking are backed by the
+ * peripheral model in tools/host/model, which preempts the running context with the interrupt
+ * handlers at the peripheral accesses.
+ *
+ */
+
+#ifndef NRF_H__
+#define NRF_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __STATIC_INLINE static inline
+#define __WEAK          __attribute__((weak))
+#define __ASM           __asm__
+
+#define __NVIC_PRIO_BITS 3
+
+/** @brief Interrupt numbers of the peripherals used by the driver. */
+typedef enum
+{
+    POWER_CLOCK_IRQn = 0,
+    RADIO_IRQn       = 1,
+    TIMER0_IRQn      = 8,
+    TIMER1_IRQn      = 9,
+    TIMER2_IRQn      = 10,
+    RTC0_IRQn        = 11,
+    RNG_IRQn         = 13,
+    RTC1_IRQn        = 17,
+    SWI0_EGU0_IRQn   = 20,
+    SWI1_EGU1_IRQn   = 21,
+    SWI2_EGU2_IRQn   = 22,
+    SWI3_EGU3_IRQn   = 23,
+    SWI4_EGU4_IRQn   = 24,
+    SWI5_EGU5_IRQn   = 25,
+    RTC2_IRQn        = 36,
+} IRQn_Type;
+
+#define NRF_CLOCK_BASE  0x40000000UL
+#define NRF_RADIO_BASE  0x40001000UL
+#define NRF_TIMER0_BASE 0x40008000UL
+#define NRF_TIMER1_BASE 0x40009000UL
+#define NRF_TIMER2_BASE 0x4000A000UL
+#define NRF_RTC0_BASE   0x4000B000UL
+#define NRF_RNG_BASE    0x4000D000UL
+#define NRF_RTC1_BASE   0x40011000UL
+#define NRF_EGU0_BASE   0x40014000UL
+#define NRF_EGU1_BASE   0x40015000UL
+#define NRF_EGU2_BASE   0x40016000UL
+#define NRF_EGU3_BASE   0x40017000UL
+#define NRF_EGU4_BASE   0x40018000UL
+#define NRF_EGU5_BASE   0x40019000UL
+#define NRF_PPI_BASE    0x4001F000UL
+#define NRF_RTC2_BASE   0x40024000UL
+
+static inline void __DMB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __DSB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __ISB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#if NRF_HOST_MODEL
+
+// The exclusive monitor is cleared when an interrupt handler preempts the context, as on the device.
+void     __CLREX(void);
+uint8_t  __LDREXB(volatile uint8_t * p_addr);
+uint32_t __STREXB(uint8_t value, volatile uint8_t * p_addr);
+uint32_t __LDREXW(volatile uint32_t * p_addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t * p_addr);
+
+#else // NRF_HOST_MODEL
+
+static inline void __CLREX(void)
+{
+    // Intentionally empty
+}
+
+static inline uint8_t __LDREXB(volatile uint8_t * p_addr)
+{
+    return *p_addr;
+}
+
+static inline uint32_t __STREXB(uint8_t value, volatile uint8_t * p_addr)
+{
+    *p_addr = value;
+    return 0;
+}
+
+static inline uint32_t __LDREXW(volatile uint32_t * p_addr)
+{
+    return *p_addr;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t * p_addr)
+{
+    *p_addr = value;
+    return 0;
+}
+
+#endif // NRF_HOST_MODEL
+
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return (value == 0) ? 32 : (uint32_t)__builtin_clz(value);
+}
+
+#if NRF_HOST_MODEL
+
+/** @brief Nested Vectored Interrupt Controller registers. */
+typedef struct
+{
+    volatile uint32_t ISER[8]; ///< Interrupt Set Enable registers.
+    volatile uint32_t ISPR[8]; ///< Interrupt Set Pending registers.
+    volatile uint8_t  IP[240]; ///< Interrupt Priority registers.
+} NVIC_Type;
+
+/** @brief System Control Block registers. */
+typedef struct
+{
+    volatile uint32_t ICSR; ///< Interrupt Control and State register.
+} SCB_Type;
+
+/** @brief Data Watchpoint and Trace registers. */
+typedef struct
+{
+    volatile uint32_t CTRL;   ///< Control register.
+    volatile uint32_t CYCCNT; ///< Cycle count register.
+} DWT_Type;
+
+/** @brief Core Debug registers. */
+typedef struct
+{
+    volatile uint32_t DEMCR; ///< Debug Exception and Monitor Control register.
+} CoreDebug_Type;
+
+/** @brief Random Number Generator registers. */
+typedef struct
+{
+    volatile uint32_t TASKS_START;   ///< Task starting the generator.
+    volatile uint32_t EVENTS_VALRDY; ///< Event generated when a new value is ready.
+    volatile uint32_t VALUE;         ///< Generated random value.
+} NRF_RNG_Type;
+
+typedef struct nrf_host_timer_s NRF_TIMER_Type;
+typedef struct nrf_host_rtc_s   NRF_RTC_Type;
+typedef struct nrf_host_egu_s   NRF_EGU_Type;
+
+extern NVIC_Type      nrf_host_nvic;
+extern SCB_Type       nrf_host_scb;
+extern CoreDebug_Type nrf_host_core_debug;
+extern NRF_RNG_Type   nrf_host_rng;
+extern NRF_TIMER_Type nrf_host_timer0;
+extern NRF_TIMER_Type nrf_host_timer1;
+extern NRF_TIMER_Type nrf_host_timer2;
+extern NRF_RTC_Type   nrf_host_rtc0;
+extern NRF_RTC_Type   nrf_host_rtc1;
+extern NRF_RTC_Type   nrf_host_rtc2;
+extern NRF_EGU_Type   nrf_host_egu0;
+extern NRF_EGU_Type   nrf_host_egu1;
+extern NRF_EGU_Type   nrf_host_egu2;
+extern NRF_EGU_Type   nrf_host_egu3;
+extern NRF_EGU_Type   nrf_host_egu4;
+extern NRF_EGU_Type   nrf_host_egu5;
+extern uint32_t       SystemCoreClock;
+
+/** @brief Updates the cycle counter to the current time of the model and returns the DWT registers. */
+DWT_Type * nrf_host_dwt_get(void);
+
+#define NVIC       (&nrf_host_nvic)
+#define SCB        (&nrf_host_scb)
+#define DWT        (nrf_host_dwt_get())
+#define CoreDebug  (&nrf_host_core_debug)
+#define NRF_RNG    (&nrf_host_rng)
+#define NRF_TIMER0 (&nrf_host_timer0)
+#define NRF_TIMER1 (&nrf_host_timer1)
+#define NRF_TIMER2 (&nrf_host_timer2)
+#define NRF_RTC0   (&nrf_host_rtc0)
+#define NRF_RTC1   (&nrf_host_rtc1)
+#define NRF_RTC2   (&nrf_host_rtc2)
+#define NRF_EGU0   (&nrf_host_egu0)
+#define NRF_EGU1   (&nrf_host_egu1)
+#define NRF_EGU2   (&nrf_host_egu2)
+#define NRF_EGU3   (&nrf_host_egu3)
+#define NRF_EGU4   (&nrf_host_egu4)
+#define NRF_EGU5   (&nrf_host_egu5)
+
+#define SCB_ICSR_VECTACTIVE_Pos    0U
+#define SCB_ICSR_VECTACTIVE_Msk    (0x1FFUL << SCB_ICSR_VECTACTIVE_Pos)
+#define DWT_CTRL_CYCCNTENA_Msk     (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+
+void     NVIC_EnableIRQ(IRQn_Type IRQn);
+void     NVIC_DisableIRQ(IRQn_Type IRQn);
+uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn);
+void     NVIC_SetPendingIRQ(IRQn_Type IRQn);
+void     NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+void     NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+uint32_t NVIC_GetPriority(IRQn_Type IRQn);
+
+void     __disable_irq(void);
+void     __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t primask);
+
+#else // NRF_HOST_MODEL
+
+// There are no interrupts on the host, so the modules masking interrupts must be used by a single
+// producer thread.
+static inline void __disable_irq(void)
+{
+    // Intentionally empty
+}
+
+static inline void __enable_irq(void)
+{
+    // Intentionally empty
+}
+
+static inline uint32_t __get_PRIMASK(void)
+{
+    return 0;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+    (void)primask;
+}
+
+#endif // NRF_HOST_MODEL
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_H__
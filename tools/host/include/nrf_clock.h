@@ -0,0 +1,108 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file provides the subset of the CLOCK HAL used by the driver built natively on a host
+ *   (e.g. Linux) for simulations and benchmarks.
+ *
+ * The functions are implemented by the CLOCK model in tools/host/model.
+ *
+ */
+
+#ifndef NRF_CLOCK_H__
+#define NRF_CLOCK_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Low-frequency clock sources. */
+typedef enum
+{
+    NRF_CLOCK_LFCLK_RC    = 0, ///< Internal 32 kHz RC oscillator.
+    NRF_CLOCK_LFCLK_Xtal  = 1, ///< External 32 kHz crystal.
+    NRF_CLOCK_LFCLK_Synth = 2, ///< Internal 32 kHz synthesizer from HFCLK system clock.
+} nrf_clock_lfclk_t;
+
+/** @brief High-frequency clock sources. */
+typedef enum
+{
+    NRF_CLOCK_HFCLK_LOW_ACCURACY  = 0, ///< Internal 16 MHz RC oscillator.
+    NRF_CLOCK_HFCLK_HIGH_ACCURACY = 1, ///< External 16 MHz/32 MHz crystal oscillator.
+} nrf_clock_hfclk_t;
+
+/** @brief CLOCK tasks. */
+typedef enum
+{
+    NRF_CLOCK_TASK_HFCLKSTART = 0x000, ///< Start HFCLK clock source.
+    NRF_CLOCK_TASK_HFCLKSTOP  = 0x004, ///< Stop HFCLK clock source.
+    NRF_CLOCK_TASK_LFCLKSTART = 0x008, ///< Start LFCLK clock source.
+    NRF_CLOCK_TASK_LFCLKSTOP  = 0x00C, ///< Stop LFCLK clock source.
+} nrf_clock_task_t;
+
+/** @brief CLOCK events. */
+typedef enum
+{
+    NRF_CLOCK_EVENT_HFCLKSTARTED = 0x100, ///< HFCLK oscillator started.
+    NRF_CLOCK_EVENT_LFCLKSTARTED = 0x104, ///< LFCLK oscillator started.
+} nrf_clock_event_t;
+
+/** @brief CLOCK interrupts. */
+typedef enum
+{
+    NRF_CLOCK_INT_HF_STARTED_MASK = (1UL << 0), ///< Interrupt on HFCLKSTARTED event.
+    NRF_CLOCK_INT_LF_STARTED_MASK = (1UL << 1), ///< Interrupt on LFCLKSTARTED event.
+} nrf_clock_int_mask_t;
+
+void nrf_clock_int_enable(uint32_t int_mask);
+
+void nrf_clock_int_disable(uint32_t int_mask);
+
+void nrf_clock_task_trigger(nrf_clock_task_t task);
+
+void nrf_clock_event_clear(nrf_clock_event_t event);
+
+bool nrf_clock_event_check(nrf_clock_event_t event);
+
+void nrf_clock_lf_src_set(nrf_clock_lfclk_t source);
+
+bool nrf_clock_lf_is_running(void);
+
+bool nrf_clock_hf_is_running(nrf_clock_hfclk_t clk_src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_CLOCK_H__
@@ -0,0 +1,112 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file provides the subset of the EGU HAL used by the driver built natively on a host
+ *   (e.g. Linux) for simulations and benchmarks.
+ *
+ * The functions are implemented by the EGU model in tools/host/model.
+ *
+ */
+
+#ifndef NRF_EGU_H__
+#define NRF_EGU_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nrf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief EGU tasks. */
+typedef enum
+{
+    NRF_EGU_TASK_TRIGGER0  = 0x000, ///< Trigger 0 for triggering the corresponding TRIGGERED[0] event.
+    NRF_EGU_TASK_TRIGGER1  = 0x004, ///< Trigger 1 for triggering the corresponding TRIGGERED[1] event.
+    NRF_EGU_TASK_TRIGGER2  = 0x008, ///< Trigger 2 for triggering the corresponding TRIGGERED[2] event.
+    NRF_EGU_TASK_TRIGGER3  = 0x00C, ///< Trigger 3 for triggering the corresponding TRIGGERED[3] event.
+    NRF_EGU_TASK_TRIGGER4  = 0x010, ///< Trigger 4 for triggering the corresponding TRIGGERED[4] event.
+    NRF_EGU_TASK_TRIGGER5  = 0x014, ///< Trigger 5 for triggering the corresponding TRIGGERED[5] event.
+    NRF_EGU_TASK_TRIGGER6  = 0x018, ///< Trigger 6 for triggering the corresponding TRIGGERED[6] event.
+    NRF_EGU_TASK_TRIGGER7  = 0x01C, ///< Trigger 7 for triggering the corresponding TRIGGERED[7] event.
+    NRF_EGU_TASK_TRIGGER8  = 0x020, ///< Trigger 8 for triggering the corresponding TRIGGERED[8] event.
+    NRF_EGU_TASK_TRIGGER9  = 0x024, ///< Trigger 9 for triggering the corresponding TRIGGERED[9] event.
+    NRF_EGU_TASK_TRIGGER10 = 0x028, ///< Trigger 10 for triggering the corresponding TRIGGERED[10] event.
+    NRF_EGU_TASK_TRIGGER11 = 0x02C, ///< Trigger 11 for triggering the corresponding TRIGGERED[11] event.
+    NRF_EGU_TASK_TRIGGER12 = 0x030, ///< Trigger 12 for triggering the corresponding TRIGGERED[12] event.
+    NRF_EGU_TASK_TRIGGER13 = 0x034, ///< Trigger 13 for triggering the corresponding TRIGGERED[13] event.
+    NRF_EGU_TASK_TRIGGER14 = 0x038, ///< Trigger 14 for triggering the corresponding TRIGGERED[14] event.
+    NRF_EGU_TASK_TRIGGER15 = 0x03C, ///< Trigger 15 for triggering the corresponding TRIGGERED[15] event.
+} nrf_egu_task_t;
+
+/** @brief EGU events. */
+typedef enum
+{
+    NRF_EGU_EVENT_TRIGGERED0  = 0x100, ///< Event number 0 generated by triggering the corresponding TRIGGER[0] task.
+    NRF_EGU_EVENT_TRIGGERED1  = 0x104, ///< Event number 1 generated by triggering the corresponding TRIGGER[1] task.
+    NRF_EGU_EVENT_TRIGGERED2  = 0x108, ///< Event number 2 generated by triggering the corresponding TRIGGER[2] task.
+    NRF_EGU_EVENT_TRIGGERED3  = 0x10C, ///< Event number 3 generated by triggering the corresponding TRIGGER[3] task.
+    NRF_EGU_EVENT_TRIGGERED4  = 0x110, ///< Event number 4 generated by triggering the corresponding TRIGGER[4] task.
+    NRF_EGU_EVENT_TRIGGERED5  = 0x114, ///< Event number 5 generated by triggering the corresponding TRIGGER[5] task.
+    NRF_EGU_EVENT_TRIGGERED6  = 0x118, ///< Event number 6 generated by triggering the corresponding TRIGGER[6] task.
+    NRF_EGU_EVENT_TRIGGERED7  = 0x11C, ///< Event number 7 generated by triggering the corresponding TRIGGER[7] task.
+    NRF_EGU_EVENT_TRIGGERED8  = 0x120, ///< Event number 8 generated by triggering the corresponding TRIGGER[8] task.
+    NRF_EGU_EVENT_TRIGGERED9  = 0x124, ///< Event number 9 generated by triggering the corresponding TRIGGER[9] task.
+    NRF_EGU_EVENT_TRIGGERED10 = 0x128, ///< Event number 10 generated by triggering the corresponding TRIGGER[10] task.
+    NRF_EGU_EVENT_TRIGGERED11 = 0x12C, ///< Event number 11 generated by triggering the corresponding TRIGGER[11] task.
+    NRF_EGU_EVENT_TRIGGERED12 = 0x130, ///< Event number 12 generated by triggering the corresponding TRIGGER[12] task.
+    NRF_EGU_EVENT_TRIGGERED13 = 0x134, ///< Event number 13 generated by triggering the corresponding TRIGGER[13] task.
+    NRF_EGU_EVENT_TRIGGERED14 = 0x138, ///< Event number 14 generated by triggering the corresponding TRIGGER[14] task.
+    NRF_EGU_EVENT_TRIGGERED15 = 0x13C, ///< Event number 15 generated by triggering the corresponding TRIGGER[15] task.
+} nrf_egu_event_t;
+
+void nrf_egu_task_trigger(NRF_EGU_Type * p_reg, nrf_egu_task_t egu_task);
+
+uint32_t nrf_egu_task_address_get(NRF_EGU_Type * p_reg, nrf_egu_task_t egu_task);
+
+bool nrf_egu_event_check(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event);
+
+void nrf_egu_event_clear(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event);
+
+uint32_t nrf_egu_event_address_get(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event);
+
+void nrf_egu_int_enable(NRF_EGU_Type * p_reg, uint32_t egu_int_mask);
+
+void nrf_egu_int_disable(NRF_EGU_Type * p_reg, uint32_t egu_int_mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_EGU_H__
@@ -0,0 +1,146 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file provides the subset of the PPI HAL used by the driver built natively on a host
+ *   (e.g. Linux) for simulations and benchmarks.
+ *
+ * The functions are implemented by the PPI model in tools/host/model. The types are also used by
+ * the driver API headers built without the model.
+ *
+ */
+
+#ifndef NRF_PPI_H__
+#define NRF_PPI_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief PPI channels. */
+typedef enum
+{
+    NRF_PPI_CHANNEL0  = 0,  ///< Channel 0.
+    NRF_PPI_CHANNEL1  = 1,  ///< Channel 1.
+    NRF_PPI_CHANNEL2  = 2,  ///< Channel 2.
+    NRF_PPI_CHANNEL3  = 3,  ///< Channel 3.
+    NRF_PPI_CHANNEL4  = 4,  ///< Channel 4.
+    NRF_PPI_CHANNEL5  = 5,  ///< Channel 5.
+    NRF_PPI_CHANNEL6  = 6,  ///< Channel 6.
+    NRF_PPI_CHANNEL7  = 7,  ///< Channel 7.
+    NRF_PPI_CHANNEL8  = 8,  ///< Channel 8.
+    NRF_PPI_CHANNEL9  = 9,  ///< Channel 9.
+    NRF_PPI_CHANNEL10 = 10, ///< Channel 10.
+    NRF_PPI_CHANNEL11 = 11, ///< Channel 11.
+    NRF_PPI_CHANNEL12 = 12, ///< Channel 12.
+    NRF_PPI_CHANNEL13 = 13, ///< Channel 13.
+    NRF_PPI_CHANNEL14 = 14, ///< Channel 14.
+    NRF_PPI_CHANNEL15 = 15, ///< Channel 15.
+    NRF_PPI_CHANNEL16 = 16, ///< Channel 16.
+    NRF_PPI_CHANNEL17 = 17, ///< Channel 17.
+    NRF_PPI_CHANNEL18 = 18, ///< Channel 18.
+    NRF_PPI_CHANNEL19 = 19, ///< Channel 19.
+    NRF_PPI_CHANNEL20 = 20, ///< Channel 20.
+    NRF_PPI_CHANNEL21 = 21, ///< Channel 21.
+    NRF_PPI_CHANNEL22 = 22, ///< Channel 22.
+    NRF_PPI_CHANNEL23 = 23, ///< Channel 23.
+    NRF_PPI_CHANNEL24 = 24, ///< Channel 24.
+    NRF_PPI_CHANNEL25 = 25, ///< Channel 25.
+    NRF_PPI_CHANNEL26 = 26, ///< Channel 26.
+    NRF_PPI_CHANNEL27 = 27, ///< Channel 27.
+    NRF_PPI_CHANNEL28 = 28, ///< Channel 28.
+    NRF_PPI_CHANNEL29 = 29, ///< Channel 29.
+    NRF_PPI_CHANNEL30 = 30, ///< Channel 30.
+    NRF_PPI_CHANNEL31 = 31, ///< Channel 31.
+} nrf_ppi_channel_t;
+
+/** @brief PPI channel groups. */
+typedef enum
+{
+    NRF_PPI_CHANNEL_GROUP0 = 0, ///< Channel group 0.
+    NRF_PPI_CHANNEL_GROUP1 = 1, ///< Channel group 1.
+    NRF_PPI_CHANNEL_GROUP2 = 2, ///< Channel group 2.
+    NRF_PPI_CHANNEL_GROUP3 = 3, ///< Channel group 3.
+    NRF_PPI_CHANNEL_GROUP4 = 4, ///< Channel group 4.
+    NRF_PPI_CHANNEL_GROUP5 = 5, ///< Channel group 5.
+} nrf_ppi_channel_group_t;
+
+/** @brief PPI tasks. */
+typedef enum
+{
+    NRF_PPI_TASK_CHG0_EN  = 0x000, ///< Task for enabling channel group 0.
+    NRF_PPI_TASK_CHG0_DIS = 0x004, ///< Task for disabling channel group 0.
+    NRF_PPI_TASK_CHG1_EN  = 0x008, ///< Task for enabling channel group 1.
+    NRF_PPI_TASK_CHG1_DIS = 0x00C, ///< Task for disabling channel group 1.
+    NRF_PPI_TASK_CHG2_EN  = 0x010, ///< Task for enabling channel group 2.
+    NRF_PPI_TASK_CHG2_DIS = 0x014, ///< Task for disabling channel group 2.
+    NRF_PPI_TASK_CHG3_EN  = 0x018, ///< Task for enabling channel group 3.
+    NRF_PPI_TASK_CHG3_DIS = 0x01C, ///< Task for disabling channel group 3.
+    NRF_PPI_TASK_CHG4_EN  = 0x020, ///< Task for enabling channel group 4.
+    NRF_PPI_TASK_CHG4_DIS = 0x024, ///< Task for disabling channel group 4.
+    NRF_PPI_TASK_CHG5_EN  = 0x028, ///< Task for enabling channel group 5.
+    NRF_PPI_TASK_CHG5_DIS = 0x02C, ///< Task for disabling channel group 5.
+} nrf_ppi_task_t;
+
+void nrf_ppi_channel_enable(nrf_ppi_channel_t channel);
+
+void nrf_ppi_channel_disable(nrf_ppi_channel_t channel);
+
+void nrf_ppi_channel_endpoint_setup(nrf_ppi_channel_t channel, uint32_t eep, uint32_t tep);
+
+void nrf_ppi_fork_endpoint_setup(nrf_ppi_channel_t channel, uint32_t fork_tep);
+
+void nrf_ppi_channel_and_fork_endpoint_setup(nrf_ppi_channel_t channel,
+                                             uint32_t          eep,
+                                             uint32_t          tep,
+                                             uint32_t          fork_tep);
+
+void nrf_ppi_channel_include_in_group(nrf_ppi_channel_t       channel,
+                                      nrf_ppi_channel_group_t channel_group);
+
+void nrf_ppi_channel_remove_from_group(nrf_ppi_channel_t       channel,
+                                       nrf_ppi_channel_group_t channel_group);
+
+void nrf_ppi_group_enable(nrf_ppi_channel_group_t group);
+
+void nrf_ppi_group_disable(nrf_ppi_channel_group_t group);
+
+uint32_t nrf_ppi_task_address_get(nrf_ppi_task_t ppi_task);
+
+uint32_t nrf_ppi_task_group_disable_address_get(nrf_ppi_channel_group_t group);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_PPI_H__
@@ -0,0 +1,288 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file provides the subset of the RADIO HAL used by the driver built natively on a host
+ *   (e.g. Linux) for simulations and benchmarks.
+ *
+ * The functions are implemented by the RADIO model in tools/host/model. The types are also used
+ * by the driver API headers built without the model.
+ *
+ */
+
+#ifndef NRF_RADIO_H__
+#define NRF_RADIO_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief RADIO tasks. */
+typedef enum
+{
+    NRF_RADIO_TASK_TXEN      = 0x000, ///< Enable RADIO in TX mode.
+    NRF_RADIO_TASK_RXEN      = 0x004, ///< Enable RADIO in RX mode.
+    NRF_RADIO_TASK_START     = 0x008, ///< Start RADIO.
+    NRF_RADIO_TASK_STOP      = 0x00C, ///< Stop RADIO.
+    NRF_RADIO_TASK_DISABLE   = 0x010, ///< Disable RADIO.
+    NRF_RADIO_TASK_RSSISTART = 0x014, ///< Start the RSSI and take one single sample of received signal strength.
+    NRF_RADIO_TASK_RSSISTOP  = 0x018, ///< Stop the RSSI measurement.
+    NRF_RADIO_TASK_BCSTART   = 0x01C, ///< Start the bit counter.
+    NRF_RADIO_TASK_BCSTOP    = 0x020, ///< Stop the bit counter.
+    NRF_RADIO_TASK_EDSTART   = 0x024, ///< Start the Energy Detect measurement.
+    NRF_RADIO_TASK_EDSTOP    = 0x028, ///< Stop the Energy Detect measurement.
+    NRF_RADIO_TASK_CCASTART  = 0x02C, ///< Start the Clear Channel Assessment.
+    NRF_RADIO_TASK_CCASTOP   = 0x030, ///< Stop the Clear Channel Assessment.
+} nrf_radio_task_t;
+
+/** @brief RADIO events. */
+typedef enum
+{
+    NRF_RADIO_EVENT_READY      = 0x100, ///< Radio has ramped up and is ready to be started.
+    NRF_RADIO_EVENT_ADDRESS    = 0x104, ///< Address sent or received.
+    NRF_RADIO_EVENT_PAYLOAD    = 0x108, ///< Packet payload sent or received.
+    NRF_RADIO_EVENT_END        = 0x10C, ///< Packet transmitted or received.
+    NRF_RADIO_EVENT_DISABLED   = 0x110, ///< RADIO has been disabled.
+    NRF_RADIO_EVENT_RSSIEND    = 0x11C, ///< Sampling of the receive signal strength complete.
+    NRF_RADIO_EVENT_BCMATCH    = 0x128, ///< Bit counter reached bit count value.
+    NRF_RADIO_EVENT_CRCOK      = 0x130, ///< Packet received with correct CRC.
+    NRF_RADIO_EVENT_CRCERROR   = 0x134, ///< Packet received with incorrect CRC.
+    NRF_RADIO_EVENT_FRAMESTART = 0x138, ///< IEEE 802.15.4 length field received.
+    NRF_RADIO_EVENT_EDEND      = 0x13C, ///< Energy Detection procedure ended.
+    NRF_RADIO_EVENT_EDSTOPPED  = 0x140, ///< The sampling of Energy Detection has stopped.
+    NRF_RADIO_EVENT_CCAIDLE    = 0x144, ///< Wireless medium in idle.
+    NRF_RADIO_EVENT_CCABUSY    = 0x148, ///< Wireless medium busy.
+    NRF_RADIO_EVENT_CCASTOPPED = 0x14C, ///< The CCA has stopped.
+    NRF_RADIO_EVENT_TXREADY    = 0x154, ///< RADIO has ramped up and is ready to be started in TX mode.
+    NRF_RADIO_EVENT_RXREADY    = 0x158, ///< RADIO has ramped up and is ready to be started in RX mode.
+    NRF_RADIO_EVENT_MHRMATCH   = 0x15C, ///< MAC Header match found.
+    NRF_RADIO_EVENT_PHYEND     = 0x16C, ///< Last bit sent or received.
+} nrf_radio_event_t;
+
+/** @brief RADIO interrupts. */
+typedef enum
+{
+    NRF_RADIO_INT_READY_MASK      = (1UL << 0),  ///< Interrupt on READY event.
+    NRF_RADIO_INT_ADDRESS_MASK    = (1UL << 1),  ///< Interrupt on ADDRESS event.
+    NRF_RADIO_INT_PAYLOAD_MASK    = (1UL << 2),  ///< Interrupt on PAYLOAD event.
+    NRF_RADIO_INT_END_MASK        = (1UL << 3),  ///< Interrupt on END event.
+    NRF_RADIO_INT_DISABLED_MASK   = (1UL << 4),  ///< Interrupt on DISABLED event.
+    NRF_RADIO_INT_RSSIEND_MASK    = (1UL << 7),  ///< Interrupt on RSSIEND event.
+    NRF_RADIO_INT_BCMATCH_MASK    = (1UL << 10), ///< Interrupt on BCMATCH event.
+    NRF_RADIO_INT_CRCOK_MASK      = (1UL << 12), ///< Interrupt on CRCOK event.
+    NRF_RADIO_INT_CRCERROR_MASK   = (1UL << 13), ///< Interrupt on CRCERROR event.
+    NRF_RADIO_INT_FRAMESTART_MASK = (1UL << 14), ///< Interrupt on FRAMESTART event.
+    NRF_RADIO_INT_EDEND_MASK      = (1UL << 15), ///< Interrupt on EDEND event.
+    NRF_RADIO_INT_EDSTOPPED_MASK  = (1UL << 16), ///< Interrupt on EDSTOPPED event.
+    NRF_RADIO_INT_CCAIDLE_MASK    = (1UL << 17), ///< Interrupt on CCAIDLE event.
+    NRF_RADIO_INT_CCABUSY_MASK    = (1UL << 18), ///< Interrupt on CCABUSY event.
+    NRF_RADIO_INT_CCASTOPPED_MASK = (1UL << 19), ///< Interrupt on CCASTOPPED event.
+    NRF_RADIO_INT_TXREADY_MASK    = (1UL << 21), ///< Interrupt on TXREADY event.
+    NRF_RADIO_INT_RXREADY_MASK    = (1UL << 22), ///< Interrupt on RXREADY event.
+    NRF_RADIO_INT_MHRMATCH_MASK   = (1UL << 23), ///< Interrupt on MHRMATCH event.
+    NRF_RADIO_INT_PHYEND_MASK     = (1UL << 27), ///< Interrupt on PHYEND event.
+} nrf_radio_int_mask_t;
+
+/** @brief RADIO shortcuts. */
+typedef enum
+{
+    NRF_RADIO_SHORT_READY_START_MASK        = (1UL << 0),  ///< Shortcut between READY event and START task.
+    NRF_RADIO_SHORT_END_DISABLE_MASK        = (1UL << 1),  ///< Shortcut between END event and DISABLE task.
+    NRF_RADIO_SHORT_DISABLED_TXEN_MASK      = (1UL << 2),  ///< Shortcut between DISABLED event and TXEN task.
+    NRF_RADIO_SHORT_DISABLED_RXEN_MASK      = (1UL << 3),  ///< Shortcut between DISABLED event and RXEN task.
+    NRF_RADIO_SHORT_ADDRESS_RSSISTART_MASK  = (1UL << 4),  ///< Shortcut between ADDRESS event and RSSISTART task.
+    NRF_RADIO_SHORT_END_START_MASK          = (1UL << 5),  ///< Shortcut between END event and START task.
+    NRF_RADIO_SHORT_ADDRESS_BCSTART_MASK    = (1UL << 6),  ///< Shortcut between ADDRESS event and BCSTART task.
+    NRF_RADIO_SHORT_DISABLED_RSSISTOP_MASK  = (1UL << 8),  ///< Shortcut between DISABLED event and RSSISTOP task.
+    NRF_RADIO_SHORT_RXREADY_CCASTART_MASK   = (1UL << 11), ///< Shortcut between RXREADY event and CCASTART task.
+    NRF_RADIO_SHORT_CCAIDLE_TXEN_MASK       = (1UL << 12), ///< Shortcut between CCAIDLE event and TXEN task.
+    NRF_RADIO_SHORT_CCABUSY_DISABLE_MASK    = (1UL << 13), ///< Shortcut between CCABUSY event and DISABLE task.
+    NRF_RADIO_SHORT_FRAMESTART_BCSTART_MASK = (1UL << 14), ///< Shortcut between FRAMESTART event and BCSTART task.
+    NRF_RADIO_SHORT_READY_EDSTART_MASK      = (1UL << 15), ///< Shortcut between READY event and EDSTART task.
+    NRF_RADIO_SHORT_EDEND_DISABLE_MASK      = (1UL << 16), ///< Shortcut between EDEND event and DISABLE task.
+    NRF_RADIO_SHORT_CCAIDLE_STOP_MASK       = (1UL << 17), ///< Shortcut between CCAIDLE event and STOP task.
+    NRF_RADIO_SHORT_TXREADY_START_MASK      = (1UL << 18), ///< Shortcut between TXREADY event and START task.
+    NRF_RADIO_SHORT_RXREADY_START_MASK      = (1UL << 19), ///< Shortcut between RXREADY event and START task.
+    NRF_RADIO_SHORT_PHYEND_DISABLE_MASK     = (1UL << 20), ///< Shortcut between PHYEND event and DISABLE task.
+    NRF_RADIO_SHORT_PHYEND_START_MASK       = (1UL << 21), ///< Shortcut between PHYEND event and START task.
+} nrf_radio_short_mask_t;
+
+/** @brief RADIO states. */
+typedef enum
+{
+    NRF_RADIO_STATE_DISABLED  = 0,  ///< No operations are going on inside the radio and the power consumption is at a minimum.
+    NRF_RADIO_STATE_RXRU      = 1,  ///< The radio is ramping up and preparing for reception.
+    NRF_RADIO_STATE_RXIDLE    = 2,  ///< The radio is ready for reception to start.
+    NRF_RADIO_STATE_RX        = 3,  ///< Reception has been started.
+    NRF_RADIO_STATE_RXDISABLE = 4,  ///< The radio is disabling the receiver.
+    NRF_RADIO_STATE_TXRU      = 9,  ///< The radio is ramping up and preparing for transmission.
+    NRF_RADIO_STATE_TXIDLE    = 10, ///< The radio is ready for transmission to start.
+    NRF_RADIO_STATE_TX        = 11, ///< The radio is transmitting a packet.
+    NRF_RADIO_STATE_TXDISABLE = 12, ///< The radio is disabling the transmitter.
+} nrf_radio_state_t;
+
+/** @brief RADIO output power levels. */
+typedef enum
+{
+    NRF_RADIO_TXPOWER_POS8DBM  = 0x08, ///< 8 dBm.
+    NRF_RADIO_TXPOWER_POS7DBM  = 0x07, ///< 7 dBm.
+    NRF_RADIO_TXPOWER_POS6DBM  = 0x06, ///< 6 dBm.
+    NRF_RADIO_TXPOWER_POS5DBM  = 0x05, ///< 5 dBm.
+    NRF_RADIO_TXPOWER_POS4DBM  = 0x04, ///< 4 dBm.
+    NRF_RADIO_TXPOWER_POS3DBM  = 0x03, ///< 3 dBm.
+    NRF_RADIO_TXPOWER_POS2DBM  = 0x02, ///< 2 dBm.
+    NRF_RADIO_TXPOWER_0DBM     = 0x00, ///< 0 dBm.
+    NRF_RADIO_TXPOWER_NEG4DBM  = 0xFC, ///< -4 dBm.
+    NRF_RADIO_TXPOWER_NEG8DBM  = 0xF8, ///< -8 dBm.
+    NRF_RADIO_TXPOWER_NEG12DBM = 0xF4, ///< -12 dBm.
+    NRF_RADIO_TXPOWER_NEG16DBM = 0xF0, ///< -16 dBm.
+    NRF_RADIO_TXPOWER_NEG20DBM = 0xEC, ///< -20 dBm.
+    NRF_RADIO_TXPOWER_NEG40DBM = 0xD8, ///< -40 dBm.
+} nrf_radio_txpower_t;
+
+/** @brief RADIO modes. */
+typedef enum
+{
+    NRF_RADIO_MODE_IEEE802154_250KBIT = 15, ///< IEEE 802.15.4-2006 250 kbit/s.
+} nrf_radio_mode_t;
+
+/** @brief RADIO preamble lengths. */
+typedef enum
+{
+    NRF_RADIO_PREAMBLE_LENGTH_8BIT       = 0, ///< 8-bit preamble.
+    NRF_RADIO_PREAMBLE_LENGTH_16BIT      = 1, ///< 16-bit preamble.
+    NRF_RADIO_PREAMBLE_LENGTH_32BIT_ZERO = 2, ///< 32-bit zero preamble used for IEEE 802.15.4.
+} nrf_radio_preamble_length_t;
+
+/** @brief RADIO CRC address inclusion modes. */
+typedef enum
+{
+    NRF_RADIO_CRC_ADDR_INCLUDE    = 0, ///< CRC calculation includes address field.
+    NRF_RADIO_CRC_ADDR_SKIP       = 1, ///< CRC calculation does not include address field.
+    NRF_RADIO_CRC_ADDR_IEEE802154 = 2, ///< CRC calculation as per 802.15.4 standard.
+} nrf_radio_crc_addr_t;
+
+/** @brief RADIO CCA modes. */
+typedef enum
+{
+    NRF_RADIO_CCA_MODE_ED,             ///< Energy Above Threshold.
+    NRF_RADIO_CCA_MODE_CARRIER,        ///< Carrier Seen.
+    NRF_RADIO_CCA_MODE_CARRIER_AND_ED, ///< Energy Above Threshold AND Carrier Seen.
+    NRF_RADIO_CCA_MODE_CARRIER_OR_ED,  ///< Energy Above Threshold OR Carrier Seen.
+} nrf_radio_cca_mode_t;
+
+/** @brief RADIO packet configuration. */
+typedef struct
+{
+    uint8_t                     lflen;      ///< Length on air of LENGTH field in number of bits.
+    uint8_t                     s0len;      ///< Length on air of S0 field in number of bytes.
+    uint8_t                     s1len;      ///< Length on air of S1 field in number of bits.
+    bool                        s1incl;     ///< Include or exclude S1 field in RAM.
+    uint8_t                     cilen;      ///< Length of code indicator (Long Range).
+    nrf_radio_preamble_length_t plen;       ///< Length of preamble on air.
+    bool                        crcinc;     ///< Indicates if LENGTH field contains CRC or not.
+    uint8_t                     termlen;    ///< Length of TERM field (Long Range).
+    uint8_t                     maxlen;     ///< Maximum length of packet payload.
+    uint8_t                     statlen;    ///< Static length in number of bytes.
+    uint8_t                     balen;      ///< Base address length in number of bytes.
+    bool                        big_endian; ///< On air endianness of packet.
+    bool                        whiteen;    ///< Enable or disable packet whitening.
+} nrf_radio_packet_conf_t;
+
+void nrf_radio_task_trigger(nrf_radio_task_t radio_task);
+
+uint32_t nrf_radio_task_address_get(nrf_radio_task_t radio_task);
+
+void nrf_radio_event_clear(nrf_radio_event_t radio_event);
+
+bool nrf_radio_event_check(nrf_radio_event_t radio_event);
+
+uint32_t nrf_radio_event_address_get(nrf_radio_event_t radio_event);
+
+void nrf_radio_shorts_set(uint32_t radio_shorts_mask);
+
+uint32_t nrf_radio_shorts_get(void);
+
+void nrf_radio_int_enable(uint32_t radio_int_mask);
+
+void nrf_radio_int_disable(uint32_t radio_int_mask);
+
+bool nrf_radio_int_enable_check(nrf_radio_int_mask_t radio_int_mask);
+
+bool nrf_radio_crc_status_check(void);
+
+void nrf_radio_packetptr_set(const void * p_packet);
+
+void nrf_radio_frequency_set(uint16_t radio_frequency);
+
+void nrf_radio_txpower_set(nrf_radio_txpower_t tx_power);
+
+void nrf_radio_mode_set(nrf_radio_mode_t radio_mode);
+
+void nrf_radio_packet_configure(const nrf_radio_packet_conf_t * p_config);
+
+void nrf_radio_crc_configure(uint8_t              crc_length,
+                             nrf_radio_crc_addr_t crc_address,
+                             uint32_t             crc_polynominal);
+
+uint8_t nrf_radio_rssi_sample_get(void);
+
+nrf_radio_state_t nrf_radio_state_get(void);
+
+void nrf_radio_modecnf0_set(bool fast_ramp_up, uint8_t default_tx);
+
+void nrf_radio_power_set(bool radio_power);
+
+void nrf_radio_bcc_set(uint32_t radio_bcc);
+
+uint32_t nrf_radio_bcc_get(void);
+
+void nrf_radio_ed_loop_count_set(uint32_t ed_loop_count);
+
+uint8_t nrf_radio_ed_sample_get(void);
+
+void nrf_radio_cca_configure(nrf_radio_cca_mode_t cca_mode,
+                             uint8_t              cca_ed_threshold,
+                             uint8_t              cca_corr_threshold,
+                             uint8_t              cca_corr_cnt);
+
+void nrf_radio_mhmu_search_pattern_set(uint32_t radio_mhmu_search_pattern);
+
+void nrf_radio_mhmu_pattern_mask_set(uint32_t radio_mhmu_pattern_mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_RADIO_H__
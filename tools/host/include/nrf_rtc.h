@@ -0,0 +1,118 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file provides the subset of the RTC HAL used by the driver built natively on a host
+ *   (e.g. Linux) for simulations and benchmarks.
+ *
+ * The functions are implemented by the RTC model in tools/host/model.
+ *
+ */
+
+#ifndef NRF_RTC_H__
+#define NRF_RTC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nrf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RTC_EVTEN_TICK_Msk     (1UL << 0)  ///< Routing of the TICK event.
+#define RTC_EVTEN_OVRFLW_Msk   (1UL << 1)  ///< Routing of the OVRFLW event.
+#define RTC_EVTEN_COMPARE0_Msk (1UL << 16) ///< Routing of the COMPARE[0] event.
+#define RTC_EVTEN_COMPARE1_Msk (1UL << 17) ///< Routing of the COMPARE[1] event.
+#define RTC_EVTEN_COMPARE2_Msk (1UL << 18) ///< Routing of the COMPARE[2] event.
+#define RTC_EVTEN_COMPARE3_Msk (1UL << 19) ///< Routing of the COMPARE[3] event.
+
+/** @brief RTC tasks. */
+typedef enum
+{
+    NRF_RTC_TASK_START            = 0x000, ///< Start.
+    NRF_RTC_TASK_STOP             = 0x004, ///< Stop.
+    NRF_RTC_TASK_CLEAR            = 0x008, ///< Clear.
+    NRF_RTC_TASK_TRIGGER_OVERFLOW = 0x00C, ///< Trigger overflow.
+} nrf_rtc_task_t;
+
+/** @brief RTC events. */
+typedef enum
+{
+    NRF_RTC_EVENT_TICK      = 0x100, ///< Tick event.
+    NRF_RTC_EVENT_OVERFLOW  = 0x104, ///< Overflow event.
+    NRF_RTC_EVENT_COMPARE_0 = 0x140, ///< Compare 0 event.
+    NRF_RTC_EVENT_COMPARE_1 = 0x144, ///< Compare 1 event.
+    NRF_RTC_EVENT_COMPARE_2 = 0x148, ///< Compare 2 event.
+    NRF_RTC_EVENT_COMPARE_3 = 0x14C, ///< Compare 3 event.
+} nrf_rtc_event_t;
+
+/** @brief RTC interrupts. */
+typedef enum
+{
+    NRF_RTC_INT_TICK_MASK     = (1UL << 0),  ///< RTC interrupt from tick event.
+    NRF_RTC_INT_OVERFLOW_MASK = (1UL << 1),  ///< RTC interrupt from overflow event.
+    NRF_RTC_INT_COMPARE0_MASK = (1UL << 16), ///< RTC interrupt from compare event on channel 0.
+    NRF_RTC_INT_COMPARE1_MASK = (1UL << 17), ///< RTC interrupt from compare event on channel 1.
+    NRF_RTC_INT_COMPARE2_MASK = (1UL << 18), ///< RTC interrupt from compare event on channel 2.
+    NRF_RTC_INT_COMPARE3_MASK = (1UL << 19), ///< RTC interrupt from compare event on channel 3.
+} nrf_rtc_int_t;
+
+void nrf_rtc_cc_set(NRF_RTC_Type * p_reg, uint32_t ch, uint32_t cc_val);
+
+void nrf_rtc_int_enable(NRF_RTC_Type * p_reg, uint32_t mask);
+
+void nrf_rtc_int_disable(NRF_RTC_Type * p_reg, uint32_t mask);
+
+uint32_t nrf_rtc_int_is_enabled(NRF_RTC_Type * p_reg, uint32_t mask);
+
+uint32_t nrf_rtc_event_pending(NRF_RTC_Type * p_reg, nrf_rtc_event_t event);
+
+void nrf_rtc_event_clear(NRF_RTC_Type * p_reg, nrf_rtc_event_t event);
+
+uint32_t nrf_rtc_counter_get(NRF_RTC_Type * p_reg);
+
+void nrf_rtc_prescaler_set(NRF_RTC_Type * p_reg, uint32_t val);
+
+uint32_t nrf_rtc_event_address_get(NRF_RTC_Type * p_reg, nrf_rtc_event_t event);
+
+void nrf_rtc_task_trigger(NRF_RTC_Type * p_reg, nrf_rtc_task_t task);
+
+void nrf_rtc_event_enable(NRF_RTC_Type * p_reg, uint32_t mask);
+
+void nrf_rtc_event_disable(NRF_RTC_Type * p_reg, uint32_t event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_RTC_H__
@@ -0,0 +1,188 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file provides the subset of the TIMER HAL used by the driver built natively on a host
+ *   (e.g. Linux) for simulations and benchmarks.
+ *
+ * The functions are implemented by the TIMER model in tools/host/model.
+ *
+ */
+
+#ifndef NRF_TIMER_H__
+#define NRF_TIMER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nrf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief TIMER tasks. */
+typedef enum
+{
+    NRF_TIMER_TASK_START    = 0x000, ///< Task for starting the timer.
+    NRF_TIMER_TASK_STOP     = 0x004, ///< Task for stopping the timer.
+    NRF_TIMER_TASK_COUNT    = 0x008, ///< Task for incrementing the timer (in counter mode).
+    NRF_TIMER_TASK_CLEAR    = 0x00C, ///< Task for resetting the timer value.
+    NRF_TIMER_TASK_SHUTDOWN = 0x010, ///< Task for powering off the timer.
+    NRF_TIMER_TASK_CAPTURE0 = 0x040, ///< Task for capturing the timer value on channel 0.
+    NRF_TIMER_TASK_CAPTURE1 = 0x044, ///< Task for capturing the timer value on channel 1.
+    NRF_TIMER_TASK_CAPTURE2 = 0x048, ///< Task for capturing the timer value on channel 2.
+    NRF_TIMER_TASK_CAPTURE3 = 0x04C, ///< Task for capturing the timer value on channel 3.
+    NRF_TIMER_TASK_CAPTURE4 = 0x050, ///< Task for capturing the timer value on channel 4.
+    NRF_TIMER_TASK_CAPTURE5 = 0x054, ///< Task for capturing the timer value on channel 5.
+} nrf_timer_task_t;
+
+/** @brief TIMER events. */
+typedef enum
+{
+    NRF_TIMER_EVENT_COMPARE0 = 0x140, ///< Event from compare channel 0.
+    NRF_TIMER_EVENT_COMPARE1 = 0x144, ///< Event from compare channel 1.
+    NRF_TIMER_EVENT_COMPARE2 = 0x148, ///< Event from compare channel 2.
+    NRF_TIMER_EVENT_COMPARE3 = 0x14C, ///< Event from compare channel 3.
+    NRF_TIMER_EVENT_COMPARE4 = 0x150, ///< Event from compare channel 4.
+    NRF_TIMER_EVENT_COMPARE5 = 0x154, ///< Event from compare channel 5.
+} nrf_timer_event_t;
+
+/** @brief TIMER shortcuts. */
+typedef enum
+{
+    NRF_TIMER_SHORT_COMPARE0_CLEAR_MASK = (1UL << 0),  ///< Shortcut for clearing the timer based on compare 0.
+    NRF_TIMER_SHORT_COMPARE1_CLEAR_MASK = (1UL << 1),  ///< Shortcut for clearing the timer based on compare 1.
+    NRF_TIMER_SHORT_COMPARE2_CLEAR_MASK = (1UL << 2),  ///< Shortcut for clearing the timer based on compare 2.
+    NRF_TIMER_SHORT_COMPARE3_CLEAR_MASK = (1UL << 3),  ///< Shortcut for clearing the timer based on compare 3.
+    NRF_TIMER_SHORT_COMPARE4_CLEAR_MASK = (1UL << 4),  ///< Shortcut for clearing the timer based on compare 4.
+    NRF_TIMER_SHORT_COMPARE5_CLEAR_MASK = (1UL << 5),  ///< Shortcut for clearing the timer based on compare 5.
+    NRF_TIMER_SHORT_COMPARE0_STOP_MASK  = (1UL << 8),  ///< Shortcut for stopping the timer based on compare 0.
+    NRF_TIMER_SHORT_COMPARE1_STOP_MASK  = (1UL << 9),  ///< Shortcut for stopping the timer based on compare 1.
+    NRF_TIMER_SHORT_COMPARE2_STOP_MASK  = (1UL << 10), ///< Shortcut for stopping the timer based on compare 2.
+    NRF_TIMER_SHORT_COMPARE3_STOP_MASK  = (1UL << 11), ///< Shortcut for stopping the timer based on compare 3.
+    NRF_TIMER_SHORT_COMPARE4_STOP_MASK  = (1UL << 12), ///< Shortcut for stopping the timer based on compare 4.
+    NRF_TIMER_SHORT_COMPARE5_STOP_MASK  = (1UL << 13), ///< Shortcut for stopping the timer based on compare 5.
+} nrf_timer_short_mask_t;
+
+/** @brief TIMER interrupts. */
+typedef enum
+{
+    NRF_TIMER_INT_COMPARE0_MASK = (1UL << 16), ///< Interrupt on COMPARE[0] event.
+    NRF_TIMER_INT_COMPARE1_MASK = (1UL << 17), ///< Interrupt on COMPARE[1] event.
+    NRF_TIMER_INT_COMPARE2_MASK = (1UL << 18), ///< Interrupt on COMPARE[2] event.
+    NRF_TIMER_INT_COMPARE3_MASK = (1UL << 19), ///< Interrupt on COMPARE[3] event.
+    NRF_TIMER_INT_COMPARE4_MASK = (1UL << 20), ///< Interrupt on COMPARE[4] event.
+    NRF_TIMER_INT_COMPARE5_MASK = (1UL << 21), ///< Interrupt on COMPARE[5] event.
+} nrf_timer_int_mask_t;
+
+/** @brief TIMER modes. */
+typedef enum
+{
+    NRF_TIMER_MODE_TIMER             = 0, ///< Timer mode: timer.
+    NRF_TIMER_MODE_COUNTER           = 1, ///< Timer mode: counter.
+    NRF_TIMER_MODE_LOW_POWER_COUNTER = 2, ///< Timer mode: low-power counter.
+} nrf_timer_mode_t;
+
+/** @brief TIMER bit width. */
+typedef enum
+{
+    NRF_TIMER_BIT_WIDTH_8  = 1, ///< Timer bit width 8 bit.
+    NRF_TIMER_BIT_WIDTH_16 = 0, ///< Timer bit width 16 bit.
+    NRF_TIMER_BIT_WIDTH_24 = 2, ///< Timer bit width 24 bit.
+    NRF_TIMER_BIT_WIDTH_32 = 3, ///< Timer bit width 32 bit.
+} nrf_timer_bit_width_t;
+
+/** @brief TIMER prescalers. */
+typedef enum
+{
+    NRF_TIMER_FREQ_16MHz = 0, ///< Timer frequency 16 MHz.
+    NRF_TIMER_FREQ_8MHz,      ///< Timer frequency 8 MHz.
+    NRF_TIMER_FREQ_4MHz,      ///< Timer frequency 4 MHz.
+    NRF_TIMER_FREQ_2MHz,      ///< Timer frequency 2 MHz.
+    NRF_TIMER_FREQ_1MHz,      ///< Timer frequency 1 MHz.
+    NRF_TIMER_FREQ_500kHz,    ///< Timer frequency 500 kHz.
+    NRF_TIMER_FREQ_250kHz,    ///< Timer frequency 250 kHz.
+    NRF_TIMER_FREQ_125kHz,    ///< Timer frequency 125 kHz.
+    NRF_TIMER_FREQ_62500Hz,   ///< Timer frequency 62500 Hz.
+    NRF_TIMER_FREQ_31250Hz,   ///< Timer frequency 31250 Hz.
+} nrf_timer_frequency_t;
+
+/** @brief TIMER capture/compare channels. */
+typedef enum
+{
+    NRF_TIMER_CC_CHANNEL0 = 0, ///< Timer capture/compare channel 0.
+    NRF_TIMER_CC_CHANNEL1,     ///< Timer capture/compare channel 1.
+    NRF_TIMER_CC_CHANNEL2,     ///< Timer capture/compare channel 2.
+    NRF_TIMER_CC_CHANNEL3,     ///< Timer capture/compare channel 3.
+    NRF_TIMER_CC_CHANNEL4,     ///< Timer capture/compare channel 4.
+    NRF_TIMER_CC_CHANNEL5,     ///< Timer capture/compare channel 5.
+} nrf_timer_cc_channel_t;
+
+void nrf_timer_task_trigger(NRF_TIMER_Type * p_reg, nrf_timer_task_t task);
+
+uint32_t nrf_timer_task_address_get(NRF_TIMER_Type * p_reg, nrf_timer_task_t task);
+
+void nrf_timer_event_clear(NRF_TIMER_Type * p_reg, nrf_timer_event_t event);
+
+bool nrf_timer_event_check(NRF_TIMER_Type * p_reg, nrf_timer_event_t event);
+
+uint32_t nrf_timer_event_address_get(NRF_TIMER_Type * p_reg, nrf_timer_event_t event);
+
+void nrf_timer_shorts_enable(NRF_TIMER_Type * p_reg, uint32_t timer_shorts_mask);
+
+void nrf_timer_shorts_disable(NRF_TIMER_Type * p_reg, uint32_t timer_shorts_mask);
+
+void nrf_timer_int_enable(NRF_TIMER_Type * p_reg, uint32_t timer_int_mask);
+
+void nrf_timer_int_disable(NRF_TIMER_Type * p_reg, uint32_t timer_int_mask);
+
+void nrf_timer_mode_set(NRF_TIMER_Type * p_reg, nrf_timer_mode_t mode);
+
+void nrf_timer_bit_width_set(NRF_TIMER_Type * p_reg, nrf_timer_bit_width_t bit_width);
+
+void nrf_timer_frequency_set(NRF_TIMER_Type * p_reg, nrf_timer_frequency_t frequency);
+
+void nrf_timer_cc_write(NRF_TIMER_Type * p_reg, nrf_timer_cc_channel_t cc_channel, uint32_t cc_value);
+
+uint32_t nrf_timer_cc_read(NRF_TIMER_Type * p_reg, nrf_timer_cc_channel_t cc_channel);
+
+/** @brief Gets the CAPTURE task of the given channel. */
+static inline nrf_timer_task_t nrf_timer_capture_task_get(uint32_t channel)
+{
+    return (nrf_timer_task_t)(NRF_TIMER_TASK_CAPTURE0 + channel * sizeof(uint32_t));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_TIMER_H__
@@ -0,0 +1,164 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the CLOCK model of the host peripheral model.
+ *
+ * The high-frequency crystal oscillator starts after the nominal startup time. The low-frequency
+ * clock starts at once, instead of the hundreds of milliseconds of a crystal, not to delay every
+ * simulation.
+ *
+ */
+
+#include "nrf_host_periph.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nrf.h>
+#include <nrf_clock.h>
+
+#define HFXO_STARTUP_TIME 360000 ///< Startup time of the high-frequency crystal oscillator, in nanoseconds.
+
+static nrf_host_periph_t      m_periph;     ///< Common part of the peripheral.
+static nrf_host_model_timer_t m_hfxo_timer; ///< Timer of the startup of the high-frequency oscillator.
+static bool                   m_hf_running; ///< Information if the high-frequency oscillator is running.
+static bool                   m_lf_running; ///< Information if the low-frequency clock is running.
+
+static void hfxo_started(void * p_context)
+{
+    (void)p_context;
+
+    m_hf_running = true;
+    nrf_host_periph_event_generate(&m_periph, NRF_CLOCK_EVENT_HFCLKSTARTED, true);
+}
+
+static void task_handler(nrf_host_periph_t * p_periph, uint32_t offset)
+{
+    (void)p_periph;
+
+    switch (offset)
+    {
+        case NRF_CLOCK_TASK_HFCLKSTART:
+            if (!m_hf_running && !m_hfxo_timer.running)
+            {
+                nrf_host_model_timer_start(&m_hfxo_timer,
+                                           nrf_host_sim_time_get() + HFXO_STARTUP_TIME,
+                                           hfxo_started,
+                                           NULL);
+            }
+            break;
+
+        case NRF_CLOCK_TASK_HFCLKSTOP:
+            nrf_host_model_timer_stop(&m_hfxo_timer);
+            m_hf_running = false;
+            break;
+
+        case NRF_CLOCK_TASK_LFCLKSTART:
+            m_lf_running = true;
+            nrf_host_periph_event_generate(&m_periph, NRF_CLOCK_EVENT_LFCLKSTARTED, true);
+            break;
+
+        case NRF_CLOCK_TASK_LFCLKSTOP:
+            m_lf_running = false;
+            break;
+
+        default:
+            break;
+    }
+}
+
+void nrf_host_clock_init(void)
+{
+    // The timer queue is emptied by the kernel.
+    memset(&m_hfxo_timer, 0, sizeof(m_hfxo_timer));
+
+    m_hf_running = false;
+    m_lf_running = false;
+
+    m_periph.base         = NRF_CLOCK_BASE;
+    m_periph.irqn         = POWER_CLOCK_IRQn;
+    m_periph.task_handler = task_handler;
+
+    nrf_host_periph_register(&m_periph);
+}
+
+void nrf_clock_int_enable(uint32_t int_mask)
+{
+    nrf_host_sim_access();
+    m_periph.inten |= int_mask;
+    nrf_host_sim_irq_dispatch();
+}
+
+void nrf_clock_int_disable(uint32_t int_mask)
+{
+    nrf_host_sim_access();
+    m_periph.inten &= ~int_mask;
+}
+
+void nrf_clock_task_trigger(nrf_clock_task_t task)
+{
+    nrf_host_sim_access();
+    task_handler(&m_periph, task);
+    nrf_host_sim_irq_dispatch();
+}
+
+void nrf_clock_event_clear(nrf_clock_event_t event)
+{
+    nrf_host_sim_access();
+    m_periph.events &= ~nrf_host_periph_event_mask(event);
+}
+
+bool nrf_clock_event_check(nrf_clock_event_t event)
+{
+    nrf_host_sim_access();
+    return (m_periph.events & nrf_host_periph_event_mask(event)) != 0;
+}
+
+void nrf_clock_lf_src_set(nrf_clock_lfclk_t source)
+{
+    (void)source;
+
+    nrf_host_sim_access();
+}
+
+bool nrf_clock_lf_is_running(void)
+{
+    nrf_host_sim_access();
+    return m_lf_running;
+}
+
+bool nrf_clock_hf_is_running(nrf_clock_hfclk_t clk_src)
+{
+    nrf_host_sim_access();
+    return (clk_src == NRF_CLOCK_HFCLK_HIGH_ACCURACY) ? m_hf_running : true;
+}
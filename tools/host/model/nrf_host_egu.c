@@ -0,0 +1,125 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the EGU model of the host peripheral model.
+ *
+ */
+
+#include "nrf_host_periph.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <nrf.h>
+#include <nrf_egu.h>
+
+#define EGU_NUM 6 ///< Number of the EGU instances.
+
+/** @brief EGU instance. */
+struct nrf_host_egu_s
+{
+    nrf_host_periph_t periph; ///< Common part of the peripheral.
+};
+
+NRF_EGU_Type nrf_host_egu0;
+NRF_EGU_Type nrf_host_egu1;
+NRF_EGU_Type nrf_host_egu2;
+NRF_EGU_Type nrf_host_egu3;
+NRF_EGU_Type nrf_host_egu4;
+NRF_EGU_Type nrf_host_egu5;
+
+static NRF_EGU_Type * const mp_egus[EGU_NUM] =
+{
+    &nrf_host_egu0, &nrf_host_egu1, &nrf_host_egu2, &nrf_host_egu3, &nrf_host_egu4, &nrf_host_egu5,
+};
+
+static void task_handler(nrf_host_periph_t * p_periph, uint32_t offset)
+{
+    if (offset <= NRF_EGU_TASK_TRIGGER15)
+    {
+        nrf_host_periph_event_generate(p_periph, NRF_HOST_PERIPH_EVENTS_OFFSET + offset, true);
+    }
+}
+
+void nrf_host_egu_init(void)
+{
+    for (uint32_t i = 0; i < EGU_NUM; i++)
+    {
+        mp_egus[i]->periph.base         = NRF_EGU0_BASE + i * (NRF_EGU1_BASE - NRF_EGU0_BASE);
+        mp_egus[i]->periph.irqn         = SWI0_EGU0_IRQn + i;
+        mp_egus[i]->periph.task_handler = task_handler;
+
+        nrf_host_periph_register(&mp_egus[i]->periph);
+    }
+}
+
+void nrf_egu_task_trigger(NRF_EGU_Type * p_reg, nrf_egu_task_t egu_task)
+{
+    nrf_host_sim_access();
+    task_handler(&p_reg->periph, egu_task);
+    nrf_host_sim_irq_dispatch();
+}
+
+uint32_t nrf_egu_task_address_get(NRF_EGU_Type * p_reg, nrf_egu_task_t egu_task)
+{
+    return p_reg->periph.base + (uint32_t)egu_task;
+}
+
+bool nrf_egu_event_check(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event)
+{
+    nrf_host_sim_access();
+    return (p_reg->periph.events & nrf_host_periph_event_mask(egu_event)) != 0;
+}
+
+void nrf_egu_event_clear(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event)
+{
+    nrf_host_sim_access();
+    p_reg->periph.events &= ~nrf_host_periph_event_mask(egu_event);
+}
+
+uint32_t nrf_egu_event_address_get(NRF_EGU_Type * p_reg, nrf_egu_event_t egu_event)
+{
+    return p_reg->periph.base + (uint32_t)egu_event;
+}
+
+void nrf_egu_int_enable(NRF_EGU_Type * p_reg, uint32_t egu_int_mask)
+{
+    nrf_host_sim_access();
+    p_reg->periph.inten |= egu_int_mask;
+    nrf_host_sim_irq_dispatch();
+}
+
+void nrf_egu_int_disable(NRF_EGU_Type * p_reg, uint32_t egu_int_mask)
+{
+    nrf_host_sim_access();
+    p_reg->periph.inten &= ~egu_int_mask;
+}
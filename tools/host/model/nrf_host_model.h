@@ -0,0 +1,220 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Behavioral model of the nRF52840 peripherals used by the 802.15.4 driver built natively
+ *        on a host.
+ *
+ */
+
+#ifndef NRF_HOST_MODEL_H__
+#define NRF_HOST_MODEL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_host_model Host peripheral model
+ * @{
+ * @ingroup nrf_802154
+ * @brief Behavioral model of the RADIO, TIMER, RTC, EGU, PPI and CLOCK peripherals and the NVIC.
+ *
+ * The model lets the unmodified driver core run end to end on a host. It runs on a virtual clock
+ * in nanoseconds, which advances only when the model is told to run or when the driver accesses
+ * a peripheral. Every access costs the CPU time set by @ref nrf_host_model_access_time_set, so the
+ * loops polling the peripherals terminate.
+ *
+ * The peripherals generate their events at the nominal times of the nRF52840 Product
+ * Specification, execute the shortcuts and publish the events to the PPI channels. The RADIO
+ * receives frames injected with @ref nrf_host_radio_frame_inject, writing them byte after byte to
+ * the buffer latched from PACKETPTR at the START task, and reports the transmitted frames to the
+ * handler set with @ref nrf_host_radio_tx_handler_set.
+ *
+ * The interrupts are level-triggered by the events enabled in INTEN, prioritized by the NVIC and
+ * masked by PRIMASK. A handler preempts the running context only at the peripheral accesses, at
+ * the NVIC and PRIMASK operations, and while the model is told to run, which is where the driver
+ * observes the hardware. The exclusive monitor is cleared on the handler entry and exit.
+ *
+ * The model is a single-threaded program. All state is static, so every simulated node needs its
+ * own copy of the driver and of the model.
+ */
+
+/** @brief Time that never comes, in nanoseconds. */
+#define NRF_HOST_MODEL_TIME_NEVER UINT64_MAX
+
+/** @brief Handler of a model timer. */
+typedef void (* nrf_host_model_handler_t)(void * p_context);
+
+/**
+ * @brief Timer of the virtual clock.
+ *
+ * The fields are managed by the model and must not be modified while the timer is running.
+ */
+typedef struct nrf_host_model_timer_s
+{
+    struct nrf_host_model_timer_s * p_next;    ///< Next timer in the queue.
+    uint64_t                        time;      ///< Expiry time, in nanoseconds.
+    nrf_host_model_handler_t        handler;   ///< Handler called at the expiry time.
+    void                          * p_context; ///< Context passed to the handler.
+    bool                            running;   ///< Information if the timer is in the queue.
+} nrf_host_model_timer_t;
+
+/**
+ * @brief Frame on the air.
+ */
+typedef struct
+{
+    const uint8_t * p_data;     ///< PHR followed by the PSDU, including the FCS.
+    uint16_t        frequency;  ///< Center frequency, in MHz.
+    int8_t          power;      ///< Power at the receiver or output power of the transmitter, in dBm.
+    uint8_t         lqi;        ///< Raw LQI reported by the receiver.
+    bool            crc_ok;     ///< Information if the receiver finds the FCS correct.
+    uint64_t        start_time; ///< Time of the first symbol of the preamble, in nanoseconds.
+} nrf_host_radio_frame_t;
+
+/** @brief Handler of the frames transmitted by the RADIO. */
+typedef void (* nrf_host_radio_tx_handler_t)(const nrf_host_radio_frame_t * p_frame,
+                                             void                         * p_context);
+
+/**
+ * @brief Resets the virtual clock and all the peripherals to their reset state.
+ *
+ * @param[in]  seed  Value read from the RNG by the driver.
+ */
+void nrf_host_model_init(uint32_t seed);
+
+/**
+ * @brief Gets the current time of the virtual clock.
+ *
+ * @returns  Current time, in nanoseconds.
+ */
+uint64_t nrf_host_model_time_get(void);
+
+/**
+ * @brief Runs the model until the given time.
+ *
+ * The interrupt handlers are executed as the peripherals generate the events. The function must
+ * be called from the thread mode.
+ *
+ * @param[in]  time  Time to run to, in nanoseconds.
+ */
+void nrf_host_model_run_until(uint64_t time);
+
+/**
+ * @brief Runs the model for the given duration.
+ *
+ * @param[in]  duration  Time to run for, in nanoseconds.
+ */
+void nrf_host_model_run_for(uint64_t duration);
+
+/**
+ * @brief Gets the time of the next scheduled event of the model.
+ *
+ * @returns  Time of the next event in nanoseconds, or @ref NRF_HOST_MODEL_TIME_NEVER.
+ */
+uint64_t nrf_host_model_next_event_time_get(void);
+
+/**
+ * @brief Sets the CPU time spent on every peripheral access.
+ *
+ * @param[in]  time  Time of an access, in nanoseconds. The default is 250 ns.
+ */
+void nrf_host_model_access_time_set(uint32_t time);
+
+/**
+ * @brief Starts a timer of the virtual clock, or restarts it if it is running.
+ *
+ * The handler is called in the context of the model, which may be a peripheral access of the
+ * driver. It may use the functions of the model, but must not call the driver.
+ *
+ * @param[inout]  p_timer    Timer to start.
+ * @param[in]     time       Expiry time, in nanoseconds. A time in the past expires immediately.
+ * @param[in]     handler    Handler called at the expiry time.
+ * @param[in]     p_context  Context passed to the handler.
+ */
+void nrf_host_model_timer_start(nrf_host_model_timer_t * p_timer,
+                                uint64_t                 time,
+                                nrf_host_model_handler_t handler,
+                                void                   * p_context);
+
+/**
+ * @brief Stops a timer of the virtual clock.
+ *
+ * @param[inout]  p_timer  Timer to stop.
+ */
+void nrf_host_model_timer_stop(nrf_host_model_timer_t * p_timer);
+
+/**
+ * @brief Sets the handler of the frames transmitted by the RADIO.
+ *
+ * The handler is called at the START task, when the preamble of the frame begins. The frame
+ * contains the FCS calculated by the RADIO.
+ *
+ * @param[in]  handler    Handler, or NULL to drop the transmitted frames.
+ * @param[in]  p_context  Context passed to the handler.
+ */
+void nrf_host_radio_tx_handler_set(nrf_host_radio_tx_handler_t handler, void * p_context);
+
+/**
+ * @brief Puts a frame on the air around the RADIO.
+ *
+ * The frame raises the energy on its frequency for its duration. It is received if the receiver
+ * was started on that frequency before the end of the preamble and is not receiving another frame
+ * when the SFD ends. The reception fails the CRC check if the frame is marked so, or if the frames
+ * overlapping it on the same frequency push its SINR below the SNR of a frame at the sensitivity
+ * level of the receiver. The frame data are copied.
+ *
+ * @param[in]  p_frame  Frame to inject. Its start time must not be earlier than the current time
+ *                      by more than the duration of the preamble.
+ */
+void nrf_host_radio_frame_inject(const nrf_host_radio_frame_t * p_frame);
+
+/**
+ * @brief Gets the time on the air of a frame.
+ *
+ * @param[in]  psdu_length  Length of the PSDU, including the FCS.
+ *
+ * @returns  Duration of the SHR, PHR and PSDU, in nanoseconds.
+ */
+uint64_t nrf_host_radio_frame_duration_get(uint8_t psdu_length);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_HOST_MODEL_H__
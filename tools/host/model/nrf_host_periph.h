@@ -0,0 +1,143 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Internal interface between the peripherals of the host model and its simulation kernel.
+ *
+ */
+
+#ifndef NRF_HOST_PERIPH_H__
+#define NRF_HOST_PERIPH_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_host_model.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_HOST_PERIPH_EVENTS_OFFSET 0x100UL ///< Offset of the first event register of a peripheral.
+#define NRF_HOST_PERIPH_NO_IRQ        (-1)    ///< Interrupt number of a peripheral without an interrupt.
+
+typedef struct nrf_host_periph_s nrf_host_periph_t;
+
+/** @brief Function executing a task of a peripheral. */
+typedef void (* nrf_host_periph_task_handler_t)(nrf_host_periph_t * p_periph, uint32_t offset);
+
+/**
+ * @brief Common part of the peripheral models.
+ *
+ * The events are stored in a bitmask indexed like the INTEN register:
+ * bit n corresponds to the event register at @ref NRF_HOST_PERIPH_EVENTS_OFFSET + 4 * n.
+ */
+struct nrf_host_periph_s
+{
+    uint32_t                       base;         ///< Base address of the peripheral.
+    int32_t                        irqn;         ///< Interrupt number, or @ref NRF_HOST_PERIPH_NO_IRQ.
+    nrf_host_periph_task_handler_t task_handler; ///< Function executing the tasks.
+    uint32_t                       events;       ///< Generated events.
+    uint32_t                       inten;        ///< Events enabled to generate the interrupt.
+};
+
+/**
+ * @brief Registers a peripheral model on the bus and at the NVIC.
+ *
+ * @param[inout]  p_periph  Peripheral to register. Its events and interrupts are cleared.
+ */
+void nrf_host_periph_register(nrf_host_periph_t * p_periph);
+
+/**
+ * @brief Gets the mask of the event register at the given offset.
+ */
+static inline uint32_t nrf_host_periph_event_mask(uint32_t offset)
+{
+    return 1UL << ((offset - NRF_HOST_PERIPH_EVENTS_OFFSET) / sizeof(uint32_t));
+}
+
+/**
+ * @brief Generates an event of a peripheral.
+ *
+ * @param[inout]  p_periph  Peripheral generating the event.
+ * @param[in]     offset    Offset of the event register.
+ * @param[in]     publish   Information if the event is published to the PPI channels.
+ */
+void nrf_host_periph_event_generate(nrf_host_periph_t * p_periph, uint32_t offset, bool publish);
+
+/**
+ * @brief Executes a task at the given address of the bus.
+ *
+ * Tasks of unknown peripherals are ignored.
+ *
+ * @param[in]  address  Address of the task register.
+ */
+void nrf_host_bus_task_trigger(uint32_t address);
+
+/**
+ * @brief Starts an access of the CPU to a peripheral.
+ *
+ * The access advances the virtual clock by the access time and lets the pending interrupts
+ * preempt the running context before the access takes effect.
+ */
+void nrf_host_sim_access(void);
+
+/**
+ * @brief Lets the pending interrupts preempt the running context.
+ */
+void nrf_host_sim_irq_dispatch(void);
+
+/**
+ * @brief Gets the current time of the virtual clock, in nanoseconds.
+ */
+uint64_t nrf_host_sim_time_get(void);
+
+/**
+ * @brief Publishes an event to the PPI channels.
+ *
+ * The tasks connected to the event are executed in the order of the channels, after the tasks
+ * already being executed by the PPI.
+ *
+ * @param[in]  address  Address of the event register.
+ */
+void nrf_host_ppi_event_publish(uint32_t address);
+
+void nrf_host_clock_init(void);
+void nrf_host_egu_init(void);
+void nrf_host_ppi_init(void);
+void nrf_host_radio_init(void);
+void nrf_host_rtc_init(void);
+void nrf_host_timer_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_HOST_PERIPH_H__
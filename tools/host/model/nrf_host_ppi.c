@@ -0,0 +1,223 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the PPI model of the host peripheral model.
+ *
+ */
+
+#include "nrf_host_periph.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nrf.h>
+#include <nrf_ppi.h>
+
+#define CHANNEL_NUM      20                                 ///< Number of the programmable channels.
+#define GROUP_NUM        6                                  ///< Number of the channel groups.
+#define TASK_QUEUE_SIZE  64                                 ///< Maximum number of the tasks waiting for execution.
+#define GROUP_TASKS_SIZE (2 * sizeof(uint32_t) * GROUP_NUM) ///< Size of the group task registers.
+
+/** @brief Programmable PPI channel. */
+typedef struct
+{
+    uint32_t eep;      ///< Event end point.
+    uint32_t tep;      ///< Task end point.
+    uint32_t fork_tep; ///< Task end point of the fork.
+} channel_t;
+
+static nrf_host_periph_t m_periph;                        ///< Common part of the peripheral.
+static channel_t         m_channels[CHANNEL_NUM];         ///< Programmable channels.
+static uint32_t          m_chen;                          ///< Enabled channels.
+static uint32_t          m_groups[GROUP_NUM];             ///< Channels included in the groups.
+static uint32_t          m_task_queue[TASK_QUEUE_SIZE];   ///< Tasks waiting for execution.
+static uint32_t          m_task_queue_head;               ///< Index of the next task to execute.
+static uint32_t          m_task_queue_tail;               ///< Index of the next free entry.
+static bool              m_executing;                     ///< Information if the tasks are being executed.
+
+static void task_enqueue(uint32_t address)
+{
+    if (address == 0)
+    {
+        return;
+    }
+
+    assert(m_task_queue_tail - m_task_queue_head < TASK_QUEUE_SIZE);
+
+    m_task_queue[m_task_queue_tail % TASK_QUEUE_SIZE] = address;
+    m_task_queue_tail++;
+}
+
+static void task_handler(nrf_host_periph_t * p_periph, uint32_t offset)
+{
+    uint32_t group = offset / (2 * sizeof(uint32_t));
+
+    (void)p_periph;
+
+    if (offset >= GROUP_TASKS_SIZE)
+    {
+        return;
+    }
+
+    if (offset % (2 * sizeof(uint32_t)) == 0)
+    {
+        m_chen |= m_groups[group];
+    }
+    else
+    {
+        m_chen &= ~m_groups[group];
+    }
+}
+
+void nrf_host_ppi_event_publish(uint32_t address)
+{
+    for (uint32_t i = 0; i < CHANNEL_NUM; i++)
+    {
+        if ((m_chen & (1UL << i)) && (m_channels[i].eep == address))
+        {
+            task_enqueue(m_channels[i].tep);
+            task_enqueue(m_channels[i].fork_tep);
+        }
+    }
+
+    // The tasks triggering further events are executed after the tasks already in the queue.
+    if (m_executing)
+    {
+        return;
+    }
+
+    m_executing = true;
+
+    while (m_task_queue_head != m_task_queue_tail)
+    {
+        uint32_t task = m_task_queue[m_task_queue_head % TASK_QUEUE_SIZE];
+
+        m_task_queue_head++;
+        nrf_host_bus_task_trigger(task);
+    }
+
+    m_executing = false;
+}
+
+void nrf_host_ppi_init(void)
+{
+    memset(m_channels, 0, sizeof(m_channels));
+    memset(m_groups, 0, sizeof(m_groups));
+
+    m_chen            = 0;
+    m_task_queue_head = 0;
+    m_task_queue_tail = 0;
+    m_executing       = false;
+
+    m_periph.base         = NRF_PPI_BASE;
+    m_periph.irqn         = NRF_HOST_PERIPH_NO_IRQ;
+    m_periph.task_handler = task_handler;
+
+    nrf_host_periph_register(&m_periph);
+}
+
+void nrf_ppi_channel_enable(nrf_ppi_channel_t channel)
+{
+    nrf_host_sim_access();
+    m_chen |= 1UL << channel;
+}
+
+void nrf_ppi_channel_disable(nrf_ppi_channel_t channel)
+{
+    nrf_host_sim_access();
+    m_chen &= ~(1UL << channel);
+}
+
+void nrf_ppi_channel_endpoint_setup(nrf_ppi_channel_t channel, uint32_t eep, uint32_t tep)
+{
+    assert(channel < CHANNEL_NUM);
+
+    nrf_host_sim_access();
+    m_channels[channel].eep = eep;
+    m_channels[channel].tep = tep;
+}
+
+void nrf_ppi_fork_endpoint_setup(nrf_ppi_channel_t channel, uint32_t fork_tep)
+{
+    assert(channel < CHANNEL_NUM);
+
+    nrf_host_sim_access();
+    m_channels[channel].fork_tep = fork_tep;
+}
+
+void nrf_ppi_channel_and_fork_endpoint_setup(nrf_ppi_channel_t channel,
+                                             uint32_t          eep,
+                                             uint32_t          tep,
+                                             uint32_t          fork_tep)
+{
+    nrf_ppi_channel_endpoint_setup(channel, eep, tep);
+    nrf_ppi_fork_endpoint_setup(channel, fork_tep);
+}
+
+void nrf_ppi_channel_include_in_group(nrf_ppi_channel_t       channel,
+                                      nrf_ppi_channel_group_t channel_group)
+{
+    nrf_host_sim_access();
+    m_groups[channel_group] |= 1UL << channel;
+}
+
+void nrf_ppi_channel_remove_from_group(nrf_ppi_channel_t       channel,
+                                       nrf_ppi_channel_group_t channel_group)
+{
+    nrf_host_sim_access();
+    m_groups[channel_group] &= ~(1UL << channel);
+}
+
+void nrf_ppi_group_enable(nrf_ppi_channel_group_t group)
+{
+    nrf_host_sim_access();
+    m_chen |= m_groups[group];
+}
+
+void nrf_ppi_group_disable(nrf_ppi_channel_group_t group)
+{
+    nrf_host_sim_access();
+    m_chen &= ~m_groups[group];
+}
+
+uint32_t nrf_ppi_task_address_get(nrf_ppi_task_t ppi_task)
+{
+    return NRF_PPI_BASE + (uint32_t)ppi_task;
+}
+
+uint32_t nrf_ppi_task_group_disable_address_get(nrf_ppi_channel_group_t group)
+{
+    return nrf_ppi_task_address_get((nrf_ppi_task_t)(NRF_PPI_TASK_CHG0_DIS +
+                                                     group * 2 * sizeof(uint32_t)));
+}
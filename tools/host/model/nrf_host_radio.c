@@ -0,0 +1,1070 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the RADIO model of the host peripheral model.
+ *
+ * The model covers the IEEE 802.15.4 mode used by the driver: the state machine with the nominal
+ * ramp-up and disabling times, the shortcuts, the bit counter, the MAC header match unit, RSSI,
+ * ED and CCA measurements, and the DMA of the frames from and to the buffer latched from PACKETPTR
+ * at the START task.
+ *
+ * A received frame is written to the RAM byte after byte, at the time the byte ends on the air.
+ * The END and CRC events of a received frame are delayed by the END event latency of the device,
+ * which the driver accounts for when it starts the ACK. The FCS of the received frames is not
+ * verified, but taken from the description of the injected frame. A received frame also fails
+ * the CRC check when the frames overlapping it on the same frequency push its SINR below the SNR
+ * of a frame at the sensitivity level. The FCS of the transmitted frames is calculated.
+ *
+ * The energy on a frequency is the power of the strongest frame on the air at that time, or the
+ * noise floor. The transmitted frames are not heard by the RADIO that sends them.
+ *
+ */
+
+#include "nrf_host_periph.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nrf.h>
+#include <nrf_radio.h>
+
+#define MAX_PSDU_SIZE  127 ///< Maximum size of the PSDU, in bytes.
+#define PHR_SIZE       1   ///< Size of the PHR, in bytes.
+#define FCS_SIZE       2   ///< Size of the FCS, in bytes.
+#define MHR_MATCH_SIZE 4   ///< Number of bytes compared by the MAC header match unit.
+#define AIR_FRAMES_NUM 64  ///< Maximum number of the frames on the air.
+
+#define BIT_TIME          4000   ///< Duration of a bit on the air, in nanoseconds.
+#define BYTE_TIME         32000  ///< Duration of a byte on the air, in nanoseconds.
+#define PREAMBLE_TIME     128000 ///< Duration of the preamble, in nanoseconds.
+#define SHR_TIME          160000 ///< Duration of the preamble and the SFD, in nanoseconds.
+#define RX_SYNC_TIME      32000  ///< Part of the preamble the receiver needs to synchronize, in nanoseconds.
+#define RAMP_UP_FAST_TIME 40000  ///< Ramp-up time in the fast ramp-up mode, in nanoseconds.
+#define RAMP_UP_TIME      130000 ///< Ramp-up time in the default ramp-up mode, in nanoseconds.
+#define RX_DISABLE_TIME   500    ///< Time of disabling the receiver, in nanoseconds.
+#define TX_DISABLE_TIME   21000  ///< Time of disabling the transmitter, in nanoseconds.
+#define RX_END_LATENCY    23000  ///< Latency of the END and CRC events of a received frame, in nanoseconds.
+#define RSSI_TIME         250    ///< Time of a single RSSI sample, in nanoseconds.
+#define ED_TIME           128000 ///< Duration of a single ED measurement, in nanoseconds.
+#define CCA_TIME          128000 ///< Duration of the CCA, in nanoseconds.
+
+#define NOISE_FLOOR_DBM    (-100) ///< Energy on a frequency without frames, in dBm.
+#define SENSITIVITY_DBM    (-100) ///< Power of the weakest frame received or seen by the CCA, in dBm.
+#define ED_RSSI_OFFSET_DBM (-94)  ///< Offset of the ED samples, in dBm.
+#define SAMPLE_MAX         127    ///< Maximum value of the RSSI and ED samples.
+
+#define FCS_POLYNOMIAL 0x8408U ///< Reversed polynomial of the 802.15.4 FCS.
+
+/** @brief Frame on the air. */
+typedef struct
+{
+    nrf_host_model_timer_t sync_timer;                      ///< Timer of the end of the SFD.
+    uint8_t                data[PHR_SIZE + MAX_PSDU_SIZE];  ///< PHR and PSDU.
+    uint16_t               frequency;                       ///< Center frequency, in MHz.
+    int8_t                 power;                           ///< Power at the receiver, in dBm.
+    uint8_t                lqi;                             ///< Raw LQI.
+    bool                   crc_ok;                          ///< Information if the FCS is correct.
+    uint64_t               start_time;                      ///< Time of the start of the preamble.
+    uint64_t               end_time;                        ///< Time of the end of the last symbol.
+    bool                   in_use;                          ///< Information if the entry is used.
+} air_frame_t;
+
+/** @brief Shortcut between an event and a task. */
+typedef struct
+{
+    nrf_radio_event_t event; ///< Event of the shortcut.
+    uint32_t          mask;  ///< Bit of the shortcut in the SHORTS register.
+    nrf_radio_task_t  task;  ///< Task of the shortcut.
+} short_t;
+
+static const short_t m_shorts_table[] =
+{
+    {NRF_RADIO_EVENT_READY,      NRF_RADIO_SHORT_READY_START_MASK,        NRF_RADIO_TASK_START    },
+    {NRF_RADIO_EVENT_END,        NRF_RADIO_SHORT_END_DISABLE_MASK,        NRF_RADIO_TASK_DISABLE  },
+    {NRF_RADIO_EVENT_DISABLED,   NRF_RADIO_SHORT_DISABLED_TXEN_MASK,      NRF_RADIO_TASK_TXEN     },
+    {NRF_RADIO_EVENT_DISABLED,   NRF_RADIO_SHORT_DISABLED_RXEN_MASK,      NRF_RADIO_TASK_RXEN     },
+    {NRF_RADIO_EVENT_ADDRESS,    NRF_RADIO_SHORT_ADDRESS_RSSISTART_MASK,  NRF_RADIO_TASK_RSSISTART},
+    {NRF_RADIO_EVENT_END,        NRF_RADIO_SHORT_END_START_MASK,          NRF_RADIO_TASK_START    },
+    {NRF_RADIO_EVENT_ADDRESS,    NRF_RADIO_SHORT_ADDRESS_BCSTART_MASK,    NRF_RADIO_TASK_BCSTART  },
+    {NRF_RADIO_EVENT_DISABLED,   NRF_RADIO_SHORT_DISABLED_RSSISTOP_MASK,  NRF_RADIO_TASK_RSSISTOP },
+    {NRF_RADIO_EVENT_RXREADY,    NRF_RADIO_SHORT_RXREADY_CCASTART_MASK,   NRF_RADIO_TASK_CCASTART },
+    {NRF_RADIO_EVENT_CCAIDLE,    NRF_RADIO_SHORT_CCAIDLE_TXEN_MASK,       NRF_RADIO_TASK_TXEN     },
+    {NRF_RADIO_EVENT_CCABUSY,    NRF_RADIO_SHORT_CCABUSY_DISABLE_MASK,    NRF_RADIO_TASK_DISABLE  },
+    {NRF_RADIO_EVENT_FRAMESTART, NRF_RADIO_SHORT_FRAMESTART_BCSTART_MASK, NRF_RADIO_TASK_BCSTART  },
+    {NRF_RADIO_EVENT_READY,      NRF_RADIO_SHORT_READY_EDSTART_MASK,      NRF_RADIO_TASK_EDSTART  },
+    {NRF_RADIO_EVENT_EDEND,      NRF_RADIO_SHORT_EDEND_DISABLE_MASK,      NRF_RADIO_TASK_DISABLE  },
+    {NRF_RADIO_EVENT_CCAIDLE,    NRF_RADIO_SHORT_CCAIDLE_STOP_MASK,       NRF_RADIO_TASK_STOP     },
+    {NRF_RADIO_EVENT_TXREADY,    NRF_RADIO_SHORT_TXREADY_START_MASK,      NRF_RADIO_TASK_START    },
+    {NRF_RADIO_EVENT_RXREADY,    NRF_RADIO_SHORT_RXREADY_START_MASK,      NRF_RADIO_TASK_START    },
+    {NRF_RADIO_EVENT_PHYEND,     NRF_RADIO_SHORT_PHYEND_DISABLE_MASK,     NRF_RADIO_TASK_DISABLE  },
+    {NRF_RADIO_EVENT_PHYEND,     NRF_RADIO_SHORT_PHYEND_START_MASK,       NRF_RADIO_TASK_START    },
+};
+
+static nrf_host_periph_t m_periph;      ///< Common part of the peripheral.
+static nrf_radio_state_t m_state;       ///< STATE register.
+static uint32_t          m_shorts;      ///< SHORTS register.
+static const uint8_t   * mp_packet;     ///< PACKETPTR register.
+static uint16_t          m_frequency;   ///< Center frequency, in MHz.
+static int8_t            m_tx_power;    ///< Output power, in dBm.
+static bool              m_fast_ramp_up; ///< Information if the fast ramp-up is enabled.
+static uint8_t           m_max_length;  ///< Maximum length of a received PSDU.
+static uint32_t          m_bcc;         ///< BCC register.
+static uint32_t          m_mhmu_pattern; ///< MHRMATCHCONF register.
+static uint32_t          m_mhmu_mask;   ///< MHRMATCHMAS register.
+static uint32_t          m_ed_count;    ///< EDCNT register.
+static uint8_t           m_ed_sample;   ///< EDSAMPLE register.
+static uint8_t           m_rssi_sample; ///< RSSISAMPLE register.
+static bool              m_crc_ok;      ///< CRCSTATUS register.
+
+static nrf_radio_cca_mode_t m_cca_mode;          ///< CCA mode.
+static uint8_t              m_cca_ed_threshold;  ///< CCA ED threshold.
+
+static nrf_host_model_timer_t m_ramp_timer;      ///< Timer of the ramp-up and disabling.
+static nrf_host_model_timer_t m_rssi_timer;      ///< Timer of the RSSI sample.
+static nrf_host_model_timer_t m_measure_timer;   ///< Timer of the ED or CCA measurement.
+static uint64_t               m_measure_start;   ///< Start time of the ED or CCA measurement.
+
+static air_frame_t            m_air_frames[AIR_FRAMES_NUM]; ///< Frames on the air.
+
+static air_frame_t          * mp_rx_frame;       ///< Frame being received.
+static uint8_t              * mp_rx_buffer;      ///< Buffer of the frame being received.
+static uint64_t               m_rx_start_time;   ///< Time the receiver was started.
+static uint64_t               m_rx_address_time; ///< Time of the end of the SFD of the received frame.
+static uint32_t               m_rx_written;      ///< Number of bytes written to the receive buffer.
+static uint32_t               m_rx_byte;         ///< Index of the next byte ending on the air.
+static bool                   m_bc_running;      ///< Information if the bit counter is running.
+static uint64_t               m_bc_start_time;   ///< Start time of the bit counter.
+static nrf_host_model_timer_t m_rx_byte_timer;   ///< Timer of the end of the next received byte.
+static nrf_host_model_timer_t m_rx_bc_timer;     ///< Timer of the bit counter match.
+static nrf_host_model_timer_t m_rx_phyend_timer; ///< Timer of the last bit of the received frame.
+static nrf_host_model_timer_t m_rx_end_timer;    ///< Timer of the END event of the received frame.
+
+static uint8_t                m_tx_frame[PHR_SIZE + MAX_PSDU_SIZE]; ///< Frame being transmitted.
+static uint32_t               m_tx_stage;        ///< Next event of the transmitted frame.
+static uint64_t               m_tx_start_time;   ///< Time the transmission was started.
+static nrf_host_model_timer_t m_tx_timer;        ///< Timer of the next event of the transmitted frame.
+
+static nrf_host_radio_tx_handler_t m_tx_handler;   ///< Handler of the transmitted frames.
+static void                      * mp_tx_context;  ///< Context of the handler of the transmitted frames.
+
+static void task_handler(nrf_host_periph_t * p_periph, uint32_t offset);
+
+/***************************************************************************************************
+ * @section Helpers
+ **************************************************************************************************/
+
+static uint64_t now(void)
+{
+    return nrf_host_sim_time_get();
+}
+
+static void event_generate(nrf_radio_event_t event)
+{
+    nrf_host_periph_event_generate(&m_periph, event, true);
+
+    for (uint32_t i = 0; i < sizeof(m_shorts_table) / sizeof(m_shorts_table[0]); i++)
+    {
+        if ((m_shorts_table[i].event == event) && (m_shorts & m_shorts_table[i].mask))
+        {
+            task_handler(&m_periph, m_shorts_table[i].task);
+        }
+    }
+}
+
+static uint64_t frame_duration_get(uint8_t psdu_length)
+{
+    return SHR_TIME + (uint64_t)(PHR_SIZE + psdu_length) * BYTE_TIME;
+}
+
+static uint8_t sample_get(int32_t value)
+{
+    if (value < 0)
+    {
+        return 0;
+    }
+
+    return (value > SAMPLE_MAX) ? SAMPLE_MAX : (uint8_t)value;
+}
+
+/** Gets the power of the strongest frame on the air on the current frequency in the given time. */
+static int32_t energy_get(uint64_t start, uint64_t end, bool * p_carrier)
+{
+    int32_t result = NOISE_FLOOR_DBM;
+
+    if (p_carrier != NULL)
+    {
+        *p_carrier = false;
+    }
+
+    for (uint32_t i = 0; i < AIR_FRAMES_NUM; i++)
+    {
+        const air_frame_t * p_frame = &m_air_frames[i];
+
+        if (!p_frame->in_use ||
+            (p_frame->frequency != m_frequency) ||
+            (p_frame->start_time > end) ||
+            (p_frame->end_time <= start))
+        {
+            continue;
+        }
+
+        if (p_frame->power > result)
+        {
+            result = p_frame->power;
+        }
+
+        if ((p_carrier != NULL) && (p_frame->power >= SENSITIVITY_DBM))
+        {
+            *p_carrier = true;
+        }
+    }
+
+    return result;
+}
+
+static double dbm_to_mw(int32_t dbm)
+{
+    return pow(10.0, dbm / 10.0);
+}
+
+/** Checks if the frames overlapping the given frame on its frequency prevent its reception. */
+static bool frame_interfered(const air_frame_t * p_frame)
+{
+    double noise = dbm_to_mw(NOISE_FLOOR_DBM);
+
+    for (uint32_t i = 0; i < AIR_FRAMES_NUM; i++)
+    {
+        const air_frame_t * p_other = &m_air_frames[i];
+
+        if ((p_other == p_frame) ||
+            !p_other->in_use ||
+            (p_other->frequency != p_frame->frequency) ||
+            (p_other->start_time >= p_frame->end_time) ||
+            (p_other->end_time <= p_frame->start_time))
+        {
+            continue;
+        }
+
+        noise += dbm_to_mw(p_other->power);
+    }
+
+    return dbm_to_mw(p_frame->power) < noise * dbm_to_mw(SENSITIVITY_DBM - NOISE_FLOOR_DBM);
+}
+
+static uint16_t fcs_calculate(const uint8_t * p_data, uint32_t length)
+{
+    uint16_t crc = 0;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        crc ^= p_data[i];
+
+        for (uint32_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? ((crc >> 1) ^ FCS_POLYNOMIAL) : (crc >> 1);
+        }
+    }
+
+    return crc;
+}
+
+/***************************************************************************************************
+ * @section Reception
+ **************************************************************************************************/
+
+/** Writes the bytes of the received frame that have ended on the air to the receive buffer. */
+static void rx_dma_sync(void)
+{
+    uint32_t length = PHR_SIZE + mp_rx_frame->data[0];
+    uint32_t ended  = (uint32_t)((now() - m_rx_address_time) / BYTE_TIME);
+
+    if (ended > length)
+    {
+        ended = length;
+    }
+
+    if (length > PHR_SIZE + (uint32_t)m_max_length)
+    {
+        length = PHR_SIZE + m_max_length;
+    }
+
+    for (; (m_rx_written < ended) && (m_rx_written < length); m_rx_written++)
+    {
+        mp_rx_buffer[m_rx_written] = mp_rx_frame->data[m_rx_written];
+    }
+}
+
+static void rx_abort(void)
+{
+    nrf_host_model_timer_stop(&m_rx_byte_timer);
+    nrf_host_model_timer_stop(&m_rx_bc_timer);
+    nrf_host_model_timer_stop(&m_rx_phyend_timer);
+    nrf_host_model_timer_stop(&m_rx_end_timer);
+
+    mp_rx_frame  = NULL;
+    m_bc_running = false;
+}
+
+static void rx_end_handler(void * p_context)
+{
+    uint8_t length = mp_rx_frame->data[0];
+
+    (void)p_context;
+
+    rx_dma_sync();
+
+    // The RADIO stores the LQI in place of the FCS.
+    if (length >= FCS_SIZE)
+    {
+        mp_rx_buffer[length - 1] = mp_rx_frame->lqi;
+    }
+
+    m_crc_ok = mp_rx_frame->crc_ok && !frame_interfered(mp_rx_frame);
+
+    rx_abort();
+
+    m_state = NRF_RADIO_STATE_RXIDLE;
+
+    event_generate(m_crc_ok ? NRF_RADIO_EVENT_CRCOK : NRF_RADIO_EVENT_CRCERROR);
+    event_generate(NRF_RADIO_EVENT_END);
+}
+
+static void rx_phyend_handler(void * p_context)
+{
+    (void)p_context;
+
+    event_generate(NRF_RADIO_EVENT_PHYEND);
+}
+
+static void rx_bc_handler(void * p_context)
+{
+    (void)p_context;
+
+    rx_dma_sync();
+    event_generate(NRF_RADIO_EVENT_BCMATCH);
+}
+
+static void rx_bc_schedule(void)
+{
+    uint64_t match_time = m_bc_start_time + (uint64_t)m_bcc * BIT_TIME;
+
+    nrf_host_model_timer_stop(&m_rx_bc_timer);
+
+    // The bit counter matches only when it reaches BCC, not when BCC is set below its value.
+    if (m_bc_running && (mp_rx_frame != NULL) && (match_time >= now()) &&
+        (match_time <= mp_rx_frame->end_time))
+    {
+        nrf_host_model_timer_start(&m_rx_bc_timer, match_time, rx_bc_handler, NULL);
+    }
+}
+
+static void rx_byte_handler(void * p_context)
+{
+    uint32_t byte   = m_rx_byte++;
+    uint32_t length = PHR_SIZE + mp_rx_frame->data[0];
+
+    (void)p_context;
+
+    rx_dma_sync();
+
+    if (byte == 0)
+    {
+        event_generate(NRF_RADIO_EVENT_FRAMESTART);
+    }
+    else if (byte == MHR_MATCH_SIZE - 1)
+    {
+        uint32_t mhr = (uint32_t)mp_rx_frame->data[0] |
+                       ((uint32_t)mp_rx_frame->data[1] << 8) |
+                       ((uint32_t)mp_rx_frame->data[2] << 16) |
+                       ((uint32_t)mp_rx_frame->data[3] << 24);
+
+        if (((mhr ^ m_mhmu_pattern) & m_mhmu_mask) == 0)
+        {
+            event_generate(NRF_RADIO_EVENT_MHRMATCH);
+        }
+    }
+
+    // The handlers of the events may have stopped the reception.
+    if ((mp_rx_frame != NULL) && (m_rx_byte < length))
+    {
+        nrf_host_model_timer_start(&m_rx_byte_timer,
+                                   m_rx_address_time + (uint64_t)(m_rx_byte + 1) * BYTE_TIME,
+                                   rx_byte_handler,
+                                   NULL);
+    }
+}
+
+static void frame_sync_handler(void * p_context)
+{
+    air_frame_t * p_frame = p_context;
+
+    if ((m_state != NRF_RADIO_STATE_RX) ||
+        (mp_rx_frame != NULL) ||
+        (p_frame->frequency != m_frequency) ||
+        (p_frame->power < SENSITIVITY_DBM) ||
+        (m_rx_start_time + RX_SYNC_TIME > p_frame->start_time + PREAMBLE_TIME))
+    {
+        return;
+    }
+
+    mp_rx_frame       = p_frame;
+    m_rx_address_time = now();
+    m_rx_written      = 0;
+    m_rx_byte         = 0;
+
+    nrf_host_model_timer_start(&m_rx_byte_timer,
+                               m_rx_address_time + BYTE_TIME,
+                               rx_byte_handler,
+                               NULL);
+    nrf_host_model_timer_start(&m_rx_phyend_timer, p_frame->end_time, rx_phyend_handler, NULL);
+    nrf_host_model_timer_start(&m_rx_end_timer,
+                               p_frame->end_time + RX_END_LATENCY,
+                               rx_end_handler,
+                               NULL);
+
+    event_generate(NRF_RADIO_EVENT_ADDRESS);
+}
+
+/***************************************************************************************************
+ * @section Transmission
+ **************************************************************************************************/
+
+static void tx_handler(void * p_context)
+{
+    uint8_t length = m_tx_frame[0];
+
+    (void)p_context;
+
+    switch (m_tx_stage++)
+    {
+        case 0:
+            nrf_host_model_timer_start(&m_tx_timer,
+                                       m_tx_start_time + SHR_TIME + BYTE_TIME,
+                                       tx_handler,
+                                       NULL);
+            event_generate(NRF_RADIO_EVENT_ADDRESS);
+            break;
+
+        case 1:
+            nrf_host_model_timer_start(&m_tx_timer,
+                                       m_tx_start_time + frame_duration_get(length),
+                                       tx_handler,
+                                       NULL);
+            event_generate(NRF_RADIO_EVENT_FRAMESTART);
+            break;
+
+        default:
+            m_state = NRF_RADIO_STATE_TXIDLE;
+            event_generate(NRF_RADIO_EVENT_END);
+            event_generate(NRF_RADIO_EVENT_PHYEND);
+            break;
+    }
+}
+
+static void tx_start(void)
+{
+    uint8_t                length = mp_packet[0] & MAX_PSDU_SIZE;
+    nrf_host_radio_frame_t frame;
+
+    memcpy(m_tx_frame, mp_packet, PHR_SIZE + length);
+
+    if (length >= FCS_SIZE)
+    {
+        uint16_t fcs = fcs_calculate(&m_tx_frame[PHR_SIZE], length - FCS_SIZE);
+
+        m_tx_frame[length - 1] = (uint8_t)fcs;
+        m_tx_frame[length]     = (uint8_t)(fcs >> 8);
+    }
+
+    m_state         = NRF_RADIO_STATE_TX;
+    m_tx_stage      = 0;
+    m_tx_start_time = now();
+
+    nrf_host_model_timer_start(&m_tx_timer, m_tx_start_time + SHR_TIME, tx_handler, NULL);
+
+    if (m_tx_handler != NULL)
+    {
+        frame.p_data     = m_tx_frame;
+        frame.frequency  = m_frequency;
+        frame.power      = m_tx_power;
+        frame.lqi        = 0;
+        frame.crc_ok     = true;
+        frame.start_time = m_tx_start_time;
+
+        m_tx_handler(&frame, mp_tx_context);
+    }
+}
+
+/***************************************************************************************************
+ * @section Measurements
+ **************************************************************************************************/
+
+static void rssi_handler(void * p_context)
+{
+    (void)p_context;
+
+    m_rssi_sample = sample_get(-energy_get(now(), now(), NULL));
+    event_generate(NRF_RADIO_EVENT_RSSIEND);
+}
+
+static void ed_handler(void * p_context)
+{
+    (void)p_context;
+
+    m_ed_sample = sample_get(energy_get(m_measure_start, now(), NULL) - ED_RSSI_OFFSET_DBM);
+    event_generate(NRF_RADIO_EVENT_EDEND);
+}
+
+static void cca_handler(void * p_context)
+{
+    bool carrier;
+    bool energy;
+    bool busy;
+
+    (void)p_context;
+
+    energy = sample_get(energy_get(m_measure_start, now(), &carrier) - ED_RSSI_OFFSET_DBM) >
+             m_cca_ed_threshold;
+
+    switch (m_cca_mode)
+    {
+        case NRF_RADIO_CCA_MODE_ED:
+            busy = energy;
+            break;
+
+        case NRF_RADIO_CCA_MODE_CARRIER:
+            busy = carrier;
+            break;
+
+        case NRF_RADIO_CCA_MODE_CARRIER_AND_ED:
+            busy = carrier && energy;
+            break;
+
+        case NRF_RADIO_CCA_MODE_CARRIER_OR_ED:
+        default:
+            busy = carrier || energy;
+            break;
+    }
+
+    event_generate(busy ? NRF_RADIO_EVENT_CCABUSY : NRF_RADIO_EVENT_CCAIDLE);
+}
+
+/***************************************************************************************************
+ * @section State machine
+ **************************************************************************************************/
+
+static void ramp_up_handler(void * p_context)
+{
+    bool tx = (m_state == NRF_RADIO_STATE_TXRU);
+
+    (void)p_context;
+
+    m_state = tx ? NRF_RADIO_STATE_TXIDLE : NRF_RADIO_STATE_RXIDLE;
+
+    event_generate(NRF_RADIO_EVENT_READY);
+    event_generate(tx ? NRF_RADIO_EVENT_TXREADY : NRF_RADIO_EVENT_RXREADY);
+}
+
+static void disabled_handler(void * p_context)
+{
+    (void)p_context;
+
+    m_state = NRF_RADIO_STATE_DISABLED;
+    event_generate(NRF_RADIO_EVENT_DISABLED);
+}
+
+/** Stops all the activities of the RADIO without generating any events. */
+static void activity_abort(void)
+{
+    rx_abort();
+
+    nrf_host_model_timer_stop(&m_ramp_timer);
+    nrf_host_model_timer_stop(&m_rssi_timer);
+    nrf_host_model_timer_stop(&m_measure_timer);
+    nrf_host_model_timer_stop(&m_tx_timer);
+}
+
+static void ramp_up(nrf_radio_state_t state)
+{
+    activity_abort();
+
+    m_state = state;
+    nrf_host_model_timer_start(&m_ramp_timer,
+                               now() + (m_fast_ramp_up ? RAMP_UP_FAST_TIME : RAMP_UP_TIME),
+                               ramp_up_handler,
+                               NULL);
+}
+
+static void disable(void)
+{
+    switch (m_state)
+    {
+        case NRF_RADIO_STATE_DISABLED:
+            event_generate(NRF_RADIO_EVENT_DISABLED);
+            break;
+
+        case NRF_RADIO_STATE_RXRU:
+        case NRF_RADIO_STATE_RXIDLE:
+        case NRF_RADIO_STATE_RX:
+            activity_abort();
+            m_state = NRF_RADIO_STATE_RXDISABLE;
+            nrf_host_model_timer_start(&m_ramp_timer,
+                                       now() + RX_DISABLE_TIME,
+                                       disabled_handler,
+                                       NULL);
+            break;
+
+        case NRF_RADIO_STATE_TXRU:
+        case NRF_RADIO_STATE_TXIDLE:
+        case NRF_RADIO_STATE_TX:
+            activity_abort();
+            m_state = NRF_RADIO_STATE_TXDISABLE;
+            nrf_host_model_timer_start(&m_ramp_timer,
+                                       now() + TX_DISABLE_TIME,
+                                       disabled_handler,
+                                       NULL);
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void task_handler(nrf_host_periph_t * p_periph, uint32_t offset)
+{
+    bool rx_on = (m_state == NRF_RADIO_STATE_RXIDLE) || (m_state == NRF_RADIO_STATE_RX);
+
+    (void)p_periph;
+
+    switch (offset)
+    {
+        case NRF_RADIO_TASK_TXEN:
+            if ((m_state == NRF_RADIO_STATE_DISABLED) || (m_state == NRF_RADIO_STATE_RXIDLE))
+            {
+                ramp_up(NRF_RADIO_STATE_TXRU);
+            }
+            break;
+
+        case NRF_RADIO_TASK_RXEN:
+            if ((m_state == NRF_RADIO_STATE_DISABLED) || (m_state == NRF_RADIO_STATE_TXIDLE))
+            {
+                ramp_up(NRF_RADIO_STATE_RXRU);
+            }
+            break;
+
+        case NRF_RADIO_TASK_START:
+            if (m_state == NRF_RADIO_STATE_TXIDLE)
+            {
+                tx_start();
+            }
+            else if (m_state == NRF_RADIO_STATE_RXIDLE)
+            {
+                mp_rx_buffer    = (uint8_t *)mp_packet;
+                m_state         = NRF_RADIO_STATE_RX;
+                m_rx_start_time = now();
+            }
+            break;
+
+        case NRF_RADIO_TASK_STOP:
+            if (m_state == NRF_RADIO_STATE_TX)
+            {
+                nrf_host_model_timer_stop(&m_tx_timer);
+                m_state = NRF_RADIO_STATE_TXIDLE;
+            }
+            else if (m_state == NRF_RADIO_STATE_RX)
+            {
+                rx_abort();
+                m_state = NRF_RADIO_STATE_RXIDLE;
+            }
+            break;
+
+        case NRF_RADIO_TASK_DISABLE:
+            disable();
+            break;
+
+        case NRF_RADIO_TASK_RSSISTART:
+            if (rx_on)
+            {
+                nrf_host_model_timer_start(&m_rssi_timer, now() + RSSI_TIME, rssi_handler, NULL);
+            }
+            break;
+
+        case NRF_RADIO_TASK_RSSISTOP:
+            nrf_host_model_timer_stop(&m_rssi_timer);
+            break;
+
+        case NRF_RADIO_TASK_BCSTART:
+            if (mp_rx_frame != NULL)
+            {
+                m_bc_running    = true;
+                m_bc_start_time = now();
+                rx_bc_schedule();
+            }
+            break;
+
+        case NRF_RADIO_TASK_BCSTOP:
+            m_bc_running = false;
+            rx_bc_schedule();
+            break;
+
+        case NRF_RADIO_TASK_EDSTART:
+            if (m_state == NRF_RADIO_STATE_RXIDLE)
+            {
+                m_measure_start = now();
+                nrf_host_model_timer_start(&m_measure_timer,
+                                           m_measure_start + (m_ed_count + 1) * ED_TIME,
+                                           ed_handler,
+                                           NULL);
+            }
+            break;
+
+        case NRF_RADIO_TASK_CCASTART:
+            if (m_state == NRF_RADIO_STATE_RXIDLE)
+            {
+                m_measure_start = now();
+                nrf_host_model_timer_start(&m_measure_timer,
+                                           m_measure_start + CCA_TIME,
+                                           cca_handler,
+                                           NULL);
+            }
+            break;
+
+        case NRF_RADIO_TASK_EDSTOP:
+        case NRF_RADIO_TASK_CCASTOP:
+            if (m_measure_timer.running)
+            {
+                nrf_host_model_timer_stop(&m_measure_timer);
+                event_generate((offset == NRF_RADIO_TASK_EDSTOP) ? NRF_RADIO_EVENT_EDSTOPPED :
+                               NRF_RADIO_EVENT_CCASTOPPED);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/** Resets the registers of the RADIO. The frames on the air are kept. */
+static void radio_reset(void)
+{
+    activity_abort();
+
+    m_periph.events    = 0;
+    m_periph.inten     = 0;
+    m_state            = NRF_RADIO_STATE_DISABLED;
+    m_shorts           = 0;
+    mp_packet          = NULL;
+    m_frequency        = 2402;
+    m_tx_power         = 0;
+    m_fast_ramp_up     = false;
+    m_max_length       = MAX_PSDU_SIZE;
+    m_bcc              = 0;
+    m_mhmu_pattern     = 0;
+    m_mhmu_mask        = 0;
+    m_ed_count         = 0;
+    m_ed_sample        = 0;
+    m_rssi_sample      = 0;
+    m_crc_ok           = false;
+    m_cca_mode         = NRF_RADIO_CCA_MODE_ED;
+    m_cca_ed_threshold = 0;
+}
+
+/***************************************************************************************************
+ * @section Model API
+ **************************************************************************************************/
+
+void nrf_host_radio_init(void)
+{
+    // The timer queue is emptied by the kernel.
+    memset(m_air_frames, 0, sizeof(m_air_frames));
+    memset(&m_ramp_timer, 0, sizeof(m_ramp_timer));
+    memset(&m_rssi_timer, 0, sizeof(m_rssi_timer));
+    memset(&m_measure_timer, 0, sizeof(m_measure_timer));
+    memset(&m_rx_byte_timer, 0, sizeof(m_rx_byte_timer));
+    memset(&m_rx_bc_timer, 0, sizeof(m_rx_bc_timer));
+    memset(&m_rx_phyend_timer, 0, sizeof(m_rx_phyend_timer));
+    memset(&m_rx_end_timer, 0, sizeof(m_rx_end_timer));
+    memset(&m_tx_timer, 0, sizeof(m_tx_timer));
+
+    m_tx_handler  = NULL;
+    mp_tx_context = NULL;
+
+    m_periph.base         = NRF_RADIO_BASE;
+    m_periph.irqn         = RADIO_IRQn;
+    m_periph.task_handler = task_handler;
+
+    nrf_host_periph_register(&m_periph);
+    radio_reset();
+}
+
+void nrf_host_radio_tx_handler_set(nrf_host_radio_tx_handler_t handler, void * p_context)
+{
+    m_tx_handler  = handler;
+    mp_tx_context = p_context;
+}
+
+void nrf_host_radio_frame_inject(const nrf_host_radio_frame_t * p_frame)
+{
+    uint8_t       length  = p_frame->p_data[0] & MAX_PSDU_SIZE;
+    air_frame_t * p_entry = NULL;
+
+    for (uint32_t i = 0; i < AIR_FRAMES_NUM; i++)
+    {
+        air_frame_t * p_candidate = &m_air_frames[i];
+
+        // The frames overlapping the received frame are kept until its end, as they interfere.
+        if (!p_candidate->in_use ||
+            ((p_candidate->end_time < now()) &&
+             ((mp_rx_frame == NULL) || (p_candidate->end_time <= mp_rx_frame->start_time))))
+        {
+            p_entry = p_candidate;
+            break;
+        }
+    }
+
+    assert(p_entry != NULL);
+
+    memcpy(p_entry->data, p_frame->p_data, PHR_SIZE + length);
+    p_entry->data[0]    = length;
+    p_entry->frequency  = p_frame->frequency;
+    p_entry->power      = p_frame->power;
+    p_entry->lqi        = p_frame->lqi;
+    p_entry->crc_ok     = p_frame->crc_ok;
+    p_entry->start_time = p_frame->start_time;
+    p_entry->end_time   = p_frame->start_time + frame_duration_get(length);
+    p_entry->in_use     = true;
+
+    nrf_host_model_timer_start(&p_entry->sync_timer,
+                               p_entry->start_time + SHR_TIME,
+                               frame_sync_handler,
+                               p_entry);
+}
+
+uint64_t nrf_host_radio_frame_duration_get(uint8_t psdu_length)
+{
+    return frame_duration_get(psdu_length);
+}
+
+/***************************************************************************************************
+ * @section HAL
+ **************************************************************************************************/
+
+void nrf_radio_task_trigger(nrf_radio_task_t radio_task)
+{
+    nrf_host_sim_access();
+    task_handler(&m_periph, radio_task);
+    nrf_host_sim_irq_dispatch();
+}
+
+uint32_t nrf_radio_task_address_get(nrf_radio_task_t radio_task)
+{
+    return NRF_RADIO_BASE + (uint32_t)radio_task;
+}
+
+void nrf_radio_event_clear(nrf_radio_event_t radio_event)
+{
+    nrf_host_sim_access();
+    m_periph.events &= ~nrf_host_periph_event_mask(radio_event);
+}
+
+bool nrf_radio_event_check(nrf_radio_event_t radio_event)
+{
+    nrf_host_sim_access();
+    return (m_periph.events & nrf_host_periph_event_mask(radio_event)) != 0;
+}
+
+uint32_t nrf_radio_event_address_get(nrf_radio_event_t radio_event)
+{
+    return NRF_RADIO_BASE + (uint32_t)radio_event;
+}
+
+void nrf_radio_shorts_set(uint32_t radio_shorts_mask)
+{
+    nrf_host_sim_access();
+    m_shorts = radio_shorts_mask;
+}
+
+uint32_t nrf_radio_shorts_get(void)
+{
+    nrf_host_sim_access();
+    return m_shorts;
+}
+
+void nrf_radio_int_enable(uint32_t radio_int_mask)
+{
+    nrf_host_sim_access();
+    m_periph.inten |= radio_int_mask;
+    nrf_host_sim_irq_dispatch();
+}
+
+void nrf_radio_int_disable(uint32_t radio_int_mask)
+{
+    nrf_host_sim_access();
+    m_periph.inten &= ~radio_int_mask;
+}
+
+bool nrf_radio_int_enable_check(nrf_radio_int_mask_t radio_int_mask)
+{
+    nrf_host_sim_access();
+    return (m_periph.inten & radio_int_mask) != 0;
+}
+
+bool nrf_radio_crc_status_check(void)
+{
+    nrf_host_sim_access();
+    return m_crc_ok;
+}
+
+void nrf_radio_packetptr_set(const void * p_packet)
+{
+    nrf_host_sim_access();
+    mp_packet = p_packet;
+}
+
+void nrf_radio_frequency_set(uint16_t radio_frequency)
+{
+    nrf_host_sim_access();
+    m_frequency = radio_frequency;
+}
+
+void nrf_radio_txpower_set(nrf_radio_txpower_t tx_power)
+{
+    nrf_host_sim_access();
+    m_tx_power = (int8_t)tx_power;
+}
+
+void nrf_radio_mode_set(nrf_radio_mode_t radio_mode)
+{
+    nrf_host_sim_access();
+    assert(radio_mode == NRF_RADIO_MODE_IEEE802154_250KBIT);
+}
+
+void nrf_radio_packet_configure(const nrf_radio_packet_conf_t * p_config)
+{
+    nrf_host_sim_access();
+    m_max_length = p_config->maxlen;
+}
+
+void nrf_radio_crc_configure(uint8_t              crc_length,
+                             nrf_radio_crc_addr_t crc_address,
+                             uint32_t             crc_polynominal)
+{
+    (void)crc_length;
+    (void)crc_address;
+    (void)crc_polynominal;
+
+    nrf_host_sim_access();
+}
+
+uint8_t nrf_radio_rssi_sample_get(void)
+{
+    nrf_host_sim_access();
+    return m_rssi_sample;
+}
+
+nrf_radio_state_t nrf_radio_state_get(void)
+{
+    nrf_host_sim_access();
+    return m_state;
+}
+
+void nrf_radio_modecnf0_set(bool fast_ramp_up, uint8_t default_tx)
+{
+    (void)default_tx;
+
+    nrf_host_sim_access();
+    m_fast_ramp_up = fast_ramp_up;
+}
+
+void nrf_radio_power_set(bool radio_power)
+{
+    nrf_host_sim_access();
+
+    if (!radio_power)
+    {
+        radio_reset();
+    }
+}
+
+void nrf_radio_bcc_set(uint32_t radio_bcc)
+{
+    nrf_host_sim_access();
+    m_bcc = radio_bcc;
+    rx_bc_schedule();
+}
+
+uint32_t nrf_radio_bcc_get(void)
+{
+    nrf_host_sim_access();
+    return m_bcc;
+}
+
+void nrf_radio_ed_loop_count_set(uint32_t ed_loop_count)
+{
+    nrf_host_sim_access();
+    m_ed_count = ed_loop_count;
+}
+
+uint8_t nrf_radio_ed_sample_get(void)
+{
+    nrf_host_sim_access();
+    return m_ed_sample;
+}
+
+void nrf_radio_cca_configure(nrf_radio_cca_mode_t cca_mode,
+                             uint8_t              cca_ed_threshold,
+                             uint8_t              cca_corr_threshold,
+                             uint8_t              cca_corr_cnt)
+{
+    (void)cca_corr_threshold;
+    (void)cca_corr_cnt;
+
+    nrf_host_sim_access();
+    m_cca_mode         = cca_mode;
+    m_cca_ed_threshold = cca_ed_threshold;
+}
+
+void nrf_radio_mhmu_search_pattern_set(uint32_t radio_mhmu_search_pattern)
+{
+    nrf_host_sim_access();
+    m_mhmu_pattern = radio_mhmu_search_pattern;
+}
+
+void nrf_radio_mhmu_pattern_mask_set(uint32_t radio_mhmu_pattern_mask)
+{
+    nrf_host_sim_access();
+    m_mhmu_mask = radio_mhmu_pattern_mask;
+}
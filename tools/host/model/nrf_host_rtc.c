@@ -0,0 +1,306 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the RTC model of the host peripheral model.
+ *
+ * The counter is derived from the virtual clock since the last change of its value, at the exact
+ * 32.768 kHz frequency. An event is generated only if it is enabled in EVTEN or INTEN, and it is
+ * published to the PPI only if it is enabled in EVTEN, as on the device. The TICK event is not
+ * modeled.
+ *
+ */
+
+#include "nrf_host_periph.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nrf.h>
+#include <nrf_rtc.h>
+
+#define RTC_NUM          3                      ///< Number of the RTC instances.
+#define CC_NUM           4                      ///< Number of the compare registers of an instance.
+#define COUNTER_MASK     0xFFFFFFUL             ///< Mask of the 24-bit counter.
+#define RTC_FREQUENCY    32768ULL               ///< Frequency of the low-frequency clock, in Hz.
+#define NS_PER_S         1000000000ULL          ///< Number of nanoseconds in a second.
+#define OVERFLOW_TRIGGER (COUNTER_MASK - 0xFUL) ///< Counter value set by the TRIGOVRFLW task.
+
+/** @brief RTC instance. */
+struct nrf_host_rtc_s
+{
+    nrf_host_periph_t      periph;        ///< Common part of the peripheral.
+    nrf_host_model_timer_t compare_timer; ///< Timer of the nearest compare match or overflow.
+    uint32_t               prescaler;     ///< PRESCALER register.
+    uint32_t               evten;         ///< EVTEN register.
+    uint32_t               cc[CC_NUM];    ///< CC registers.
+    bool                   running;       ///< Information if the RTC is started.
+    uint32_t               count_ref;     ///< Counter value at the reference time.
+    uint64_t               time_ref;      ///< Time of the last change of the counter, in nanoseconds.
+};
+
+NRF_RTC_Type nrf_host_rtc0;
+NRF_RTC_Type nrf_host_rtc1;
+NRF_RTC_Type nrf_host_rtc2;
+
+static NRF_RTC_Type * const mp_rtcs[RTC_NUM] = {&nrf_host_rtc0, &nrf_host_rtc1, &nrf_host_rtc2};
+
+static const uint32_t m_rtc_bases[RTC_NUM] = {NRF_RTC0_BASE, NRF_RTC1_BASE, NRF_RTC2_BASE};
+static const int32_t  m_rtc_irqns[RTC_NUM] = {RTC0_IRQn, RTC1_IRQn, RTC2_IRQn};
+
+/** Gets the number of ticks between the reference time and the given time. */
+static uint64_t ticks_get(const NRF_RTC_Type * p_reg, uint64_t time)
+{
+    unsigned __int128 dt = time - p_reg->time_ref;
+
+    return (uint64_t)(dt * RTC_FREQUENCY / (NS_PER_S * (p_reg->prescaler + 1)));
+}
+
+/** Gets the time of the given tick after the reference time. */
+static uint64_t tick_time_get(const NRF_RTC_Type * p_reg, uint64_t ticks)
+{
+    unsigned __int128 dt = (unsigned __int128)ticks * NS_PER_S * (p_reg->prescaler + 1);
+
+    return p_reg->time_ref + (uint64_t)((dt + RTC_FREQUENCY - 1) / RTC_FREQUENCY);
+}
+
+static uint32_t counter_get(const NRF_RTC_Type * p_reg)
+{
+    uint64_t ticks = p_reg->running ? ticks_get(p_reg, nrf_host_sim_time_get()) : 0;
+
+    return (uint32_t)((p_reg->count_ref + ticks) & COUNTER_MASK);
+}
+
+/** Sets the counter value at the current time. */
+static void counter_set(NRF_RTC_Type * p_reg, uint32_t value)
+{
+    p_reg->count_ref = value & COUNTER_MASK;
+    p_reg->time_ref  = nrf_host_sim_time_get();
+}
+
+/** Gets the number of ticks until the counter increments to the given value. */
+static uint32_t ticks_to_value_get(uint32_t counter, uint32_t value)
+{
+    uint32_t dt = (value - counter) & COUNTER_MASK;
+
+    return (dt == 0) ? (COUNTER_MASK + 1) : dt;
+}
+
+static void event_generate(NRF_RTC_Type * p_reg, nrf_rtc_event_t event)
+{
+    uint32_t mask = nrf_host_periph_event_mask(event);
+
+    if ((p_reg->evten | p_reg->periph.inten) & mask)
+    {
+        nrf_host_periph_event_generate(&p_reg->periph, event, (p_reg->evten & mask) != 0);
+    }
+}
+
+static void compare_schedule(NRF_RTC_Type * p_reg);
+
+static void compare_timer_handler(void * p_context)
+{
+    NRF_RTC_Type * p_reg   = p_context;
+    uint32_t       counter = counter_get(p_reg);
+
+    if (counter == 0)
+    {
+        event_generate(p_reg, NRF_RTC_EVENT_OVERFLOW);
+    }
+
+    for (uint32_t i = 0; i < CC_NUM; i++)
+    {
+        if (p_reg->cc[i] == counter)
+        {
+            event_generate(p_reg, NRF_RTC_EVENT_COMPARE_0 + i * sizeof(uint32_t));
+        }
+    }
+
+    compare_schedule(p_reg);
+}
+
+/** Schedules the timer of the virtual clock at the nearest compare match or overflow. */
+static void compare_schedule(NRF_RTC_Type * p_reg)
+{
+    uint32_t counter = counter_get(p_reg);
+    uint32_t dt_min  = ticks_to_value_get(counter, 0);
+
+    nrf_host_model_timer_stop(&p_reg->compare_timer);
+
+    if (!p_reg->running)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < CC_NUM; i++)
+    {
+        uint32_t dt = ticks_to_value_get(counter, p_reg->cc[i]);
+
+        if (dt < dt_min)
+        {
+            dt_min = dt;
+        }
+    }
+
+    nrf_host_model_timer_start(&p_reg->compare_timer,
+                               tick_time_get(p_reg,
+                                             ticks_get(p_reg, nrf_host_sim_time_get()) + dt_min),
+                               compare_timer_handler,
+                               p_reg);
+}
+
+static void task_handler(nrf_host_periph_t * p_periph, uint32_t offset)
+{
+    NRF_RTC_Type * p_reg = (NRF_RTC_Type *)p_periph;
+
+    switch (offset)
+    {
+        case NRF_RTC_TASK_START:
+            if (!p_reg->running)
+            {
+                counter_set(p_reg, p_reg->count_ref);
+                p_reg->running = true;
+            }
+            break;
+
+        case NRF_RTC_TASK_STOP:
+            counter_set(p_reg, counter_get(p_reg));
+            p_reg->running = false;
+            break;
+
+        case NRF_RTC_TASK_CLEAR:
+            counter_set(p_reg, 0);
+            break;
+
+        case NRF_RTC_TASK_TRIGGER_OVERFLOW:
+            counter_set(p_reg, OVERFLOW_TRIGGER);
+            break;
+
+        default:
+            break;
+    }
+
+    compare_schedule(p_reg);
+}
+
+void nrf_host_rtc_init(void)
+{
+    for (uint32_t i = 0; i < RTC_NUM; i++)
+    {
+        NRF_RTC_Type * p_reg = mp_rtcs[i];
+
+        // The timer queue is emptied by the kernel.
+        memset(p_reg, 0, sizeof(*p_reg));
+
+        p_reg->periph.base         = m_rtc_bases[i];
+        p_reg->periph.irqn         = m_rtc_irqns[i];
+        p_reg->periph.task_handler = task_handler;
+
+        nrf_host_periph_register(&p_reg->periph);
+    }
+}
+
+void nrf_rtc_cc_set(NRF_RTC_Type * p_reg, uint32_t ch, uint32_t cc_val)
+{
+    nrf_host_sim_access();
+    p_reg->cc[ch] = cc_val & COUNTER_MASK;
+    compare_schedule(p_reg);
+}
+
+void nrf_rtc_int_enable(NRF_RTC_Type * p_reg, uint32_t mask)
+{
+    nrf_host_sim_access();
+    p_reg->periph.inten |= mask;
+    nrf_host_sim_irq_dispatch();
+}
+
+void nrf_rtc_int_disable(NRF_RTC_Type * p_reg, uint32_t mask)
+{
+    nrf_host_sim_access();
+    p_reg->periph.inten &= ~mask;
+}
+
+uint32_t nrf_rtc_int_is_enabled(NRF_RTC_Type * p_reg, uint32_t mask)
+{
+    nrf_host_sim_access();
+    return p_reg->periph.inten & mask;
+}
+
+uint32_t nrf_rtc_event_pending(NRF_RTC_Type * p_reg, nrf_rtc_event_t event)
+{
+    nrf_host_sim_access();
+    return (p_reg->periph.events & nrf_host_periph_event_mask(event)) ? 1 : 0;
+}
+
+void nrf_rtc_event_clear(NRF_RTC_Type * p_reg, nrf_rtc_event_t event)
+{
+    nrf_host_sim_access();
+    p_reg->periph.events &= ~nrf_host_periph_event_mask(event);
+}
+
+uint32_t nrf_rtc_counter_get(NRF_RTC_Type * p_reg)
+{
+    nrf_host_sim_access();
+    return counter_get(p_reg);
+}
+
+void nrf_rtc_prescaler_set(NRF_RTC_Type * p_reg, uint32_t val)
+{
+    nrf_host_sim_access();
+    counter_set(p_reg, counter_get(p_reg));
+    p_reg->prescaler = val;
+    compare_schedule(p_reg);
+}
+
+uint32_t nrf_rtc_event_address_get(NRF_RTC_Type * p_reg, nrf_rtc_event_t event)
+{
+    return p_reg->periph.base + (uint32_t)event;
+}
+
+void nrf_rtc_task_trigger(NRF_RTC_Type * p_reg, nrf_rtc_task_t task)
+{
+    nrf_host_sim_access();
+    task_handler(&p_reg->periph, task);
+    nrf_host_sim_irq_dispatch();
+}
+
+void nrf_rtc_event_enable(NRF_RTC_Type * p_reg, uint32_t mask)
+{
+    nrf_host_sim_access();
+    p_reg->evten |= mask;
+}
+
+void nrf_rtc_event_disable(NRF_RTC_Type * p_reg, uint32_t event)
+{
+    nrf_host_sim_access();
+    p_reg->evten &= ~event;
+}
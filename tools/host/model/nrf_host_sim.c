@@ -0,0 +1,531 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the simulation kernel of the host peripheral model: the virtual clock,
+ *   the peripheral bus, the NVIC and the Cortex-M core registers used by the driver.
+ *
+ */
+
+#include "nrf_host_model.h"
+#include "nrf_host_periph.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <nrf.h>
+
+#define IRQ_NUM               48                        ///< Number of the interrupts of the device.
+#define PERIPH_NUM            16                        ///< Maximum number of the peripherals on the bus.
+#define PERIPH_ADDRESS_MASK   0xFFFFF000UL              ///< Mask of the base address in the address of a register.
+#define THREAD_PRIORITY       (1UL << __NVIC_PRIO_BITS) ///< Execution priority of the thread mode.
+#define VECTACTIVE_IRQ_OFFSET 16                        ///< Difference between the active vector and the interrupt number.
+#define ACCESS_TIME_DEFAULT   250                       ///< Default CPU time of a peripheral access, in nanoseconds.
+#define CPU_FREQUENCY         64000000UL                ///< Frequency of the cycle counter, in Hz.
+
+/***************************************************************************************************
+ * @section Interrupt handlers
+ **************************************************************************************************/
+
+void nrf_host_default_handler(void);
+
+#define IRQ_HANDLER_DECLARE(name) void name(void) __attribute__((weak, alias("nrf_host_default_handler")))
+
+IRQ_HANDLER_DECLARE(POWER_CLOCK_IRQHandler);
+IRQ_HANDLER_DECLARE(RADIO_IRQHandler);
+IRQ_HANDLER_DECLARE(TIMER0_IRQHandler);
+IRQ_HANDLER_DECLARE(TIMER1_IRQHandler);
+IRQ_HANDLER_DECLARE(TIMER2_IRQHandler);
+IRQ_HANDLER_DECLARE(RTC0_IRQHandler);
+IRQ_HANDLER_DECLARE(RNG_IRQHandler);
+IRQ_HANDLER_DECLARE(RTC1_IRQHandler);
+IRQ_HANDLER_DECLARE(SWI0_EGU0_IRQHandler);
+IRQ_HANDLER_DECLARE(SWI1_EGU1_IRQHandler);
+IRQ_HANDLER_DECLARE(SWI2_EGU2_IRQHandler);
+IRQ_HANDLER_DECLARE(SWI3_EGU3_IRQHandler);
+IRQ_HANDLER_DECLARE(SWI4_EGU4_IRQHandler);
+IRQ_HANDLER_DECLARE(SWI5_EGU5_IRQHandler);
+IRQ_HANDLER_DECLARE(RTC2_IRQHandler);
+
+static void (* const m_vectors[IRQ_NUM])(void) =
+{
+    [POWER_CLOCK_IRQn] = POWER_CLOCK_IRQHandler,
+    [RADIO_IRQn]       = RADIO_IRQHandler,
+    [TIMER0_IRQn]      = TIMER0_IRQHandler,
+    [TIMER1_IRQn]      = TIMER1_IRQHandler,
+    [TIMER2_IRQn]      = TIMER2_IRQHandler,
+    [RTC0_IRQn]        = RTC0_IRQHandler,
+    [RNG_IRQn]         = RNG_IRQHandler,
+    [RTC1_IRQn]        = RTC1_IRQHandler,
+    [SWI0_EGU0_IRQn]   = SWI0_EGU0_IRQHandler,
+    [SWI1_EGU1_IRQn]   = SWI1_EGU1_IRQHandler,
+    [SWI2_EGU2_IRQn]   = SWI2_EGU2_IRQHandler,
+    [SWI3_EGU3_IRQn]   = SWI3_EGU3_IRQHandler,
+    [SWI4_EGU4_IRQn]   = SWI4_EGU4_IRQHandler,
+    [SWI5_EGU5_IRQn]   = SWI5_EGU5_IRQHandler,
+    [RTC2_IRQn]        = RTC2_IRQHandler,
+};
+
+/***************************************************************************************************
+ * @section Model state
+ **************************************************************************************************/
+
+NVIC_Type      nrf_host_nvic;
+SCB_Type       nrf_host_scb;
+CoreDebug_Type nrf_host_core_debug;
+NRF_RNG_Type   nrf_host_rng;
+uint32_t       SystemCoreClock = CPU_FREQUENCY;
+
+static DWT_Type                 m_dwt;                  ///< Data Watchpoint and Trace registers.
+static uint64_t                 m_now;                  ///< Current time of the virtual clock, in nanoseconds.
+static uint32_t                 m_access_time;          ///< CPU time of a peripheral access, in nanoseconds.
+static nrf_host_model_timer_t * mp_timers;              ///< Queue of the running timers, sorted by the expiry time.
+static nrf_host_periph_t      * mp_periphs[PERIPH_NUM]; ///< Peripherals on the bus.
+static nrf_host_periph_t      * mp_irq_periphs[IRQ_NUM]; ///< Peripherals generating each interrupt.
+static uint32_t                 m_exec_priority;        ///< Execution priority of the running context.
+static bool                     m_primask;              ///< PRIMASK register.
+static bool                     m_excl_monitor;         ///< Exclusive monitor of the LDREX and STREX instructions.
+
+/***************************************************************************************************
+ * @section Virtual clock
+ **************************************************************************************************/
+
+static void timer_remove(nrf_host_model_timer_t * p_timer)
+{
+    nrf_host_model_timer_t ** pp_timer = &mp_timers;
+
+    while (*pp_timer != p_timer)
+    {
+        assert(*pp_timer != NULL);
+        pp_timer = &(*pp_timer)->p_next;
+    }
+
+    *pp_timer         = p_timer->p_next;
+    p_timer->p_next   = NULL;
+    p_timer->running  = false;
+}
+
+/** Runs the timers expiring before the given time and sets the clock to that time. */
+static void time_advance(uint64_t time)
+{
+    while ((mp_timers != NULL) && (mp_timers->time <= time))
+    {
+        nrf_host_model_timer_t * p_timer = mp_timers;
+
+        timer_remove(p_timer);
+
+        // The interrupt handlers run by an expired timer may have moved the clock past the next one.
+        if (p_timer->time > m_now)
+        {
+            m_now = p_timer->time;
+        }
+
+        p_timer->handler(p_timer->p_context);
+
+        nrf_host_sim_irq_dispatch();
+    }
+
+    if (time > m_now)
+    {
+        m_now = time;
+    }
+}
+
+uint64_t nrf_host_sim_time_get(void)
+{
+    return m_now;
+}
+
+void nrf_host_sim_access(void)
+{
+    time_advance(m_now + m_access_time);
+    nrf_host_sim_irq_dispatch();
+}
+
+/***************************************************************************************************
+ * @section Peripheral bus
+ **************************************************************************************************/
+
+void nrf_host_periph_register(nrf_host_periph_t * p_periph)
+{
+    for (uint32_t i = 0; i < PERIPH_NUM; i++)
+    {
+        if (mp_periphs[i] == NULL)
+        {
+            mp_periphs[i] = p_periph;
+            break;
+        }
+
+        assert(i < PERIPH_NUM - 1);
+    }
+
+    if (p_periph->irqn != NRF_HOST_PERIPH_NO_IRQ)
+    {
+        assert(p_periph->irqn < IRQ_NUM);
+        mp_irq_periphs[p_periph->irqn] = p_periph;
+    }
+
+    p_periph->events = 0;
+    p_periph->inten  = 0;
+}
+
+void nrf_host_periph_event_generate(nrf_host_periph_t * p_periph, uint32_t offset, bool publish)
+{
+    p_periph->events |= nrf_host_periph_event_mask(offset);
+
+    if (publish)
+    {
+        nrf_host_ppi_event_publish(p_periph->base + offset);
+    }
+}
+
+void nrf_host_bus_task_trigger(uint32_t address)
+{
+    for (uint32_t i = 0; (i < PERIPH_NUM) && (mp_periphs[i] != NULL); i++)
+    {
+        if (mp_periphs[i]->base == (address & PERIPH_ADDRESS_MASK))
+        {
+            mp_periphs[i]->task_handler(mp_periphs[i], address & ~PERIPH_ADDRESS_MASK);
+            break;
+        }
+    }
+}
+
+/***************************************************************************************************
+ * @section NVIC
+ **************************************************************************************************/
+
+static bool irq_bit_get(const volatile uint32_t * p_reg, uint32_t irqn)
+{
+    return (p_reg[irqn / 32] & (1UL << (irqn % 32))) != 0;
+}
+
+static uint32_t irq_priority_get(uint32_t irqn)
+{
+    return nrf_host_nvic.IP[irqn] >> (8 - __NVIC_PRIO_BITS);
+}
+
+static bool irq_is_pending(uint32_t irqn)
+{
+    nrf_host_periph_t * p_periph = mp_irq_periphs[irqn];
+
+    return irq_bit_get(nrf_host_nvic.ISPR, irqn) ||
+           ((p_periph != NULL) && ((p_periph->events & p_periph->inten) != 0));
+}
+
+/** Gets the enabled pending interrupt that preempts the running context, or -1. */
+static int32_t irq_to_handle_get(void)
+{
+    int32_t  result          = -1;
+    uint32_t result_priority = m_exec_priority;
+
+    if (m_primask)
+    {
+        return -1;
+    }
+
+    for (uint32_t irqn = 0; irqn < IRQ_NUM; irqn++)
+    {
+        if (irq_bit_get(nrf_host_nvic.ISER, irqn) &&
+            irq_is_pending(irqn) &&
+            (irq_priority_get(irqn) < result_priority))
+        {
+            result          = (int32_t)irqn;
+            result_priority = irq_priority_get(irqn);
+        }
+    }
+
+    return result;
+}
+
+static void irq_handle(uint32_t irqn)
+{
+    uint32_t exec_priority = m_exec_priority;
+    uint32_t icsr          = nrf_host_scb.ICSR;
+
+    nrf_host_nvic.ISPR[irqn / 32] &= ~(1UL << (irqn % 32));
+
+    m_exec_priority   = irq_priority_get(irqn);
+    nrf_host_scb.ICSR = (icsr & ~SCB_ICSR_VECTACTIVE_Msk) |
+                        ((irqn + VECTACTIVE_IRQ_OFFSET) << SCB_ICSR_VECTACTIVE_Pos);
+    m_excl_monitor    = false;
+
+    m_vectors[irqn]();
+
+    m_excl_monitor    = false;
+    nrf_host_scb.ICSR = icsr;
+    m_exec_priority   = exec_priority;
+}
+
+void nrf_host_sim_irq_dispatch(void)
+{
+    int32_t irqn;
+
+    while ((irqn = irq_to_handle_get()) >= 0)
+    {
+        irq_handle((uint32_t)irqn);
+    }
+}
+
+void nrf_host_default_handler(void)
+{
+    uint32_t vector = (nrf_host_scb.ICSR & SCB_ICSR_VECTACTIVE_Msk) >> SCB_ICSR_VECTACTIVE_Pos;
+
+    fprintf(stderr, "Unhandled interrupt %lu\n", (unsigned long)(vector - VECTACTIVE_IRQ_OFFSET));
+    abort();
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+    nrf_host_sim_access();
+    nrf_host_nvic.ISER[IRQn / 32] |= 1UL << (IRQn % 32);
+    nrf_host_sim_irq_dispatch();
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+    nrf_host_sim_access();
+    nrf_host_nvic.ISER[IRQn / 32] &= ~(1UL << (IRQn % 32));
+}
+
+uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn)
+{
+    nrf_host_sim_access();
+    return irq_is_pending(IRQn) ? 1 : 0;
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+    nrf_host_sim_access();
+    nrf_host_nvic.ISPR[IRQn / 32] |= 1UL << (IRQn % 32);
+    nrf_host_sim_irq_dispatch();
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+    nrf_host_sim_access();
+    nrf_host_nvic.ISPR[IRQn / 32] &= ~(1UL << (IRQn % 32));
+}
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+    nrf_host_sim_access();
+    nrf_host_nvic.IP[IRQn] = (uint8_t)(priority << (8 - __NVIC_PRIO_BITS));
+}
+
+uint32_t NVIC_GetPriority(IRQn_Type IRQn)
+{
+    return irq_priority_get(IRQn);
+}
+
+/***************************************************************************************************
+ * @section Core registers and instructions
+ **************************************************************************************************/
+
+void __disable_irq(void)
+{
+    m_primask = true;
+}
+
+void __enable_irq(void)
+{
+    m_primask = false;
+    nrf_host_sim_irq_dispatch();
+}
+
+uint32_t __get_PRIMASK(void)
+{
+    return m_primask ? 1 : 0;
+}
+
+void __set_PRIMASK(uint32_t primask)
+{
+    if (primask & 1)
+    {
+        __disable_irq();
+    }
+    else
+    {
+        __enable_irq();
+    }
+}
+
+void __CLREX(void)
+{
+    m_excl_monitor = false;
+}
+
+uint8_t __LDREXB(volatile uint8_t * p_addr)
+{
+    m_excl_monitor = true;
+    return *p_addr;
+}
+
+uint32_t __STREXB(uint8_t value, volatile uint8_t * p_addr)
+{
+    if (!m_excl_monitor)
+    {
+        return 1;
+    }
+
+    m_excl_monitor = false;
+    *p_addr        = value;
+    return 0;
+}
+
+uint32_t __LDREXW(volatile uint32_t * p_addr)
+{
+    m_excl_monitor = true;
+    return *p_addr;
+}
+
+uint32_t __STREXW(uint32_t value, volatile uint32_t * p_addr)
+{
+    if (!m_excl_monitor)
+    {
+        return 1;
+    }
+
+    m_excl_monitor = false;
+    *p_addr        = value;
+    return 0;
+}
+
+DWT_Type * nrf_host_dwt_get(void)
+{
+    if (m_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk)
+    {
+        m_dwt.CYCCNT = (uint32_t)(m_now * (CPU_FREQUENCY / 1000000UL) / 1000UL);
+    }
+
+    return &m_dwt;
+}
+
+/***************************************************************************************************
+ * @section Public API
+ **************************************************************************************************/
+
+void nrf_host_model_init(uint32_t seed)
+{
+    memset(&nrf_host_nvic, 0, sizeof(nrf_host_nvic));
+    memset(&nrf_host_scb, 0, sizeof(nrf_host_scb));
+    memset(&nrf_host_core_debug, 0, sizeof(nrf_host_core_debug));
+    memset(&m_dwt, 0, sizeof(m_dwt));
+    memset(mp_periphs, 0, sizeof(mp_periphs));
+    memset(mp_irq_periphs, 0, sizeof(mp_irq_periphs));
+
+    m_now           = 0;
+    m_access_time   = ACCESS_TIME_DEFAULT;
+    mp_timers       = NULL;
+    m_exec_priority = THREAD_PRIORITY;
+    m_primask       = false;
+    m_excl_monitor  = false;
+
+    // The driver reads a single value to seed the pseudo-random generator, so it is ready at once.
+    nrf_host_rng.TASKS_START   = 0;
+    nrf_host_rng.EVENTS_VALRDY = 1;
+    nrf_host_rng.VALUE         = seed;
+
+    nrf_host_clock_init();
+    nrf_host_egu_init();
+    nrf_host_ppi_init();
+    nrf_host_radio_init();
+    nrf_host_rtc_init();
+    nrf_host_timer_init();
+}
+
+uint64_t nrf_host_model_time_get(void)
+{
+    return m_now;
+}
+
+void nrf_host_model_run_until(uint64_t time)
+{
+    assert(m_exec_priority == THREAD_PRIORITY);
+
+    nrf_host_sim_irq_dispatch();
+    time_advance(time);
+}
+
+void nrf_host_model_run_for(uint64_t duration)
+{
+    nrf_host_model_run_until(m_now + duration);
+}
+
+uint64_t nrf_host_model_next_event_time_get(void)
+{
+    return (mp_timers != NULL) ? mp_timers->time : NRF_HOST_MODEL_TIME_NEVER;
+}
+
+void nrf_host_model_access_time_set(uint32_t time)
+{
+    m_access_time = time;
+}
+
+void nrf_host_model_timer_start(nrf_host_model_timer_t * p_timer,
+                                uint64_t                 time,
+                                nrf_host_model_handler_t handler,
+                                void                   * p_context)
+{
+    nrf_host_model_timer_t ** pp_timer = &mp_timers;
+
+    if (p_timer->running)
+    {
+        timer_remove(p_timer);
+    }
+
+    p_timer->time      = time;
+    p_timer->handler   = handler;
+    p_timer->p_context = p_context;
+    p_timer->running   = true;
+
+    // Timers expiring at the same time run in the order they were started.
+    while ((*pp_timer != NULL) && ((*pp_timer)->time <= time))
+    {
+        pp_timer = &(*pp_timer)->p_next;
+    }
+
+    p_timer->p_next = *pp_timer;
+    *pp_timer       = p_timer;
+}
+
+void nrf_host_model_timer_stop(nrf_host_model_timer_t * p_timer)
+{
+    if (p_timer->running)
+    {
+        timer_remove(p_timer);
+    }
+}
@@ -0,0 +1,368 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the TIMER model of the host peripheral model.
+ *
+ * In the timer mode, the counter is derived from the virtual clock since the last change of its
+ * value. A single timer of the virtual clock is scheduled at the nearest compare match. A compare
+ * event is generated when the counter increments to the value of the CC register, as on
+ * the device.
+ *
+ */
+
+#include "nrf_host_periph.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <nrf.h>
+#include <nrf_timer.h>
+
+#define TIMER_NUM        3       ///< Number of the TIMER instances.
+#define CC_NUM           6       ///< Number of the capture/compare registers of an instance.
+#define BASE_FREQUENCY   16      ///< Frequency of the timer clock before the prescaler, in MHz.
+#define NS_PER_US        1000ULL ///< Number of nanoseconds in a microsecond.
+#define SHORT_STOP_SHIFT 8       ///< Position of the COMPARE_STOP shortcuts in the SHORTS register.
+
+/** @brief TIMER instance. */
+struct nrf_host_timer_s
+{
+    nrf_host_periph_t      periph;        ///< Common part of the peripheral.
+    nrf_host_model_timer_t compare_timer; ///< Timer of the nearest compare match.
+    nrf_timer_mode_t       mode;          ///< MODE register.
+    nrf_timer_bit_width_t  bit_width;     ///< BITMODE register.
+    uint32_t               prescaler;     ///< PRESCALER register.
+    uint32_t               shorts;        ///< SHORTS register.
+    uint32_t               cc[CC_NUM];    ///< CC registers.
+    bool                   running;       ///< Information if the timer is started.
+    uint32_t               count_ref;     ///< Counter value at the reference time.
+    uint64_t               time_ref;      ///< Time of the last change of the counter, in nanoseconds.
+};
+
+NRF_TIMER_Type nrf_host_timer0;
+NRF_TIMER_Type nrf_host_timer1;
+NRF_TIMER_Type nrf_host_timer2;
+
+static NRF_TIMER_Type * const mp_timers[TIMER_NUM] =
+{
+    &nrf_host_timer0, &nrf_host_timer1, &nrf_host_timer2,
+};
+
+static uint32_t counter_mask_get(const NRF_TIMER_Type * p_reg)
+{
+    switch (p_reg->bit_width)
+    {
+        case NRF_TIMER_BIT_WIDTH_8:
+            return UINT8_MAX;
+
+        case NRF_TIMER_BIT_WIDTH_24:
+            return 0xFFFFFFUL;
+
+        case NRF_TIMER_BIT_WIDTH_32:
+            return UINT32_MAX;
+
+        case NRF_TIMER_BIT_WIDTH_16:
+        default:
+            return UINT16_MAX;
+    }
+}
+
+static bool is_ticking(const NRF_TIMER_Type * p_reg)
+{
+    return p_reg->running && (p_reg->mode == NRF_TIMER_MODE_TIMER);
+}
+
+/** Gets the number of ticks between the reference time and the given time. */
+static uint64_t ticks_get(const NRF_TIMER_Type * p_reg, uint64_t time)
+{
+    return (time - p_reg->time_ref) * BASE_FREQUENCY / (NS_PER_US << p_reg->prescaler);
+}
+
+/** Gets the time of the given tick after the reference time. */
+static uint64_t tick_time_get(const NRF_TIMER_Type * p_reg, uint64_t ticks)
+{
+    uint64_t period_x16 = NS_PER_US << p_reg->prescaler;
+
+    return p_reg->time_ref + (ticks * period_x16 + BASE_FREQUENCY - 1) / BASE_FREQUENCY;
+}
+
+static uint32_t counter_get(const NRF_TIMER_Type * p_reg)
+{
+    uint64_t ticks = is_ticking(p_reg) ? ticks_get(p_reg, nrf_host_sim_time_get()) : 0;
+
+    return (uint32_t)((p_reg->count_ref + ticks) & counter_mask_get(p_reg));
+}
+
+/** Sets the counter value at the current time. */
+static void counter_set(NRF_TIMER_Type * p_reg, uint32_t value)
+{
+    p_reg->count_ref = value & counter_mask_get(p_reg);
+    p_reg->time_ref  = nrf_host_sim_time_get();
+}
+
+static void compare_schedule(NRF_TIMER_Type * p_reg);
+
+/** Generates the events and executes the shortcuts of the CC registers matching the counter. */
+static void compare_match(NRF_TIMER_Type * p_reg, uint32_t counter)
+{
+    uint32_t mask = counter_mask_get(p_reg);
+
+    for (uint32_t i = 0; i < CC_NUM; i++)
+    {
+        if ((p_reg->cc[i] & mask) != counter)
+        {
+            continue;
+        }
+
+        if (p_reg->shorts & (1UL << (SHORT_STOP_SHIFT + i)))
+        {
+            counter_set(p_reg, counter);
+            p_reg->running = false;
+        }
+
+        if (p_reg->shorts & (1UL << i))
+        {
+            counter_set(p_reg, 0);
+        }
+
+        nrf_host_periph_event_generate(&p_reg->periph,
+                                       NRF_TIMER_EVENT_COMPARE0 + i * sizeof(uint32_t),
+                                       true);
+    }
+}
+
+static void compare_timer_handler(void * p_context)
+{
+    NRF_TIMER_Type * p_reg = p_context;
+
+    compare_match(p_reg, counter_get(p_reg));
+    compare_schedule(p_reg);
+}
+
+/** Schedules the timer of the virtual clock at the nearest compare match. */
+static void compare_schedule(NRF_TIMER_Type * p_reg)
+{
+    uint64_t mask    = counter_mask_get(p_reg);
+    uint64_t ticks   = 0;
+    uint64_t dt_min  = UINT64_MAX;
+    uint32_t counter = counter_get(p_reg);
+
+    nrf_host_model_timer_stop(&p_reg->compare_timer);
+
+    if (!is_ticking(p_reg))
+    {
+        return;
+    }
+
+    ticks = ticks_get(p_reg, nrf_host_sim_time_get());
+
+    for (uint32_t i = 0; i < CC_NUM; i++)
+    {
+        // The counter equal to CC matches only after a wrap-around.
+        uint64_t dt = ((p_reg->cc[i] - counter) & mask);
+
+        if (dt == 0)
+        {
+            dt = mask + 1;
+        }
+
+        if (dt < dt_min)
+        {
+            dt_min = dt;
+        }
+    }
+
+    nrf_host_model_timer_start(&p_reg->compare_timer,
+                               tick_time_get(p_reg, ticks + dt_min),
+                               compare_timer_handler,
+                               p_reg);
+}
+
+static void task_handler(nrf_host_periph_t * p_periph, uint32_t offset)
+{
+    NRF_TIMER_Type * p_reg = (NRF_TIMER_Type *)p_periph;
+
+    switch (offset)
+    {
+        case NRF_TIMER_TASK_START:
+            if (!p_reg->running)
+            {
+                counter_set(p_reg, p_reg->count_ref);
+                p_reg->running = true;
+            }
+            break;
+
+        case NRF_TIMER_TASK_STOP:
+            counter_set(p_reg, counter_get(p_reg));
+            p_reg->running = false;
+            break;
+
+        case NRF_TIMER_TASK_COUNT:
+            if (p_reg->running && (p_reg->mode != NRF_TIMER_MODE_TIMER))
+            {
+                counter_set(p_reg, p_reg->count_ref + 1);
+                compare_match(p_reg, p_reg->count_ref);
+            }
+            break;
+
+        case NRF_TIMER_TASK_CLEAR:
+            counter_set(p_reg, 0);
+            break;
+
+        case NRF_TIMER_TASK_SHUTDOWN:
+            counter_set(p_reg, 0);
+            p_reg->running = false;
+            break;
+
+        default:
+            if ((offset >= NRF_TIMER_TASK_CAPTURE0) && (offset <= NRF_TIMER_TASK_CAPTURE5))
+            {
+                p_reg->cc[(offset - NRF_TIMER_TASK_CAPTURE0) / sizeof(uint32_t)] = counter_get(p_reg);
+            }
+            break;
+    }
+
+    compare_schedule(p_reg);
+}
+
+void nrf_host_timer_init(void)
+{
+    for (uint32_t i = 0; i < TIMER_NUM; i++)
+    {
+        NRF_TIMER_Type * p_reg = mp_timers[i];
+
+        // The timer queue is emptied by the kernel.
+        memset(p_reg, 0, sizeof(*p_reg));
+
+        p_reg->periph.base         = NRF_TIMER0_BASE + i * (NRF_TIMER1_BASE - NRF_TIMER0_BASE);
+        p_reg->periph.irqn         = TIMER0_IRQn + i;
+        p_reg->periph.task_handler = task_handler;
+        p_reg->mode                = NRF_TIMER_MODE_TIMER;
+        p_reg->bit_width           = NRF_TIMER_BIT_WIDTH_16;
+        p_reg->prescaler           = NRF_TIMER_FREQ_1MHz;
+
+        nrf_host_periph_register(&p_reg->periph);
+    }
+}
+
+void nrf_timer_task_trigger(NRF_TIMER_Type * p_reg, nrf_timer_task_t task)
+{
+    nrf_host_sim_access();
+    task_handler(&p_reg->periph, task);
+    nrf_host_sim_irq_dispatch();
+}
+
+uint32_t nrf_timer_task_address_get(NRF_TIMER_Type * p_reg, nrf_timer_task_t task)
+{
+    return p_reg->periph.base + (uint32_t)task;
+}
+
+void nrf_timer_event_clear(NRF_TIMER_Type * p_reg, nrf_timer_event_t event)
+{
+    nrf_host_sim_access();
+    p_reg->periph.events &= ~nrf_host_periph_event_mask(event);
+}
+
+bool nrf_timer_event_check(NRF_TIMER_Type * p_reg, nrf_timer_event_t event)
+{
+    nrf_host_sim_access();
+    return (p_reg->periph.events & nrf_host_periph_event_mask(event)) != 0;
+}
+
+uint32_t nrf_timer_event_address_get(NRF_TIMER_Type * p_reg, nrf_timer_event_t event)
+{
+    return p_reg->periph.base + (uint32_t)event;
+}
+
+void nrf_timer_shorts_enable(NRF_TIMER_Type * p_reg, uint32_t timer_shorts_mask)
+{
+    nrf_host_sim_access();
+    p_reg->shorts |= timer_shorts_mask;
+}
+
+void nrf_timer_shorts_disable(NRF_TIMER_Type * p_reg, uint32_t timer_shorts_mask)
+{
+    nrf_host_sim_access();
+    p_reg->shorts &= ~timer_shorts_mask;
+}
+
+void nrf_timer_int_enable(NRF_TIMER_Type * p_reg, uint32_t timer_int_mask)
+{
+    nrf_host_sim_access();
+    p_reg->periph.inten |= timer_int_mask;
+    nrf_host_sim_irq_dispatch();
+}
+
+void nrf_timer_int_disable(NRF_TIMER_Type * p_reg, uint32_t timer_int_mask)
+{
+    nrf_host_sim_access();
+    p_reg->periph.inten &= ~timer_int_mask;
+}
+
+void nrf_timer_mode_set(NRF_TIMER_Type * p_reg, nrf_timer_mode_t mode)
+{
+    nrf_host_sim_access();
+    counter_set(p_reg, counter_get(p_reg));
+    p_reg->mode = mode;
+    compare_schedule(p_reg);
+}
+
+void nrf_timer_bit_width_set(NRF_TIMER_Type * p_reg, nrf_timer_bit_width_t bit_width)
+{
+    nrf_host_sim_access();
+    counter_set(p_reg, counter_get(p_reg));
+    p_reg->bit_width = bit_width;
+    counter_set(p_reg, p_reg->count_ref);
+    compare_schedule(p_reg);
+}
+
+void nrf_timer_frequency_set(NRF_TIMER_Type * p_reg, nrf_timer_frequency_t frequency)
+{
+    nrf_host_sim_access();
+    counter_set(p_reg, counter_get(p_reg));
+    p_reg->prescaler = frequency;
+    compare_schedule(p_reg);
+}
+
+void nrf_timer_cc_write(NRF_TIMER_Type * p_reg, nrf_timer_cc_channel_t cc_channel, uint32_t cc_value)
+{
+    nrf_host_sim_access();
+    p_reg->cc[cc_channel] = cc_value;
+    compare_schedule(p_reg);
+}
+
+uint32_t nrf_timer_cc_read(NRF_TIMER_Type * p_reg, nrf_timer_cc_channel_t cc_channel)
+{
+    nrf_host_sim_access();
+    return p_reg->cc[cc_channel];
+}
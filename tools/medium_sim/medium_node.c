@@ -0,0 +1,257 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements a node of the medium simulator.
+ *
+ * The file is linked with a copy of the driver and of the peripheral model. It implements the
+ * driver callouts, counts their outcomes and replaces the random number generator of the platform,
+ * so that every node draws its own CSMA-CA backoffs and the backoffs can be counted.
+ *
+ */
+
+#include "medium_node.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "platform/random/nrf_802154_random.h"
+
+static medium_node_config_t m_config;         ///< Configuration of the node.
+static medium_node_stats_t  m_stats;          ///< Counters of the node.
+static bool                 m_tx_busy;        ///< Indicates if a transmission is in progress.
+static uint64_t             m_tx_request_time; ///< Time the current transmission was requested.
+static bool                 m_tx_accessed;    ///< Indicates if the current frame reached the air.
+static uint32_t             m_tx_backoffs;    ///< Backoffs drawn for the current frame.
+static uint32_t             m_rng;            ///< State of the pseudo-random number generator.
+
+/***************************************************************************************************
+ * @section Random number generator
+ **************************************************************************************************/
+
+void nrf_802154_random_init(void)
+{
+    m_rng = (m_config.seed != 0) ? m_config.seed : 1;
+}
+
+void nrf_802154_random_deinit(void)
+{
+    // Intentionally empty
+}
+
+uint32_t nrf_802154_random_get(void)
+{
+    uint32_t be = NRF_802154_CSMA_CA_MIN_BE + m_tx_backoffs;
+
+    // The CSMA-CA procedure is the only user of the random numbers. Its backoff exponent starts
+    // from the minimum and grows with every busy CCA.
+    if (be > NRF_802154_CSMA_CA_MAX_BE)
+    {
+        be = NRF_802154_CSMA_CA_MAX_BE;
+    }
+
+    m_rng ^= m_rng << 13;
+    m_rng ^= m_rng >> 17;
+    m_rng ^= m_rng << 5;
+
+    m_tx_backoffs++;
+    m_stats.backoffs++;
+    m_stats.backoff_periods += m_rng % (1UL << be);
+
+    return m_rng;
+}
+
+/***************************************************************************************************
+ * @section Driver callouts
+ **************************************************************************************************/
+
+static void tx_finish(bool channel_busy)
+{
+    // Every backoff but the last one ended with a busy CCA, unless the channel was never free.
+    uint32_t busy = (channel_busy || (m_tx_backoffs == 0)) ? m_tx_backoffs : m_tx_backoffs - 1;
+
+    if (busy > NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS)
+    {
+        busy = NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS;
+    }
+
+    m_stats.backoff_hist[busy]++;
+    m_tx_busy = false;
+}
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    (void)power;
+    (void)lqi;
+
+    m_stats.rx_frames++;
+    m_stats.rx_bytes += p_data[0];
+
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+{
+    if (error == NRF_802154_RX_ERROR_INVALID_FCS)
+    {
+        m_stats.rx_crc_errors++;
+    }
+    else if (error != NRF_802154_RX_ERROR_INVALID_DEST_ADDR)
+    {
+        m_stats.rx_other_errors++;
+    }
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame, uint8_t * p_ack, int8_t power, uint8_t lqi)
+{
+    (void)p_frame;
+    (void)power;
+    (void)lqi;
+
+    if (p_ack != NULL)
+    {
+        m_stats.tx_acked++;
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+
+    tx_finish(false);
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_NO_ACK:
+            m_stats.tx_no_ack++;
+            break;
+
+        case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+            m_stats.tx_busy_channel++;
+            break;
+
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+            m_stats.tx_invalid_ack++;
+            break;
+
+        default:
+            m_stats.tx_other_errors++;
+            break;
+    }
+
+    tx_finish(error == NRF_802154_TX_ERROR_BUSY_CHANNEL);
+}
+
+/***************************************************************************************************
+ * @section Node API
+ **************************************************************************************************/
+
+static void air_tx_handler(const nrf_host_radio_frame_t * p_frame, void * p_context)
+{
+    (void)p_context;
+
+    m_stats.tx_on_air++;
+
+    // The first frame on the air after the request is the data frame, the next ones are the ACKs.
+    if (m_tx_busy && !m_tx_accessed)
+    {
+        m_tx_accessed            = true;
+        m_stats.tx_accessed++;
+        m_stats.tx_access_delay += p_frame->start_time - m_tx_request_time;
+    }
+
+    m_config.tx_handler(m_config.id, p_frame);
+}
+
+static void node_init(const medium_node_config_t * p_config)
+{
+    uint8_t pan_id[PAN_ID_SIZE];
+    uint8_t short_address[SHORT_ADDRESS_SIZE];
+    uint8_t extended_address[EXTENDED_ADDRESS_SIZE] = {0};
+
+    pan_id[0]        = (uint8_t)p_config->pan_id;
+    pan_id[1]        = (uint8_t)(p_config->pan_id >> 8);
+    short_address[0] = (uint8_t)p_config->short_address;
+    short_address[1] = (uint8_t)(p_config->short_address >> 8);
+
+    m_config  = *p_config;
+    m_tx_busy = false;
+    memset(&m_stats, 0, sizeof(m_stats));
+    memcpy(extended_address, short_address, sizeof(short_address));
+
+    nrf_host_model_init(p_config->seed);
+    nrf_host_radio_tx_handler_set(air_tx_handler, NULL);
+
+    nrf_802154_init();
+    nrf_802154_channel_set(p_config->channel);
+    nrf_802154_tx_power_set(p_config->tx_power);
+    nrf_802154_pan_id_set(pan_id);
+    nrf_802154_short_address_set(short_address);
+    nrf_802154_extended_address_set(extended_address);
+    (void)nrf_802154_receive();
+}
+
+static bool node_tx_idle(void)
+{
+    return !m_tx_busy;
+}
+
+static void node_transmit(const uint8_t * p_data)
+{
+    m_tx_busy         = true;
+    m_tx_accessed     = false;
+    m_tx_backoffs     = 0;
+    m_tx_request_time = nrf_host_model_time_get();
+    m_stats.tx_requests++;
+
+    nrf_802154_transmit_csma_ca_raw(p_data);
+}
+
+static void node_stats_get(medium_node_stats_t * p_stats)
+{
+    *p_stats = m_stats;
+}
+
+const medium_node_api_t medium_node_api =
+{
+    .init                = node_init,
+    .next_event_time_get = nrf_host_model_next_event_time_get,
+    .run_until           = nrf_host_model_run_until,
+    .frame_inject        = nrf_host_radio_frame_inject,
+    .tx_idle             = node_tx_idle,
+    .transmit            = node_transmit,
+    .stats_get           = node_stats_get,
+};
@@ -0,0 +1,120 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Interface between the medium simulator and a simulated node.
+ *
+ */
+
+#ifndef MEDIUM_NODE_H__
+#define MEDIUM_NODE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_host_model.h"
+
+/**
+ * @brief Handler of the frames transmitted by a node.
+ *
+ * @param[in]  node_id  Identifier of the transmitting node.
+ * @param[in]  p_frame  Transmitted frame.
+ */
+typedef void (* medium_node_tx_handler_t)(uint32_t node_id, const nrf_host_radio_frame_t * p_frame);
+
+/**
+ * @brief Configuration of a node.
+ */
+typedef struct
+{
+    uint32_t                 id;            ///< Identifier of the node, passed to @p tx_handler.
+    uint32_t                 seed;          ///< Seed of the peripheral model and of the CSMA-CA backoffs.
+    uint8_t                  channel;       ///< Channel of the node.
+    int8_t                   tx_power;      ///< Transmit power, in dBm.
+    uint16_t                 pan_id;        ///< PAN ID of the node.
+    uint16_t                 short_address; ///< Short address of the node.
+    medium_node_tx_handler_t tx_handler;    ///< Handler of the frames transmitted by the node.
+} medium_node_config_t;
+
+/**
+ * @brief Counters of a node.
+ */
+typedef struct
+{
+    uint32_t tx_requests;      ///< Frames passed to the CSMA-CA procedure.
+    uint32_t tx_acked;         ///< Frames acknowledged by the destination.
+    uint32_t tx_no_ack;        ///< Frames transmitted without receiving the ACK.
+    uint32_t tx_busy_channel;  ///< Frames dropped after the CSMA-CA found the channel busy too many times.
+    uint32_t tx_invalid_ack;   ///< Frames answered by another frame than the expected ACK.
+    uint32_t tx_other_errors;  ///< Frames failed due to other errors.
+    uint32_t tx_on_air;        ///< Frames, including the ACKs, put on the air.
+    uint64_t tx_access_delay;  ///< Sum of the times from the request to the start of the frame on the air, in nanoseconds.
+    uint32_t tx_accessed;      ///< Frames included in @c tx_access_delay.
+    uint32_t backoffs;         ///< Random backoffs drawn by the CSMA-CA procedure, each followed by a CCA.
+    uint32_t backoff_hist[NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS + 1]; ///< Finished procedures by the number of busy CCAs.
+    uint64_t backoff_periods;  ///< Sum of the drawn backoff periods.
+    uint32_t rx_frames;        ///< Frames received and accepted by the driver.
+    uint64_t rx_bytes;         ///< Sum of the PSDU lengths of the received frames.
+    uint32_t rx_crc_errors;    ///< Frames received with an invalid FCS.
+    uint32_t rx_other_errors;  ///< Reception failed due to other errors.
+} medium_node_stats_t;
+
+/**
+ * @brief Functions of a node.
+ *
+ * Every node is a separate copy of the driver and of the peripheral model, with the symbols
+ * prefixed by the node index. The copies are reached through their instances of this structure.
+ */
+typedef struct
+{
+    /** @brief Initializes the model and the driver and starts the reception. */
+    void (* init)(const medium_node_config_t * p_config);
+
+    /** @brief Gets the time of the next event of the model, in nanoseconds. */
+    uint64_t (* next_event_time_get)(void);
+
+    /** @brief Runs the model until the given time, in nanoseconds. */
+    void (* run_until)(uint64_t time);
+
+    /** @brief Puts a frame on the air around the node. */
+    void (* frame_inject)(const nrf_host_radio_frame_t * p_frame);
+
+    /** @brief Checks if the node is ready to start the next transmission. */
+    bool (* tx_idle)(void);
+
+    /** @brief Starts the transmission of a frame with the CSMA-CA procedure. */
+    void (* transmit)(const uint8_t * p_data);
+
+    /** @brief Gets the counters of the node. */
+    void (* stats_get)(medium_node_stats_t * p_stats);
+} medium_node_api_t;
+
+#endif // MEDIUM_NODE_H__
@@ -0,0 +1,514 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements a host simulator of many driver instances sharing a radio medium.
+ *
+ * Every node is a separate copy of the unmodified driver on the host peripheral model. The nodes
+ * are placed at random in a square area and run in lockstep on the virtual clock: the simulator
+ * advances all nodes to the earliest event of any node or of the traffic generator. A frame put on
+ * the air by a node is injected into every other node with the power reduced by the log-distance
+ * path loss, delayed by the propagation time, and dropped at random with the per-link loss
+ * probability. The RADIO model of the receiver fails the CRC check of the frames corrupted by the
+ * overlapping ones, and reports the RSSI and the LQI of the received power.
+ *
+ * The nodes generate unicast data frames with a Poisson process and send them with the CSMA-CA
+ * procedure of the driver. The simulator reports the aggregate throughput, the ACK success rate
+ * and the CSMA-CA backoff statistics.
+ *
+ */
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "medium_node.h"
+#include "nrf_802154_const.h"
+
+#define CHANNEL            11         ///< Channel of the nodes.
+#define PAN_ID             0xCAFE     ///< PAN ID of the nodes.
+#define SHORT_ADDRESS_BASE 0x0001     ///< Short address of the first node.
+#define QUEUE_LEN          8          ///< Maximum number of frames waiting for transmission at a node.
+#define FRAME_OVERHEAD     11         ///< Size of the MAC header and the FCS of a data frame, in bytes.
+
+#define PATH_LOSS_1M       40.0       ///< Path loss at the reference distance of 1 meter, in dB.
+#define MIN_DISTANCE       1.0        ///< Minimum distance used in the path loss, in meters.
+#define HEARING_DBM        (-110)     ///< Power below which a frame is not injected at all, in dBm.
+#define ED_RSSI_OFFSET_DBM (-94)      ///< Power of the lowest LQI, in dBm.
+#define LQI_MAX            63         ///< Maximum raw LQI.
+#define LIGHT_SPEED        0.299792458 ///< Speed of light, in meters per nanosecond.
+
+/**
+ * @brief Parameters of the simulation.
+ */
+typedef struct
+{
+    uint32_t nodes;        ///< Number of the nodes.
+    double   area;         ///< Side of the square area of the nodes, in meters.
+    double   exponent;     ///< Path loss exponent.
+    int8_t   tx_power;     ///< Transmit power of the nodes, in dBm.
+    double   link_loss;    ///< Probability of losing a frame on a link.
+    double   frame_rate;   ///< Mean rate of the frames generated by a node, in frames per second.
+    uint8_t  psdu_length;  ///< Length of the PSDU of the generated frames, in bytes.
+    bool     star;         ///< Indicates if all nodes send to the first node.
+    bool     verbose;      ///< Indicates if the counters of every node are printed.
+    uint64_t duration;     ///< Simulated time, in nanoseconds.
+    uint64_t seed;         ///< Seed of the pseudo-random number generator.
+} sim_params_t;
+
+/**
+ * @brief State of a node kept by the simulator.
+ */
+typedef struct
+{
+    const medium_node_api_t * p_api;                 ///< Functions of the node.
+    double                    x;                     ///< Position of the node, in meters.
+    double                    y;                     ///< Position of the node, in meters.
+    uint64_t                  arrival_time;          ///< Time of the next generated frame.
+    uint32_t                  queued;                ///< Number of frames waiting for transmission.
+    uint32_t                  generated;             ///< Number of generated frames.
+    uint32_t                  dropped;               ///< Number of frames dropped due to the full queue.
+    uint8_t                   sequence;              ///< Sequence number of the next frame.
+    uint8_t                   frame[MAX_PACKET_SIZE + PHR_SIZE]; ///< Frame being transmitted.
+} sim_node_t;
+
+extern const medium_node_api_t * const medium_nodes[MEDIUM_NODES_NUM];
+
+static sim_params_t m_params;                                  ///< Parameters of the simulation.
+static sim_node_t   m_nodes[MEDIUM_NODES_NUM];                 ///< Nodes.
+static double       m_path_loss[MEDIUM_NODES_NUM][MEDIUM_NODES_NUM]; ///< Path loss of the links, in dB.
+static uint64_t     m_delay[MEDIUM_NODES_NUM][MEDIUM_NODES_NUM];     ///< Propagation delay of the links, in nanoseconds.
+static uint64_t     m_rng;                                     ///< State of the pseudo-random number generator.
+
+/***************************************************************************************************
+ * @section Pseudo-random number generator
+ **************************************************************************************************/
+
+static uint64_t rng_next(void)
+{
+    m_rng ^= m_rng << 13;
+    m_rng ^= m_rng >> 7;
+    m_rng ^= m_rng << 17;
+
+    return m_rng;
+}
+
+/** @brief Draw a number uniformly distributed in (0, 1]. */
+static double rng_uniform(void)
+{
+    return ((double)(rng_next() >> 11) + 1.0) / 9007199254740993.0;
+}
+
+/** @brief Draw an exponentially distributed duration with the given mean. */
+static uint64_t rng_exp(double mean)
+{
+    return (uint64_t)(-mean * log(rng_uniform())) + 1;
+}
+
+/***************************************************************************************************
+ * @section Medium
+ **************************************************************************************************/
+
+static void medium_init(void)
+{
+    for (uint32_t i = 0; i < m_params.nodes; i++)
+    {
+        m_nodes[i].x = m_params.area * rng_uniform();
+        m_nodes[i].y = m_params.area * rng_uniform();
+    }
+
+    if (m_params.star)
+    {
+        m_nodes[0].x = m_params.area / 2.0;
+        m_nodes[0].y = m_params.area / 2.0;
+    }
+
+    for (uint32_t i = 0; i < m_params.nodes; i++)
+    {
+        for (uint32_t j = 0; j < m_params.nodes; j++)
+        {
+            double distance = hypot(m_nodes[i].x - m_nodes[j].x, m_nodes[i].y - m_nodes[j].y);
+
+            m_delay[i][j]     = (uint64_t)(distance / LIGHT_SPEED);
+            distance          = (distance < MIN_DISTANCE) ? MIN_DISTANCE : distance;
+            m_path_loss[i][j] = PATH_LOSS_1M + 10.0 * m_params.exponent * log10(distance);
+        }
+    }
+}
+
+/** @brief Put the frame transmitted by a node on the air around all other nodes. */
+static void medium_tx_handler(uint32_t node_id, const nrf_host_radio_frame_t * p_frame)
+{
+    for (uint32_t i = 0; i < m_params.nodes; i++)
+    {
+        nrf_host_radio_frame_t frame = *p_frame;
+        double                 power = p_frame->power - m_path_loss[node_id][i];
+        int32_t                lqi   = (int32_t)power - ED_RSSI_OFFSET_DBM;
+
+        if ((i == node_id) || (power < HEARING_DBM))
+        {
+            continue;
+        }
+
+        frame.power       = (int8_t)floor(power);
+        frame.lqi         = (lqi < 0) ? 0 : ((lqi > LQI_MAX) ? LQI_MAX : (uint8_t)lqi);
+        frame.crc_ok      = (rng_uniform() > m_params.link_loss);
+        frame.start_time += m_delay[node_id][i];
+
+        m_nodes[i].p_api->frame_inject(&frame);
+    }
+}
+
+/***************************************************************************************************
+ * @section Traffic
+ **************************************************************************************************/
+
+static uint32_t destination_get(uint32_t node_id)
+{
+    uint32_t destination;
+
+    if (m_params.star)
+    {
+        return (node_id == 0) ? 1 + (uint32_t)(rng_next() % (m_params.nodes - 1)) : 0;
+    }
+
+    destination = (uint32_t)(rng_next() % (m_params.nodes - 1));
+
+    return (destination >= node_id) ? destination + 1 : destination;
+}
+
+static void frame_transmit(uint32_t node_id)
+{
+    sim_node_t * p_node      = &m_nodes[node_id];
+    uint16_t     source      = SHORT_ADDRESS_BASE + node_id;
+    uint16_t     destination = SHORT_ADDRESS_BASE + destination_get(node_id);
+    uint8_t    * p_frame     = p_node->frame;
+
+    p_frame[0]  = m_params.psdu_length;
+    p_frame[1]  = 0x61; // Data frame, ACK request, PAN ID compression.
+    p_frame[2]  = 0x88; // Short destination and source addresses.
+    p_frame[3]  = p_node->sequence++;
+    p_frame[4]  = (uint8_t)PAN_ID;
+    p_frame[5]  = (uint8_t)(PAN_ID >> 8);
+    p_frame[6]  = (uint8_t)destination;
+    p_frame[7]  = (uint8_t)(destination >> 8);
+    p_frame[8]  = (uint8_t)source;
+    p_frame[9]  = (uint8_t)(source >> 8);
+    memset(&p_frame[10], (uint8_t)node_id, m_params.psdu_length - FRAME_OVERHEAD + FCS_SIZE);
+
+    p_node->queued--;
+    p_node->p_api->transmit(p_frame);
+}
+
+static void traffic_process(uint64_t now)
+{
+    double mean = 1e9 / m_params.frame_rate;
+
+    for (uint32_t i = 0; i < m_params.nodes; i++)
+    {
+        sim_node_t * p_node = &m_nodes[i];
+
+        while (p_node->arrival_time <= now)
+        {
+            p_node->generated++;
+
+            if (p_node->queued < QUEUE_LEN)
+            {
+                p_node->queued++;
+            }
+            else
+            {
+                p_node->dropped++;
+            }
+
+            p_node->arrival_time += rng_exp(mean);
+        }
+
+        if ((p_node->queued > 0) && p_node->p_api->tx_idle())
+        {
+            frame_transmit(i);
+        }
+    }
+}
+
+/***************************************************************************************************
+ * @section Simulation
+ **************************************************************************************************/
+
+static void sim_run(void)
+{
+    double mean = 1e9 / m_params.frame_rate;
+
+    medium_init();
+
+    for (uint32_t i = 0; i < m_params.nodes; i++)
+    {
+        medium_node_config_t config =
+        {
+            .id            = i,
+            .seed          = (uint32_t)rng_next(),
+            .channel       = CHANNEL,
+            .tx_power      = m_params.tx_power,
+            .pan_id        = PAN_ID,
+            .short_address = SHORT_ADDRESS_BASE + i,
+            .tx_handler    = medium_tx_handler,
+        };
+
+        m_nodes[i].p_api        = medium_nodes[i];
+        m_nodes[i].arrival_time = rng_exp(mean);
+        m_nodes[i].p_api->init(&config);
+    }
+
+    while (true)
+    {
+        uint64_t next = UINT64_MAX;
+
+        for (uint32_t i = 0; i < m_params.nodes; i++)
+        {
+            uint64_t node_next = m_nodes[i].p_api->next_event_time_get();
+
+            next = (node_next < next) ? node_next : next;
+            next = (m_nodes[i].arrival_time < next) ? m_nodes[i].arrival_time : next;
+        }
+
+        if (next > m_params.duration)
+        {
+            break;
+        }
+
+        for (uint32_t i = 0; i < m_params.nodes; i++)
+        {
+            m_nodes[i].p_api->run_until(next);
+        }
+
+        traffic_process(next);
+    }
+}
+
+static void results_print(void)
+{
+    medium_node_stats_t total;
+    medium_node_stats_t stats;
+    uint32_t            generated = 0;
+    uint32_t            dropped   = 0;
+    uint32_t            data_on_air;
+    double              seconds   = m_params.duration / 1e9;
+
+    memset(&total, 0, sizeof(total));
+
+    if (m_params.verbose)
+    {
+        printf("%4s %7s %7s %7s %7s %7s %7s %7s %7s\n",
+               "node", "gen", "drop", "tx_req", "acked", "no_ack", "busy", "rx", "crc_err");
+    }
+
+    for (uint32_t i = 0; i < m_params.nodes; i++)
+    {
+        m_nodes[i].p_api->stats_get(&stats);
+
+        if (m_params.verbose)
+        {
+            printf("%4u %7u %7u %7u %7u %7u %7u %7u %7u\n",
+                   i,
+                   m_nodes[i].generated,
+                   m_nodes[i].dropped,
+                   stats.tx_requests,
+                   stats.tx_acked,
+                   stats.tx_no_ack,
+                   stats.tx_busy_channel,
+                   stats.rx_frames,
+                   stats.rx_crc_errors);
+        }
+
+        generated             += m_nodes[i].generated;
+        dropped               += m_nodes[i].dropped;
+        total.tx_requests     += stats.tx_requests;
+        total.tx_acked        += stats.tx_acked;
+        total.tx_no_ack       += stats.tx_no_ack;
+        total.tx_busy_channel += stats.tx_busy_channel;
+        total.tx_invalid_ack  += stats.tx_invalid_ack;
+        total.tx_other_errors += stats.tx_other_errors;
+        total.tx_access_delay += stats.tx_access_delay;
+        total.tx_accessed     += stats.tx_accessed;
+        total.backoffs        += stats.backoffs;
+        total.backoff_periods += stats.backoff_periods;
+        total.rx_frames       += stats.rx_frames;
+        total.rx_bytes        += stats.rx_bytes;
+        total.rx_crc_errors   += stats.rx_crc_errors;
+        total.rx_other_errors += stats.rx_other_errors;
+
+        for (uint32_t nb = 0; nb <= NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS; nb++)
+        {
+            total.backoff_hist[nb] += stats.backoff_hist[nb];
+        }
+    }
+
+    data_on_air = total.tx_acked + total.tx_no_ack + total.tx_invalid_ack;
+
+    printf("Nodes: %u, area: %.0f m, rate: %.1f fps/node, PSDU: %u B, duration: %.1f s\n",
+           m_params.nodes, m_params.area, m_params.frame_rate, m_params.psdu_length, seconds);
+    printf("Offered:      %u frames, %u dropped from the queues\n", generated, dropped);
+    printf("Throughput:   %u frames delivered, %.2f kbit/s (offered %.2f kbit/s)\n",
+           total.rx_frames,
+           total.rx_bytes * 8.0 / seconds / 1000.0,
+           generated * m_params.psdu_length * 8.0 / seconds / 1000.0);
+    printf("ACK success:  %.1f %% (%u acked, %u not acked, %u invalid ACK)\n",
+           data_on_air ? 100.0 * total.tx_acked / data_on_air : 0.0,
+           total.tx_acked,
+           total.tx_no_ack,
+           total.tx_invalid_ack);
+    printf("Access fail:  %u busy channel, %u other errors\n",
+           total.tx_busy_channel,
+           total.tx_other_errors);
+    printf("CSMA-CA:      %.2f backoffs/frame, %.1f us mean backoff, %.1f us mean access delay\n",
+           total.tx_requests ? (double)total.backoffs / total.tx_requests : 0.0,
+           total.backoffs ? (double)total.backoff_periods * UNIT_BACKOFF_PERIOD / total.backoffs :
+           0.0,
+           total.tx_accessed ? total.tx_access_delay / 1000.0 / total.tx_accessed : 0.0);
+    printf("Busy CCAs:   ");
+
+    for (uint32_t nb = 0; nb <= NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS; nb++)
+    {
+        printf(" %u:%u", nb, total.backoff_hist[nb]);
+    }
+
+    printf("\nReception:    %u CRC errors, %u other errors\n",
+           total.rx_crc_errors,
+           total.rx_other_errors);
+}
+
+static void usage_print(const char * p_name)
+{
+    printf("Usage: %s [options]\n"
+           "  -n <nodes>    number of nodes (2 - %u, default 16)\n"
+           "  -a <m>        side of the square area of the nodes (default 30)\n"
+           "  -e <exp>      path loss exponent (default 3.0)\n"
+           "  -P <dBm>      transmit power (default 0)\n"
+           "  -L <prob>     probability of losing a frame on a link (default 0)\n"
+           "  -r <fps>      mean frame rate of a node (default 10)\n"
+           "  -f <bytes>    PSDU length of the frames (%u - %u, default 50)\n"
+           "  -c            all nodes send to the first node placed in the center\n"
+           "  -v            print the counters of every node\n"
+           "  -t <s>        simulated duration (default 10)\n"
+           "  -s <seed>     random seed (default 1)\n",
+           p_name, MEDIUM_NODES_NUM, FRAME_OVERHEAD + 1, MAX_PACKET_SIZE);
+}
+
+int main(int argc, char ** argv)
+{
+    int opt;
+
+    m_params.nodes       = 16;
+    m_params.area        = 30.0;
+    m_params.exponent    = 3.0;
+    m_params.tx_power    = 0;
+    m_params.link_loss   = 0.0;
+    m_params.frame_rate  = 10.0;
+    m_params.psdu_length = 50;
+    m_params.star        = false;
+    m_params.verbose     = false;
+    m_params.duration    = 10ULL * 1000000000ULL;
+    m_params.seed        = 1;
+
+    while ((opt = getopt(argc, argv, "n:a:e:P:L:r:f:cvt:s:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                m_params.nodes = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'a':
+                m_params.area = atof(optarg);
+                break;
+
+            case 'e':
+                m_params.exponent = atof(optarg);
+                break;
+
+            case 'P':
+                m_params.tx_power = (int8_t)atoi(optarg);
+                break;
+
+            case 'L':
+                m_params.link_loss = atof(optarg);
+                break;
+
+            case 'r':
+                m_params.frame_rate = atof(optarg);
+                break;
+
+            case 'f':
+                m_params.psdu_length = (uint8_t)strtoul(optarg, NULL, 0);
+                break;
+
+            case 'c':
+                m_params.star = true;
+                break;
+
+            case 'v':
+                m_params.verbose = true;
+                break;
+
+            case 't':
+                m_params.duration = (uint64_t)(atof(optarg) * 1e9);
+                break;
+
+            case 's':
+                m_params.seed = strtoull(optarg, NULL, 0);
+                break;
+
+            default:
+                usage_print(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    if ((m_params.nodes < 2) || (m_params.nodes > MEDIUM_NODES_NUM) ||
+        (m_params.frame_rate <= 0.0) || (m_params.link_loss < 0.0) || (m_params.link_loss > 1.0) ||
+        (m_params.psdu_length <= FRAME_OVERHEAD) || (m_params.psdu_length > MAX_PACKET_SIZE))
+    {
+        usage_print(argv[0]);
+        return 1;
+    }
+
+    m_rng = m_params.seed ? m_params.seed : 1;
+
+    sim_run();
+    results_print();
+
+    return 0;
+}
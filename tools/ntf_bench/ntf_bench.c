@@ -0,0 +1,436 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements a host benchmark of the notification ring backend.
+ *
+ * A producer thread plays the role of the RADIO IRQ handler: it issues the received frame
+ * notifications in bursts, each frame occupying one of the receive buffers until the consumer frees
+ * it. A consumer thread plays the role of the stack thread: it waits for the wake-up requested by
+ * the ring and drains the ring in batches. The time from the notification being issued to its
+ * callback being called is measured with the monotonic clock of the host.
+ *
+ */
+
+#include <assert.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_notification_ring.h"
+
+#define BUFFERS_NUM NRF_802154_RX_BUFFERS ///< Number of the receive buffers in flight.
+#define BUFFER_SIZE 128                   ///< Size of the receive buffer.
+
+/**
+ * @brief Parameters of a single benchmark run.
+ */
+typedef struct
+{
+    uint32_t count;    ///< Number of the notifications to be issued.
+    uint32_t burst;    ///< Number of the notifications issued back-to-back.
+    uint32_t interval; ///< Time between the bursts, in microseconds.
+    uint32_t batch;    ///< Maximum number of the notifications drained at once, or 0 for no limit.
+} bench_params_t;
+
+/**
+ * @brief Results of a single benchmark run.
+ */
+typedef struct
+{
+    uint32_t received; ///< Number of the received notifications.
+    uint32_t wakes;    ///< Number of the consumer wake-ups requested by the ring.
+    uint32_t drains;   ///< Number of the drain calls which processed any notification.
+    uint64_t lat_sum;  ///< Sum of the notification latencies, in nanoseconds.
+    uint32_t lat_p50;  ///< Median notification latency, in nanoseconds.
+    uint32_t lat_p99;  ///< 99th percentile of the notification latency, in nanoseconds.
+    uint32_t lat_max;  ///< Maximum notification latency, in nanoseconds.
+} bench_results_t;
+
+static uint8_t          m_buffers[BUFFERS_NUM][BUFFER_SIZE]; ///< Receive buffers.
+static uint8_t        * mp_free[BUFFERS_NUM];                ///< Stack of the free receive buffers.
+static uint32_t         m_free_cnt;                          ///< Number of the free receive buffers.
+static pthread_mutex_t  m_free_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   m_free_cond  = PTHREAD_COND_INITIALIZER;
+
+static sem_t            m_wake_sem;                          ///< Semaphore posted by the wake hook.
+static volatile bool    m_done;                              ///< Indicates that the producer finished.
+
+static uint32_t       * mp_latencies;                        ///< Latencies of the received notifications.
+static bench_results_t  m_results;                           ///< Results of the current run.
+
+static uint64_t time_ns_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void time_wait(uint32_t us)
+{
+    struct timespec ts;
+
+    // Sleep rather than busy wait, so that the consumer is not starved on a single-core host.
+    // The scheduler latency delays only the next burst, as the timestamp is taken after waking up.
+    ts.tv_sec  = us / 1000000;
+    ts.tv_nsec = (long)(us % 1000000) * 1000;
+
+    nanosleep(&ts, NULL);
+}
+
+static uint8_t * buffer_alloc(void)
+{
+    uint8_t * p_buffer;
+
+    pthread_mutex_lock(&m_free_mutex);
+
+    while (m_free_cnt == 0)
+    {
+        pthread_cond_wait(&m_free_cond, &m_free_mutex);
+    }
+
+    p_buffer = mp_free[--m_free_cnt];
+
+    pthread_mutex_unlock(&m_free_mutex);
+
+    return p_buffer;
+}
+
+void nrf_802154_buffer_free_raw(uint8_t * p_data)
+{
+    pthread_mutex_lock(&m_free_mutex);
+
+    assert(m_free_cnt < BUFFERS_NUM);
+    mp_free[m_free_cnt++] = p_data;
+
+    pthread_cond_signal(&m_free_cond);
+    pthread_mutex_unlock(&m_free_mutex);
+}
+
+void nrf_802154_notification_ring_wake(void)
+{
+    m_results.wakes++;
+    sem_post(&m_wake_sem);
+}
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    uint64_t now = time_ns_get();
+    uint64_t timestamp;
+
+    (void)power;
+    (void)lqi;
+
+    memcpy(&timestamp, &p_data[1], sizeof(timestamp));
+
+    mp_latencies[m_results.received++] = (uint32_t)(now - timestamp);
+
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error)
+{
+    (void)error;
+    assert(false);
+}
+
+void nrf_802154_transmitted_raw(const uint8_t * p_frame, uint8_t * p_ack, int8_t power, uint8_t lqi)
+{
+    (void)p_frame;
+    (void)p_ack;
+    (void)power;
+    (void)lqi;
+    assert(false);
+}
+
+void nrf_802154_transmit_failed(const uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)p_frame;
+    (void)error;
+    assert(false);
+}
+
+void nrf_802154_energy_detected(uint8_t result)
+{
+    (void)result;
+    assert(false);
+}
+
+void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
+{
+    (void)error;
+    assert(false);
+}
+
+void nrf_802154_cca_done(bool channel_free)
+{
+    (void)channel_free;
+    assert(false);
+}
+
+void nrf_802154_cca_failed(nrf_802154_cca_error_t error)
+{
+    (void)error;
+    assert(false);
+}
+
+#if NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+void nrf_802154_rx_window_ended(const nrf_802154_rx_window_stats_t * p_stats)
+{
+    (void)p_stats;
+    assert(false);
+}
+
+#endif // NRF_802154_RX_DUTY_CYCLE_ENABLED
+
+static void * consumer_thread(void * p_arg)
+{
+    const bench_params_t * p_params = p_arg;
+
+    while (true)
+    {
+        sem_wait(&m_wake_sem);
+
+        // The ring requests a wake-up only when it becomes non-empty, so it must be drained
+        // completely before waiting again. Yielding between the batches lets other work of
+        // the stack thread run.
+        while (nrf_802154_notification_ring_is_pending())
+        {
+            if (nrf_802154_notification_ring_drain(p_params->batch) > 0)
+            {
+                m_results.drains++;
+            }
+
+            sched_yield();
+        }
+
+        if (m_done && !nrf_802154_notification_ring_is_pending())
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+static void * producer_thread(void * p_arg)
+{
+    const bench_params_t * p_params = p_arg;
+
+    for (uint32_t i = 0; i < p_params->count; i++)
+    {
+        uint8_t * p_buffer = buffer_alloc();
+        uint64_t  timestamp;
+
+        if ((i % p_params->burst) == 0)
+        {
+            time_wait(p_params->interval);
+        }
+
+        timestamp   = time_ns_get();
+        p_buffer[0] = sizeof(timestamp) + 2;
+        memcpy(&p_buffer[1], &timestamp, sizeof(timestamp));
+
+        nrf_802154_notify_received(p_buffer, -50, 255);
+    }
+
+    m_done = true;
+    sem_post(&m_wake_sem);
+
+    return NULL;
+}
+
+static int latency_compare(const void * p_a, const void * p_b)
+{
+    uint32_t a = *(const uint32_t *)p_a;
+    uint32_t b = *(const uint32_t *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+static void bench_run(const bench_params_t * p_params, bench_results_t * p_results)
+{
+    pthread_t consumer;
+    pthread_t producer;
+
+    memset(&m_results, 0, sizeof(m_results));
+    m_done       = false;
+    mp_latencies = calloc(p_params->count, sizeof(uint32_t));
+    assert(mp_latencies != NULL);
+
+    for (m_free_cnt = 0; m_free_cnt < BUFFERS_NUM; m_free_cnt++)
+    {
+        mp_free[m_free_cnt] = m_buffers[m_free_cnt];
+    }
+
+    sem_init(&m_wake_sem, 0, 0);
+    nrf_802154_notification_init();
+
+    pthread_create(&consumer, NULL, consumer_thread, (void *)p_params);
+    pthread_create(&producer, NULL, producer_thread, (void *)p_params);
+
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    sem_destroy(&m_wake_sem);
+
+    assert(m_results.received == p_params->count);
+
+    for (uint32_t i = 0; i < m_results.received; i++)
+    {
+        m_results.lat_sum += mp_latencies[i];
+    }
+
+    qsort(mp_latencies, m_results.received, sizeof(uint32_t), latency_compare);
+
+    if (m_results.received > 0)
+    {
+        m_results.lat_p50 = mp_latencies[m_results.received / 2];
+        m_results.lat_p99 = mp_latencies[(uint64_t)m_results.received * 99 / 100];
+        m_results.lat_max = mp_latencies[m_results.received - 1];
+    }
+
+    free(mp_latencies);
+
+    *p_results = m_results;
+}
+
+static void header_print(void)
+{
+    printf("%-6s %6s %8s %9s %9s %9s %9s %9s %9s\n",
+           "batch", "burst", "ntf", "wake/ntf", "ntf/drain", "lat_avg", "lat_p50", "lat_p99",
+           "lat_max");
+}
+
+static void results_print(const bench_params_t * p_params, const bench_results_t * p_results)
+{
+    printf("%-6u %6u %8u %9.3f %9.2f %9.1f %9.1f %9.1f %9.1f\n",
+           p_params->batch,
+           p_params->burst,
+           p_results->received,
+           p_results->received ? (double)p_results->wakes / p_results->received : 0.0,
+           p_results->drains ? (double)p_results->received / p_results->drains : 0.0,
+           p_results->received ? p_results->lat_sum / 1000.0 / p_results->received : 0.0,
+           p_results->lat_p50 / 1000.0,
+           p_results->lat_p99 / 1000.0,
+           p_results->lat_max / 1000.0);
+}
+
+static void usage_print(const char * p_name)
+{
+    printf("Usage: %s [options]\n"
+           "  -B <n>        notifications drained at once, 0 for no limit; sweeps if omitted\n"
+           "  -b <n>        notifications issued back-to-back (default 8)\n"
+           "  -i <us>       time between the bursts (default 200)\n"
+           "  -n <n>        number of notifications (default 100000)\n"
+           "Latencies are reported in microseconds.\n",
+           p_name);
+}
+
+int main(int argc, char ** argv)
+{
+    static const uint32_t sweep_batches[] = {1, 4, 16, 0};
+
+    bench_params_t  params;
+    bench_results_t results;
+    bool            sweep = true;
+    int             opt;
+
+    params.count    = 100000;
+    params.burst    = 8;
+    params.interval = 200;
+    params.batch    = 0;
+
+    while ((opt = getopt(argc, argv, "B:b:i:n:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'B':
+                params.batch = strtoul(optarg, NULL, 0);
+                sweep        = false;
+                break;
+
+            case 'b':
+                params.burst = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'i':
+                params.interval = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'n':
+                params.count = strtoul(optarg, NULL, 0);
+                break;
+
+            default:
+                usage_print(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    if ((params.burst == 0) || (params.count == 0))
+    {
+        usage_print(argv[0]);
+        return 1;
+    }
+
+    header_print();
+
+    if (!sweep)
+    {
+        bench_run(&params, &results);
+        results_print(&params, &results);
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(sweep_batches) / sizeof(sweep_batches[0]); i++)
+    {
+        params.batch = sweep_batches[i];
+
+        bench_run(&params, &results);
+        results_print(&params, &results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,560 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements a host benchmark of the 802.15.4 traffic under the BLE coexistence.
+ *
+ * The host RAAL replays a timeslot trace on a virtual clock, either a periodic BLE connection or
+ * a schedule recorded on a device and loaded from a file. A discrete-event model of the 802.15.4
+ * traffic requests the timeslots for the transmitted frames and checks if the received frames
+ * fit in the timeslots. The results are reproducible for the given seed.
+ *
+ */
+
+#include <assert.h>
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rsch/raal/nrf_raal_api.h"
+#include "rsch/raal/host/nrf_raal_host.h"
+
+#define TIME_NEVER        UINT64_MAX ///< Time of an event that is not scheduled.
+#define FRAME_QUEUE_LEN   16         ///< Maximum number of frames waiting for transmission.
+#define TRACE_EVENTS_MAX  4096       ///< Maximum number of events in a trace file.
+
+/**
+ * @brief Parameters of a single benchmark run.
+ */
+typedef struct
+{
+    double   tx_rate;      ///< Mean rate of the transmitted frames, in frames per second.
+    double   rx_rate;      ///< Mean rate of the frames sent to the device, in frames per second.
+    uint32_t frame_length; ///< Duration of the frame, including the ACK, in microseconds.
+    uint32_t max_wait;     ///< Time after which a queued frame is dropped, in microseconds.
+    uint64_t duration;     ///< Duration of the run, in microseconds.
+    uint64_t seed;         ///< Seed of the pseudo-random number generator.
+} bench_params_t;
+
+/**
+ * @brief Results of a single benchmark run.
+ */
+typedef struct
+{
+    uint32_t tx_offered;  ///< Number of frames queued for transmission.
+    uint32_t tx_ok;       ///< Number of frames transmitted.
+    uint32_t tx_dropped;  ///< Number of frames dropped after waiting too long for a timeslot.
+    uint32_t tx_cut;      ///< Number of transmissions cut by the end of a timeslot.
+    uint64_t tx_wait_sum; ///< Sum of the times from queuing to transmission, in microseconds.
+    uint32_t tx_wait_max; ///< Maximum time from queuing to transmission, in microseconds.
+    uint32_t rx_offered;  ///< Number of frames sent to the device.
+    uint32_t rx_ok;       ///< Number of frames received.
+} bench_results_t;
+
+static uint64_t               m_rng;                     ///< State of the pseudo-random number generator.
+static const bench_params_t * mp_params;                 ///< Parameters of the current run.
+static bench_results_t        m_results;                 ///< Results of the current run.
+
+static bool                   m_granted;                 ///< Indicates if a timeslot is granted.
+static uint64_t               m_frames[FRAME_QUEUE_LEN]; ///< Queuing times of the frames waiting for transmission.
+static uint32_t               m_frames_head;             ///< Index of the oldest queued frame.
+static uint32_t               m_frames_cnt;              ///< Number of the queued frames.
+static uint64_t               m_tx_arrival;              ///< Time of the next frame queued for transmission.
+static uint64_t               m_rx_arrival;              ///< Time of the next frame sent to the device.
+static bool                   m_tx_active;               ///< Indicates if a frame is being transmitted.
+static bool                   m_tx_cut;                  ///< Indicates if the timeslot ended during the transmission.
+static uint64_t               m_tx_end;                  ///< Time the transmission ends.
+static bool                   m_rx_active;               ///< Indicates if a frame is being received.
+static bool                   m_rx_cut;                  ///< Indicates if the timeslot ended during the reception.
+static uint64_t               m_rx_end;                  ///< Time the reception ends.
+
+static nrf_raal_host_event_t  m_trace_events[TRACE_EVENTS_MAX]; ///< Events of the trace.
+static nrf_raal_host_trace_t  m_trace;                          ///< Replayed trace.
+
+/***************************************************************************************************
+ * @section Pseudo-random number generator
+ **************************************************************************************************/
+
+static uint64_t rng_next(void)
+{
+    m_rng ^= m_rng << 13;
+    m_rng ^= m_rng >> 7;
+    m_rng ^= m_rng << 17;
+
+    return m_rng;
+}
+
+/** @brief Draw an exponentially distributed duration with the given mean. */
+static uint64_t rng_exp(double mean)
+{
+    double u = ((double)(rng_next() >> 11) + 1.0) / 9007199254740993.0;
+
+    return (uint64_t)(-mean * log(u)) + 1;
+}
+
+/** @brief Draw the time of the next arrival for the given rate. */
+static uint64_t arrival_next(double rate)
+{
+    if (rate <= 0.0)
+    {
+        return TIME_NEVER;
+    }
+
+    return nrf_raal_host_time_get() + rng_exp(1000000.0 / rate);
+}
+
+/***************************************************************************************************
+ * @section Traces
+ **************************************************************************************************/
+
+/** @brief Set up a trace of a single periodic BLE connection. */
+static void trace_periodic_set(uint32_t interval, uint32_t event_length)
+{
+    m_trace_events[0].start    = 0;
+    m_trace_events[0].duration = event_length;
+
+    m_trace.p_events   = m_trace_events;
+    m_trace.events_num = (event_length > 0) ? 1 : 0;
+    m_trace.period     = interval;
+}
+
+/** @brief Load a trace from a file.
+ *
+ * Each line of the file contains the start and the duration of an event, in microseconds.
+ * The line "period <us>" makes the trace repeat with the given period. Lines starting with '#'
+ * are ignored.
+ *
+ * @retval true   The trace was loaded.
+ * @retval false  The file could not be read or parsed.
+ */
+static bool trace_load(const char * p_path)
+{
+    FILE * p_file = fopen(p_path, "r");
+    char   line[128];
+
+    if (p_file == NULL)
+    {
+        return false;
+    }
+
+    m_trace.p_events   = m_trace_events;
+    m_trace.events_num = 0;
+    m_trace.period     = 0;
+
+    while (fgets(line, sizeof(line), p_file) != NULL)
+    {
+        unsigned long start;
+        unsigned long duration;
+
+        if ((line[0] == '#') || (line[0] == '\n'))
+        {
+            continue;
+        }
+
+        if (sscanf(line, "period %lu", &start) == 1)
+        {
+            m_trace.period = start;
+        }
+        else if ((sscanf(line, "%lu %lu", &start, &duration) == 2) &&
+                 (m_trace.events_num < TRACE_EVENTS_MAX))
+        {
+            m_trace_events[m_trace.events_num].start    = start;
+            m_trace_events[m_trace.events_num].duration = duration;
+            m_trace.events_num++;
+        }
+        else
+        {
+            fclose(p_file);
+            return false;
+        }
+    }
+
+    fclose(p_file);
+
+    return true;
+}
+
+/** @brief Get the fraction of time the trace blocks the radio driver. */
+static double trace_duty_get(void)
+{
+    uint64_t busy = 0;
+
+    if (m_trace.period == 0)
+    {
+        return 0.0;
+    }
+
+    for (uint32_t i = 0; i < m_trace.events_num; i++)
+    {
+        busy += m_trace.p_events[i].duration;
+    }
+
+    return (double)busy / m_trace.period;
+}
+
+/***************************************************************************************************
+ * @section 802.15.4 traffic model
+ **************************************************************************************************/
+
+void nrf_raal_timeslot_started(void)
+{
+    m_granted = true;
+}
+
+void nrf_raal_timeslot_ended(void)
+{
+    m_granted = false;
+    m_tx_cut  = m_tx_active;
+    m_rx_cut  = m_rx_active;
+}
+
+static void frame_dequeue(void)
+{
+    assert(m_frames_cnt > 0);
+
+    m_frames_head = (m_frames_head + 1) % FRAME_QUEUE_LEN;
+    m_frames_cnt--;
+}
+
+/** @brief Get the time the oldest queued frame is dropped. */
+static uint64_t drop_time_get(void)
+{
+    if ((m_frames_cnt == 0) || m_tx_active)
+    {
+        return TIME_NEVER;
+    }
+
+    return m_frames[m_frames_head] + mp_params->max_wait;
+}
+
+/** @brief Process all events due at the current time. */
+static void traffic_process(void)
+{
+    uint64_t now = nrf_raal_host_time_get();
+
+    if (m_tx_active && (m_tx_end <= now))
+    {
+        m_tx_active = false;
+
+        if (m_tx_cut)
+        {
+            m_results.tx_cut++;
+        }
+        else
+        {
+            m_results.tx_ok++;
+        }
+
+        frame_dequeue();
+    }
+
+    if (m_rx_active && (m_rx_end <= now))
+    {
+        m_rx_active = false;
+
+        if (!m_rx_cut)
+        {
+            m_results.rx_ok++;
+        }
+    }
+
+    if (m_rx_arrival <= now)
+    {
+        m_results.rx_offered++;
+        m_rx_arrival = arrival_next(mp_params->rx_rate);
+
+        // The radio receives only between transmissions and while a timeslot is granted.
+        if (m_granted && !m_tx_active && !m_rx_active)
+        {
+            m_rx_active = true;
+            m_rx_cut    = false;
+            m_rx_end    = now + mp_params->frame_length;
+        }
+    }
+
+    if (m_tx_arrival <= now)
+    {
+        m_results.tx_offered++;
+        m_tx_arrival = arrival_next(mp_params->tx_rate);
+
+        if (m_frames_cnt < FRAME_QUEUE_LEN)
+        {
+            m_frames[(m_frames_head + m_frames_cnt) % FRAME_QUEUE_LEN] = now;
+            m_frames_cnt++;
+        }
+        else
+        {
+            m_results.tx_dropped++;
+        }
+    }
+
+    while (drop_time_get() <= now)
+    {
+        m_results.tx_dropped++;
+        frame_dequeue();
+    }
+
+    if ((m_frames_cnt > 0) && m_granted && !m_tx_active && !m_rx_active &&
+        nrf_raal_timeslot_request(mp_params->frame_length))
+    {
+        uint32_t wait = (uint32_t)(now - m_frames[m_frames_head]);
+
+        m_results.tx_wait_sum += wait;
+
+        if (wait > m_results.tx_wait_max)
+        {
+            m_results.tx_wait_max = wait;
+        }
+
+        m_tx_active = true;
+        m_tx_cut    = false;
+        m_tx_end    = now + mp_params->frame_length;
+    }
+}
+
+/***************************************************************************************************
+ * @section Benchmark
+ **************************************************************************************************/
+
+static uint64_t min_time(uint64_t a, uint64_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/** @brief Run the simulation with the given parameters and the current trace. */
+static void bench_run(const bench_params_t * p_params, bench_results_t * p_results)
+{
+    uint64_t end;
+
+    mp_params = p_params;
+    memset(&m_results, 0, sizeof(m_results));
+
+    m_rng         = p_params->seed ? p_params->seed : 1;
+    m_granted     = false;
+    m_frames_head = 0;
+    m_frames_cnt  = 0;
+    m_tx_active   = false;
+    m_rx_active   = false;
+
+    nrf_raal_host_trace_set(&m_trace);
+    nrf_raal_init();
+    nrf_raal_continuous_mode_enter();
+
+    end          = nrf_raal_host_time_get() + p_params->duration;
+    m_tx_arrival = arrival_next(p_params->tx_rate);
+    m_rx_arrival = arrival_next(p_params->rx_rate);
+
+    while (nrf_raal_host_time_get() < end)
+    {
+        uint64_t next = nrf_raal_host_next_event_time_get();
+
+        next = min_time(next, m_tx_arrival);
+        next = min_time(next, m_rx_arrival);
+        next = min_time(next, drop_time_get());
+        next = min_time(next, m_tx_active ? m_tx_end : TIME_NEVER);
+        next = min_time(next, m_rx_active ? m_rx_end : TIME_NEVER);
+        next = min_time(next, end);
+
+        nrf_raal_host_time_advance(next);
+        traffic_process();
+    }
+
+    nrf_raal_continuous_mode_exit();
+    nrf_raal_uninit();
+
+    *p_results = m_results;
+}
+
+static void header_print(void)
+{
+    printf("%-10s %6s %6s %7s %7s %7s %5s %9s %9s %7s %7s %8s\n",
+           "trace", "ble[%]", "ts[%]", "tx_off", "tx_ok", "tx_drop", "cut",
+           "wait_avg", "wait_max", "rx_off", "rx_ok", "loss[%]");
+}
+
+static void results_print(const char              * p_name,
+                          const bench_params_t    * p_params,
+                          const bench_results_t   * p_results)
+{
+    nrf_raal_host_stats_t stats;
+    uint32_t              tx_lost;
+
+    nrf_raal_host_stats_get(&stats);
+
+    tx_lost = p_results->tx_dropped + p_results->tx_cut;
+
+    printf("%-10s %6.1f %6.1f %7u %7u %7u %5u %9.1f %9u %7u %7u %8.2f\n",
+           p_name,
+           100.0 * trace_duty_get(),
+           100.0 * stats.granted_time / p_params->duration,
+           p_results->tx_offered,
+           p_results->tx_ok,
+           p_results->tx_dropped,
+           p_results->tx_cut,
+           (p_results->tx_ok + p_results->tx_cut) ?
+           (double)p_results->tx_wait_sum / (p_results->tx_ok + p_results->tx_cut) : 0.0,
+           p_results->tx_wait_max,
+           p_results->rx_offered,
+           p_results->rx_ok,
+           (p_results->tx_offered + p_results->rx_offered) ?
+           100.0 * (tx_lost + p_results->rx_offered - p_results->rx_ok) /
+           (p_results->tx_offered + p_results->rx_offered) : 0.0);
+}
+
+static void usage_print(const char * p_name)
+{
+    printf("Usage: %s [options]\n"
+           "  -f <file>     replay the BLE schedule from a trace file\n"
+           "  -i <us>       BLE connection interval; sweeps the interval if neither -f nor -i is given\n"
+           "  -e <us>       BLE connection event length (default 2500)\n"
+           "  -r <fps>      transmitted frame rate (default 20)\n"
+           "  -R <fps>      received frame rate (default 20)\n"
+           "  -l <us>       frame duration including ACK (default 4800)\n"
+           "  -w <us>       maximum time a frame waits for a timeslot (default 50000)\n"
+           "  -t <s>        simulated duration (default 60)\n"
+           "  -s <seed>     random seed (default 1)\n",
+           p_name);
+}
+
+int main(int argc, char ** argv)
+{
+    static const uint32_t sweep_intervals[] = {7500, 15000, 30000, 50000, 100000};
+
+    bench_params_t  params;
+    bench_results_t results;
+    const char    * p_file       = NULL;
+    uint32_t        interval     = 0;
+    uint32_t        event_length = 2500;
+    int             opt;
+
+    params.tx_rate      = 20.0;
+    params.rx_rate      = 20.0;
+    params.frame_length = 4800;
+    params.max_wait     = 50000;
+    params.duration     = 60ULL * 1000000ULL;
+    params.seed         = 1;
+
+    while ((opt = getopt(argc, argv, "f:i:e:r:R:l:w:t:s:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'f':
+                p_file = optarg;
+                break;
+
+            case 'i':
+                interval = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'e':
+                event_length = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'r':
+                params.tx_rate = atof(optarg);
+                break;
+
+            case 'R':
+                params.rx_rate = atof(optarg);
+                break;
+
+            case 'l':
+                params.frame_length = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'w':
+                params.max_wait = strtoul(optarg, NULL, 0);
+                break;
+
+            case 't':
+                params.duration = (uint64_t)(atof(optarg) * 1000000.0);
+                break;
+
+            case 's':
+                params.seed = strtoull(optarg, NULL, 0);
+                break;
+
+            default:
+                usage_print(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    if ((interval != 0) && (event_length >= interval))
+    {
+        usage_print(argv[0]);
+        return 1;
+    }
+
+    header_print();
+
+    if (p_file != NULL)
+    {
+        if (!trace_load(p_file))
+        {
+            fprintf(stderr, "Cannot load trace %s\n", p_file);
+            return 1;
+        }
+
+        bench_run(&params, &results);
+        results_print("file", &params, &results);
+    }
+    else if (interval != 0)
+    {
+        char name[16];
+
+        trace_periodic_set(interval, event_length);
+        bench_run(&params, &results);
+
+        snprintf(name, sizeof(name), "%.1fms", interval / 1000.0);
+        results_print(name, &params, &results);
+    }
+    else
+    {
+        for (size_t i = 0; i < sizeof(sweep_intervals) / sizeof(sweep_intervals[0]); i++)
+        {
+            char name[16];
+
+            trace_periodic_set(sweep_intervals[i], event_length);
+            bench_run(&params, &results);
+
+            snprintf(name, sizeof(name), "%.1fms", sweep_intervals[i] / 1000.0);
+            results_print(name, &params, &results);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,1133 @@
+/* Copyright (c) 2019, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright notice, this
+ *      list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *   3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements a host microbenchmark of the software RX path of the driver.
+ *
+ * A corpus of frames is fed through the functions called by the driver core while a frame is being
+ * received: @ref nrf_802154_filter_frame_part at each BCMATCH step, the ACK data lookups and
+ * @ref nrf_802154_ack_generator_create. The corpus covers the 2003, 2006 and 2015 frame versions,
+ * every addressing mode, frames with the auxiliary security header and frames with Header IEs.
+ * Frames captured on the air can be added from a pcap file. The time spent in each stage is
+ * measured with the monotonic clock of the host and reported per frame class.
+ *
+ * The host is much faster than the target, so the absolute numbers are meaningful only relative to
+ * each other and to a baseline recorded on the same host. A baseline can be saved and compared
+ * against with a tolerance, and a budget can be set for the filtering and the ACK generation,
+ * so that a change of the RX path which slows it down beyond the turnaround budget is detected.
+ *
+ */
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+#include "nrf_host_model.h"
+#include "mac_features/nrf_802154_filter.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/ack_generator/nrf_802154_ack_data.h"
+#include "mac_features/ack_generator/nrf_802154_ack_generator.h"
+
+#define CLASSES_MAX      64                     ///< Maximum number of the frame classes.
+#define FRAMES_MAX       1024                   ///< Maximum number of the frames in the corpus.
+#define CLASS_NAME_SIZE  32                     ///< Size of the name of the frame class.
+#define PSDU_BUF_SIZE    (MAX_PACKET_SIZE + PHR_SIZE) ///< Size of the buffer of a single frame.
+#define BCC_INIT_BYTES   (PHR_SIZE + FCF_SIZE)  ///< Number of bytes checked at the first BCMATCH.
+
+#define PAN_ID           0xabcd                 ///< PAN ID of the benchmarked device.
+#define SHORT_ADDRESS    0x0001                 ///< Short address of the benchmarked device.
+#define PEER_SHORT       0x0002                 ///< Short address of the peer sending the frames.
+#define FOREIGN_SHORT    0x0bad                 ///< Short address of another device.
+#define BROADCAST_SHORT  0xffff                 ///< Broadcast short address.
+#define FOREIGN_PAN_ID   0x1234                 ///< PAN ID of another network.
+
+#define FCF_DST_MODE_POS 10                     ///< Position of the Destination Addressing Mode in the FCF.
+#define FCF_VERSION_POS  12                     ///< Position of the Frame Version in the FCF.
+#define FCF_SRC_MODE_POS 14                     ///< Position of the Source Addressing Mode in the FCF.
+#define FCF_SECURITY     (1 << 3)               ///< Security Enabled bit of the FCF.
+#define FCF_AR           (1 << 5)               ///< Acknowledgment Request bit of the FCF.
+#define FCF_PANID_COMPR  (1 << 6)               ///< PAN ID Compression bit of the FCF.
+#define FCF_IE_PRESENT   (1 << 9)               ///< IE Present bit of the FCF.
+
+#define ADDR_NONE        0                      ///< Addressing mode: address not present.
+#define ADDR_SHORT       2                      ///< Addressing mode: short address.
+#define ADDR_EXT         3                      ///< Addressing mode: extended address.
+
+#define SEC_CTRL         0x0d                   ///< Security level 5 (ENC-MIC-32), Key Identifier Mode 1.
+#define SEC_MIC_SIZE     4                      ///< Size of the MIC of @ref SEC_CTRL.
+#define CMD_DATA_REQUEST 0x04                   ///< Data Request MAC command identifier.
+
+#define LINKTYPE_IEEE802_15_4_WITHFCS 195       ///< pcap link type of frames with the FCS.
+#define LINKTYPE_IEEE802_15_4_NOFCS   230       ///< pcap link type of frames without the FCS.
+#define LINKTYPE_IEEE802_15_4_TAP     283       ///< pcap link type of frames with the TAP header.
+
+/**
+ * @brief Destination of a frame of the synthesized corpus.
+ */
+typedef enum
+{
+    DST_OWN,       ///< Frame addressed to the benchmarked device.
+    DST_BROADCAST, ///< Frame sent to the broadcast address.
+    DST_FOREIGN,   ///< Frame addressed to another device.
+} dst_kind_t;
+
+/**
+ * @brief Stages of the RX path.
+ */
+typedef enum
+{
+    STAGE_NONE,    ///< Empty stage used to measure the overhead of the benchmark loop.
+    STAGE_FILTER,  ///< Frame filtering at the consecutive BCMATCH events.
+    STAGE_LOOKUP,  ///< ACK data lookups for the source address of the frame.
+    STAGE_ACK,     ///< ACK generation, including the lookups done by the generator.
+
+    STAGE_NUM,     ///< Number of the stages.
+} stage_t;
+
+/**
+ * @brief Description of a class of the synthesized corpus.
+ */
+typedef struct
+{
+    const char * p_name;      ///< Name of the class.
+    uint8_t      version;     ///< Frame Version field.
+    uint8_t      type;        ///< Frame Type field.
+    uint8_t      dst_mode;    ///< Destination Addressing Mode field.
+    uint8_t      src_mode;    ///< Source Addressing Mode field.
+    bool         panid_compr; ///< PAN ID Compression field.
+    bool         ar;          ///< Acknowledgment Request field.
+    bool         secured;     ///< Indicates if the frame carries the auxiliary security header.
+    bool         ie;          ///< Indicates if the frame carries a Header IE.
+    dst_kind_t   dst;         ///< Destination of the frame.
+    uint8_t      weight;      ///< Share of the class in the mixed traffic, in frames.
+} frame_spec_t;
+
+/**
+ * @brief Frame of the corpus.
+ */
+typedef struct
+{
+    uint8_t  psdu[PSDU_BUF_SIZE]; ///< Frame, starting with the PHR.
+    uint8_t  class_idx;           ///< Index of the class of the frame.
+    uint8_t  steps;               ///< Number of the calls of the filter until the frame was filtered.
+    bool     accepted;            ///< Indicates if the frame passes the filter.
+    bool     ack;                 ///< Indicates if the ACK is generated for the frame.
+} frame_t;
+
+/**
+ * @brief Frame class and its results.
+ */
+typedef struct
+{
+    char     name[CLASS_NAME_SIZE]; ///< Name of the class.
+    uint32_t weight;                ///< Share of the class in the mixed traffic, in frames.
+    bool     expect_accept;         ///< Expected result of the filter, if @ref checked.
+    bool     checked;               ///< Indicates if the filter result is checked.
+    uint32_t frames;                ///< Number of the frames in the class.
+    double   ns[STAGE_NUM];         ///< Time of each stage, in nanoseconds per frame.
+} frame_class_t;
+
+/**
+ * @brief Parameters of the benchmark.
+ */
+typedef struct
+{
+    uint32_t     iterations; ///< Number of the frames processed in a single repetition.
+    uint32_t     repeats;    ///< Number of the repetitions; the fastest one is reported.
+    double       budget;     ///< Budget of filtering and ACK generation, in ns, or 0 if disabled.
+    double       tolerance;  ///< Accepted slowdown against the baseline, in percent.
+    const char * p_pcap;     ///< Path of the pcap file to be added to the corpus, or NULL.
+    const char * p_save;     ///< Path of the baseline to be written, or NULL.
+    const char * p_compare;  ///< Path of the baseline to be compared against, or NULL.
+} bench_params_t;
+
+static const frame_spec_t m_specs[] =
+{
+    // name                   version type                 dst         src         compr  ar     sec    ie     dst            weight
+    {"2003 data s/s",         0,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_SHORT, true,  true,  false, false, DST_OWN,       4 },
+    {"2006 data s/s",         1,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_SHORT, true,  true,  false, false, DST_OWN,       16},
+    {"2006 data s/e",         1,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_EXT,   true,  true,  false, false, DST_OWN,       4 },
+    {"2006 data e/e",         1,      FRAME_TYPE_DATA,    ADDR_EXT,   ADDR_EXT,   true,  true,  false, false, DST_OWN,       4 },
+    {"2006 data e/s nocompr", 1,      FRAME_TYPE_DATA,    ADDR_EXT,   ADDR_SHORT, false, true,  false, false, DST_OWN,       1 },
+    {"2006 data -/s",         1,      FRAME_TYPE_DATA,    ADDR_NONE,  ADDR_SHORT, false, true,  false, false, DST_OWN,       1 },
+    {"2006 data s/-",         1,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_NONE,  false, true,  false, false, DST_OWN,       1 },
+    {"2006 data bcast",       1,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_SHORT, true,  false, false, false, DST_BROADCAST, 8 },
+    {"2006 data foreign",     1,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_SHORT, true,  true,  false, false, DST_FOREIGN,   16},
+    {"2006 data s/s sec",     1,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_SHORT, true,  true,  true,  false, DST_OWN,       16},
+    {"2006 data e/e sec",     1,      FRAME_TYPE_DATA,    ADDR_EXT,   ADDR_EXT,   true,  true,  true,  false, DST_OWN,       4 },
+    {"2006 cmd datareq s/s",  1,      FRAME_TYPE_COMMAND, ADDR_SHORT, ADDR_SHORT, true,  true,  false, false, DST_OWN,       4 },
+    {"2006 cmd datareq s/e",  1,      FRAME_TYPE_COMMAND, ADDR_SHORT, ADDR_EXT,   true,  true,  false, false, DST_OWN,       2 },
+    {"2015 data s/s",         2,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_SHORT, true,  true,  false, false, DST_OWN,       2 },
+    {"2015 data s/e",         2,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_EXT,   false, true,  false, false, DST_OWN,       1 },
+    {"2015 data e/e",         2,      FRAME_TYPE_DATA,    ADDR_EXT,   ADDR_EXT,   true,  true,  false, false, DST_OWN,       1 },
+    {"2015 data e/e pan",     2,      FRAME_TYPE_DATA,    ADDR_EXT,   ADDR_EXT,   false, true,  false, false, DST_OWN,       1 },
+    {"2015 data e/e ie",      2,      FRAME_TYPE_DATA,    ADDR_EXT,   ADDR_EXT,   true,  true,  false, true,  DST_OWN,       2 },
+    {"2015 data s/e sec",     2,      FRAME_TYPE_DATA,    ADDR_SHORT, ADDR_EXT,   false, true,  true,  false, DST_OWN,       2 },
+    {"2015 data e/e sec ie",  2,      FRAME_TYPE_DATA,    ADDR_EXT,   ADDR_EXT,   true,  true,  true,  true,  DST_OWN,       4 },
+    {"2015 data -/e",         2,      FRAME_TYPE_DATA,    ADDR_NONE,  ADDR_EXT,   false, true,  false, false, DST_OWN,       1 },
+    {"2015 data foreign",     2,      FRAME_TYPE_DATA,    ADDR_EXT,   ADDR_EXT,   true,  true,  true,  true,  DST_FOREIGN,   2 },
+};
+
+static const uint8_t m_ext_address[EXTENDED_ADDRESS_SIZE] =
+{0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef};             ///< Extended address of the device.
+static const uint8_t m_peer_ext[EXTENDED_ADDRESS_SIZE] =
+{0x10, 0x32, 0x54, 0x76, 0x98, 0xba, 0xdc, 0xfe};             ///< Extended address of the peer.
+static const uint8_t m_foreign_ext[EXTENDED_ADDRESS_SIZE] =
+{0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee};             ///< Extended address of another device.
+static const uint8_t m_ack_ie[] = {0x03, 0x00, 0xf4, 0xce, 0x36}; ///< Vendor Specific Header IE set in the Enh-ACKs.
+
+static frame_t         m_frames[FRAMES_MAX];                  ///< Corpus of the frames.
+static uint32_t        m_frames_num;                          ///< Number of the frames in the corpus.
+static frame_class_t   m_classes[CLASSES_MAX];                ///< Frame classes.
+static uint32_t        m_classes_num;                         ///< Number of the frame classes.
+static uint32_t        m_order[FRAMES_MAX * 16];              ///< Order of the frames processed in a run.
+static volatile uintptr_t m_sink;                             ///< Sink of the results of the stages.
+
+static uint64_t time_ns_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/***************************************************************************************************
+ * @section Frame corpus
+ **************************************************************************************************/
+
+static uint8_t * u16_write(uint8_t * p_dst, uint16_t value)
+{
+    p_dst[0] = (uint8_t)value;
+    p_dst[1] = (uint8_t)(value >> 8);
+
+    return p_dst + 2;
+}
+
+static uint8_t * bytes_write(uint8_t * p_dst, const uint8_t * p_src, uint8_t len)
+{
+    memcpy(p_dst, p_src, len);
+
+    return p_dst + len;
+}
+
+static uint32_t class_find_or_add(const char * p_name, uint32_t weight)
+{
+    for (uint32_t i = 0; i < m_classes_num; i++)
+    {
+        if (strcmp(m_classes[i].name, p_name) == 0)
+        {
+            return i;
+        }
+    }
+
+    if (m_classes_num == CLASSES_MAX)
+    {
+        return CLASSES_MAX;
+    }
+
+    snprintf(m_classes[m_classes_num].name, CLASS_NAME_SIZE, "%s", p_name);
+    m_classes[m_classes_num].weight = weight;
+
+    return m_classes_num++;
+}
+
+/**
+ * @brief Checks which PAN ID fields are present according to the frame version and addressing.
+ */
+static void panids_present(const frame_spec_t * p_spec, bool * p_dst_panid, bool * p_src_panid)
+{
+    bool dst = (p_spec->dst_mode != ADDR_NONE);
+    bool src = (p_spec->src_mode != ADDR_NONE);
+
+    if (p_spec->version < 2)
+    {
+        *p_dst_panid = dst;
+        *p_src_panid = src && !(dst && p_spec->panid_compr);
+    }
+    else if (dst && src)
+    {
+        // IEEE 802.15.4-2015, Table 7-2.
+        bool both_ext = (p_spec->dst_mode == ADDR_EXT) && (p_spec->src_mode == ADDR_EXT);
+
+        *p_dst_panid = !(both_ext && p_spec->panid_compr);
+        *p_src_panid = !both_ext && !p_spec->panid_compr;
+    }
+    else
+    {
+        *p_dst_panid = (dst || !src) ? (dst != p_spec->panid_compr) : false;
+        *p_src_panid = !dst && src && !p_spec->panid_compr;
+    }
+}
+
+static void frame_build(const frame_spec_t * p_spec, uint8_t seq, uint8_t * p_psdu)
+{
+    static const uint8_t vendor_ie[] = {0xf4, 0xce, 0x36}; // Nordic OUI.
+
+    uint8_t * p = &p_psdu[PHR_SIZE];
+    uint16_t  fcf;
+    bool      dst_panid;
+    bool      src_panid;
+
+    panids_present(p_spec, &dst_panid, &src_panid);
+
+    fcf = p_spec->type |
+          (p_spec->secured ? FCF_SECURITY : 0) |
+          (p_spec->ar ? FCF_AR : 0) |
+          (p_spec->panid_compr ? FCF_PANID_COMPR : 0) |
+          (p_spec->ie ? FCF_IE_PRESENT : 0) |
+          (p_spec->dst_mode << FCF_DST_MODE_POS) |
+          (p_spec->version << FCF_VERSION_POS) |
+          (p_spec->src_mode << FCF_SRC_MODE_POS);
+
+    p    = u16_write(p, fcf);
+    *p++ = seq;
+
+    if (dst_panid)
+    {
+        p = u16_write(p, (p_spec->dst == DST_FOREIGN) ? FOREIGN_PAN_ID : PAN_ID);
+    }
+
+    if (p_spec->dst_mode == ADDR_SHORT)
+    {
+        p = u16_write(p, (p_spec->dst == DST_OWN) ? SHORT_ADDRESS :
+                         (p_spec->dst == DST_BROADCAST) ? BROADCAST_SHORT : FOREIGN_SHORT);
+    }
+    else if (p_spec->dst_mode == ADDR_EXT)
+    {
+        p = bytes_write(p, (p_spec->dst == DST_FOREIGN) ? m_foreign_ext : m_ext_address,
+                        EXTENDED_ADDRESS_SIZE);
+    }
+
+    if (src_panid)
+    {
+        p = u16_write(p, PAN_ID);
+    }
+
+    if (p_spec->src_mode == ADDR_SHORT)
+    {
+        p = u16_write(p, PEER_SHORT);
+    }
+    else if (p_spec->src_mode == ADDR_EXT)
+    {
+        p = bytes_write(p, m_peer_ext, EXTENDED_ADDRESS_SIZE);
+    }
+
+    if (p_spec->secured)
+    {
+        *p++ = SEC_CTRL;
+        *p++ = seq; // Frame Counter.
+        *p++ = 0;
+        *p++ = 0;
+        *p++ = 0;
+        *p++ = 1;   // Key Index.
+    }
+
+    if (p_spec->ie)
+    {
+        // Vendor Specific Header IE followed by the Header Termination 1 IE.
+        p = u16_write(p, sizeof(vendor_ie));
+        p = bytes_write(p, vendor_ie, sizeof(vendor_ie));
+        p = u16_write(p, 0x7e << 7);
+    }
+
+    if (p_spec->type == FRAME_TYPE_COMMAND)
+    {
+        *p++ = CMD_DATA_REQUEST;
+    }
+    else
+    {
+        // Payload of a typical 6LoWPAN data frame.
+        for (uint8_t i = 0; i < 40; i++)
+        {
+            *p++ = (uint8_t)(seq + i);
+        }
+    }
+
+    if (p_spec->secured)
+    {
+        memset(p, 0, SEC_MIC_SIZE);
+        p += SEC_MIC_SIZE;
+    }
+
+    memset(p, 0, FCS_SIZE);
+    p += FCS_SIZE;
+
+    p_psdu[0] = (uint8_t)(p - &p_psdu[PHR_SIZE]);
+}
+
+static void corpus_build(uint32_t variants)
+{
+    for (size_t i = 0; i < sizeof(m_specs) / sizeof(m_specs[0]); i++)
+    {
+        uint32_t class_idx = class_find_or_add(m_specs[i].p_name, m_specs[i].weight);
+
+        m_classes[class_idx].checked       = true;
+        m_classes[class_idx].expect_accept = (m_specs[i].dst != DST_FOREIGN);
+
+        for (uint32_t v = 0; (v < variants) && (m_frames_num < FRAMES_MAX); v++)
+        {
+            frame_build(&m_specs[i], (uint8_t)(i * variants + v), m_frames[m_frames_num].psdu);
+            m_frames[m_frames_num++].class_idx = class_idx;
+        }
+    }
+}
+
+static void class_name_describe(const uint8_t * p_psdu, char * p_name)
+{
+    static const char * const versions[] = {"2003", "2006", "2015", "v3"};
+    static const char         modes[]    = {'-', '?', 's', 'e'};
+
+    uint16_t fcf     = p_psdu[PHR_SIZE] | (p_psdu[PHR_SIZE + 1] << 8);
+    uint8_t  type    = fcf & FRAME_TYPE_MASK;
+    uint8_t  version = (fcf >> FCF_VERSION_POS) & 0x03;
+
+    snprintf(p_name,
+             CLASS_NAME_SIZE,
+             "pcap %s %s %c/%c%s%s",
+             versions[version],
+             (type == FRAME_TYPE_DATA) ? "data" :
+             (type == FRAME_TYPE_COMMAND) ? "cmd" :
+             (type == FRAME_TYPE_ACK) ? "ack" : "other",
+             modes[(fcf >> FCF_DST_MODE_POS) & 0x03],
+             modes[(fcf >> FCF_SRC_MODE_POS) & 0x03],
+             (fcf & FCF_SECURITY) ? " sec" : "",
+             (fcf & FCF_IE_PRESENT) ? " ie" : "");
+}
+
+/**
+ * @brief Addresses a captured unicast frame to the benchmarked device.
+ *
+ * The captured frames are addressed to the devices of another network, so they would all be
+ * rejected early by the filter. Only the destination fields are rewritten, so the layout of the
+ * frame, which determines the cost of parsing it, is preserved.
+ */
+static void frame_retarget(uint8_t * p_psdu)
+{
+    bool    ext;
+    uint8_t panid_offset = nrf_802154_frame_parser_dst_panid_offset_get(p_psdu);
+    uint8_t addr_offset  = nrf_802154_frame_parser_dst_addr_offset_get(p_psdu);
+
+    if (addr_offset == 0)
+    {
+        return;
+    }
+
+    ext = nrf_802154_frame_parser_dst_addr_is_extended(p_psdu);
+
+    if (!ext && (p_psdu[addr_offset] == 0xff) && (p_psdu[addr_offset + 1] == 0xff))
+    {
+        return;
+    }
+
+    if (panid_offset != 0)
+    {
+        u16_write(&p_psdu[panid_offset], PAN_ID);
+    }
+
+    if (ext)
+    {
+        memcpy(&p_psdu[addr_offset], m_ext_address, EXTENDED_ADDRESS_SIZE);
+    }
+    else
+    {
+        u16_write(&p_psdu[addr_offset], SHORT_ADDRESS);
+    }
+}
+
+static uint32_t u32_get(const uint8_t * p_data, bool swapped)
+{
+    return swapped ?
+           ((uint32_t)p_data[0] << 24) | ((uint32_t)p_data[1] << 16) | (p_data[2] << 8) | p_data[3] :
+           ((uint32_t)p_data[3] << 24) | ((uint32_t)p_data[2] << 16) | (p_data[1] << 8) | p_data[0];
+}
+
+static bool corpus_pcap_load(const char * p_path)
+{
+    FILE    * p_file = fopen(p_path, "rb");
+    uint8_t   header[24];
+    uint8_t   record[16];
+    uint8_t   data[256];
+    uint32_t  linktype;
+    uint32_t  loaded = 0;
+    bool      swapped;
+
+    if (p_file == NULL)
+    {
+        perror(p_path);
+        return false;
+    }
+
+    if (fread(header, sizeof(header), 1, p_file) != 1)
+    {
+        fprintf(stderr, "%s: too short to contain the pcap header\n", p_path);
+        fclose(p_file);
+        return false;
+    }
+
+    swapped = (u32_get(header, false) == 0xd4c3b2a1) || (u32_get(header, false) == 0x4d3cb2a1);
+
+    if (!swapped && (u32_get(header, false) != 0xa1b2c3d4) && (u32_get(header, false) != 0xa1b23c4d))
+    {
+        fprintf(stderr, "%s: not a pcap file\n", p_path);
+        fclose(p_file);
+        return false;
+    }
+
+    linktype = u32_get(&header[20], swapped);
+
+    if ((linktype != LINKTYPE_IEEE802_15_4_WITHFCS) &&
+        (linktype != LINKTYPE_IEEE802_15_4_NOFCS) &&
+        (linktype != LINKTYPE_IEEE802_15_4_TAP))
+    {
+        fprintf(stderr, "%s: unsupported link type %u\n", p_path, linktype);
+        fclose(p_file);
+        return false;
+    }
+
+    while ((m_frames_num < FRAMES_MAX) && (fread(record, sizeof(record), 1, p_file) == 1))
+    {
+        uint32_t  incl_len = u32_get(&record[8], swapped);
+        uint32_t  offset   = 0;
+        uint32_t  psdu_len;
+        frame_t * p_frame  = &m_frames[m_frames_num];
+        char      name[CLASS_NAME_SIZE];
+        uint32_t  class_idx;
+
+        if ((incl_len > sizeof(data)) || (fread(data, incl_len, 1, p_file) != 1))
+        {
+            break;
+        }
+
+        if (linktype == LINKTYPE_IEEE802_15_4_TAP)
+        {
+            // The TAP header length includes the TLVs.
+            offset = (incl_len >= 4) ? (uint32_t)(data[2] | (data[3] << 8)) : incl_len;
+        }
+
+        if (offset >= incl_len)
+        {
+            continue;
+        }
+
+        psdu_len = incl_len - offset + ((linktype == LINKTYPE_IEEE802_15_4_NOFCS) ? FCS_SIZE : 0);
+
+        if ((psdu_len < FCF_SIZE + FCS_SIZE) || (psdu_len > MAX_PACKET_SIZE))
+        {
+            continue;
+        }
+
+        memset(p_frame->psdu, 0, sizeof(p_frame->psdu));
+        memcpy(&p_frame->psdu[PHR_SIZE], &data[offset], incl_len - offset);
+        p_frame->psdu[0] = (uint8_t)psdu_len;
+
+        frame_retarget(p_frame->psdu);
+        class_name_describe(p_frame->psdu, name);
+
+        class_idx = class_find_or_add(name, 0);
+
+        if (class_idx == CLASSES_MAX)
+        {
+            continue;
+        }
+
+        p_frame->class_idx = (uint8_t)class_idx;
+        m_classes[class_idx].weight++;
+        m_frames_num++;
+        loaded++;
+    }
+
+    fclose(p_file);
+
+    printf("Loaded %u frame(s) from %s\n", loaded, p_path);
+
+    return true;
+}
+
+/***************************************************************************************************
+ * @section RX path stages
+ **************************************************************************************************/
+
+/**
+ * @brief Filters the frame the way the BCMATCH handler of the core does.
+ *
+ * The filter is called with the number of bytes received so far. As long as it accepts the part of
+ * the frame and requests more bytes, the core sets the next BCMATCH at the requested byte. The frame
+ * is filtered when the filter accepts it without requesting more bytes.
+ */
+static bool frame_filter(const uint8_t * p_psdu, uint8_t * p_steps)
+{
+    nrf_802154_rx_error_t result;
+    uint8_t               num_bytes = BCC_INIT_BYTES;
+    uint8_t               prev_num_bytes;
+    uint8_t               steps     = 0;
+
+    do
+    {
+        prev_num_bytes = num_bytes;
+        steps++;
+        result = nrf_802154_filter_frame_part(p_psdu, &num_bytes);
+    }
+    while ((result == NRF_802154_RX_ERROR_NONE) && (num_bytes != prev_num_bytes));
+
+    if (p_steps != NULL)
+    {
+        *p_steps = steps;
+    }
+
+    return result == NRF_802154_RX_ERROR_NONE;
+}
+
+static uintptr_t frame_lookup(const uint8_t * p_psdu)
+{
+    bool            ext;
+    uint8_t         ie_len     = 0;
+    const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_psdu, &ext);
+    uintptr_t       result     = nrf_802154_ack_data_pending_bit_should_be_set(p_psdu);
+
+    // The IE data is looked up only for the Enh-ACKs.
+    if ((p_psdu[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2)
+    {
+        result += (uintptr_t)nrf_802154_ack_data_ie_get(p_src_addr, ext, &ie_len) + ie_len;
+    }
+
+    return result;
+}
+
+static uintptr_t stage_run(stage_t stage, const frame_t * p_frame)
+{
+    switch (stage)
+    {
+        case STAGE_FILTER:
+            return frame_filter(p_frame->psdu, NULL);
+
+        case STAGE_LOOKUP:
+            return frame_lookup(p_frame->psdu);
+
+        case STAGE_ACK:
+            return p_frame->ack ? (uintptr_t)nrf_802154_ack_generator_create(p_frame->psdu) : 0;
+
+        default:
+            return (uintptr_t)p_frame->psdu[0];
+    }
+}
+
+/**
+ * @brief Measures a stage over the frames listed in @ref m_order.
+ *
+ * @returns  Time of the fastest repetition, in nanoseconds per frame.
+ */
+static double stage_time(stage_t stage, uint32_t order_num, const bench_params_t * p_params)
+{
+    double best = INFINITY;
+
+    for (uint32_t rep = 0; rep < p_params->repeats; rep++)
+    {
+        uintptr_t sink = 0;
+        uint32_t  idx  = 0;
+        uint64_t  start;
+        double    ns;
+
+        start = time_ns_get();
+
+        for (uint32_t i = 0; i < p_params->iterations; i++)
+        {
+            sink += stage_run(stage, &m_frames[m_order[idx]]);
+
+            if (++idx == order_num)
+            {
+                idx = 0;
+            }
+        }
+
+        ns     = (double)(time_ns_get() - start) / p_params->iterations;
+        m_sink = sink;
+
+        if (ns < best)
+        {
+            best = ns;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Measures all the stages over the frames listed in @ref m_order.
+ */
+static void stages_time(uint32_t order_num, const bench_params_t * p_params, double * p_ns)
+{
+    double overhead = stage_time(STAGE_NONE, order_num, p_params);
+
+    for (uint32_t stage = STAGE_FILTER; stage < STAGE_NUM; stage++)
+    {
+        p_ns[stage] = stage_time((stage_t)stage, order_num, p_params) - overhead;
+
+        if (p_ns[stage] < 0.0)
+        {
+            p_ns[stage] = 0.0;
+        }
+    }
+
+    p_ns[STAGE_NONE] = overhead;
+}
+
+/***************************************************************************************************
+ * @section Benchmark
+ **************************************************************************************************/
+
+static void device_configure(void)
+{
+    uint8_t pan_id[PAN_ID_SIZE];
+    uint8_t short_addr[SHORT_ADDRESS_SIZE];
+    uint8_t addr[EXTENDED_ADDRESS_SIZE];
+
+    nrf_host_model_init(1);
+    nrf_802154_init();
+
+    u16_write(pan_id, PAN_ID);
+    u16_write(short_addr, SHORT_ADDRESS);
+    nrf_802154_pan_id_set(pan_id);
+    nrf_802154_short_address_set(short_addr);
+    nrf_802154_extended_address_set(m_ext_address);
+    nrf_802154_pan_coord_set(true);
+    nrf_802154_auto_ack_set(true);
+    nrf_802154_auto_pending_bit_set(true);
+
+    // The ACK data lists are filled up, so that the lookups take the longest path. The peer is
+    // added last, so that its entry is not necessarily in the middle of the list.
+    for (uint32_t i = 1; i < NRF_802154_PENDING_SHORT_ADDRESSES; i++)
+    {
+        u16_write(short_addr, (uint16_t)(0x1000 + i * 0x0101));
+        (void)nrf_802154_pending_bit_for_addr_set(short_addr, false);
+        (void)nrf_802154_ack_data_set(short_addr, false, m_ack_ie, sizeof(m_ack_ie),
+                                      NRF_802154_ACK_DATA_IE);
+    }
+
+    for (uint32_t i = 1; i < NRF_802154_PENDING_EXTENDED_ADDRESSES; i++)
+    {
+        memcpy(addr, m_peer_ext, sizeof(addr));
+        addr[EXTENDED_ADDRESS_SIZE - 1] ^= (uint8_t)(i << 1);
+        addr[0]                         ^= (uint8_t)i;
+        (void)nrf_802154_pending_bit_for_addr_set(addr, true);
+        (void)nrf_802154_ack_data_set(addr, true, m_ack_ie, sizeof(m_ack_ie),
+                                      NRF_802154_ACK_DATA_IE);
+    }
+
+    u16_write(short_addr, PEER_SHORT);
+    (void)nrf_802154_pending_bit_for_addr_set(short_addr, false);
+    (void)nrf_802154_pending_bit_for_addr_set(m_peer_ext, true);
+    (void)nrf_802154_ack_data_set(short_addr, false, m_ack_ie, sizeof(m_ack_ie),
+                                  NRF_802154_ACK_DATA_IE);
+    (void)nrf_802154_ack_data_set(m_peer_ext, true, m_ack_ie, sizeof(m_ack_ie),
+                                  NRF_802154_ACK_DATA_IE);
+}
+
+/**
+ * @brief Runs the frames through the RX path once and checks the results of the filter and the
+ *        ACK generator.
+ *
+ * @returns  Number of the frames with unexpected results.
+ */
+static uint32_t corpus_check(void)
+{
+    uint32_t failures = 0;
+
+    for (uint32_t i = 0; i < m_frames_num; i++)
+    {
+        frame_t       * p_frame = &m_frames[i];
+        frame_class_t * p_class = &m_classes[p_frame->class_idx];
+
+        p_frame->accepted = frame_filter(p_frame->psdu, &p_frame->steps);
+        p_frame->ack      = p_frame->accepted &&
+                            nrf_802154_frame_parser_ar_bit_is_set(p_frame->psdu);
+        p_class->frames++;
+
+        if (p_class->checked && (p_frame->accepted != p_class->expect_accept))
+        {
+            printf("%s: frame %s unexpectedly\n", p_class->name,
+                   p_frame->accepted ? "accepted" : "rejected");
+            failures++;
+        }
+
+        if (p_frame->ack && (nrf_802154_ack_generator_create(p_frame->psdu) == NULL))
+        {
+            if (p_class->checked)
+            {
+                printf("%s: ACK not generated\n", p_class->name);
+                failures++;
+            }
+
+            p_frame->ack = false;
+        }
+    }
+
+    return failures;
+}
+
+static uint32_t order_class_fill(uint32_t class_idx)
+{
+    uint32_t num = 0;
+
+    for (uint32_t i = 0; i < m_frames_num; i++)
+    {
+        if (m_frames[i].class_idx == class_idx)
+        {
+            m_order[num++] = i;
+        }
+    }
+
+    return num;
+}
+
+/**
+ * @brief Interleaves the frames of all the classes according to their weights.
+ */
+static uint32_t order_mix_fill(void)
+{
+    uint32_t next[CLASSES_MAX] = {0};
+    uint32_t num               = 0;
+    bool     added             = true;
+
+    // Each round adds up to weight frames of every class, round-robin over the frames of the class.
+    for (uint32_t round = 0; added && (round < 16); round++)
+    {
+        added = false;
+
+        for (uint32_t class_idx = 0; class_idx < m_classes_num; class_idx++)
+        {
+            for (uint32_t w = 0; (w < m_classes[class_idx].weight) && (num < FRAMES_MAX * 16); w++)
+            {
+                for (uint32_t n = 0; n < m_frames_num; n++)
+                {
+                    uint32_t i = (next[class_idx] + n) % m_frames_num;
+
+                    if (m_frames[i].class_idx == class_idx)
+                    {
+                        m_order[num++]   = i;
+                        next[class_idx]  = i + 1;
+                        added            = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    return num;
+}
+
+static double rx_path_ns(const double * p_ns)
+{
+    return p_ns[STAGE_FILTER] + p_ns[STAGE_ACK];
+}
+
+static void header_print(void)
+{
+    printf("%-24s %6s %5s %5s %10s %10s %10s %10s\n",
+           "class", "frames", "steps", "acks", "filter[ns]", "lookup[ns]", "ack[ns]", "rx[ns]");
+}
+
+static void class_print(const char * p_name, uint32_t frames, double steps, double acks,
+                        const double * p_ns)
+{
+    printf("%-24s %6u %5.1f %5.2f %10.1f %10.1f %10.1f %10.1f\n",
+           p_name, frames, steps, acks,
+           p_ns[STAGE_FILTER], p_ns[STAGE_LOOKUP], p_ns[STAGE_ACK], rx_path_ns(p_ns));
+}
+
+static void class_stats_get(uint32_t order_num, double * p_steps, double * p_acks)
+{
+    uint32_t steps = 0;
+    uint32_t acks  = 0;
+
+    for (uint32_t i = 0; i < order_num; i++)
+    {
+        steps += m_frames[m_order[i]].steps;
+        acks  += m_frames[m_order[i]].ack;
+    }
+
+    *p_steps = (double)steps / order_num;
+    *p_acks  = (double)acks / order_num;
+}
+
+static bool baseline_save(const char * p_path, const frame_class_t * p_mix)
+{
+    FILE * p_file = fopen(p_path, "w");
+
+    if (p_file == NULL)
+    {
+        perror(p_path);
+        return false;
+    }
+
+    for (uint32_t i = 0; i <= m_classes_num; i++)
+    {
+        const frame_class_t * p_class = (i < m_classes_num) ? &m_classes[i] : p_mix;
+
+        fprintf(p_file, "%s;%.1f;%.1f;%.1f\n", p_class->name, p_class->ns[STAGE_FILTER],
+                p_class->ns[STAGE_LOOKUP], p_class->ns[STAGE_ACK]);
+    }
+
+    fclose(p_file);
+
+    return true;
+}
+
+/**
+ * @brief Compares the results with the baseline.
+ *
+ * @returns  Number of the stages slower than the baseline by more than the tolerance, or -1 if
+ *           the baseline cannot be read.
+ */
+static int baseline_compare(const char * p_path, double tolerance, const frame_class_t * p_mix)
+{
+    static const char * const stage_names[STAGE_NUM] = {"", "filter", "lookup", "ack"};
+
+    FILE * p_file = fopen(p_path, "r");
+    char   line[128];
+    int    regressions = 0;
+
+    if (p_file == NULL)
+    {
+        perror(p_path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), p_file) != NULL)
+    {
+        double                base[STAGE_NUM] = {0};
+        char                * p_sep           = strchr(line, ';');
+        const frame_class_t * p_class         = NULL;
+
+        if ((p_sep == NULL) ||
+            (sscanf(p_sep + 1, "%lf;%lf;%lf",
+                    &base[STAGE_FILTER], &base[STAGE_LOOKUP], &base[STAGE_ACK]) != 3))
+        {
+            continue;
+        }
+
+        *p_sep = '\0';
+
+        for (uint32_t i = 0; i <= m_classes_num; i++)
+        {
+            const frame_class_t * p_candidate = (i < m_classes_num) ? &m_classes[i] : p_mix;
+
+            if (strcmp(p_candidate->name, line) == 0)
+            {
+                p_class = p_candidate;
+                break;
+            }
+        }
+
+        if (p_class == NULL)
+        {
+            continue;
+        }
+
+        for (uint32_t stage = STAGE_FILTER; stage < STAGE_NUM; stage++)
+        {
+            // Stages shorter than a few nanoseconds are dominated by the measurement noise.
+            double limit = fmax(base[stage] * (1.0 + tolerance / 100.0), base[stage] + 2.0);
+
+            if (p_class->ns[stage] > limit)
+            {
+                printf("Regression: %s %s %.1f ns, baseline %.1f ns\n",
+                       p_class->name, stage_names[stage], p_class->ns[stage], base[stage]);
+                regressions++;
+            }
+        }
+    }
+
+    fclose(p_file);
+
+    return regressions;
+}
+
+static void usage_print(const char * p_name)
+{
+    printf("Usage: %s [options]\n"
+           "  -n <frames>   frames processed in a single repetition (default 200000)\n"
+           "  -r <repeats>  repetitions of each measurement, the fastest is reported (default 5)\n"
+           "  -v <variants> synthesized frames of each class (default 4)\n"
+           "  -p <file>     add the frames of a pcap file to the corpus\n"
+           "  -b <ns>       budget of filtering and ACK generation of any class (default none)\n"
+           "  -w <file>     write the results as a baseline\n"
+           "  -c <file>     compare the results with a baseline\n"
+           "  -T <percent>  accepted slowdown against the baseline (default 25)\n",
+           p_name);
+}
+
+int main(int argc, char ** argv)
+{
+    bench_params_t params;
+    frame_class_t  mix;
+    uint32_t       variants = 4;
+    uint32_t       failures;
+    uint32_t       order_num;
+    double         steps;
+    double         acks;
+    double         rx_max   = 0.0;
+    int            opt;
+
+    params.iterations = 200000;
+    params.repeats    = 5;
+    params.budget     = 0.0;
+    params.tolerance  = 25.0;
+    params.p_pcap     = NULL;
+    params.p_save     = NULL;
+    params.p_compare  = NULL;
+
+    while ((opt = getopt(argc, argv, "n:r:v:p:b:w:c:T:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                params.iterations = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'r':
+                params.repeats = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'v':
+                variants = strtoul(optarg, NULL, 0);
+                break;
+
+            case 'p':
+                params.p_pcap = optarg;
+                break;
+
+            case 'b':
+                params.budget = atof(optarg);
+                break;
+
+            case 'w':
+                params.p_save = optarg;
+                break;
+
+            case 'c':
+                params.p_compare = optarg;
+                break;
+
+            case 'T':
+                params.tolerance = atof(optarg);
+                break;
+
+            default:
+                usage_print(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    if ((params.iterations == 0) || (params.repeats == 0) || (variants == 0))
+    {
+        usage_print(argv[0]);
+        return 1;
+    }
+
+    device_configure();
+    corpus_build(variants);
+
+    if ((params.p_pcap != NULL) && !corpus_pcap_load(params.p_pcap))
+    {
+        return 1;
+    }
+
+    failures = corpus_check();
+
+    if (failures != 0)
+    {
+        printf("%u frame(s) with unexpected results.\n", failures);
+        return 1;
+    }
+
+    header_print();
+
+    for (uint32_t i = 0; i < m_classes_num; i++)
+    {
+        frame_class_t * p_class = &m_classes[i];
+
+        order_num = order_class_fill(i);
+        stages_time(order_num, &params, p_class->ns);
+        class_stats_get(order_num, &steps, &acks);
+        class_print(p_class->name, p_class->frames, steps, acks, p_class->ns);
+
+        if (rx_path_ns(p_class->ns) > rx_max)
+        {
+            rx_max = rx_path_ns(p_class->ns);
+        }
+    }
+
+    memset(&mix, 0, sizeof(mix));
+    snprintf(mix.name, CLASS_NAME_SIZE, "mix");
+
+    order_num = order_mix_fill();
+    stages_time(order_num, &params, mix.ns);
+    class_stats_get(order_num, &steps, &acks);
+    printf("\n");
+    class_print(mix.name, order_num, steps, acks, mix.ns);
+    printf("\nLoop overhead: %.1f ns/frame (subtracted)\n", mix.ns[STAGE_NONE]);
+
+    if ((params.p_save != NULL) && !baseline_save(params.p_save, &mix))
+    {
+        return 1;
+    }
+
+    if (params.p_compare != NULL)
+    {
+        int regressions = baseline_compare(params.p_compare, params.tolerance, &mix);
+
+        if (regressions < 0)
+        {
+            return 1;
+        }
+
+        failures += (uint32_t)regressions;
+    }
+
+    if ((params.budget > 0.0) && (rx_max > params.budget))
+    {
+        printf("Budget exceeded: %.1f ns, budget %.1f ns\n", rx_max, params.budget);
+        failures++;
+    }
+
+    return (failures == 0) ? 0 : 1;
+}